@@ -4,6 +4,9 @@
 
 #include <libff/algebra/curves/bls12_377/bls12_377_pp.hpp>
 #include <libff/algebra/curves/bw6_761/bw6_761_pp.hpp>
+#include <libff/algebra/curves/g2_precomp_cache.hpp>
+#include <libff/algebra/scalar_multiplication/multiexp.hpp>
+#include <libff/common/parallel.hpp>
 
 namespace libff
 {
@@ -13,46 +16,110 @@ namespace ffi
 
 // Generic functions to be used by the entry points
 
-template<typename ppT>
-bool g1_add(
-    const void *a_g1,
-    size_t a_g1_size,
-    const void *b_g1,
-    size_t b_g1_size,
-    void *out_g1,
-    size_t out_g1_size)
+template<typename GroupT>
+bool group_add(
+    const void *a,
+    size_t a_size,
+    const void *b,
+    size_t b_size,
+    void *out,
+    size_t out_size)
 {
-    libff::G1<ppT> a;
-    libff::G1<ppT> b;
-    if (group_element_read(a, a_g1, a_g1_size) &&
-        group_element_read(b, b_g1, b_g1_size)) {
-        const libff::G1<ppT> output = a + b;
-        return group_element_write(output, out_g1, out_g1_size);
+    GroupT a_el;
+    GroupT b_el;
+    if (group_element_read(a_el, a, a_size) &&
+        group_element_read(b_el, b, b_size)) {
+        const GroupT output = a_el + b_el;
+        return group_element_write(output, out, out_size);
     }
 
     return false;
 }
 
-template<typename ppT>
-bool g1_mul(
-    const void *p_g1,
-    size_t p_g1_size,
+template<typename GroupT, typename FieldT = typename GroupT::scalar_field>
+bool group_mul(
+    const void *p,
+    size_t p_size,
     const void *s_fr,
     size_t s_fr_size,
-    void *out_g1,
-    size_t out_g1_size)
+    void *out,
+    size_t out_size)
 {
-    libff::G1<ppT> p;
-    libff::Fr<ppT> s;
-    if (group_element_read(p, p_g1, p_g1_size) &&
+    GroupT p_el;
+    FieldT s;
+    if (group_element_read(p_el, p, p_size) &&
         field_element_read(s, s_fr, s_fr_size)) {
-        const libff::G1<ppT> output = s * p;
-        return group_element_write(output, out_g1, out_g1_size);
+        const GroupT output = s * p_el;
+        return group_element_write(output, out, out_size);
     }
 
     return false;
 }
 
+template<typename GroupT, typename FieldT = typename GroupT::scalar_field>
+bool group_msm(
+    size_t num_entries,
+    const void *points,
+    size_t points_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out,
+    size_t out_size)
+{
+    std::vector<GroupT> points_el;
+    std::vector<FieldT> scalars;
+    if (!group_elements_read(points_el, num_entries, points, points_size) ||
+        !field_elements_read(
+            scalars, num_entries, scalars_fr, scalars_fr_size)) {
+        return false;
+    }
+
+    if (num_entries == 0) {
+        return group_element_write(GroupT::zero(), out, out_size);
+    }
+
+    // Points read from FFI buffers are affine (and therefore in special
+    // form), so mixed addition can be used.
+    const GroupT output = multi_exp<
+        GroupT,
+        FieldT,
+        multi_exp_method_auto,
+        multi_exp_base_form_special>(
+        points_el.begin(),
+        points_el.end(),
+        scalars.begin(),
+        scalars.end(),
+        parallel_num_threads());
+    return group_element_write(output, out, out_size);
+}
+
+template<typename GroupT, typename FieldT = typename GroupT::scalar_field>
+bool group_batch_mul(
+    size_t num_entries,
+    const void *points,
+    size_t points_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out,
+    size_t out_size)
+{
+    std::vector<GroupT> points_el;
+    std::vector<FieldT> scalars;
+    if (!group_elements_read(points_el, num_entries, points, points_size) ||
+        !field_elements_read(
+            scalars, num_entries, scalars_fr, scalars_fr_size)) {
+        return false;
+    }
+
+    parallel_for(0, num_entries, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            points_el[i] = scalars[i] * points_el[i];
+        }
+    });
+
+    return group_elements_write(points_el, out, out_size);
+}
+
 template<typename ppT>
 bool pairing(
     const void *a_g1,
@@ -115,6 +182,103 @@ bool pairing(
     return false;
 }
 
+/// The precomputed value for the i-th G2 element of a multi-pairing, where
+/// the first qs.size() elements are precomputed (into storage) on each call,
+/// and the remaining elements were taken from the cache.
+template<typename ppT>
+static const libff::G2_precomp<ppT> &multi_pairing_precomp_G2(
+    const size_t i,
+    const std::vector<libff::G2<ppT>> &qs,
+    const std::vector<std::shared_ptr<const libff::G2_precomp<ppT>>>
+        &fixed_prec_qs,
+    libff::G2_precomp<ppT> &storage)
+{
+    if (i < qs.size()) {
+        storage = ppT::precompute_G2(qs[i]);
+        return storage;
+    }
+    return *fixed_prec_qs[i - qs.size()];
+}
+
+template<typename ppT>
+bool multi_pairing_check(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size,
+    size_t num_fixed_pairs,
+    const void *fixed_g1s,
+    size_t fixed_g1s_size,
+    const void *fixed_g2s,
+    size_t fixed_g2s_size)
+{
+    std::vector<libff::G1<ppT>> ps;
+    std::vector<libff::G2<ppT>> qs;
+    std::vector<libff::G1<ppT>> fixed_ps;
+    std::vector<libff::G2<ppT>> fixed_qs;
+    if (!group_elements_read(ps, num_pairs, g1s, g1s_size) ||
+        !group_elements_read(qs, num_pairs, g2s, g2s_size) ||
+        !group_elements_read(
+            fixed_ps, num_fixed_pairs, fixed_g1s, fixed_g1s_size) ||
+        !group_elements_read(
+            fixed_qs, num_fixed_pairs, fixed_g2s, fixed_g2s_size)) {
+        return false;
+    }
+
+    // Only the fixed G2 elements (e.g. from a verification key) go through
+    // the global cache, so that per-call inputs do not evict them. They are
+    // looked up before the parallel loop, to avoid contention on the cache.
+    std::vector<std::shared_ptr<const libff::G2_precomp<ppT>>> fixed_prec_qs;
+    fixed_prec_qs.reserve(num_fixed_pairs);
+    for (const libff::G2<ppT> &Q : fixed_qs) {
+        fixed_prec_qs.push_back(libff::cached_precompute_G2<ppT>(Q));
+    }
+    ps.insert(ps.end(), fixed_ps.begin(), fixed_ps.end());
+
+    // Each task computes the product of the Miller loops for a contiguous
+    // range of pairs (two at a time, using the double Miller loop). The
+    // final exponentiation is applied once, to the product over all ranges.
+    const libff::Fqk<ppT> f = parallel_reduce(
+        0,
+        ps.size(),
+        2,
+        libff::Fqk<ppT>::one(),
+        [&ps, &qs, &fixed_prec_qs](size_t begin, size_t end) {
+            libff::Fqk<ppT> f = libff::Fqk<ppT>::one();
+            libff::G2_precomp<ppT> storage;
+            libff::G2_precomp<ppT> storage_next;
+            size_t i = begin;
+            for (; i + 1 < end; i += 2) {
+                f = f * ppT::double_miller_loop(
+                            ppT::precompute_G1(ps[i]),
+                            multi_pairing_precomp_G2<ppT>(
+                                i, qs, fixed_prec_qs, storage),
+                            ppT::precompute_G1(ps[i + 1]),
+                            multi_pairing_precomp_G2<ppT>(
+                                i + 1, qs, fixed_prec_qs, storage_next));
+            }
+            if (i < end) {
+                f = f * ppT::miller_loop(
+                            ppT::precompute_G1(ps[i]),
+                            multi_pairing_precomp_G2<ppT>(
+                                i, qs, fixed_prec_qs, storage));
+            }
+            return f;
+        },
+        [](const libff::Fqk<ppT> &a, const libff::Fqk<ppT> &b) {
+            return a * b;
+        });
+
+    return libff::GT<ppT>::one() == ppT::final_exponentiation(f);
+}
+
+template<typename ppT> bool set_g2_precomp_cache_capacity(size_t capacity)
+{
+    libff::g2_precomp_cache<ppT>::global().set_capacity(capacity);
+    return true;
+}
+
 } // namespace ffi
 
 } // namespace libff
@@ -127,6 +291,12 @@ extern "C" bool bls12_377_init()
     return true;
 }
 
+extern "C" bool bls12_377_set_g2_precomp_cache_capacity(size_t capacity)
+{
+    return libff::ffi::set_g2_precomp_cache_capacity<libff::bls12_377_pp>(
+        capacity);
+}
+
 extern "C" bool bls12_377_g1_add(
     const void *a_g1,
     size_t a_g1_size,
@@ -135,7 +305,7 @@ extern "C" bool bls12_377_g1_add(
     void *out_g1,
     size_t out_g1_size)
 {
-    return libff::ffi::g1_add<libff::bls12_377_pp>(
+    return libff::ffi::group_add<libff::G1<libff::bls12_377_pp>>(
         a_g1, a_g1_size, b_g1, b_g1_size, out_g1, out_g1_size);
 }
 
@@ -148,10 +318,110 @@ extern "C" bool bls12_377_g1_mul(
     size_t out_g1_size)
 
 {
-    return libff::ffi::g1_mul<libff::bls12_377_pp>(
+    return libff::ffi::group_mul<libff::G1<libff::bls12_377_pp>>(
         p_g1, p_g1_size, s_fr, s_fr_size, out_g1, out_g1_size);
 }
 
+extern "C" bool bls12_377_g1_msm(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1,
+    size_t out_g1_size)
+{
+    return libff::ffi::group_msm<libff::G1<libff::bls12_377_pp>>(
+        num_entries,
+        points_g1,
+        points_g1_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g1,
+        out_g1_size);
+}
+
+extern "C" bool bls12_377_g1_batch_mul(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1s,
+    size_t out_g1s_size)
+{
+    return libff::ffi::group_batch_mul<libff::G1<libff::bls12_377_pp>>(
+        num_entries,
+        points_g1,
+        points_g1_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g1s,
+        out_g1s_size);
+}
+
+extern "C" bool bls12_377_g2_add(
+    const void *a_g2,
+    size_t a_g2_size,
+    const void *b_g2,
+    size_t b_g2_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_add<libff::G2<libff::bls12_377_pp>>(
+        a_g2, a_g2_size, b_g2, b_g2_size, out_g2, out_g2_size);
+}
+
+extern "C" bool bls12_377_g2_mul(
+    const void *p_g2,
+    size_t p_g2_size,
+    const void *s_fr,
+    size_t s_fr_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_mul<libff::G2<libff::bls12_377_pp>>(
+        p_g2, p_g2_size, s_fr, s_fr_size, out_g2, out_g2_size);
+}
+
+extern "C" bool bls12_377_g2_msm(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_msm<libff::G2<libff::bls12_377_pp>>(
+        num_entries,
+        points_g2,
+        points_g2_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g2,
+        out_g2_size);
+}
+
+extern "C" bool bls12_377_g2_batch_mul(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2s,
+    size_t out_g2s_size)
+{
+    return libff::ffi::group_batch_mul<libff::G2<libff::bls12_377_pp>>(
+        num_entries,
+        points_g2,
+        points_g2_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g2s,
+        out_g2s_size);
+}
+
 extern "C" bool bls12_377_pairing(
     const void *a_g1,
     size_t a_g1_size,
@@ -189,6 +459,42 @@ extern "C" bool bls12_377_pairing(
         h_g2_size);
 }
 
+extern "C" bool bls12_377_multi_pairing_check(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size)
+{
+    return libff::ffi::multi_pairing_check<libff::bls12_377_pp>(
+        num_pairs, g1s, g1s_size, g2s, g2s_size, 0, nullptr, 0, nullptr, 0);
+}
+
+extern "C" bool bls12_377_multi_pairing_check_fixed_g2(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size,
+    size_t num_fixed_pairs,
+    const void *fixed_g1s,
+    size_t fixed_g1s_size,
+    const void *fixed_g2s,
+    size_t fixed_g2s_size)
+{
+    return libff::ffi::multi_pairing_check<libff::bls12_377_pp>(
+        num_pairs,
+        g1s,
+        g1s_size,
+        g2s,
+        g2s_size,
+        num_fixed_pairs,
+        fixed_g1s,
+        fixed_g1s_size,
+        fixed_g2s,
+        fixed_g2s_size);
+}
+
 // BW6-761 entry points
 
 extern "C" bool bw6_761_init()
@@ -197,6 +503,12 @@ extern "C" bool bw6_761_init()
     return true;
 }
 
+extern "C" bool bw6_761_set_g2_precomp_cache_capacity(size_t capacity)
+{
+    return libff::ffi::set_g2_precomp_cache_capacity<libff::bw6_761_pp>(
+        capacity);
+}
+
 extern "C" bool bw6_761_g1_add(
     const void *a_g1,
     size_t a_g1_size,
@@ -205,7 +517,7 @@ extern "C" bool bw6_761_g1_add(
     void *out_g1,
     size_t out_g1_size)
 {
-    return libff::ffi::g1_add<libff::bw6_761_pp>(
+    return libff::ffi::group_add<libff::G1<libff::bw6_761_pp>>(
         a_g1, a_g1_size, b_g1, b_g1_size, out_g1, out_g1_size);
 }
 
@@ -218,10 +530,110 @@ extern "C" bool bw6_761_g1_mul(
     size_t out_g1_size)
 
 {
-    return libff::ffi::g1_mul<libff::bw6_761_pp>(
+    return libff::ffi::group_mul<libff::G1<libff::bw6_761_pp>>(
         p_g1, p_g1_size, s_fr, s_fr_size, out_g1, out_g1_size);
 }
 
+extern "C" bool bw6_761_g1_msm(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1,
+    size_t out_g1_size)
+{
+    return libff::ffi::group_msm<libff::G1<libff::bw6_761_pp>>(
+        num_entries,
+        points_g1,
+        points_g1_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g1,
+        out_g1_size);
+}
+
+extern "C" bool bw6_761_g1_batch_mul(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1s,
+    size_t out_g1s_size)
+{
+    return libff::ffi::group_batch_mul<libff::G1<libff::bw6_761_pp>>(
+        num_entries,
+        points_g1,
+        points_g1_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g1s,
+        out_g1s_size);
+}
+
+extern "C" bool bw6_761_g2_add(
+    const void *a_g2,
+    size_t a_g2_size,
+    const void *b_g2,
+    size_t b_g2_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_add<libff::G2<libff::bw6_761_pp>>(
+        a_g2, a_g2_size, b_g2, b_g2_size, out_g2, out_g2_size);
+}
+
+extern "C" bool bw6_761_g2_mul(
+    const void *p_g2,
+    size_t p_g2_size,
+    const void *s_fr,
+    size_t s_fr_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_mul<libff::G2<libff::bw6_761_pp>>(
+        p_g2, p_g2_size, s_fr, s_fr_size, out_g2, out_g2_size);
+}
+
+extern "C" bool bw6_761_g2_msm(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2,
+    size_t out_g2_size)
+{
+    return libff::ffi::group_msm<libff::G2<libff::bw6_761_pp>>(
+        num_entries,
+        points_g2,
+        points_g2_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g2,
+        out_g2_size);
+}
+
+extern "C" bool bw6_761_g2_batch_mul(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2s,
+    size_t out_g2s_size)
+{
+    return libff::ffi::group_batch_mul<libff::G2<libff::bw6_761_pp>>(
+        num_entries,
+        points_g2,
+        points_g2_size,
+        scalars_fr,
+        scalars_fr_size,
+        out_g2s,
+        out_g2s_size);
+}
+
 extern "C" bool bw6_761_pairing(
     const void *a_g1,
     size_t a_g1_size,
@@ -258,3 +670,39 @@ extern "C" bool bw6_761_pairing(
         h_g2,
         h_g2_size);
 }
+
+extern "C" bool bw6_761_multi_pairing_check(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size)
+{
+    return libff::ffi::multi_pairing_check<libff::bw6_761_pp>(
+        num_pairs, g1s, g1s_size, g2s, g2s_size, 0, nullptr, 0, nullptr, 0);
+}
+
+extern "C" bool bw6_761_multi_pairing_check_fixed_g2(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size,
+    size_t num_fixed_pairs,
+    const void *fixed_g1s,
+    size_t fixed_g1s_size,
+    const void *fixed_g2s,
+    size_t fixed_g2s_size)
+{
+    return libff::ffi::multi_pairing_check<libff::bw6_761_pp>(
+        num_pairs,
+        g1s,
+        g1s_size,
+        g2s,
+        g2s_size,
+        num_fixed_pairs,
+        fixed_g1s,
+        fixed_g1s_size,
+        fixed_g2s,
+        fixed_g2s_size);
+}
@@ -18,6 +18,10 @@ extern "C"
 
 bool bls12_377_init();
 
+// Set the maximum number of precomputed G2 elements held in the cache used by
+// bls12_377_multi_pairing_check_fixed_g2 (0 disables caching).
+bool bls12_377_set_g2_precomp_cache_capacity(size_t capacity);
+
 bool bls12_377_g1_add(
     const void *a_g1,
     size_t a_g1_size,
@@ -34,6 +38,62 @@ bool bls12_377_g1_mul(
     void *out_g1,
     size_t out_g1_size);
 
+// Multi-scalar multiplication: out_g1 = sum_i scalars_fr[i] * points_g1[i].
+// points_g1 and scalars_fr are contiguous arrays of num_entries elements.
+bool bls12_377_g1_msm(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1,
+    size_t out_g1_size);
+
+// Batch scalar multiplication: out_g1s[i] = scalars_fr[i] * points_g1[i]. All
+// buffers are contiguous arrays of num_entries elements.
+bool bls12_377_g1_batch_mul(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1s,
+    size_t out_g1s_size);
+
+bool bls12_377_g2_add(
+    const void *a_g2,
+    size_t a_g2_size,
+    const void *b_g2,
+    size_t b_g2_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bls12_377_g2_mul(
+    const void *p_g2,
+    size_t p_g2_size,
+    const void *s_fr,
+    size_t s_fr_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bls12_377_g2_msm(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bls12_377_g2_batch_mul(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2s,
+    size_t out_g2s_size);
+
 bool bls12_377_pairing(
     const void *a_g1,
     size_t a_g1_size,
@@ -52,6 +112,33 @@ bool bls12_377_pairing(
     const void *h_g2,
     size_t h_g2_size);
 
+// Returns true iff prod_i e(g1s[i], g2s[i]) == 1, where g1s and g2s are
+// contiguous arrays of num_pairs elements.
+bool bls12_377_multi_pairing_check(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size);
+
+// As bls12_377_multi_pairing_check, for the pairs (g1s[i], g2s[i]) and
+// (fixed_g1s[i], fixed_g2s[i]). The precomputation of each of fixed_g2s is
+// cached, so this should be used for G2 elements which are common to many
+// calls (e.g. elements of a verification key). G2 elements which vary
+// between calls should be passed in g2s, so that they do not evict fixed
+// elements.
+bool bls12_377_multi_pairing_check_fixed_g2(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size,
+    size_t num_fixed_pairs,
+    const void *fixed_g1s,
+    size_t fixed_g1s_size,
+    const void *fixed_g2s,
+    size_t fixed_g2s_size);
+
 // BW6-761 entry points
 //
 // Fr elements must be 48 bytes
@@ -60,6 +147,10 @@ bool bls12_377_pairing(
 
 bool bw6_761_init();
 
+// Set the maximum number of precomputed G2 elements held in the cache used by
+// bw6_761_multi_pairing_check_fixed_g2 (0 disables caching).
+bool bw6_761_set_g2_precomp_cache_capacity(size_t capacity);
+
 bool bw6_761_g1_add(
     const void *a_g1,
     size_t a_g1_size,
@@ -76,6 +167,62 @@ bool bw6_761_g1_mul(
     void *out_g1,
     size_t out_g1_size);
 
+// Multi-scalar multiplication: out_g1 = sum_i scalars_fr[i] * points_g1[i].
+// points_g1 and scalars_fr are contiguous arrays of num_entries elements.
+bool bw6_761_g1_msm(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1,
+    size_t out_g1_size);
+
+// Batch scalar multiplication: out_g1s[i] = scalars_fr[i] * points_g1[i]. All
+// buffers are contiguous arrays of num_entries elements.
+bool bw6_761_g1_batch_mul(
+    size_t num_entries,
+    const void *points_g1,
+    size_t points_g1_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g1s,
+    size_t out_g1s_size);
+
+bool bw6_761_g2_add(
+    const void *a_g2,
+    size_t a_g2_size,
+    const void *b_g2,
+    size_t b_g2_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bw6_761_g2_mul(
+    const void *p_g2,
+    size_t p_g2_size,
+    const void *s_fr,
+    size_t s_fr_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bw6_761_g2_msm(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2,
+    size_t out_g2_size);
+
+bool bw6_761_g2_batch_mul(
+    size_t num_entries,
+    const void *points_g2,
+    size_t points_g2_size,
+    const void *scalars_fr,
+    size_t scalars_fr_size,
+    void *out_g2s,
+    size_t out_g2s_size);
+
 bool bw6_761_pairing(
     const void *a_g1,
     size_t a_g1_size,
@@ -94,6 +241,33 @@ bool bw6_761_pairing(
     const void *h_g2,
     size_t h_g2_size);
 
+// Returns true iff prod_i e(g1s[i], g2s[i]) == 1, where g1s and g2s are
+// contiguous arrays of num_pairs elements.
+bool bw6_761_multi_pairing_check(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size);
+
+// As bw6_761_multi_pairing_check, for the pairs (g1s[i], g2s[i]) and
+// (fixed_g1s[i], fixed_g2s[i]). The precomputation of each of fixed_g2s is
+// cached, so this should be used for G2 elements which are common to many
+// calls (e.g. elements of a verification key). G2 elements which vary
+// between calls should be passed in g2s, so that they do not evict fixed
+// elements.
+bool bw6_761_multi_pairing_check_fixed_g2(
+    size_t num_pairs,
+    const void *g1s,
+    size_t g1s_size,
+    const void *g2s,
+    size_t g2s_size,
+    size_t num_fixed_pairs,
+    const void *fixed_g1s,
+    size_t fixed_g1s_size,
+    const void *fixed_g2s,
+    size_t fixed_g2s_size);
+
 #if __cplusplus
 }
 #endif
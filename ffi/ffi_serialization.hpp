@@ -2,6 +2,7 @@
 #define __LIBFF_FFI_FFI_SERIALIZATION_HPP__
 
 #include <libff/algebra/curves/public_params.hpp>
+#include <vector>
 
 namespace libff
 {
@@ -55,6 +56,33 @@ template<typename GroupT>
 bool group_element_write(
     const GroupT &g, const void *buffer, size_t buffer_size);
 
+/// Read num_elements field elements from a contiguous buffer (each element
+/// in the format expected by field_element_read). Elements are parsed in
+/// parallel when MULTICORE is enabled. Returns true on success.
+template<typename FieldT>
+bool field_elements_read(
+    std::vector<FieldT> &fs,
+    size_t num_elements,
+    const void *buffer,
+    size_t buffer_size);
+
+/// Read num_elements group elements from a contiguous buffer (each element in
+/// the format expected by group_element_read). Elements are parsed and
+/// checked in parallel when MULTICORE is enabled. Returns true on success.
+template<typename GroupT>
+bool group_elements_read(
+    std::vector<GroupT> &gs,
+    size_t num_elements,
+    const void *buffer,
+    size_t buffer_size);
+
+/// Write a vector of group elements to a contiguous buffer (each element in
+/// the format written by group_element_write). All elements are converted to
+/// affine form using a single batch inversion. Returns true on success.
+template<typename GroupT>
+bool group_elements_write(
+    const std::vector<GroupT> &gs, void *buffer, size_t buffer_size);
+
 } // namespace ffi
 
 } // namespace libff
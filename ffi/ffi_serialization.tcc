@@ -4,6 +4,8 @@
 #include "ffi_serialization.hpp"
 
 #include <libff/algebra/fields/fp.hpp>
+#include <libff/algebra/scalar_multiplication/multiexp.hpp>
+#include <libff/common/parallel.hpp>
 
 namespace libff
 {
@@ -83,6 +85,23 @@ public:
     }
 };
 
+// Write an element which is already in affine form (see
+// group_element_write).
+template<typename GroupT>
+bool affine_group_element_write(
+    const GroupT &affine_p, void *buffer, size_t buffer_size)
+{
+    constexpr size_t coordinate_size = sizeof(affine_p.X);
+    if (buffer_size == 2 * coordinate_size) {
+        if (field_element_write(affine_p.X, buffer, coordinate_size)) {
+            buffer = ((char *)buffer) + coordinate_size;
+            return field_element_write(affine_p.Y, buffer, coordinate_size);
+        }
+    }
+
+    return false;
+}
+
 template<typename FieldT> bool field_element_equals_zero(const FieldT &f)
 {
     return f == FieldT::zero();
@@ -173,17 +192,104 @@ bool group_element_read(GroupT &g, const void *buffer, size_t buffer_size)
 template<typename GroupT>
 bool group_element_write(const GroupT &g, void *buffer, size_t buffer_size)
 {
-    constexpr size_t coordinate_size = sizeof(g.X);
-    if (buffer_size == 2 * coordinate_size) {
-        GroupT affine_p = g;
-        affine_p.to_affine_coordinates();
-        if (field_element_write(affine_p.X, buffer, coordinate_size)) {
-            buffer = ((char *)buffer) + coordinate_size;
-            return field_element_write(affine_p.Y, buffer, coordinate_size);
-        }
+    GroupT affine_p = g;
+    affine_p.to_affine_coordinates();
+    return internal::affine_group_element_write(affine_p, buffer, buffer_size);
+}
+
+template<typename FieldT>
+bool field_elements_read(
+    std::vector<FieldT> &fs,
+    size_t num_elements,
+    const void *buffer,
+    size_t buffer_size)
+{
+    constexpr size_t element_size = sizeof(FieldT);
+    if (buffer_size != num_elements * element_size) {
+        return false;
     }
 
-    return false;
+    fs.resize(num_elements);
+    return parallel_reduce(
+        0,
+        num_elements,
+        0,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t i = begin; i < end; ++i) {
+                success = field_element_read(
+                              fs[i],
+                              ((const char *)buffer) + i * element_size,
+                              element_size) &&
+                          success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
+}
+
+template<typename GroupT>
+bool group_elements_read(
+    std::vector<GroupT> &gs,
+    size_t num_elements,
+    const void *buffer,
+    size_t buffer_size)
+{
+    constexpr size_t element_size = 2 * sizeof(((GroupT *)nullptr)->X);
+    if (buffer_size != num_elements * element_size) {
+        return false;
+    }
+
+    gs.resize(num_elements);
+    return parallel_reduce(
+        0,
+        num_elements,
+        0,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t i = begin; i < end; ++i) {
+                success = group_element_read(
+                              gs[i],
+                              ((const char *)buffer) + i * element_size,
+                              element_size) &&
+                          success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
+}
+
+template<typename GroupT>
+bool group_elements_write(
+    const std::vector<GroupT> &gs, void *buffer, size_t buffer_size)
+{
+    constexpr size_t element_size = 2 * sizeof(((GroupT *)nullptr)->X);
+    if (buffer_size != gs.size() * element_size) {
+        return false;
+    }
+
+    std::vector<GroupT> affine_gs(gs);
+    batch_to_special(affine_gs);
+
+    return parallel_reduce(
+        0,
+        affine_gs.size(),
+        0,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t i = begin; i < end; ++i) {
+                success = internal::affine_group_element_write(
+                              affine_gs[i],
+                              ((char *)buffer) + i * element_size,
+                              element_size) &&
+                          success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
 }
 
 } // namespace ffi
@@ -0,0 +1,160 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_COMMITMENTS_KZG_HPP__
+#define __LIBFF_ALGEBRA_COMMITMENTS_KZG_HPP__
+
+#include "libff/algebra/curves/curve_serialization.hpp"
+#include "libff/algebra/curves/public_params.hpp"
+#include "libff/algebra/polynomials/polynomial.hpp"
+
+#include <string>
+#include <vector>
+
+namespace libff
+{
+
+/// Structured reference string for KZG polynomial commitments (Kate,
+/// Zaverucha, Goldberg, "Constant-Size Commitments to Polynomials and Their
+/// Applications", ASIACRYPT 2010), for a secret tau.
+///
+/// g1_powers holds [tau^i]_1 for i = 0, ..., max_degree, supporting
+/// commitments to polynomials in coefficient form. g1_lagrange is optional
+/// and, if present, holds [L_i(tau)]_1 for the Lagrange basis polynomials L_i
+/// of ntt_domain<Fr<ppT>>(g1_lagrange.size()), supporting commitments to
+/// polynomials in evaluation form without interpolation. All G1 elements are
+/// held in special form.
+template<typename ppT> class kzg_srs
+{
+public:
+    std::vector<G1<ppT>> g1_powers;
+    std::vector<G1<ppT>> g1_lagrange;
+    G2<ppT> g2_one;
+    G2<ppT> g2_tau;
+
+    kzg_srs();
+    kzg_srs(
+        std::vector<G1<ppT>> &&g1_powers,
+        std::vector<G1<ppT>> &&g1_lagrange,
+        const G2<ppT> &g2_one,
+        const G2<ppT> &g2_tau);
+
+    /// Maximum degree of polynomials that can be committed to in coefficient
+    /// form.
+    size_t max_degree() const;
+
+    /// Generate an SRS from a known tau, with powers up to max_degree and (if
+    /// lagrange_size is non-zero) a Lagrange basis for the domain of size
+    /// lagrange_size. For testing only: tau must be kept secret.
+    static kzg_srs<ppT> generate_from_secret(
+        const Fr<ppT> &tau,
+        const size_t max_degree,
+        const size_t lagrange_size = 0);
+};
+
+/// Write the SRS to a group_container file. Sections are, in order: the G1
+/// powers, the G2 elements (g2_one, g2_tau), and the G1 Lagrange basis
+/// (which may be empty).
+template<typename ppT>
+void kzg_srs_write(const kzg_srs<ppT> &srs, const std::string &filename);
+
+/// Read an SRS written by kzg_srs_write, decoding directly from the mapped
+/// file, and performing the given checks on the group elements. Only the
+/// first max_degree + 1 powers (and all Lagrange elements) are read. Throws
+/// std::runtime_error if the file is invalid or any check fails.
+template<typename ppT>
+kzg_srs<ppT> kzg_srs_read(
+    const std::string &filename,
+    const group_check_t check = group_check_subgroup,
+    const size_t max_degree = (size_t)-1);
+
+/// A claim that the polynomial committed to by commitment evaluates to
+/// evaluation at point, with witness as the proof.
+template<typename ppT> class kzg_evaluation_claim
+{
+public:
+    G1<ppT> commitment;
+    Fr<ppT> point;
+    Fr<ppT> evaluation;
+    G1<ppT> witness;
+};
+
+/// Commit to a polynomial in coefficient form. Throws std::invalid_argument
+/// if the polynomial has degree greater than srs.max_degree().
+template<typename ppT>
+G1<ppT> kzg_commit(const kzg_srs<ppT> &srs, const polynomial<Fr<ppT>> &p);
+
+/// Commit to a polynomial in evaluation form over the domain of the Lagrange
+/// basis. Throws std::invalid_argument if the number of evaluations is not
+/// equal to srs.g1_lagrange.size().
+template<typename ppT>
+G1<ppT> kzg_commit_evaluations(
+    const kzg_srs<ppT> &srs, const std::vector<Fr<ppT>> &evaluations);
+
+/// Compute the witness for the evaluation of p at z, writing p(z) to
+/// evaluation.
+template<typename ppT>
+G1<ppT> kzg_open(
+    const kzg_srs<ppT> &srs,
+    const polynomial<Fr<ppT>> &p,
+    const Fr<ppT> &z,
+    Fr<ppT> &evaluation);
+
+/// Compute the witnesses for the evaluations of p at each of the given
+/// points, writing the evaluations to evaluations. Equivalent to calling
+/// kzg_open for each point, with temporary storage for the
+/// multi-exponentiations shared between points.
+template<typename ppT>
+std::vector<G1<ppT>> kzg_open_at_points(
+    const kzg_srs<ppT> &srs,
+    const polynomial<Fr<ppT>> &p,
+    const std::vector<Fr<ppT>> &points,
+    std::vector<Fr<ppT>> &evaluations);
+
+/// Compute a single witness for the evaluations of several polynomials at
+/// z, combined as sum_i gamma^i * polynomials[i], where gamma is chosen by
+/// the verifier (or derived from a transcript). The individual evaluations
+/// are written to evaluations.
+template<typename ppT>
+G1<ppT> kzg_open_batch(
+    const kzg_srs<ppT> &srs,
+    const std::vector<polynomial<Fr<ppT>>> &polynomials,
+    const Fr<ppT> &z,
+    const Fr<ppT> &gamma,
+    std::vector<Fr<ppT>> &evaluations);
+
+/// The claim checked by the verifier for a witness produced by
+/// kzg_open_batch. ppT cannot be deduced, and must be given explicitly.
+template<typename ppT>
+kzg_evaluation_claim<ppT> kzg_batch_claim(
+    const std::vector<G1<ppT>> &commitments,
+    const Fr<ppT> &z,
+    const std::vector<Fr<ppT>> &evaluations,
+    const Fr<ppT> &gamma,
+    const G1<ppT> &witness);
+
+/// Verify a single claim, using a single double Miller loop.
+template<typename ppT>
+bool kzg_verify(
+    const kzg_srs<ppT> &srs, const kzg_evaluation_claim<ppT> &claim);
+
+/// Verify several claims (at arbitrary points) together. The claims are
+/// combined using random 128-bit scalars, so that only two
+/// multi-exponentiations and a single double Miller loop are required.
+/// Returns false (except with probability at most 2^-128) if any claim is
+/// invalid.
+template<typename ppT>
+bool kzg_batch_verify(
+    const kzg_srs<ppT> &srs,
+    const std::vector<kzg_evaluation_claim<ppT>> &claims);
+
+} // namespace libff
+
+#include "libff/algebra/commitments/kzg.tcc"
+
+#endif // __LIBFF_ALGEBRA_COMMITMENTS_KZG_HPP__
@@ -0,0 +1,472 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_COMMITMENTS_KZG_TCC__
+#define __LIBFF_ALGEBRA_COMMITMENTS_KZG_TCC__
+
+#include "libff/algebra/commitments/kzg.hpp"
+#include "libff/algebra/curves/g2_precomp_cache.hpp"
+#include "libff/algebra/curves/group_container.hpp"
+#include "libff/algebra/fields/field_utils.hpp"
+#include "libff/algebra/scalar_multiplication/multiexp.hpp"
+#include "libff/common/parallel.hpp"
+#include "libff/common/rng.hpp"
+
+#include <stdexcept>
+
+namespace libff
+{
+
+namespace internal
+{
+
+inline size_t kzg_multi_exp_num_chunks()
+{
+    return parallel_num_threads();
+}
+
+/// sum_i scalars[i] * bases[i], for i < scalars.size(), where bases are in
+/// special form.
+template<typename GroupT, typename FieldT>
+GroupT kzg_multi_exp_special(
+    const std::vector<GroupT> &bases, const std::vector<FieldT> &scalars)
+{
+    if (scalars.empty()) {
+        return GroupT::zero();
+    }
+
+    return multi_exp<
+        GroupT,
+        FieldT,
+        multi_exp_method_auto,
+        multi_exp_base_form_special>(
+        bases.begin(),
+        bases.begin() + scalars.size(),
+        scalars.begin(),
+        scalars.end(),
+        kzg_multi_exp_num_chunks());
+}
+
+/// As above, using (and retaining) temporary storage in the given workspace.
+template<typename GroupT, typename FieldT>
+GroupT kzg_multi_exp_special(
+    const std::vector<GroupT> &bases,
+    const std::vector<FieldT> &scalars,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
+{
+    if (scalars.empty()) {
+        return GroupT::zero();
+    }
+
+    return multi_exp<
+        GroupT,
+        FieldT,
+        multi_exp_method_auto,
+        multi_exp_base_form_special>(
+        bases.begin(),
+        bases.begin() + scalars.size(),
+        scalars.begin(),
+        scalars.end(),
+        kzg_multi_exp_num_chunks(),
+        workspace);
+}
+
+template<typename GroupT, typename FieldT>
+GroupT kzg_multi_exp(
+    const std::vector<GroupT> &bases, const std::vector<FieldT> &scalars)
+{
+    if (scalars.empty()) {
+        return GroupT::zero();
+    }
+
+    return multi_exp<GroupT, FieldT, multi_exp_method_auto>(
+        bases.begin(),
+        bases.end(),
+        scalars.begin(),
+        scalars.end(),
+        kzg_multi_exp_num_chunks());
+}
+
+/// gamma^0, ..., gamma^(n-1)
+template<typename FieldT>
+std::vector<FieldT> kzg_powers(const FieldT &gamma, const size_t n)
+{
+    std::vector<FieldT> powers(n);
+    FieldT power = FieldT::one();
+    for (size_t i = 0; i < n; ++i) {
+        powers[i] = power;
+        power *= gamma;
+    }
+    return powers;
+}
+
+/// Number of bits of the random scalars used to combine claims in
+/// kzg_batch_verify. An invalid claim is accepted with probability at most
+/// 2^-kzg_batch_verify_scalar_bits.
+constexpr size_t kzg_batch_verify_scalar_bits = 128;
+
+/// 1, followed by n - 1 random scalars of kzg_batch_verify_scalar_bits bits.
+/// Short scalars are sufficient for soundness, and reduce the cost of the
+/// multi-exponentiations.
+template<typename FieldT>
+std::vector<FieldT> kzg_batch_verify_scalars(const size_t n)
+{
+    constexpr size_t limbs_per_scalar =
+        (kzg_batch_verify_scalar_bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+    static_assert(
+        limbs_per_scalar <= FieldT::num_limbs,
+        "field too small for batch verification scalars");
+
+    std::vector<FieldT> scalars(n);
+    if (n == 0) {
+        return scalars;
+    }
+
+    std::vector<mp_limb_t> limbs((n - 1) * limbs_per_scalar);
+    random_bytes(limbs.data(), limbs.size() * sizeof(mp_limb_t));
+    scalars[0] = FieldT::one();
+    for (size_t j = 1; j < n; ++j) {
+        bigint<FieldT::num_limbs> r;
+        for (size_t k = 0; k < limbs_per_scalar; ++k) {
+            r.data[k] = limbs[(j - 1) * limbs_per_scalar + k];
+        }
+        scalars[j] = FieldT(r);
+    }
+
+    return scalars;
+}
+
+/// Check e(A, [1]_2) * e(-B, [tau]_2) == 1
+template<typename ppT>
+bool kzg_pairing_check(
+    const kzg_srs<ppT> &srs, const G1<ppT> &A, const G1<ppT> &B)
+{
+    const G1_precomp<ppT> A_precomp = ppT::precompute_G1(A);
+    const G1_precomp<ppT> minus_B_precomp = ppT::precompute_G1(-B);
+    const Fqk<ppT> miller_result = ppT::double_miller_loop(
+        A_precomp,
+        *cached_precompute_G2<ppT>(srs.g2_one),
+        minus_B_precomp,
+        *cached_precompute_G2<ppT>(srs.g2_tau));
+    return ppT::final_exponentiation(miller_result) == GT<ppT>::one();
+}
+
+} // namespace internal
+
+template<typename ppT>
+kzg_srs<ppT>::kzg_srs()
+    : g1_powers(), g1_lagrange(), g2_one(G2<ppT>::one()), g2_tau()
+{
+}
+
+template<typename ppT>
+kzg_srs<ppT>::kzg_srs(
+    std::vector<G1<ppT>> &&g1_powers,
+    std::vector<G1<ppT>> &&g1_lagrange,
+    const G2<ppT> &g2_one,
+    const G2<ppT> &g2_tau)
+    : g1_powers(std::move(g1_powers))
+    , g1_lagrange(std::move(g1_lagrange))
+    , g2_one(g2_one)
+    , g2_tau(g2_tau)
+{
+}
+
+template<typename ppT> size_t kzg_srs<ppT>::max_degree() const
+{
+    return g1_powers.empty() ? 0 : g1_powers.size() - 1;
+}
+
+template<typename ppT>
+kzg_srs<ppT> kzg_srs<ppT>::generate_from_secret(
+    const Fr<ppT> &tau, const size_t max_degree, const size_t lagrange_size)
+{
+    using Field = Fr<ppT>;
+
+    // Scalars for [tau^i]_1, followed by those for [L_i(tau)]_1.
+    std::vector<Field> scalars = internal::kzg_powers(tau, max_degree + 1);
+    if (lagrange_size > 0) {
+        // L_i(tau) = omega^i * (tau^n - 1) / (n * (tau - omega^i))
+        const Field omega = get_root_of_unity<Field>(lagrange_size);
+        const Field tau_n_minus_one =
+            (tau ^ (unsigned long)lagrange_size) - Field::one();
+        if (tau_n_minus_one.is_zero()) {
+            throw std::invalid_argument("tau must not be in the domain");
+        }
+
+        const std::vector<Field> omega_i =
+            internal::kzg_powers(omega, lagrange_size);
+        std::vector<Field> denominators(lagrange_size);
+        const Field n = Field((long)lagrange_size);
+        for (size_t i = 0; i < lagrange_size; ++i) {
+            denominators[i] = n * (tau - omega_i[i]);
+        }
+        batch_invert(denominators);
+        for (size_t i = 0; i < lagrange_size; ++i) {
+            scalars.push_back(omega_i[i] * tau_n_minus_one * denominators[i]);
+        }
+    }
+
+    const size_t scalar_size = Field::size_in_bits();
+    const size_t window = get_exp_window_size<G1<ppT>>(scalars.size());
+    const window_table<G1<ppT>> table =
+        get_window_table(scalar_size, window, G1<ppT>::one());
+    std::vector<G1<ppT>> g1_elements =
+        batch_exp(scalar_size, window, table, scalars);
+    batch_to_special(g1_elements);
+
+    std::vector<G1<ppT>> g1_lagrange(
+        g1_elements.begin() + max_degree + 1, g1_elements.end());
+    g1_elements.resize(max_degree + 1);
+    return kzg_srs<ppT>(
+        std::move(g1_elements),
+        std::move(g1_lagrange),
+        G2<ppT>::one(),
+        tau * G2<ppT>::one());
+}
+
+// Elements are written uncompressed in Montgomery form, which requires the
+// least work to decode.
+template<typename ppT>
+void kzg_srs_write(const kzg_srs<ppT> &srs, const std::string &filename)
+{
+    group_container_writer writer(filename);
+    writer.write_section<form_montgomery, compression_off>(srs.g1_powers);
+    writer.write_section<form_montgomery, compression_off>(
+        std::vector<G2<ppT>>{srs.g2_one, srs.g2_tau});
+    writer.write_section<form_montgomery, compression_off>(srs.g1_lagrange);
+    writer.close();
+}
+
+template<typename ppT>
+kzg_srs<ppT> kzg_srs_read(
+    const std::string &filename,
+    const group_check_t check,
+    const size_t max_degree)
+{
+    const group_container_reader reader(filename);
+    if (reader.num_sections() != 3) {
+        throw std::runtime_error("unexpected number of sections in KZG SRS");
+    }
+
+    // Decoded elements are in affine (and therefore special) form.
+    const group_container_section_view<G1<ppT>> powers_view =
+        reader.template section<G1<ppT>>(0);
+    const size_t num_powers =
+        (max_degree < powers_view.size()) ? max_degree + 1 : powers_view.size();
+    std::vector<G1<ppT>> g1_powers;
+    powers_view.read(g1_powers, check, 0, num_powers);
+
+    std::vector<G2<ppT>> g2_elements;
+    reader.template section<G2<ppT>>(1).read(g2_elements, check);
+    if (g2_elements.size() != 2) {
+        throw std::runtime_error("unexpected number of G2 elements in KZG SRS");
+    }
+
+    std::vector<G1<ppT>> g1_lagrange;
+    reader.template section<G1<ppT>>(2).read(g1_lagrange, check);
+
+    return kzg_srs<ppT>(
+        std::move(g1_powers),
+        std::move(g1_lagrange),
+        g2_elements[0],
+        g2_elements[1]);
+}
+
+template<typename ppT>
+G1<ppT> kzg_commit(const kzg_srs<ppT> &srs, const polynomial<Fr<ppT>> &p)
+{
+    if (p.size() > srs.g1_powers.size()) {
+        throw std::invalid_argument("polynomial degree exceeds KZG SRS size");
+    }
+
+    return internal::kzg_multi_exp_special(srs.g1_powers, p);
+}
+
+template<typename ppT>
+G1<ppT> kzg_commit_evaluations(
+    const kzg_srs<ppT> &srs, const std::vector<Fr<ppT>> &evaluations)
+{
+    if (evaluations.size() != srs.g1_lagrange.size()) {
+        throw std::invalid_argument(
+            "number of evaluations does not match KZG Lagrange basis");
+    }
+
+    return internal::kzg_multi_exp_special(srs.g1_lagrange, evaluations);
+}
+
+template<typename ppT>
+G1<ppT> kzg_open(
+    const kzg_srs<ppT> &srs,
+    const polynomial<Fr<ppT>> &p,
+    const Fr<ppT> &z,
+    Fr<ppT> &evaluation)
+{
+    polynomial<Fr<ppT>> quotient;
+    evaluation = polynomial_divide_by_linear(p, z, quotient);
+    return kzg_commit(srs, quotient);
+}
+
+// The quotients for all points are computed first, and then committed to
+// using a single multi_exp_workspace, so that the scalar and bucket buffers
+// are allocated once for all openings rather than once per opening. Each
+// division and multi-exponentiation is parallelized internally, so points are
+// processed in sequence.
+template<typename ppT>
+std::vector<G1<ppT>> kzg_open_at_points(
+    const kzg_srs<ppT> &srs,
+    const polynomial<Fr<ppT>> &p,
+    const std::vector<Fr<ppT>> &points,
+    std::vector<Fr<ppT>> &evaluations)
+{
+    if (p.size() > srs.g1_powers.size()) {
+        throw std::invalid_argument("polynomial degree exceeds KZG SRS size");
+    }
+
+    std::vector<polynomial<Fr<ppT>>> quotients(points.size());
+    evaluations.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        evaluations[i] =
+            polynomial_divide_by_linear(p, points[i], quotients[i]);
+    }
+
+    multi_exp_workspace<G1<ppT>, Fr<ppT>> workspace;
+    std::vector<G1<ppT>> witnesses(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        witnesses[i] = internal::kzg_multi_exp_special(
+            srs.g1_powers, quotients[i], workspace);
+    }
+
+    return witnesses;
+}
+
+template<typename ppT>
+G1<ppT> kzg_open_batch(
+    const kzg_srs<ppT> &srs,
+    const std::vector<polynomial<Fr<ppT>>> &polynomials,
+    const Fr<ppT> &z,
+    const Fr<ppT> &gamma,
+    std::vector<Fr<ppT>> &evaluations)
+{
+    using Field = Fr<ppT>;
+
+    evaluations = polynomial_batch_evaluate(polynomials, z);
+
+    size_t combined_size = 0;
+    for (const polynomial<Field> &p : polynomials) {
+        combined_size = std::max(combined_size, p.size());
+    }
+
+    // sum_i gamma^i * polynomials[i], computed for each coefficient.
+    const std::vector<Field> gamma_powers =
+        internal::kzg_powers(gamma, polynomials.size());
+    polynomial<Field> combined(combined_size);
+    parallel_for(0, combined_size, 0, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            Field c = Field::zero();
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                if (j < polynomials[i].size()) {
+                    c += gamma_powers[i] * polynomials[i][j];
+                }
+            }
+            combined[j] = c;
+        }
+    });
+
+    Field combined_evaluation;
+    return kzg_open(srs, combined, z, combined_evaluation);
+}
+
+template<typename ppT>
+kzg_evaluation_claim<ppT> kzg_batch_claim(
+    const std::vector<G1<ppT>> &commitments,
+    const Fr<ppT> &z,
+    const std::vector<Fr<ppT>> &evaluations,
+    const Fr<ppT> &gamma,
+    const G1<ppT> &witness)
+{
+    if (commitments.size() != evaluations.size()) {
+        throw std::invalid_argument(
+            "numbers of commitments and evaluations differ");
+    }
+
+    const std::vector<Fr<ppT>> gamma_powers =
+        internal::kzg_powers(gamma, commitments.size());
+    Fr<ppT> combined_evaluation = Fr<ppT>::zero();
+    for (size_t i = 0; i < evaluations.size(); ++i) {
+        combined_evaluation += gamma_powers[i] * evaluations[i];
+    }
+
+    kzg_evaluation_claim<ppT> claim;
+    claim.commitment = internal::kzg_multi_exp(commitments, gamma_powers);
+    claim.point = z;
+    claim.evaluation = combined_evaluation;
+    claim.witness = witness;
+    return claim;
+}
+
+// e(C - [y]_1, [1]_2) = e(W, [tau - z]_2) is checked as
+//
+//   e(C - [y]_1 + z * W, [1]_2) * e(-W, [tau]_2) = 1
+template<typename ppT>
+bool kzg_verify(const kzg_srs<ppT> &srs, const kzg_evaluation_claim<ppT> &claim)
+{
+    const G1<ppT> A = claim.commitment - claim.evaluation * G1<ppT>::one() +
+                      claim.point * claim.witness;
+    return internal::kzg_pairing_check(srs, A, claim.witness);
+}
+
+// For random r_j, the individual checks are combined as
+//
+//   e(sum_j r_j * (C_j - [y_j]_1 + z_j * W_j), [1]_2) *
+//     e(-sum_j r_j * W_j, [tau]_2) = 1
+//
+// r_0 = 1, and the remaining r_j are short (see
+// kzg_batch_verify_scalar_bits).
+template<typename ppT>
+bool kzg_batch_verify(
+    const kzg_srs<ppT> &srs,
+    const std::vector<kzg_evaluation_claim<ppT>> &claims)
+{
+    using Field = Fr<ppT>;
+
+    const size_t num_claims = claims.size();
+    if (num_claims == 0) {
+        return true;
+    }
+
+    // Bases and scalars for sum_j r_j * C_j + (r_j * z_j) * W_j, and for
+    // sum_j r_j * W_j.
+    std::vector<G1<ppT>> a_bases(2 * num_claims);
+    std::vector<Field> a_scalars(2 * num_claims);
+    std::vector<G1<ppT>> b_bases(num_claims);
+    std::vector<Field> b_scalars(num_claims);
+    const std::vector<Field> r_j =
+        internal::kzg_batch_verify_scalars<Field>(num_claims);
+    Field evaluation = Field::zero();
+    for (size_t j = 0; j < num_claims; ++j) {
+        const kzg_evaluation_claim<ppT> &claim = claims[j];
+        const Field &r = r_j[j];
+        a_bases[2 * j] = claim.commitment;
+        a_scalars[2 * j] = r;
+        a_bases[2 * j + 1] = claim.witness;
+        a_scalars[2 * j + 1] = r * claim.point;
+        b_bases[j] = claim.witness;
+        b_scalars[j] = r;
+        evaluation += r * claim.evaluation;
+    }
+
+    const G1<ppT> A = internal::kzg_multi_exp(a_bases, a_scalars) -
+                      evaluation * G1<ppT>::one();
+    const G1<ppT> B = internal::kzg_multi_exp(b_bases, b_scalars);
+    return internal::kzg_pairing_check(srs, A, B);
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_COMMITMENTS_KZG_TCC__
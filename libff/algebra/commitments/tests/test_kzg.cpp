@@ -0,0 +1,194 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/commitments/kzg.hpp"
+#include "libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "libff/algebra/curves/bls12_377/bls12_377_pp.hpp"
+#include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#ifdef CURVE_BN128
+#include "libff/algebra/curves/bn128/bn128_pp.hpp"
+#endif
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace libff;
+
+namespace
+{
+
+template<typename FieldT>
+polynomial<FieldT> random_polynomial(const size_t num_coefficients)
+{
+    polynomial<FieldT> p(num_coefficients);
+    for (FieldT &c : p) {
+        c = FieldT::random_element();
+    }
+    return p;
+}
+
+template<typename ppT> void test_kzg_srs(const kzg_srs<ppT> &srs)
+{
+    const std::string filename = "test_kzg_srs.bin";
+    kzg_srs_write(srs, filename);
+
+    const kzg_srs<ppT> srs_read = kzg_srs_read<ppT>(filename);
+    ASSERT_EQ(srs.g1_powers, srs_read.g1_powers);
+    ASSERT_EQ(srs.g1_lagrange, srs_read.g1_lagrange);
+    ASSERT_EQ(srs.g2_one, srs_read.g2_one);
+    ASSERT_EQ(srs.g2_tau, srs_read.g2_tau);
+    for (const G1<ppT> &g : srs_read.g1_powers) {
+        ASSERT_TRUE(g.is_special());
+    }
+
+    const kzg_srs<ppT> srs_truncated =
+        kzg_srs_read<ppT>(filename, group_check_well_formed, 10);
+    ASSERT_EQ(10, srs_truncated.max_degree());
+    ASSERT_EQ(
+        std::vector<G1<ppT>>(srs.g1_powers.begin(), srs.g1_powers.begin() + 11),
+        srs_truncated.g1_powers);
+
+    std::remove(filename.c_str());
+}
+
+template<typename ppT> void test_kzg()
+{
+    using Field = Fr<ppT>;
+    const size_t max_degree = 63;
+    const size_t lagrange_size = 32;
+    const Field tau = Field::random_element();
+    const kzg_srs<ppT> srs =
+        kzg_srs<ppT>::generate_from_secret(tau, max_degree, lagrange_size);
+    ASSERT_EQ(max_degree, srs.max_degree());
+    ASSERT_EQ(lagrange_size, srs.g1_lagrange.size());
+
+    test_kzg_srs(srs);
+
+    // Commitments in coefficient and evaluation forms.
+    const polynomial<Field> p = random_polynomial<Field>(max_degree + 1);
+    const G1<ppT> p_commit = kzg_commit(srs, p);
+    ASSERT_EQ(polynomial_evaluate(p, tau) * G1<ppT>::one(), p_commit);
+    ASSERT_THROW(
+        kzg_commit(srs, random_polynomial<Field>(max_degree + 2)),
+        std::invalid_argument);
+
+    const polynomial<Field> q = random_polynomial<Field>(lagrange_size);
+    const ntt_domain<Field> domain(lagrange_size);
+    ASSERT_EQ(
+        kzg_commit(srs, q),
+        kzg_commit_evaluations(srs, polynomial_to_evaluations(q, domain)));
+    ASSERT_THROW(
+        kzg_commit_evaluations(srs, std::vector<Field>(lagrange_size - 1)),
+        std::invalid_argument);
+
+    // Single opening
+    const Field z = Field::random_element();
+    kzg_evaluation_claim<ppT> claim;
+    claim.commitment = p_commit;
+    claim.point = z;
+    claim.witness = kzg_open(srs, p, z, claim.evaluation);
+    ASSERT_EQ(polynomial_evaluate(p, z), claim.evaluation);
+    ASSERT_TRUE(kzg_verify(srs, claim));
+
+    kzg_evaluation_claim<ppT> invalid_claim = claim;
+    invalid_claim.evaluation += Field::one();
+    ASSERT_FALSE(kzg_verify(srs, invalid_claim));
+    invalid_claim = claim;
+    invalid_claim.point += Field::one();
+    ASSERT_FALSE(kzg_verify(srs, invalid_claim));
+
+    // Openings at many points, verified together.
+    std::vector<Field> points;
+    for (size_t i = 0; i < 5; ++i) {
+        points.push_back(Field::random_element());
+    }
+    std::vector<Field> evaluations;
+    const std::vector<G1<ppT>> witnesses =
+        kzg_open_at_points(srs, p, points, evaluations);
+    ASSERT_EQ(polynomial_evaluate(p, points), evaluations);
+
+    std::vector<kzg_evaluation_claim<ppT>> claims;
+    for (size_t i = 0; i < points.size(); ++i) {
+        kzg_evaluation_claim<ppT> c;
+        c.commitment = p_commit;
+        c.point = points[i];
+        c.evaluation = evaluations[i];
+        c.witness = witnesses[i];
+        ASSERT_TRUE(kzg_verify(srs, c));
+        Field evaluation;
+        ASSERT_EQ(kzg_open(srs, p, points[i], evaluation), witnesses[i]);
+        claims.push_back(c);
+    }
+
+    // Several polynomials opened at a single point.
+    std::vector<polynomial<Field>> polynomials;
+    std::vector<G1<ppT>> commitments;
+    for (size_t i = 0; i < 4; ++i) {
+        polynomials.push_back(random_polynomial<Field>(10 + 13 * i));
+        commitments.push_back(kzg_commit(srs, polynomials.back()));
+    }
+    const Field gamma = Field::random_element();
+    const Field batch_z = Field::random_element();
+    std::vector<Field> batch_evaluations;
+    const G1<ppT> batch_witness =
+        kzg_open_batch(srs, polynomials, batch_z, gamma, batch_evaluations);
+    ASSERT_EQ(
+        polynomial_batch_evaluate(polynomials, batch_z), batch_evaluations);
+    const kzg_evaluation_claim<ppT> batch_claim = kzg_batch_claim<ppT>(
+        commitments, batch_z, batch_evaluations, gamma, batch_witness);
+    ASSERT_TRUE(kzg_verify(srs, batch_claim));
+    claims.push_back(batch_claim);
+
+    batch_evaluations[2] += Field::one();
+    ASSERT_FALSE(kzg_verify(
+        srs,
+        kzg_batch_claim<ppT>(
+            commitments, batch_z, batch_evaluations, gamma, batch_witness)));
+
+    // Batch verification of all claims, including the combined claim.
+    ASSERT_TRUE(kzg_batch_verify(srs, claims));
+    ASSERT_TRUE(
+        kzg_batch_verify(srs, std::vector<kzg_evaluation_claim<ppT>>()));
+    for (size_t i = 0; i < claims.size(); ++i) {
+        std::vector<kzg_evaluation_claim<ppT>> invalid_claims = claims;
+        invalid_claims[i].evaluation += Field::one();
+        ASSERT_FALSE(kzg_batch_verify(srs, invalid_claims));
+    }
+    std::vector<kzg_evaluation_claim<ppT>> swapped_claims = claims;
+    std::swap(swapped_claims[0].witness, swapped_claims[1].witness);
+    ASSERT_FALSE(kzg_batch_verify(srs, swapped_claims));
+}
+
+TEST(KZGTest, ALT_BN128)
+{
+    alt_bn128_pp::init_public_params();
+    test_kzg<alt_bn128_pp>();
+}
+
+TEST(KZGTest, BLS12_381)
+{
+    bls12_381_pp::init_public_params();
+    test_kzg<bls12_381_pp>();
+}
+
+TEST(KZGTest, BLS12_377)
+{
+    bls12_377_pp::init_public_params();
+    test_kzg<bls12_377_pp>();
+}
+
+#ifdef CURVE_BN128
+TEST(KZGTest, BN128)
+{
+    bn128_pp::init_public_params();
+    test_kzg<bn128_pp>();
+}
+#endif
+
+} // namespace
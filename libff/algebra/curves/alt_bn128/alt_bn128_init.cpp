@@ -12,8 +12,12 @@
 namespace libff
 {
 
-bigint<alt_bn128_r_limbs> alt_bn128_modulus_r;
-bigint<alt_bn128_q_limbs> alt_bn128_modulus_q;
+constexpr bigint<alt_bn128_r_limbs> alt_bn128_modulus_r =
+    bigint<alt_bn128_r_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001");
+constexpr bigint<alt_bn128_q_limbs> alt_bn128_modulus_q =
+    bigint<alt_bn128_q_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47");
 
 alt_bn128_Fq alt_bn128_coeff_b;
 alt_bn128_Fq2 alt_bn128_twist;
@@ -40,261 +44,276 @@ void init_alt_bn128_params()
 
     /* parameters for scalar field Fr */
 
-    alt_bn128_modulus_r = bigint_r("2188824287183927522224640574525727508854836"
-                                   "4400416034343698204186575808495617");
     assert(alt_bn128_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        alt_bn128_Fr::Rsquared =
-            bigint_r("944936681149208446651664254269745548490766851729442924617"
-                     "792859073125903783");
-        alt_bn128_Fr::Rcubed =
-            bigint_r("586654854594384522748989487204024472040386810557878410528"
-                     "1690076696998248512");
+        alt_bn128_Fr::Rsquared = bigint_r::from_hex(
+            "216d0b17f4e44a58c49833d53bb808553fe3ab1e35c59e31bb8e645ae216da7");
+        alt_bn128_Fr::Rcubed = bigint_r::from_hex(
+            "cf8594b7fcc657c893cc664a19fcfed2a489cbe1cfbb6b85e94d8e1b4bf0040");
         alt_bn128_Fr::inv = 0xc2e1f593efffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        alt_bn128_Fr::Rsquared =
-            bigint_r("944936681149208446651664254269745548490766851729442924617"
-                     "792859073125903783");
-        alt_bn128_Fr::Rcubed =
-            bigint_r("586654854594384522748989487204024472040386810557878410528"
-                     "1690076696998248512");
+        alt_bn128_Fr::Rsquared = bigint_r::from_hex(
+            "216d0b17f4e44a58c49833d53bb808553fe3ab1e35c59e31bb8e645ae216da7");
+        alt_bn128_Fr::Rcubed = bigint_r::from_hex(
+            "cf8594b7fcc657c893cc664a19fcfed2a489cbe1cfbb6b85e94d8e1b4bf0040");
         alt_bn128_Fr::inv = 0xefffffff;
     }
     alt_bn128_Fr::num_bits = 254;
-    alt_bn128_Fr::euler = bigint_r("1094412143591963761112320287262863754427418"
-                                   "2200208017171849102093287904247808");
+    alt_bn128_Fr::euler = bigint_r::from_hex(
+        "183227397098d014dc2822db40c0ac2e9419f4243cdcb848a1f0fac9f8000000");
     alt_bn128_Fr::s = 28;
-    alt_bn128_Fr::t = bigint_r(
-        "81540058820840996586704275553141814055101440848469862132140264610111");
-    alt_bn128_Fr::t_minus_1_over_2 = bigint_r(
-        "40770029410420498293352137776570907027550720424234931066070132305055");
-    alt_bn128_Fr::multiplicative_generator = alt_bn128_Fr("5");
-    alt_bn128_Fr::root_of_unity =
-        alt_bn128_Fr("191032190679217139442913928276920700361456519573292863153"
-                     "05642004821462161904");
-    alt_bn128_Fr::nqr = alt_bn128_Fr("5");
-    alt_bn128_Fr::nqr_to_t =
-        alt_bn128_Fr("191032190679217139442913928276920700361456519573292863153"
-                     "05642004821462161904");
+    alt_bn128_Fr::t = bigint_r::from_hex(
+        "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f");
+    alt_bn128_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "183227397098d014dc2822db40c0ac2e9419f4243cdcb848a1f0fac9f");
+    alt_bn128_Fr::multiplicative_generator = alt_bn128_Fr::from_montgomery_hex(
+        "15d0085520f5bbc347d8eb76d8dd0689eaba68a3a32a913f1b0d0ef99fffffe6");
+    alt_bn128_Fr::root_of_unity = alt_bn128_Fr::from_montgomery_hex(
+        "1860ef942963f9e756452ac01eb203d8a22bf3742445ffd6636e735580d13d9c");
+    alt_bn128_Fr::nqr = alt_bn128_Fr::from_montgomery_hex(
+        "15d0085520f5bbc347d8eb76d8dd0689eaba68a3a32a913f1b0d0ef99fffffe6");
+    alt_bn128_Fr::nqr_to_t = alt_bn128_Fr::from_montgomery_hex(
+        "1860ef942963f9e756452ac01eb203d8a22bf3742445ffd6636e735580d13d9c");
     alt_bn128_Fr::static_init();
 
     /* parameters for base field Fq */
 
-    alt_bn128_modulus_q = bigint_q("2188824287183927522224640574525727508869631"
-                                   "1157297823662689037894645226208583");
     assert(alt_bn128_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        alt_bn128_Fq::Rsquared =
-            bigint_q("309661650298370392384356793683737445173554096841907652877"
-                     "1170197431451843209");
-        alt_bn128_Fq::Rcubed =
-            bigint_q("149217865411596481859481527385630809590936198385102451777"
-                     "10943249661917737183");
+        alt_bn128_Fq::Rsquared = bigint_q::from_hex(
+            "6d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89");
+        alt_bn128_Fq::Rcubed = bigint_q::from_hex(
+            "20fd6e902d592544ef7f0b0c0ada0afb62f210e6a7283db6b1cd6dafda1530df");
         alt_bn128_Fq::inv = 0x87d20782e4866389;
     }
     if (sizeof(mp_limb_t) == 4) {
-        alt_bn128_Fq::Rsquared =
-            bigint_q("309661650298370392384356793683737445173554096841907652877"
-                     "1170197431451843209");
-        alt_bn128_Fq::Rcubed =
-            bigint_q("149217865411596481859481527385630809590936198385102451777"
-                     "10943249661917737183");
+        alt_bn128_Fq::Rsquared = bigint_q::from_hex(
+            "6d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89");
+        alt_bn128_Fq::Rcubed = bigint_q::from_hex(
+            "20fd6e902d592544ef7f0b0c0ada0afb62f210e6a7283db6b1cd6dafda1530df");
         alt_bn128_Fq::inv = 0xe4866389;
     }
     alt_bn128_Fq::num_bits = 254;
-    alt_bn128_Fq::euler = bigint_q("1094412143591963761112320287262863754434815"
-                                   "5578648911831344518947322613104291");
+    alt_bn128_Fq::euler = bigint_q::from_hex(
+        "183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3");
     alt_bn128_Fq::s = 1;
-    alt_bn128_Fq::t = bigint_q("10944121435919637611123202872628637544348155578"
-                               "648911831344518947322613104291");
-    alt_bn128_Fq::t_minus_1_over_2 =
-        bigint_q("5472060717959818805561601436314318772174077789324455915672259"
-                 "473661306552145");
-    alt_bn128_Fq::multiplicative_generator = alt_bn128_Fq("3");
-    alt_bn128_Fq::root_of_unity =
-        alt_bn128_Fq("218882428718392752222464057452572750886963111572978236626"
-                     "89037894645226208582");
-    alt_bn128_Fq::nqr = alt_bn128_Fq("3");
-    alt_bn128_Fq::nqr_to_t =
-        alt_bn128_Fq("218882428718392752222464057452572750886963111572978236626"
-                     "89037894645226208582");
+    alt_bn128_Fq::t = bigint_q::from_hex(
+        "183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3");
+    alt_bn128_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "c19139cb84c680a6e14116da060561765e05aa45a1c72a34f082305b61f3f51");
+    alt_bn128_Fq::multiplicative_generator = alt_bn128_Fq::from_montgomery_hex(
+        "2a1f6744ce179d8e334bea4e696bd2841f6ac17ae15521b97a17caa950ad28d7");
+    alt_bn128_Fq::root_of_unity = alt_bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
+    alt_bn128_Fq::nqr = alt_bn128_Fq::from_montgomery_hex(
+        "2a1f6744ce179d8e334bea4e696bd2841f6ac17ae15521b97a17caa950ad28d7");
+    alt_bn128_Fq::nqr_to_t = alt_bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
     alt_bn128_Fq::static_init();
 
     /* parameters for twist field Fq2 */
-    alt_bn128_Fq2::euler = bigint<2 * alt_bn128_q_limbs>(
-        "2395475880083114212209940226083393703996261582655504112182239011270350"
-        "4684318911872392052590971893598559411615740655013091812781706979347432"
-        "3196511433944");
+    alt_bn128_Fq2::euler = bigint<2 * alt_bn128_q_limbs>::from_hex(
+        "492e25c3b1e5fce2ccd37be01a4690e5805c2a88b1bab031376fd2e1a6359c682344f4"
+        "abd09216425280c4e36cb656e5301039684f560809daa2c5113aeb4d8");
     alt_bn128_Fq2::s = 4;
-    alt_bn128_Fq2::t = bigint<2 * alt_bn128_q_limbs>(
-        "2994344850103892765262425282604242129995326978319380140227798764087938"
-        "0855398639840490065738714866998199264519675818766364765977133724184290"
-        "399563929243");
-    alt_bn128_Fq2::t_minus_1_over_2 = bigint<2 * alt_bn128_q_limbs>(
-        "1497172425051946382631212641302121064997663489159690070113899382043969"
-        "0427699319920245032869357433499099632259837909383182382988566862092145"
-        "199781964621");
-    alt_bn128_Fq2::non_residue =
-        alt_bn128_Fq("218882428718392752222464057452572750886963111572978236626"
-                     "89037894645226208582");
-    alt_bn128_Fq2::nqr = alt_bn128_Fq2(alt_bn128_Fq("2"), alt_bn128_Fq("1"));
+    alt_bn128_Fq2::t = bigint<2 * alt_bn128_q_limbs>::from_hex(
+        "925c4b8763cbf9c599a6f7c0348d21cb00b85511637560626edfa5c34c6b38d04689e9"
+        "57a1242c84a50189c6d96cadca602072d09eac1013b5458a2275d69b");
+    alt_bn128_Fq2::t_minus_1_over_2 = bigint<2 * alt_bn128_q_limbs>::from_hex(
+        "492e25c3b1e5fce2ccd37be01a4690e5805c2a88b1bab031376fd2e1a6359c682344f4"
+        "abd09216425280c4e36cb656e5301039684f560809daa2c5113aeb4d");
+    alt_bn128_Fq2::non_residue = alt_bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
+    alt_bn128_Fq2::nqr = alt_bn128_Fq2(
+        alt_bn128_Fq::from_montgomery_hex(
+            "1c14ef83340fbe5eccdd46def0f28c5814f1d651eb8e167ba6ba871b8b1e1b3a"),
+        alt_bn128_Fq::one());
     alt_bn128_Fq2::nqr_to_t = alt_bn128_Fq2(
-        alt_bn128_Fq("503350371626262426731249255837998268717520073493487759859"
-                     "9011485707452665730"),
-        alt_bn128_Fq("314498342015008975724433667930697407966947188435857772134"
-                     "235984660852259084"));
-    alt_bn128_Fq2::Frobenius_coeffs_c1[0] = alt_bn128_Fq("1");
-    alt_bn128_Fq2::Frobenius_coeffs_c1[1] =
-        alt_bn128_Fq("218882428718392752222464057452572750886963111572978236626"
-                     "89037894645226208582");
+        alt_bn128_Fq::from_montgomery_hex(
+            "2581f70bad99ce67936464b898f81824b2fe144b3e84d778801dd97687961532"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "e752acf9ba98a59d0048196eb1419ecf3a19577808492c960b5b57507394ed9"));
+    alt_bn128_Fq2::Frobenius_coeffs_c1[0] = alt_bn128_Fq::one();
+    alt_bn128_Fq2::Frobenius_coeffs_c1[1] = alt_bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
+    alt_bn128_Fq2::half = alt_bn128_Fq::from_montgomery_hex(
+        "1f37631a3d9cbfac8f5f7492fcfd4f44d0fd2add2f1c6ae587bee7d24f060572");
+    alt_bn128_Fq2::non_residue_inverse = alt_bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
+    // non_residue = -1
+    alt_bn128_Fq2::sqrt_minus_non_residue = alt_bn128_Fq::one();
+    alt_bn128_Fq2::sqrt_minus_non_residue_inverse = alt_bn128_Fq::one();
     alt_bn128_Fq2::static_init();
 
     /* parameters for Fq6 */
-    alt_bn128_Fq6::non_residue =
-        alt_bn128_Fq2(alt_bn128_Fq("9"), alt_bn128_Fq("1"));
+    alt_bn128_Fq6::non_residue = alt_bn128_Fq2(
+        alt_bn128_Fq::from_montgomery_hex(
+            "1d9598e8a7e398572943337e3940c6d12f3d6f4dd31bd011f60647ce410d7ff7"),
+        alt_bn128_Fq::one());
     alt_bn128_Fq6::Frobenius_coeffs_c1[0] =
-        alt_bn128_Fq2(alt_bn128_Fq("1"), alt_bn128_Fq("0"));
+        alt_bn128_Fq2(alt_bn128_Fq::one(), alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c1[1] = alt_bn128_Fq2(
-        alt_bn128_Fq("215754636382808430103983242694308260992690442743472168272"
-                     "12613867836435027261"),
-        alt_bn128_Fq("103076015958737097001522842738161122640692301306164367556"
-                     "25194854815875713954"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "1956bcd8118214ec7a007127242e0991347f91c8a9aa6454b5773b104563ab30"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "26694fbb4e82ebc3b6e713cdfae0ca3aaa1c7b6d89f891416e849f1ea0aa475"
+            "7"));
     alt_bn128_Fq6::Frobenius_coeffs_c1[2] = alt_bn128_Fq2(
-        alt_bn128_Fq("218882428718392752200424452601091531672777074144720616417"
-                     "14758635765020556616"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2682e617020217e06001b4b8b615564a7dce557cdb5e56b93350c88e13e80b9c"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c1[3] = alt_bn128_Fq2(
-        alt_bn128_Fq("377200088191985377643369518671385823900907359381719577177"
-                     "3381919316419345261"),
-        alt_bn128_Fq("223659549596724518828170124820318179512106890260586122785"
-                     "5261137820944008926"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "20273e77e3439f8219eeaf64e248c7f4b311782a4aa662b2c9af22f716ad6bad"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "a46036d4417cc5569e6188b446c84673933d5817ba76b4cacc02860f7ce93ac"));
     alt_bn128_Fq6::Frobenius_coeffs_c1[4] = alt_bn128_Fq2(
-        alt_bn128_Fq(
-            "2203960485148121921418603742825762020974279258880205651966"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2c3b3f0d26594943aa303344d4741444a6bb947cffbe332371930c11d782e155"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c1[5] = alt_bn128_Fq2(
-        alt_bn128_Fq("184290212234778536576607920343698658391145044464312347263"
-                     "92080002137598044644"),
-        alt_bn128_Fq("934404577999832033381242022323798102950601212407552567920"
-                     "8581902008406485703"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "274aa195cd9d8be4dcb16ae0fc8bdf354771cb2fdc92ce12f91aba2654e8e3b1"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "301949bd2fc8883a4fd35f13c3b562194bb28433cb43988c5cfc50ae18811f8"
+            "b"));
     alt_bn128_Fq6::Frobenius_coeffs_c2[0] =
-        alt_bn128_Fq2(alt_bn128_Fq("1"), alt_bn128_Fq("0"));
+        alt_bn128_Fq2(alt_bn128_Fq::one(), alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c2[1] = alt_bn128_Fq2(
-        alt_bn128_Fq("258191134446700933526731111546880309955166560507619674086"
-                     "7805258568234346338"),
-        alt_bn128_Fq("199377569717756479879959321699293419943146406529649494483"
-                     "13374472400716661030"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "15df9cddbb9fd3ec9c941f314b3e2399a5bb2bd3273411fb7361d77f843abe92"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "24830a9d3171f0fd37bc870a0c7dd2b962cb29a5a4445b605dddfd154bd8c94"
+            "9"));
     alt_bn128_Fq6::Frobenius_coeffs_c2[2] = alt_bn128_Fq2(
-        alt_bn128_Fq(
-            "2203960485148121921418603742825762020974279258880205651966"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2c3b3f0d26594943aa303344d4741444a6bb947cffbe332371930c11d782e155"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c2[3] = alt_bn128_Fq2(
-        alt_bn128_Fq("532447920244990354272678339550621448192825776240064327978"
-                     "0343368557297135718"),
-        alt_bn128_Fq("162089003807376930849194951273343879813937264198568887999"
-                     "17914180988844123039"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "6b03d4d3476ec58d858f5d00e9bd47abfd62df528fdeadf448a93a57b6762df"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "170c812b84dda0b2b533eee05adeaef1a1a54e7a56f4299f2b19daf4bcc936d"
+            "1"));
     alt_bn128_Fq6::Frobenius_coeffs_c2[4] = alt_bn128_Fq2(
-        alt_bn128_Fq("218882428718392752200424452601091531672777074144720616417"
-                     "14758635765020556616"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2682e617020217e06001b4b8b615564a7dce557cdb5e56b93350c88e13e80b9c"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq6::Frobenius_coeffs_c2[5] = alt_bn128_Fq2(
-        alt_bn128_Fq("139818523249223623442523112342822575072163877898209836420"
-                     "40889267519694726527"),
-        alt_bn128_Fq("762982839116520937157738419325082020168425524177380907714"
-                     "6787135900891633097"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "13d47447f11adfe4436330b527a7604931f010c9183fcdb2843420f1d8dadbd6"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "2539111d0c13aea383b015829ba62f102a925d02d5ab101aef494023a857fa7"
+            "4"));
 
     /* parameters for Fq12 */
 
-    alt_bn128_Fq12::non_residue =
-        alt_bn128_Fq2(alt_bn128_Fq("9"), alt_bn128_Fq("1"));
+    alt_bn128_Fq12::non_residue = alt_bn128_Fq2(
+        alt_bn128_Fq::from_montgomery_hex(
+            "1d9598e8a7e398572943337e3940c6d12f3d6f4dd31bd011f60647ce410d7ff7"),
+        alt_bn128_Fq::one());
     alt_bn128_Fq12::Frobenius_coeffs_c1[0] =
-        alt_bn128_Fq2(alt_bn128_Fq("1"), alt_bn128_Fq("0"));
+        alt_bn128_Fq2(alt_bn128_Fq::one(), alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[1] = alt_bn128_Fq2(
-        alt_bn128_Fq("837611886576382149658397386762636409258990606586829877690"
-                     "9617916018768340080"),
-        alt_bn128_Fq("164698233230778082238891372411765367990092866461081699356"
-                     "59301613961712198316"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2f34d751a1f3a7c11bded5ef08a2087ca6b1d7387afb78aaf9ba69633144907"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "10a75716b3899551dc2ff3a253dfc926d00f02a4565de15ba222ae234c492d7"
+            "2"));
     alt_bn128_Fq12::Frobenius_coeffs_c1[2] = alt_bn128_Fq2(
-        alt_bn128_Fq("218882428718392752200424452601091531672777074144720616417"
-                     "14758635765020556617"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "4290f65bad856e60e201271ad0d4418f0c5d61468b39769ca8d800500fa1bf2"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[3] = alt_bn128_Fq2(
-        alt_bn128_Fq("116974234963581543048257829225847253129123834411595050387"
-                     "94027105778954184319"),
-        alt_bn128_Fq("303847389135065887422783454877609941456349188919719272345"
-                     "083954437860409601"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "8116d8983a20d23659da72fca1009b50af7129ed4c96d9f365316184e46d97d"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "26684515eff054a69b2220928caf0ae03d9f02878a73bf7fb1df4af7c39c193"
+            "9"));
     alt_bn128_Fq12::Frobenius_coeffs_c1[4] = alt_bn128_Fq2(
-        alt_bn128_Fq("218882428718392752200424452601091531672777074144720616417"
-                     "14758635765020556616"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2682e617020217e06001b4b8b615564a7dce557cdb5e56b93350c88e13e80b9c"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[5] = alt_bn128_Fq2(
-        alt_bn128_Fq("332130463059433280824180905495836122032247737529120626188"
-                     "4409189760185844239"),
-        alt_bn128_Fq("572226693789653288578005195895834823114337370010937299937"
-                     "4820235121374419868"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "51e20146982d2a753dfb9d0d985e92d408bf52b4d19b61486b76f821b329076"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "15c0edff3c66bf54bef22cf038cf41b96d8fffe33415de240fbc9cd47752ebc"
+            "7"));
     alt_bn128_Fq12::Frobenius_coeffs_c1[6] = alt_bn128_Fq2(
-        alt_bn128_Fq("218882428718392752222464057452572750886963111572978236626"
-                     "89037894645226208582"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[7] = alt_bn128_Fq2(
-        alt_bn128_Fq("135121240060754537256624318776309109961064050914295248857"
-                     "79419978626457868503"),
-        alt_bn128_Fq("541841954876146699835726850408073828968702451118965372702"
-                     "9736280683514010267"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2d7100fdc71265ada692585790f737d5cd164d1de0c213028c84e580a568b440"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "1fbcf75c2da80ad7dc2052142da18f36c77267ed1213e93199fdddf38c33cfd"
+            "5"));
     alt_bn128_Fq12::Frobenius_coeffs_c1[8] = alt_bn128_Fq2(
-        alt_bn128_Fq(
-            "2203960485148121921418603742825762020974279258880205651966"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2c3b3f0d26594943aa303344d4741444a6bb947cffbe332371930c11d782e155"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[9] = alt_bn128_Fq2(
-        alt_bn128_Fq("101908193754811209174206228226725497757839277161383186238"
-                     "95010788866272024264"),
-        alt_bn128_Fq("215843954827042093348236222903796651472399619683781043903"
-                     "43953940207365798982"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2852e0e95d8f930652b29e86b7714ea88c8a57f293a85cee05cd75fe8a3623ca"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "9fc095cf1414b831d2e2523f4d24d7d59e26809ddfe0b0d8a41411f14e0e40e"));
     alt_bn128_Fq12::Frobenius_coeffs_c1[10] = alt_bn128_Fq2(
-        alt_bn128_Fq(
-            "2203960485148121921418603742825762020974279258880205651967"),
-        alt_bn128_Fq("0"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "9e1685bdf2f8849584e90fdcb6c021319b315148d1373d408cfc388c494f1ab"),
+        alt_bn128_Fq::zero());
     alt_bn128_Fq12::Frobenius_coeffs_c1[11] = alt_bn128_Fq2(
-        alt_bn128_Fq("185669382412449424140045966902989138683738337820066174008"
-                     "04628704885040364344"),
-        alt_bn128_Fq("161659759339427423364663537862989268575529374571884506633"
-                     "14217659523851788715"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "2b462e5e77aecd8264708be5a7fb6f3056f575661b581478b5691c94bd4a6cd1"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "1aa36073a4cae0d4f95e18c648b216a429f16aae345bec692c63ef42612a118"
+            "0"));
 
     /* choice of short Weierstrass curve and its twist */
 
-    alt_bn128_coeff_b = alt_bn128_Fq("3");
-    alt_bn128_twist = alt_bn128_Fq2(alt_bn128_Fq("9"), alt_bn128_Fq("1"));
+    alt_bn128_coeff_b = alt_bn128_Fq::from_montgomery_hex(
+        "2a1f6744ce179d8e334bea4e696bd2841f6ac17ae15521b97a17caa950ad28d7");
+    alt_bn128_twist = alt_bn128_Fq2(
+        alt_bn128_Fq::from_montgomery_hex(
+            "1d9598e8a7e398572943337e3940c6d12f3d6f4dd31bd011f60647ce410d7ff7"),
+        alt_bn128_Fq::one());
     alt_bn128_twist_coeff_b = alt_bn128_coeff_b * alt_bn128_twist.inverse();
     alt_bn128_twist_mul_by_b_c0 =
         alt_bn128_coeff_b * alt_bn128_Fq2::non_residue;
     alt_bn128_twist_mul_by_b_c1 =
         alt_bn128_coeff_b * alt_bn128_Fq2::non_residue;
     alt_bn128_twist_mul_by_q_X = alt_bn128_Fq2(
-        alt_bn128_Fq("215754636382808430103983242694308260992690442743472168272"
-                     "12613867836435027261"),
-        alt_bn128_Fq("103076015958737097001522842738161122640692301306164367556"
-                     "25194854815875713954"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "1956bcd8118214ec7a007127242e0991347f91c8a9aa6454b5773b104563ab30"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "26694fbb4e82ebc3b6e713cdfae0ca3aaa1c7b6d89f891416e849f1ea0aa475"
+            "7"));
     alt_bn128_twist_mul_by_q_Y = alt_bn128_Fq2(
-        alt_bn128_Fq("282156518219453684454815956169350265935961718524412036707"
-                     "8079554186484126554"),
-        alt_bn128_Fq("350584376791155637868703030998424884554024350989925964101"
-                     "3678093033130930403"));
+        alt_bn128_Fq::from_montgomery_hex(
+            "253570bea500f8dd31a9d1b6f9645366bb30f162e133bacbe4bbdd0c2936b629"),
+        alt_bn128_Fq::from_montgomery_hex(
+            "2c87200285defecc6d16bd27bb7edc6b07affd117826d1dba1d77ce45ffe77c"
+            "7"));
 
     /* choice of group G1 */
 
     // Identities
     alt_bn128_G1::G1_zero = alt_bn128_G1(
         alt_bn128_Fq::zero(), alt_bn128_Fq::one(), alt_bn128_Fq::zero());
-    alt_bn128_G1::G1_one =
-        alt_bn128_G1(alt_bn128_Fq("1"), alt_bn128_Fq("2"), alt_bn128_Fq::one());
+    alt_bn128_G1::G1_one = alt_bn128_G1(
+        alt_bn128_Fq::one(),
+        alt_bn128_Fq::from_montgomery_hex(
+            "1c14ef83340fbe5eccdd46def0f28c5814f1d651eb8e167ba6ba871b8b1e1b3a"),
+        alt_bn128_Fq::one());
 
     // Curve coeffs
     alt_bn128_G1::coeff_a = alt_bn128_Fq::zero();
     alt_bn128_G1::coeff_b = alt_bn128_coeff_b;
 
     // Cofactor
-    alt_bn128_G1::h = bigint<alt_bn128_G1::h_limbs>("1");
+    alt_bn128_G1::h = bigint<alt_bn128_G1::h_limbs>::from_hex("1");
 
     // WNAF
     alt_bn128_G1::wnaf_window_table.resize(0);
@@ -357,15 +376,19 @@ void init_alt_bn128_params()
 
     alt_bn128_G2::G2_one = alt_bn128_G2(
         alt_bn128_Fq2(
-            alt_bn128_Fq("10857046999023057135944570762232829481370756359578518"
-                         "086990519993285655852781"),
-            alt_bn128_Fq("11559732032986387107991004021392285783925812861821192"
-                         "530917403151452391805634")),
+            alt_bn128_Fq::from_montgomery_hex(
+                "19573841af96503bfbb8264797811adfdceb1935497b01728e83b5d102bc20"
+                "26"),
+            alt_bn128_Fq::from_montgomery_hex(
+                "14fef0833aea7b6b09e950fc52a02f866043dd5a5802d8c4afb4737da84c61"
+                "40")),
         alt_bn128_Fq2(
-            alt_bn128_Fq("84956539231234314176049732474892724384181905872636001"
-                         "48770280649306958101930"),
-            alt_bn128_Fq("40823678758634336813322034031454355683168513275934012"
-                         "08105741076214120093531")),
+            alt_bn128_Fq::from_montgomery_hex(
+                "28fd7eebae9e4206ff9e1a62231b7dfefe7fd297f59e9b78619dfa9d886be9"
+                "f6"),
+            alt_bn128_Fq::from_montgomery_hex(
+                "da4a0e693fd648255f935be33351076dc57f922327d3cbb64095b56c71856e"
+                "e")),
         alt_bn128_Fq2::one());
 
     // Curve coeffs
@@ -378,9 +401,8 @@ void init_alt_bn128_params()
     // h2 = (36 * u^4) + (36 * u^3) + (30 * u^2) + 6*u + 1; h2
     // #
     // 21888242871839275222246405745257275088844257914179612981679871602714643921549
-    alt_bn128_G2::h =
-        bigint<alt_bn128_G2::h_limbs>("2188824287183927522224640574525727508884"
-                                      "4257914179612981679871602714643921549");
+    alt_bn128_G2::h = bigint<alt_bn128_G2::h_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585e06ceecda572a2489345f2299c0f9fa8d");
 
     // WNAF
     alt_bn128_G2::wnaf_window_table.resize(0);
@@ -437,23 +459,20 @@ void init_alt_bn128_params()
 
     /* pairing parameters */
 
-    alt_bn128_ate_loop_count = bigint_q("29793968203157093288");
+    alt_bn128_ate_loop_count = bigint_q::from_hex("19d797039be763ba8");
     alt_bn128_ate_is_loop_count_neg = false;
-    alt_bn128_final_exponent = bigint<12 * alt_bn128_q_limbs>(
-        "5524842336132240963126171267831731470973821037629576541888827343141969"
-        "1083990754121397450276154062981700960854865468034362770115382944674781"
-        "0907373256841551006201639677726139946029199968412598804882391702273019"
-        "0836532720475663165843655597764930274954582383739028759376599435048732"
-        "2055416155052592630230333174746351564471187665317712957830319109590090"
-        "9191624817826566688241804408081892785725967931714097716709526092261278"
-        "0719525601711114440720492291235650574837501614600243533462841672824527"
-        "5621766233552881351913980829117053907212538123081572907154486160275093"
-        "6964829313608137325426383735122175229541155376346436093930287402089517"
-        "4269731789175697133847480818272554725769374714961957527271882614356332"
-        "7123871013173609629979816885292554054934233077527987700678435480142224"
-        "972257378356168517961881648003769500551542616236243107224563832474448"
-        "0");
-    alt_bn128_final_exponent_z = bigint_q("4965661367192848881");
+    alt_bn128_final_exponent = bigint<12 * alt_bn128_q_limbs>::from_hex(
+        "2f4b6dc97020fddadf107d20bc842d43bf6369b1ff6a1c71015f3f7be2e1e30a73bb94"
+        "fec0daf15466b2383a5d3ec3d15ad524d8f70c54efee1bd8c3b21377e563a09a1b7058"
+        "87e72eceaddea3790364a61f676baaf977870e88d5c6c8fef0781361e443ae77f5b63a"
+        "2a2264487f2940a8b1ddb3d15062cd0fb2015dfc6668449aed3cc48a82d0d602d268c7"
+        "daab6a41294c0cc4ebe5664568dfc50e1648a45a4a1e3a5195846a3ed011a337a02088"
+        "ec80e0ebae8755cfe107acf3aafb40494e406f804216bb10cf430b0f37856b42db8dc5"
+        "514724ee93dfb10826f0dd4a0364b9580291d2cd65664814fde37ca80bb4ea44eacc5e"
+        "641bbadf423f9a2cbf813b8d145da90029baee7ddadda71c7f3811c4105262945bba16"
+        "68c3be69a3c230974d83561841d766f9c9d570bb7fbe04c7e8a6c3c760c0de81def356"
+        "92da361102b6b9b2b918837fa97896e84abb40a4efb7e54523a486964b64ca86f120");
+    alt_bn128_final_exponent_z = bigint_q::from_hex("44e992b44a6909f1");
     alt_bn128_final_exponent_is_z_neg = false;
 }
 } // namespace libff
@@ -24,8 +24,8 @@ const mp_size_t alt_bn128_r_limbs =
 const mp_size_t alt_bn128_q_limbs =
     (alt_bn128_q_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<alt_bn128_r_limbs> alt_bn128_modulus_r;
-extern bigint<alt_bn128_q_limbs> alt_bn128_modulus_q;
+extern const bigint<alt_bn128_r_limbs> alt_bn128_modulus_r;
+extern const bigint<alt_bn128_q_limbs> alt_bn128_modulus_q;
 
 typedef Fp_model<alt_bn128_r_limbs, alt_bn128_modulus_r> alt_bn128_Fr;
 typedef Fp_model<alt_bn128_q_limbs, alt_bn128_modulus_q> alt_bn128_Fq;
@@ -8,7 +8,9 @@
 namespace libff
 {
 
-bigint<bls12_377_r_limbs> bls12_377_modulus_r;
+constexpr bigint<bls12_377_r_limbs> bls12_377_modulus_r =
+    bigint<bls12_377_r_limbs>::from_hex(
+        "12ab655e9a2ca55660b44d1e5c37b00159aa76fed00000010a11800000000001");
 // bls12_377_modulus_q is a macro referring to bw6_761_modulus_r. See
 // bls12_377_init.hpp.
 // bigint<bls12_377_q_limbs> bls12_377_modulus_q;
@@ -57,45 +59,39 @@ void init_bls12_377_params()
 
     // Parameters for scalar field Fr
     // r = 0x12ab655e9a2ca55660b44d1e5c37b00159aa76fed00000010a11800000000001
-    bls12_377_modulus_r = bigint_r("8444461749428370424248824938781546531375899"
-                                   "335154063827935233455917409239041");
     assert(bls12_377_Fr::modulus_is_valid());
     // 64-bit architecture
     if (sizeof(mp_limb_t) == 8) {
-        bls12_377_Fr::Rsquared =
-            bigint_r("508595941311779472113692600146818027278633330499214071737"
-                     "745792929336755579");
-        bls12_377_Fr::Rcubed =
-            bigint_r("271718748542331355632020787121653842635320109739890963908"
-                     "6937135091399607628");
+        bls12_377_Fr::Rsquared = bigint_r::from_hex(
+            "11fdae7eff1c939a7cc008fe5dc8593cc2c27b58860591f25d577bab861857b");
+        bls12_377_Fr::Rcubed = bigint_r::from_hex(
+            "601dfa555c48ddab1e55ef6f1c9d713624d23ffae2716996a4295c90f65454c");
         bls12_377_Fr::inv = 0xa117fffffffffff;
     }
     // 32-bit architecture
     if (sizeof(mp_limb_t) == 4) {
-        bls12_377_Fr::Rsquared =
-            bigint_r("508595941311779472113692600146818027278633330499214071737"
-                     "745792929336755579");
-        bls12_377_Fr::Rcubed =
-            bigint_r("271718748542331355632020787121653842635320109739890963908"
-                     "6937135091399607628");
+        bls12_377_Fr::Rsquared = bigint_r::from_hex(
+            "11fdae7eff1c939a7cc008fe5dc8593cc2c27b58860591f25d577bab861857b");
+        bls12_377_Fr::Rcubed = bigint_r::from_hex(
+            "601dfa555c48ddab1e55ef6f1c9d713624d23ffae2716996a4295c90f65454c");
         bls12_377_Fr::inv = 0xffffffff;
     }
     bls12_377_Fr::num_bits = 253;
-    bls12_377_Fr::euler = bigint_r("4222230874714185212124412469390773265687949"
-                                   "667577031913967616727958704619520");
+    bls12_377_Fr::euler = bigint_r::from_hex(
+        "955b2af4d1652ab305a268f2e1bd800acd53b7f680000008508c00000000000");
     bls12_377_Fr::s = 47;
-    bls12_377_Fr::t = bigint_r(
-        "60001509534603559531609739528203892656505753216962260608619555");
-    bls12_377_Fr::t_minus_1_over_2 = bigint_r(
-        "30000754767301779765804869764101946328252876608481130304309777");
-    bls12_377_Fr::multiplicative_generator = bls12_377_Fr("22");
-    bls12_377_Fr::root_of_unity =
-        bls12_377_Fr("806515965671681287737496751840327346652143269366181061997"
-                     "9959746626482506078");
-    bls12_377_Fr::nqr = bls12_377_Fr("11");
-    bls12_377_Fr::nqr_to_t =
-        bls12_377_Fr("692488678884788206012306650822351907723216075069845241107"
-                     "1850219367055984476");
+    bls12_377_Fr::t = bigint_r::from_hex(
+        "2556cabd34594aacc1689a3cb86f6002b354edfda00000021423");
+    bls12_377_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "12ab655e9a2ca55660b44d1e5c37b00159aa76fed00000010a11");
+    bls12_377_Fr::multiplicative_generator = bls12_377_Fr::from_montgomery_hex(
+        "c79cfc4b98199704c01534d92860e69929216656ffffec7296c7ffffffffed3");
+    bls12_377_Fr::root_of_unity = bls12_377_Fr::from_montgomery_hex(
+        "f906c5b3befb0ce03ba0666b2f925255e223adbfc381dacaf80da4dda3ad648");
+    bls12_377_Fr::nqr = bls12_377_Fr::from_montgomery_hex(
+        "f929a91a9d71f63565ad035f75edf35761e46b21fffff6419beffffffffff6a");
+    bls12_377_Fr::nqr_to_t = bls12_377_Fr::from_montgomery_hex(
+        "d1ba211c5cc349cd7aacc7c597248269a14cda3ec99772b3c3d3ca739381fb2");
     bls12_377_Fr::static_init();
 
     // Parameters for base field Fq
@@ -104,203 +100,214 @@ void init_bls12_377_params()
     // sage:
     // mod(0x1ae3a4617c510eac63b05c06ca1493b1a22d9f300f5138f1ef3622fba094800170b5d44300000008508c00000000001,
     // 6) # = 1
-    bls12_377_modulus_q =
-        bigint_q("2586644260129690940106527336948935335363935127549146605398842"
-                 "62666720468348340822774968888139573360124440321458177");
     assert(bls12_377_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bls12_377_Fq::Rsquared = bigint_q(
-            "661274283768726978163325701168662324052305289846649183196063154202"
-            "33909940404532140033099444330447428417853902114");
-        bls12_377_Fq::Rcubed = bigint_q(
-            "157734475176213061358192738313701451942220138363611391489992831740"
-            "412033225490229541667992423878570205050777755168");
+        bls12_377_Fq::Rsquared = bigint_q::from_hex(
+            "6dfccb1e914b88837e92f041790bf9bfdf7d03827dc3ac22a5f11162d6b46d0329"
+            "fcaab00431b1b786686c9400cd22");
+        bls12_377_Fq::Rcubed = bigint_q::from_hex(
+            "1065ab4c0e7dda53f72540713590cb96a2a9516c804a20e2be8b1180449f513e50"
+            "f4148be329585581f532f8815de20");
         bls12_377_Fq::inv = 0x8508bfffffffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bls12_377_Fq::Rsquared = bigint_q(
-            "661274283768726978163325701168662324052305289846649183196063154202"
-            "33909940404532140033099444330447428417853902114");
-        bls12_377_Fq::Rcubed = bigint_q(
-            "157734475176213061358192738313701451942220138363611391489992831740"
-            "412033225490229541667992423878570205050777755168");
+        bls12_377_Fq::Rsquared = bigint_q::from_hex(
+            "6dfccb1e914b88837e92f041790bf9bfdf7d03827dc3ac22a5f11162d6b46d0329"
+            "fcaab00431b1b786686c9400cd22");
+        bls12_377_Fq::Rcubed = bigint_q::from_hex(
+            "1065ab4c0e7dda53f72540713590cb96a2a9516c804a20e2be8b1180449f513e50"
+            "f4148be329585581f532f8815de20");
         bls12_377_Fq::inv = 0xffffffff;
     }
 
     bls12_377_Fq::num_bits = 377;
-    bls12_377_Fq::euler =
-        bigint_q("1293322130064845470053263668474467667681967563774573302699421"
-                 "31333360234174170411387484444069786680062220160729088");
+    bls12_377_Fq::euler = bigint_q::from_hex(
+        "d71d230be28875631d82e03650a49d8d116cf9807a89c78f79b117dd04a4000b85aea2"
+        "180000004284600000000000");
     bls12_377_Fq::s = 46;
-    bls12_377_Fq::t =
-        bigint_q("3675842578061421676390135839012792950148785745837396071634149"
-                 "488243117337281387659330802195819009059");
-    bls12_377_Fq::t_minus_1_over_2 =
-        bigint_q("1837921289030710838195067919506396475074392872918698035817074"
-                 "744121558668640693829665401097909504529");
-    bls12_377_Fq::multiplicative_generator = bls12_377_Fq("15");
-    bls12_377_Fq::root_of_unity = bls12_377_Fq(
-        "3286357854725450502960126193986832566977050893937512246290474576635225"
-        "6812585773382134936404344547323199885654433");
+    bls12_377_Fq::t = bigint_q::from_hex(
+        "6b8e9185f1443ab18ec1701b28524ec688b67cc03d44e3c7bcd88bee82520005c2d751"
+        "0c00000021423");
+    bls12_377_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "35c748c2f8a21d58c760b80d94292763445b3e601ea271e3de6c45f741290002e16ba8"
+        "8600000010a11");
+    bls12_377_Fq::multiplicative_generator = bls12_377_Fq::from_montgomery_hex(
+        "19016a3edcd115f6968af36d106a4b2d10f7bf375757f17dc8ffe3035319f32669be3a"
+        "3bffffb5d15eefffffffff714");
+    bls12_377_Fq::root_of_unity = bls12_377_Fq::from_montgomery_hex(
+        "fda47f566e4289b7f9a1cc67b4e064d82b4258b1e4da96259d41860d7882d6720bc7a4"
+        "bf05c59cdfcae622791aab1e");
     // We need to find a qnr (small preferably) in order to compute square roots
     // in the field
-    bls12_377_Fq::nqr = bls12_377_Fq("5");
-    bls12_377_Fq::nqr_to_t = bls12_377_Fq(
-        "3377495600822765621977587665628813354707861049382861377725882934574055"
-        "6592044969439504850374928261397247202212840");
+    bls12_377_Fq::nqr = bls12_377_Fq::from_montgomery_hex(
+        "114c5a35730b618ba8be6fd148d4f4f4e661ca22778db8cfe81201ffa68f7bb7f37c04"
+        "d4ffffe7488fd3ffffffffd07");
+    bls12_377_Fq::nqr_to_t = bls12_377_Fq::from_montgomery_hex(
+        "ba7904c8cf8495cce5a0cba0df931b2c1a6dd31d8d5057a818ea191f8a0eaf254e4780"
+        "a6722e5168f876aa8bb191f2");
     bls12_377_Fq::static_init();
 
     // Parameters for twist field Fq2
-    bls12_377_Fq2::euler = bigint<2 * bls12_377_q_limbs>(
-        "3345364264230938125808962594624906928800576001088647925307095745329795"
-        "7116339370141113413635838485065209570299254148838549585056123015878375"
-        "0227249980418287852270900634666582330594333230337725133219903165601670"
-        "27213559780081664");
+    bls12_377_Fq2::euler = bigint<2 * bls12_377_q_limbs>::from_hex(
+        "16983e85dd7fd912b489dd9b0931e25dc5c3ed257749f8faf38a09eed26ae04e80c57d"
+        "c833066e00a7389281526b62305555545db857018c1925cac31c64eb5e5fde91af8e04"
+        "d256d1347970dec00399c692a780000008508c00000000000");
     bls12_377_Fq2::s = 47;
-    bls12_377_Fq2::t = bigint<2 * bls12_377_q_limbs>(
-        "4754048552841450893153254632217264839938161459668674418291936583116517"
-        "6127142572882339399080590404004751647874022280630227875599477749628896"
-        "1383541476974255391881599499962735436887347234371823579436839914935817"
-        "251");
-    bls12_377_Fq2::t_minus_1_over_2 = bigint<2 * bls12_377_q_limbs>(
-        "2377024276420725446576627316108632419969080729834337209145968291558258"
-        "8063571286441169699540295202002375823937011140315113937799738874814448"
-        "0691770738487127695940799749981367718443673617185911789718419957467908"
-        "625");
+    bls12_377_Fq2::t = bigint<2 * bls12_377_q_limbs>::from_hex(
+        "5a60fa1775ff644ad227766c24c78977170fb495dd27e3ebce2827bb49ab813a0315f7"
+        "20cc19b8029ce24a0549ad88c155555176e15c063064972b0c7193ad797f7a46be3813"
+        "495b44d1e5c37b000e671a4a9e00000021423");
+    bls12_377_Fq2::t_minus_1_over_2 = bigint<2 * bls12_377_q_limbs>::from_hex(
+        "2d307d0bbaffb2256913bb361263c4bb8b87da4aee93f1f5e71413dda4d5c09d018afb"
+        "90660cdc014e712502a4d6c460aaaaa8bb70ae0318324b958638c9d6bcbfbd235f1c09"
+        "a4ada268f2e1bd8007338d254f00000010a11");
     // https://github.com/scipr-lab/zexe/blob/6bfe574f7adea14b97ff554bbb594988635b1908/algebra/src/bls12_377/fields/fq2.rs#L11
     // Additive inverse of 5 in GF(q)
     // sage: GF(q)(-5)
     // Fp2 = Fp[X] / (X^2 - (-5)))
-    bls12_377_Fq2::non_residue = bls12_377_Fq(
-        "2586644260129690940106527336948935335363935127549146605398842626667204"
-        "68348340822774968888139573360124440321458172");
-    bls12_377_Fq2::nqr = bls12_377_Fq2(bls12_377_Fq("0"), bls12_377_Fq("1"));
+    bls12_377_Fq2::non_residue = bls12_377_Fq::from_montgomery_hex(
+        "9974a2c0945ad20baf1ec35813f9ebcbbcbd50d97c38022072420fbfa0504497d39cf6"
+        "e000018bfc0b8000000002fa");
+    bls12_377_Fq2::nqr =
+        bls12_377_Fq2(bls12_377_Fq::zero(), bls12_377_Fq::one());
     bls12_377_Fq2::nqr_to_t = bls12_377_Fq2(
-        bls12_377_Fq("0"),
-        bls12_377_Fq(
-            "257286236321774568987262729980034669694531728092793737444525294935"
-            "421142460394028155736019924956637466133519652786"));
-    bls12_377_Fq2::Frobenius_coeffs_c1[0] = bls12_377_Fq("1");
-    bls12_377_Fq2::Frobenius_coeffs_c1[1] = bls12_377_Fq(
-        "2586644260129690940106527336948935335363935127549146605398842626667204"
-        "68348340822774968888139573360124440321458176");
+        bls12_377_Fq::zero(),
+        bls12_377_Fq::from_montgomery_hex(
+            "15ba71189a6385f4a021599cc5c7ec254ae960c13a4a01744ca531578d90b2d2fd"
+            "cafcf064e14f8b6ece84433bd6475"));
+    bls12_377_Fq2::Frobenius_coeffs_c1[0] = bls12_377_Fq::one();
+    bls12_377_Fq2::Frobenius_coeffs_c1[1] = bls12_377_Fq::from_montgomery_hex(
+        "120d3e434c71c5079467000ec64c4529ed4423b9278b0897f75ae862f8c080dc5cabdc"
+        "0b000004f823ac00000000099");
+    bls12_377_Fq2::half = bls12_377_Fq::from_montgomery_hex(
+        "46b330f17efa4d267a4adfc01e42743da74bdbb73e3182cfbed9d4c53e9ff928a04fc1"
+        "bfffffd88166ffffffffffb4");
+    bls12_377_Fq2::non_residue_inverse = bls12_377_Fq::from_montgomery_hex(
+        "39c3fa70f49f434b747cccfc142743b95da6d8b6e4f01b7fe4561ad64f34cf8df55926"
+        "899999a98072266666666685");
     bls12_377_Fq2::static_init();
 
     // Parameters for Fq6 = (Fq2)^3
     bls12_377_Fq6::non_residue =
-        bls12_377_Fq2(bls12_377_Fq("0"), bls12_377_Fq("1"));
+        bls12_377_Fq2(bls12_377_Fq::zero(), bls12_377_Fq::one());
     bls12_377_Fq6::Frobenius_coeffs_c1[0] =
-        bls12_377_Fq2(bls12_377_Fq("1"), bls12_377_Fq("0"));
+        bls12_377_Fq2(bls12_377_Fq::one(), bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c1[1] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410946"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "4702bf3ac023805cf848adfdcd640c5cc426090a9c587e9b64a150cdf726cf1333"
+            "66940ac2a74b5892506da58478da"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c1[2] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410945"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "167d6a36f873fd0d63eb8aeea32285efb9868449d1509081ada4fd6fd832edcd8f"
+            "e2454bac2a79adacd106da5847973"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c1[3] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969094010652733694893533536393512754914660539884262666"
-            "720468348340822774968888139573360124440321458176"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "120d3e434c71c5079467000ec64c4529ed4423b9278b0897f75ae862f8c080dc5c"
+            "abdc0b000004f823ac00000000099"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c1[4] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047231"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "1673786dd04ed6a6942bd126ed3e52ebd5eb3e9f658bb10838ec0deec12213103d"
+            "7f6b0253d58b52c766f925a7b8727"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c1[5] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047232"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "4663a2a83dd119effc4d11826f20dc1e8a71ae63e00a8704191258bc8619233e0d"
+            "38ef753d5865aa3baf925a7b868e"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[0] =
-        bls12_377_Fq2(bls12_377_Fq("1"), bls12_377_Fq("0"));
+        bls12_377_Fq2(bls12_377_Fq::one(), bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[1] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410945"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "167d6a36f873fd0d63eb8aeea32285efb9868449d1509081ada4fd6fd832edcd8f"
+            "e2454bac2a79adacd106da5847973"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[2] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047231"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "1673786dd04ed6a6942bd126ed3e52ebd5eb3e9f658bb10838ec0deec12213103d"
+            "7f6b0253d58b52c766f925a7b8727"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[3] =
-        bls12_377_Fq2(bls12_377_Fq("1"), bls12_377_Fq("0"));
+        bls12_377_Fq2(bls12_377_Fq::one(), bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[4] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410945"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "167d6a36f873fd0d63eb8aeea32285efb9868449d1509081ada4fd6fd832edcd8f"
+            "e2454bac2a79adacd106da5847973"),
+        bls12_377_Fq::zero());
     bls12_377_Fq6::Frobenius_coeffs_c2[5] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047231"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "1673786dd04ed6a6942bd126ed3e52ebd5eb3e9f658bb10838ec0deec12213103d"
+            "7f6b0253d58b52c766f925a7b8727"),
+        bls12_377_Fq::zero());
 
     // Parameters for Fq12 = ((Fq2)^3)^2
     bls12_377_Fq12::non_residue =
-        bls12_377_Fq2(bls12_377_Fq("0"), bls12_377_Fq("1"));
+        bls12_377_Fq2(bls12_377_Fq::zero(), bls12_377_Fq::one());
     bls12_377_Fq12::Frobenius_coeffs_c1[0] =
-        bls12_377_Fq2(bls12_377_Fq("1"), bls12_377_Fq("0"));
+        bls12_377_Fq2(bls12_377_Fq::one(), bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[1] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "929493452202778647586249605064731826779530489092832489809601043817"
-            "95901929519566951595905490535835115111760994353"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "daa7058067d46fa24883de1e09a9ee930eeb0ac79dd4bd578d5187fbd2bd23a42e"
+            "0cb968c1fa446ec47a04a3f7ca9e"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[2] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410946"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "4702bf3ac023805cf848adfdcd640c5cc426090a9c587e9b64a150cdf726cf1333"
+            "66940ac2a74b5892506da58478da"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[3] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "216465761340224619389371505802605247630151569547285782856803747159"
-            "100223055385581585702401816380679166954762214499"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "158723199046d5d40f29b58d88472bcdf8fe44106dd987961a530d183ab0e53fd4"
+            "9de0c6da34a32982c13d9d084771f"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[4] = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410945"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "167d6a36f873fd0d63eb8aeea32285efb9868449d1509081ada4fd6fd832edcd8f"
+            "e2454bac2a79adacd106da5847973"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[5] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "123516416119946754630746545296132064952198520638002533875843642777"
-            "304321125866014634106496325844844051843001220146"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "7dcb2c189c98ed9eaa177aba7ac8ce4c80f9363f3fc3bc0a17df4987d85130591b"
+            "d15304e14fee296799d52c8cac81"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[6] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969094010652733694893533536393512754914660539884262666"
-            "720468348340822774968888139573360124440321458176"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "120d3e434c71c5079467000ec64c4529ed4423b9278b0897f75ae862f8c080dc5c"
+            "abdc0b000004f823ac00000000099"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[7] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "165715080792691229252027773188420350858440463845631411558924158284"
-            "924566418821255823372982649037525009328560463824"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "d39340975d3c7b23f281e24e979f4c8713eee839573ed1c76610a7be368adc72dd"
+            "508ac73e05bc164445fb5c083563"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[8] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047231"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "1673786dd04ed6a6942bd126ed3e52ebd5eb3e9f658bb10838ec0deec12213103d"
+            "7f6b0253d58b52c766f925a7b8727"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[9] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "421986646727444746212812278922882859062419432076288776830805155076"
-            "20245292955241189266486323192680957485559243678"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "55c8147ec0a38d85486a67941cd67e3a92f5b1fa177b15bd4e315e365e39ac19c1"
+            "7f37c25cb5cdecdcac262f7b88e2"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[10] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "258664426012969093929703085429980814127835149614277183275038967946"
-            "009968870203535512256352201271898244626862047232"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "4663a2a83dd119effc4d11826f20dc1e8a71ae63e00a8704191258bc8619233e0d"
+            "38ef753d5865aa3baf925a7b868e"),
+        bls12_377_Fq::zero());
     bls12_377_Fq12::Frobenius_coeffs_c1[11] = bls12_377_Fq2(
-        bls12_377_Fq(
-            "135148009893022339379906188398761468584194992116912126664040619889"
-            "416147222474808140862391813728516072597320238031"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "1306f19ff2877fd2790ee45b226806ccda1e0bcc1b54fd314db82e63230f6cfbde"
+            "f8bf12b1eb0125ba1262ad3735380"),
+        bls12_377_Fq::zero());
 
     // Choice of short Weierstrass curve and its twist
     // E(Fq): y^2 = x^3 + 1
-    bls12_377_coeff_b = bls12_377_Fq("1");
+    bls12_377_coeff_b = bls12_377_Fq::one();
     // We use a type-D twist here, E'(Fq2): y^2 = x^3 + 1/u
-    bls12_377_twist = bls12_377_Fq2(bls12_377_Fq("0"), bls12_377_Fq("1"));
+    bls12_377_twist = bls12_377_Fq2(bls12_377_Fq::zero(), bls12_377_Fq::one());
     bls12_377_twist_coeff_b = bls12_377_coeff_b * bls12_377_twist.inverse();
 
     bls12_377_twist_mul_by_b_c0 =
@@ -308,26 +315,27 @@ void init_bls12_377_params()
     bls12_377_twist_mul_by_b_c1 =
         bls12_377_coeff_b * bls12_377_Fq2::non_residue;
     bls12_377_twist_mul_by_q_X = bls12_377_Fq2(
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410946"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "4702bf3ac023805cf848adfdcd640c5cc426090a9c587e9b64a150cdf726cf1333"
+            "66940ac2a74b5892506da58478da"),
+        bls12_377_Fq::zero());
     bls12_377_twist_mul_by_q_Y = bls12_377_Fq2(
-        bls12_377_Fq(
-            "216465761340224619389371505802605247630151569547285782856803747159"
-            "100223055385581585702401816380679166954762214499"),
-        bls12_377_Fq("0"));
+        bls12_377_Fq::from_montgomery_hex(
+            "158723199046d5d40f29b58d88472bcdf8fe44106dd987961a530d183ab0e53fd4"
+            "9de0c6da34a32982c13d9d084771f"),
+        bls12_377_Fq::zero());
 
     // Choice of group G1
     // Identities
     bls12_377_G1::G1_zero = bls12_377_G1(
         bls12_377_Fq::zero(), bls12_377_Fq::one(), bls12_377_Fq::zero());
     bls12_377_G1::G1_one = bls12_377_G1(
-        bls12_377_Fq(
-            "819379993731509642399382555734659482399886715026479765942196956448"
-            "55304257327692006745978603320413799295628339695"),
-        bls12_377_Fq(
-            "241266749859715473739788878240585681733927191168601896383759122102"
-            "112907357779751001206799952863815012735208165030"),
+        bls12_377_Fq::from_montgomery_hex(
+            "a41206b361fd4dc97d78cc6f065272761662e4425e16985c1551c469a510ddc54d"
+            "d773169d5658260f33b9772451f4"),
+        bls12_377_Fq::from_montgomery_hex(
+            "7da93326303c712ec3ddb401d52814c27849e2d655cd18fafaf3dad4daf54a0063"
+            "8d4c5f44adb88193961fb8cb81f3"),
         bls12_377_Fq::one());
 
     // Curve coeffs
@@ -335,28 +343,30 @@ void init_bls12_377_params()
     bls12_377_G1::coeff_b = bls12_377_coeff_b;
 
     // Trace of Frobenius
-    bls12_377_trace_of_frobenius = bigint_r("9586122913090633730");
+    bls12_377_trace_of_frobenius = bigint_r::from_hex("8508c00000000002");
 
     // Cofactor
-    bls12_377_G1::h =
-        bigint<bls12_377_G1::h_limbs>("30631250834960419227450344600217059328");
+    bls12_377_G1::h = bigint<bls12_377_G1::h_limbs>::from_hex(
+        "170b5d44300000000000000000000000");
 
     // G1 fast subgroup check:  0 == [c0]P + [c1]sigma(P)
-    bls12_377_g1_endomorphism_beta =
-        bls12_377_Fq("809496482649127194085583631406374772648452947207104994781"
-                     "37287262712535938301461879813459410945");
-    bls12_377_g1_safe_subgroup_check_c1 =
-        bigint_r("91893752504881257701523279626832445441");
+    bls12_377_g1_endomorphism_beta = bls12_377_Fq::from_montgomery_hex(
+        "167d6a36f873fd0d63eb8aeea32285efb9868449d1509081ada4fd6fd832edcd8fe245"
+        "4bac2a79adacd106da5847973");
+    bls12_377_g1_safe_subgroup_check_c1 = bigint_r::from_hex(
+        "452217cc900000010a11800000000001");
 
     // G1 proof of subgroup: values used to generate x' s.t. [r]x' = x.
-    bls12_377_g1_proof_of_safe_subgroup_w =
-        bigint_r("5285428838741532253824584287042945485047145357130994810877");
-    bls12_377_g1_proof_of_safe_subgroup_non_member_x = bls12_377_Fq(
-        "5579135224678387240478846790990709250936401022990388020368969649878761"
-        "5734938123558571181995209025075818229621722");
-    bls12_377_g1_proof_of_safe_subgroup_non_member_y = bls12_377_Fq(
-        "1743638558335201382296667234848353486892365850134605544446097301206037"
-        "41818916846216286948728983932214174344518655");
+    bls12_377_g1_proof_of_safe_subgroup_w = bigint_r::from_hex(
+        "d78e73ad8a538805abcbf3c7d00000095a9d7ffffffffffd");
+    bls12_377_g1_proof_of_safe_subgroup_non_member_x =
+        bls12_377_Fq::from_montgomery_hex(
+            "357cb26ce15873513b9a132f566f933c58c572361d9a821744286a1bbe07b3c857"
+            "cfd4b57fd8c924c2ce6227076df2");
+    bls12_377_g1_proof_of_safe_subgroup_non_member_y =
+        bls12_377_Fq::from_montgomery_hex(
+            "5e30dee86f6cb73ccf200cdf06e9fa1fbf830fe273a6deb8577be56c5a5b08eea7"
+            "3f8eee374c1950ab12806fccfe1b");
 
     // WNAF
     //
@@ -429,19 +439,19 @@ void init_bls12_377_params()
         bls12_377_Fq2::zero(), bls12_377_Fq2::one(), bls12_377_Fq2::zero());
     bls12_377_G2::G2_one = bls12_377_G2(
         bls12_377_Fq2(
-            bls12_377_Fq(
-                "11158394577469511644391122625782382343446874024988304283774515"
-                "1039122196680777376765707574547389190084887628324746"),
-            bls12_377_Fq(
-                "12906698065670308551815730115433521588608211252437868655587316"
-                "1080604845924984124025594590925548060469686767592854")),
+            bls12_377_Fq::from_montgomery_hex(
+                "15ead1503da667281c40f8c210db8138ed35eb4287ea298623934ef8ba45cb"
+                "f48e9417f5f7b1b42e13fbf09e0ea512"),
+            bls12_377_Fq::from_montgomery_hex(
+                "1115c5dd3454f465452b67a5fb158d811cbe4d469c5b92ea852607f848ce02"
+                "029ca32141215fcfcf3383c3ec1c34f21")),
         bls12_377_Fq2(
-            bls12_377_Fq(
-                "16886329972466897718302994134759646260897838050396510334100391"
-                "8678547611204475537878680436662916294540335494194722"),
-            bls12_377_Fq(
-                "23389249728747576225133535189361842960367292146986439276751455"
-                "2093535653615809913098097380147379993375817193725968")),
+            bls12_377_Fq::from_montgomery_hex(
+                "1e70e2732488b38a86a2ce5285a01fe1095089c852c552dbe6b35e67dd3b20"
+                "af319ebc5fd13f26d91002dd10ddb504"),
+            bls12_377_Fq::from_montgomery_hex(
+                "17edd4fd3901446e6268934c4b778d1cc564d1da387d11c346bfdd5cd9f303"
+                "47ceac813978c9586095d999c4de04360")),
         bls12_377_Fq2::one());
 
     // Curve twist coeffs
@@ -449,10 +459,9 @@ void init_bls12_377_params()
     bls12_377_G2::coeff_b = bls12_377_twist_coeff_b;
 
     // Cofactor
-    bls12_377_G2::h = bigint<bls12_377_G2::h_limbs>(
-        "7923214915284317143930293550643874566881017850177945424769256759165301"
-        "4366169332282092779667740924864672894786184047614126306918357646745593"
-        "76407658497");
+    bls12_377_G2::h = bigint<bls12_377_G2::h_limbs>::from_hex(
+        "26ba558ae9562addd88d99a6f6a829fbb36b00e1dcc40c8c505634fae2e189d693e8c3"
+        "6676bd09a0f3622fba094800452217cc900000000000000000000001");
 
     // Untwist-Frobenius-Twist coefficients
     bls12_377_Fq12 untwist_frobenius_twist_w =
@@ -467,10 +476,10 @@ void init_bls12_377_params()
         bls12_377_g2_untwist_frobenius_twist_w_3.inverse();
 
     // Fast cofactor multiplication coefficients
-    bls12_377_g2_mul_by_cofactor_h2_0 =
-        bigint_r("293634935485640680722085584138834120318524213360527933441");
-    bls12_377_g2_mul_by_cofactor_h2_1 =
-        bigint_r("30631250834960419227450344600217059328");
+    bls12_377_g2_mul_by_cofactor_h2_0 = bigint_r::from_hex(
+        "bf9b117dd04a4002e16ba88600000000000000000000001");
+    bls12_377_g2_mul_by_cofactor_h2_1 = bigint_r::from_hex(
+        "170b5d44300000000000000000000000");
 
     // G2 wNAF window table
     bls12_377_G2::wnaf_window_table.resize(0);
@@ -535,31 +544,28 @@ void init_bls12_377_params()
     //   u = 2**63 + 2**58 + 2**56 + 2**51 + 2**47 + 2**46 + 1
     // Based on the power-2 decomposition of u, we should have 63 doubling
     // steps and 7 addition steps in the Miller Loop.
-    bls12_377_ate_loop_count = bigint_q("9586122913090633729");
+    bls12_377_ate_loop_count = bigint_q::from_hex("8508c00000000001");
     bls12_377_ate_is_loop_count_neg = false;
     // k (embedding degree) = 12
     // bls12_377_final_exponent = (q^12 - 1) / r
-    bls12_377_final_exponent = bigint<12 * bls12_377_q_limbs>(
-        "1062352101801986048825403166370756842879803290512381119957121396507912"
-        "9114663661236359849629341526275899063345613340067081670062620727617884"
-        "1374877547391501474912045595142051864923855902722089344674614449446527"
-        "1100516937116825006879082077612477209563023710218982773301998983506333"
-        "4551453893534663070786533932633573962932272563471643288531959637300817"
-        "0702655374295064848809909810690412694053835028896773570820128072985299"
-        "3111812442856905982234628974507740157013415744497327152098177404714691"
-        "8354408632568723153146248333028827919406785654402107153546667815607201"
-        "4885908324782254034441364093498774812681548179045413406141732619497724"
-        "0306092432436686172324518261985938925498500823600746581427336149713413"
-        "8868945580557938161335670207544906643574043606819537336472235809927599"
-        "6281232753142880061708040445602386764639316393397119131110809745825932"
-        "2813870415432059977568309560404130900019702541996812571801831180595931"
-        "5220036948621879242495199408833915486421612374480018459896018440926235"
-        "2618246549569323848592604793727760229797367342216290972978901546921944"
-        "4152846277021881179562447110897237757369083391323126054783555085125681"
-        "7740247389770320334698430697237343583761719223414894063451411431859122"
-        "7384883115800054127650702518101599918971109363249432325268702807248769"
-        "46523218213525646968094720");
-    bls12_377_final_exponent_z = bigint_q("9586122913090633729");
+    bls12_377_final_exponent = bigint<12 * bls12_377_q_limbs>::from_hex(
+        "1b2ff68c1abdc48ab4f04ed12cc8f9b2f161b41c7eb8865b9ad3c9bb0571dd94c6bde6"
+        "6548dc13624d9d741024ceb315f46a89cc2482605eb6afc6d8977e5e2ccbec348dd362"
+        "d59ec2b5bc62a1b467ae44572215548abc98bb4193886ed89cceaedd0221aba84fb33e"
+        "5584ac29619a87a00c315178155496857c995eab4a8a9af95f4015db27955ae408d692"
+        "7d0ab37d52f3917c4ddec88f8159f7bcba7eb65f1aae4eeb4e70cb20227159c08a7fdf"
+        "ea9b62bb308918eac3202569dd1bcdd86b431e3646356fc3fb79f89b30775e006993ad"
+        "b629586b6c874b7688f86f11ef7ad94a40eb020da3c532b317232fa56dc564637b331a"
+        "8e8832eab84269f00b506602c8594b7f7da5a5d8d851fff6ab1d38a354fc8e0b8958e2"
+        "a9e5ce2d7e50ec36d761d9505fe5e1f317257e2df2952fcd4c93b85278c20488b4ccae"
+        "e94db3fec1ce8283473e4b493843fa73abe99af8bafce29170b2b863b9513b5a473129"
+        "91f60c5a4f6872b5d574212bf00d797c0bea3c0f7dfd748e63679fda9b1c50f2df74de"
+        "38f38e004ae0df997a10db31d209cacbf58ba0678bfe7cd0985bc43258d72d8d5106c2"
+        "1635ae1e527eb01fca3032d50d97756ec9ee756eaba7f21652a808a4e2539e838ef7ec"
+        "4b178b29e3b976c46bd0ecdd32c1fb75e6e0aef2d8b5661f595a98023f3520381aba8d"
+        "a6cce785dbb0a0bba025478d75ee749619cdb7c42a21098ece86a00c6c2046c1e00000"
+        "063c69000000000000");
+    bls12_377_final_exponent_z = bigint_q::from_hex("8508c00000000001");
     bls12_377_final_exponent_is_z_neg = false;
 }
 
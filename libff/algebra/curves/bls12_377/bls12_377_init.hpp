@@ -32,16 +32,16 @@ const mp_size_t bls12_377_q_limbs =
 // Declare the r modulus from bw6_761_modulus_r. We must instantiate the field
 // model templates using references to the SAME bigint, otherwise Fr<bw6_761_pp>
 // and Fq<bls12_377_pp> are different types (see the Fp_model type parameters).
-extern bigint<bls12_377_q_limbs> bw6_761_modulus_r;
+extern const bigint<bls12_377_q_limbs> bw6_761_modulus_r;
 
-extern bigint<bls12_377_r_limbs> bls12_377_modulus_r;
+extern const bigint<bls12_377_r_limbs> bls12_377_modulus_r;
 // Ideally, we would use a reference:
 //
-//   bigint<bls12_377_q_limbs> &bls12_377_modulus_q = bw6_761_modulus_r;
+//   const bigint<bls12_377_q_limbs> &bls12_377_modulus_q = bw6_761_modulus_r;
 //
 // but bls12_377_modulus_q cannot then be used as a template parameter. We are
-// forced to use a macro. Note that bw6_761_modulus_r is initialized by both
-// bw6_761_init() and bls12_377_init() (whether references or macros are used).
+// forced to use a macro. Note that bw6_761_modulus_r is a constant defined in
+// bw6_761_init.cpp, so it is valid regardless of which curve is initialized.
 #define bls12_377_modulus_q bw6_761_modulus_r
 
 typedef Fp_model<bls12_377_r_limbs, bls12_377_modulus_r> bls12_377_Fr;
@@ -5,8 +5,13 @@
 namespace libff
 {
 
-bigint<bls12_381_r_limbs> bls12_381_modulus_r;
-bigint<bls12_381_q_limbs> bls12_381_modulus_q;
+constexpr bigint<bls12_381_r_limbs> bls12_381_modulus_r =
+    bigint<bls12_381_r_limbs>::from_hex(
+        "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001");
+constexpr bigint<bls12_381_q_limbs> bls12_381_modulus_q =
+    bigint<bls12_381_q_limbs>::from_hex(
+        "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabff"
+        "feb153ffffb9feffffffffaaab");
 
 bls12_381_Fq bls12_381_coeff_b;
 bigint<bls12_381_r_limbs> bls12_381_trace_of_frobenius;
@@ -33,311 +38,286 @@ void init_bls12_381_params()
 
     /* parameters for scalar field Fr */
 
-    bls12_381_modulus_r = bigint_r("5243587517512619047944774050818596583769055"
-                                   "2500527637822603658699938581184513");
     assert(bls12_381_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bls12_381_Fr::Rsquared =
-            bigint_r("329490647479426544212979752063071073927857568219980068178"
-                     "8903916070560242797");
-        bls12_381_Fr::Rcubed =
-            bigint_r("498292539885403193545507422492760844601274463553159150895"
-                     "27227471280320770991");
+        bls12_381_Fr::Rsquared = bigint_r::from_hex(
+            "748d9d99f59ff1105d314967254398f2b6cedcb87925c23c999e990f3f29c6d");
+        bls12_381_Fr::Rcubed = bigint_r::from_hex(
+            "6e2a5bb9c8db33e973d13c71c7b5f4181b3e0d188cf06990c62c1807439b73af");
         bls12_381_Fr::inv = 0xfffffffeffffffff; // (-1/modulus) mod W
     }
     if (sizeof(mp_limb_t) == 4) {
-        bls12_381_Fr::Rsquared =
-            bigint_r("329490647479426544212979752063071073927857568219980068178"
-                     "8903916070560242797");
-        bls12_381_Fr::Rcubed =
-            bigint_r("498292539885403193545507422492760844601274463553159150895"
-                     "27227471280320770991");
+        bls12_381_Fr::Rsquared = bigint_r::from_hex(
+            "748d9d99f59ff1105d314967254398f2b6cedcb87925c23c999e990f3f29c6d");
+        bls12_381_Fr::Rcubed = bigint_r::from_hex(
+            "6e2a5bb9c8db33e973d13c71c7b5f4181b3e0d188cf06990c62c1807439b73af");
         bls12_381_Fr::inv = 0xffffffff;
     }
     bls12_381_Fr::num_bits = 255;
-    bls12_381_Fr::euler = bigint_r("2621793758756309523972387025409298291884527"
-                                   "6250263818911301829349969290592256");
+    bls12_381_Fr::euler = bigint_r::from_hex(
+        "39f6d3a994cebea4199cec0404d0ec02a9ded2017fff2dff7fffffff80000000");
     bls12_381_Fr::s = 32;
-    bls12_381_Fr::t = bigint_r(
-        "12208678567578594777604504606729831043093128246378069236549469339647");
-    bls12_381_Fr::t_minus_1_over_2 = bigint_r(
-        "6104339283789297388802252303364915521546564123189034618274734669823");
-    bls12_381_Fr::multiplicative_generator = bls12_381_Fr("7");
-    bls12_381_Fr::root_of_unity =
-        bls12_381_Fr("102382273577394958236510305758492320625588601802844775411"
-                     "89508159991286009131");
-    bls12_381_Fr::nqr = bls12_381_Fr("5");
-    bls12_381_Fr::nqr_to_t =
-        bls12_381_Fr("937917089079007706106976984802249742464848817460758522850"
-                     "752807661925904159");
+    bls12_381_Fr::t = bigint_r::from_hex(
+        "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff");
+    bls12_381_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "39f6d3a994cebea4199cec0404d0ec02a9ded2017fff2dff7fffffff");
+    bls12_381_Fr::multiplicative_generator = bls12_381_Fr::from_montgomery_hex(
+        "351332208fc5a8c4ff9c57876f8457b017e363d300189c0f0000000efffffff1");
+    bls12_381_Fr::root_of_unity = bls12_381_Fr::from_montgomery_hex(
+        "5bf3adda19e9b27b0af53ae352a31e645b1b4c801819d7ecb9b58d8c5f0e466a");
+    bls12_381_Fr::nqr = bls12_381_Fr::from_montgomery_hex(
+        "4c9cf6d363b9de5cc83b7a7960bb7c566d9f3df00120c0b0000000afffffff5");
+    bls12_381_Fr::nqr_to_t = bls12_381_Fr::from_montgomery_hex(
+        "3f0ee990743a3b6a0d6db230471dd5051ce1e93dfd4b71e59cab6d5c0c17f47c");
     bls12_381_Fr::static_init();
 
     /* parameters for base field Fq */
-    bls12_381_modulus_q =
-        bigint_q("4002409555221667393417789825735904156556882819939007885332058"
-                 "136124031650490837864442687629129015664037894272559787");
     assert(bls12_381_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bls12_381_Fq::Rsquared = bigint_q(
-            "270826391065473017479378762632817651183645519716631767700615429398"
-            "2164122222515399004018013397331347120527951271750"); // k=6
-        bls12_381_Fq::Rcubed = bigint_q(
-            "163906754277462589423671657554808490593875383721159409588363701458"
-            "2201460755008380976950835174037649440777609978336");
+        bls12_381_Fq::Rsquared = bigint_q::from_hex(
+            "11988fe592cae3aa9a793e85b519952d67eb88a9939d83c08de5476c4c95b6d50a"
+            "76e6a609d104f1f4df1f341c341746"); // k=6
+        bls12_381_Fq::Rcubed = bigint_q::from_hex(
+            "aa6346091755d4d2512d4356572472834c04e5e921e17619a53352a615e29dd315"
+            "f831e03a7adf8ed48ac6bd94ca1e0");
 
         bls12_381_Fq::inv = 0x89f3fffcfffcfffd;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bls12_381_Fq::Rsquared = bigint_q(
-            "270826391065473017479378762632817651183645519716631767700615429398"
-            "2164122222515399004018013397331347120527951271750");
-        bls12_381_Fq::Rcubed = bigint_q(
-            "163906754277462589423671657554808490593875383721159409588363701458"
-            "2201460755008380976950835174037649440777609978336");
+        bls12_381_Fq::Rsquared = bigint_q::from_hex(
+            "11988fe592cae3aa9a793e85b519952d67eb88a9939d83c08de5476c4c95b6d50a"
+            "76e6a609d104f1f4df1f341c341746");
+        bls12_381_Fq::Rcubed = bigint_q::from_hex(
+            "aa6346091755d4d2512d4356572472834c04e5e921e17619a53352a615e29dd315"
+            "f831e03a7adf8ed48ac6bd94ca1e0");
         bls12_381_Fq::inv = 0xfffcfffd;
     }
     bls12_381_Fq::num_bits = 381;
-    bls12_381_Fq::euler =
-        bigint_q("2001204777610833696708894912867952078278441409969503942666029"
-                 "068062015825245418932221343814564507832018947136279893");
+    bls12_381_Fq::euler = bigint_q::from_hex(
+        "d0088f51cbff34d258dd3db21a5d66bb23ba5c279c2895fb39869507b587b120f55fff"
+        "f58a9ffffdcff7fffffffd555");
     bls12_381_Fq::s = 1;
-    bls12_381_Fq::t =
-        bigint_q("2001204777610833696708894912867952078278441409969503942666029"
-                 "068062015825245418932221343814564507832018947136279893");
-    bls12_381_Fq::t_minus_1_over_2 =
-        bigint_q("1000602388805416848354447456433976039139220704984751971333014"
-                 "534031007912622709466110671907282253916009473568139946");
-    bls12_381_Fq::multiplicative_generator = bls12_381_Fq("2");
-    bls12_381_Fq::root_of_unity = bls12_381_Fq(
-        "4002409555221667393417789825735904156556882819939007885332058136124031"
-        "650490837864442687629129015664037894272559786");
-    bls12_381_Fq::nqr = bls12_381_Fq("2");
-    bls12_381_Fq::nqr_to_t = bls12_381_Fq(
-        "4002409555221667393417789825735904156556882819939007885332058136124031"
-        "650490837864442687629129015664037894272559786");
+    bls12_381_Fq::t = bigint_q::from_hex(
+        "d0088f51cbff34d258dd3db21a5d66bb23ba5c279c2895fb39869507b587b120f55fff"
+        "f58a9ffffdcff7fffffffd555");
+    bls12_381_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "680447a8e5ff9a692c6e9ed90d2eb35d91dd2e13ce144afd9cc34a83dac3d8907aafff"
+        "fac54ffffee7fbfffffffeaaa");
+    bls12_381_Fq::multiplicative_generator = bls12_381_Fq::from_montgomery_hex(
+        "11ebab9dbb81e28c6cf28d7901622c038b256521ed1f9bcb57605e0db0ddbb51b93c00"
+        "18d6c40005321300000006554f");
+    bls12_381_Fq::root_of_unity = bls12_381_Fq::from_montgomery_hex(
+        "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b7fff"
+        "2ed47fffd43f5fffffffcaaae");
+    bls12_381_Fq::nqr = bls12_381_Fq::from_montgomery_hex(
+        "11ebab9dbb81e28c6cf28d7901622c038b256521ed1f9bcb57605e0db0ddbb51b93c00"
+        "18d6c40005321300000006554f");
+    bls12_381_Fq::nqr_to_t = bls12_381_Fq::from_montgomery_hex(
+        "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b7fff"
+        "2ed47fffd43f5fffffffcaaae");
     bls12_381_Fq::static_init();
 
     /* parameters for twist field Fq2 */
-    bls12_381_Fq2::euler = bigint<2 * bls12_381_q_limbs>(
-        "8009641123864852705971874322159486308847560049665276329931192268492988"
-        "3742456785717003280396510967149874771927700853652655519422698534529681"
-        "0010121051821790554650651713590637900820398474816583070927051183888744"
-        "9985712996744742684");
+    bls12_381_Fq2::euler = bigint<2 * bls12_381_q_limbs>::from_hex(
+        "1521bd25c61afe3a5e93c75511792f4f16e48728738235a3372cf249a4f45e82853167"
+        "e8b6ee5377a98a49984bc77808eb430ce430c2e3d949742d43848d024b35fc8f69f38d"
+        "ba18b1619c1b1089e7ebe76b58ebb1c1755935500000e38c71c");
     bls12_381_Fq2::s = 3;
-    bls12_381_Fq2::t = bigint<2 * bls12_381_q_limbs>(
-        "2002410280966213176492968580539871577211890012416319082482798067123247"
-        "0935614196429250820099127741787468692981925213413163879855674633632420"
-        "2502530262955447638662662928397659475205099618704145767731762795972186"
-        "2496428249186185671");
-    bls12_381_Fq2::t_minus_1_over_2 = bigint<2 * bls12_381_q_limbs>(
-        "1001205140483106588246484290269935788605945006208159541241399033561623"
-        "5467807098214625410049563870893734346490962606706581939927837316816210"
-        "1251265131477723819331331464198829737602549809352072883865881397986093"
-        "1248214124593092835");
-    bls12_381_Fq2::non_residue = bls12_381_Fq(
-        "4002409555221667393417789825735904156556882819939007885332058136124031"
-        "650490837864442687629129015664037894272559786");
+    bls12_381_Fq2::t = bigint<2 * bls12_381_q_limbs>::from_hex(
+        "5486f497186bf8e97a4f1d5445e4bd3c5b921ca1ce08d68cdcb3c92693d17a0a14c59f"
+        "a2dbb94ddea62926612f1de023ad0c3390c30b8f6525d0b50e1234092cd7f23da7ce36"
+        "e862c586706c42279faf9dad63aec705d564d54000038e31c7");
+    bls12_381_Fq2::t_minus_1_over_2 = bigint<2 * bls12_381_q_limbs>::from_hex(
+        "2a437a4b8c35fc74bd278eaa22f25e9e2dc90e50e7046b466e59e49349e8bd050a62cf"
+        "d16ddca6ef53149330978ef011d68619c86185c7b292e85a87091a04966bf91ed3e71b"
+        "743162c338362113cfd7ced6b1d76382eab26aa00001c718e3");
+    bls12_381_Fq2::non_residue = bls12_381_Fq::from_montgomery_hex(
+        "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b7fff"
+        "2ed47fffd43f5fffffffcaaae");
     bls12_381_Fq2::nqr =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("1")); // u+1
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::one()); // u+1
     bls12_381_Fq2::nqr_to_t = bls12_381_Fq2(
-        bls12_381_Fq(
-            "102873214623510634997532447921579527738483993692975789615564311803"
-            "2610843298655225875571310552543014690878354869257"),
-        bls12_381_Fq(
-            "297367740898656104344246534652010887917204288300924998917641501809"
-            "1420807192182638567116318576472649347015917690530"));
-    bls12_381_Fq2::Frobenius_coeffs_c1[0] = bls12_381_Fq("1");
-    bls12_381_Fq2::Frobenius_coeffs_c1[1] = bls12_381_Fq(
-        "4002409555221667393417789825735904156556882819939007885332058136124031"
-        "650490837864442687629129015664037894272559786");
+        bls12_381_Fq::from_montgomery_hex(
+            "e2b7eedbbfd87d22da2596696cebc1dd1ca2087da74d4a72f088dd86b4ebef1dc1"
+            "7dec12a927e7c7bcfa7a25aa30fda"),
+        bls12_381_Fq::from_montgomery_hex(
+            "bd592fc7d825ec81d794e4fac7cf0b992ad2afd19103e18382844c88b623732429"
+            "4213d86c181833e2f585da55c9ad1"));
+    bls12_381_Fq2::Frobenius_coeffs_c1[0] = bls12_381_Fq::one();
+    bls12_381_Fq2::Frobenius_coeffs_c1[1] = bls12_381_Fq::from_montgomery_hex(
+        "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b7fff"
+        "2ed47fffd43f5fffffffcaaae");
+    bls12_381_Fq2::half = bls12_381_Fq::from_montgomery_hex(
+        "17fbb8571a006596d3916126f2d14ca26e22d1ec31ebb502633cb57c253c276f8550"
+        "00053ab000011804000000015554");
+    bls12_381_Fq2::non_residue_inverse = bls12_381_Fq::from_montgomery_hex(
+        "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b7fff"
+        "2ed47fffd43f5fffffffcaaae");
+    // non_residue = -1
+    bls12_381_Fq2::sqrt_minus_non_residue = bls12_381_Fq::one();
+    bls12_381_Fq2::sqrt_minus_non_residue_inverse = bls12_381_Fq::one();
     bls12_381_Fq2::static_init();
 
     /* parameters for Fq6 */
 
-    bls12_381_Fq6::euler = bigint<6 * bls12_381_q_limbs>(
-        "2055413310034685917547178203792332860309200402936847589812920000288065"
-        "0925292078031236336437155417867098264344518387365893430771451315477306"
-        "7723923870911995741881272581302001907244790574962263945847542833396860"
-        "73743682966778056496"
-        "2327945395707855461784923849488018385374868097169740055671857527378364"
-        "8469851242261268044817816320342666827076722752447529192782544353128746"
-        "1471193084577848300836833318729082346882823602164341569076593462295099"
-        "0371613607731757827"
-        "4075669149520898024347473697702653612215721050521068924301068068177428"
-        "7151859717713146107915044671570816889418683602912643322766216203471482"
-        "2884004062053629214182533388992931530312083763262100940571236423950189"
-        "3128509197213249204");
+    bls12_381_Fq6::euler = bigint<6 * bls12_381_q_limbs>::from_hex(
+        "9371d4e7304d0fa4e62ebc88e887916a3f47a64530ea5faec3b80a5aafb02f61c5c7a2"
+        "0f03ae29c52eb22b534e3dbd4264a36a407bec8ab42986cc5f0c3ee6808960b8b614e3"
+        "4fc6c6934a17eb72ef9a7c05b237181fc24afc603a2a5dc4677dde5a59854f6e67aee6"
+        "95d7bb0b68ec70f121a055ebd05832d6abc880e11c1d74beb721510ef1d1c9e38fdd51"
+        "54b7f3f660306e020b22d026c5ac4f177057477b37b27e1cf1c67248f2ca3cf9783250"
+        "b4f6bdf093229e30754f3ed447c3d2467ff1b5f0ceb167594d5e7b1c9939b468717fb3"
+        "abb906c3a9e629de10b644e8882560d2f0e80b754895fd5a45655188961fd7f73945e3"
+        "2de373135fbae98d8f11125475cb554cdebd9d5adc635cac21f144d079fa5f96f6364c"
+        "231e0382eb4");
     bls12_381_Fq6::s = 3;
-    bls12_381_Fq6::t = bigint<6 * bls12_381_q_limbs>(
-        "5138533275086714793867945509480832150773001007342118974532300000720162"
-        "7313230195078090841092888544667745660861295968414733576928628288693266"
-        "9309809677279989354703181453255004768111976437405659864618857083492151"
-        "8435920741694514124"
-        "0581986348926963865446230962372004596343717024292435013917964381844591"
-        "2117462810565317011204454080085666706769180688111882298195636088282186"
-        "5367798271144462075209208329682270586720705900541085392269148365573774"
-        "7592903401932939456"
-        "8518917287380224506086868424425663403053930262630267231075267017044357"
-        "1787964929428286526978761167892704222354670900728160830691554050867870"
-        "5721001015513407303545633347248232882578020940815525235142809105987547"
-        "3282127299303312301");
-    bls12_381_Fq6::t_minus_1_over_2 = bigint<6 * bls12_381_q_limbs>(
-        "2569266637543357396933972754740416075386500503671059487266150000360081"
-        "3656615097539045420546444272333872830430647984207366788464314144346633"
-        "4654904838639994677351590726627502384055988218702829932309428541746075"
-        "9217960370847257062"
-        "0290993174463481932723115481186002298171858512146217506958982190922295"
-        "6058731405282658505602227040042833353384590344055941149097818044141093"
-        "2683899135572231037604604164841135293360352950270542696134574182786887"
-        "3796451700966469728"
-        "4259458643690112253043434212212831701526965131315133615537633508522178"
-        "5893982464714143263489380583946352111177335450364080415345777025433935"
-        "2860500507756703651772816673624116441289010470407762617571404552993773"
-        "6641063649651656150");
+    bls12_381_Fq6::t = bigint<6 * bls12_381_q_limbs>::from_hex(
+        "24dc7539cc1343e9398baf223a21e45a8fd1e9914c3a97ebb0ee0296abec0bd87171e8"
+        "83c0eb8a714bac8ad4d38f6f509928da901efb22ad0a61b317c30fb9a022582e2d8538"
+        "d3f1b1a4d285fadcbbe69f016c8dc607f092bf180e8a977119df7796966153db99ebb9"
+        "a575eec2da3b1c3c4868157af4160cb5aaf2203847075d2fadc85443bc747278e3f754"
+        "552dfcfd980c1b8082c8b409b16b13c5dc15d1decdec9f873c719c923cb28f3e5e0c94"
+        "2d3daf7c24c8a78c1d53cfb511f0f4919ffc6d7c33ac59d653579ec7264e6d1a1c5fec"
+        "eaee41b0ea798a77842d913a22095834bc3a02dd52257f56915954622587f5fdce5178"
+        "cb78dcc4d7eeba6363c444951d72d55337af6756b718d72b087c51341e7e97e5bd8d93"
+        "08c780e0bad");
+    bls12_381_Fq6::t_minus_1_over_2 = bigint<6 * bls12_381_q_limbs>::from_hex(
+        "126e3a9ce609a1f49cc5d7911d10f22d47e8f4c8a61d4bf5d877014b55f605ec38b8f4"
+        "41e075c538a5d6456a69c7b7a84c946d480f7d91568530d98be187dcd0112c1716c29c"
+        "69f8d8d26942fd6e5df34f80b646e303f8495f8c07454bb88cefbbcb4b30a9edccf5dc"
+        "d2baf7616d1d8e1e24340abd7a0b065ad579101c2383ae97d6e42a21de3a393c71fbaa"
+        "2a96fe7ecc060dc041645a04d8b589e2ee0ae8ef66f64fc39e38ce491e59479f2f064a"
+        "169ed7be126453c60ea9e7da88f87a48cffe36be19d62ceb29abcf639327368d0e2ff6"
+        "757720d8753cc53bc216c89d1104ac1a5e1d016ea912bfab48acaa3112c3fafee728bc"
+        "65bc6e626bf75d31b1e2224a8eb96aa99bd7b3ab5b8c6b95843e289a0f3f4bf2dec6c9"
+        "8463c0705d6");
     bls12_381_Fq6::non_residue =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("1"));
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::one());
     bls12_381_Fq6::nqr = bls12_381_Fq6(
         bls12_381_Fq2::one(), bls12_381_Fq2::one(), bls12_381_Fq2::zero());
-    bls12_381_Fq temp_Fq6 = bls12_381_Fq(
-        "2973677408986561043442465346520108879172042883009249989176415018091420"
-        "807192182638567116318576472649347015917690530");
+    bls12_381_Fq temp_Fq6 = bls12_381_Fq::from_montgomery_hex(
+        "bd592fc7d825ec81d794e4fac7cf0b992ad2afd19103e18382844c88b6237324294213"
+        "d86c181833e2f585da55c9ad1");
     bls12_381_Fq6::nqr_to_t = bls12_381_Fq6(
         bls12_381_Fq2(temp_Fq6, temp_Fq6),
         bls12_381_Fq2::zero(),
         bls12_381_Fq2::zero());
     bls12_381_Fq6::Frobenius_coeffs_c1[0] =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("0"));
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c1[1] = bls12_381_Fq2(
-        bls12_381_Fq("0"),
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939436"));
+        bls12_381_Fq::zero(),
+        bls12_381_Fq::from_montgomery_hex(
+            "18f020655463874103f97d6e83d050d28eb60ebe01bacb9e587042afd3851b955d"
+            "ab22461fcda5d2cd03c9e48671f071"));
     bls12_381_Fq6::Frobenius_coeffs_c1[2] = bls12_381_Fq2(
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620350"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "51ba4ab241b61603636b76660701c6ec26a2ff874fd029b16a8ca3ac61577f7f3b"
+            "8ddab7ece5a2a30f1361b798a64e8"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c1[3] =
-        bls12_381_Fq2(bls12_381_Fq("0"), bls12_381_Fq("1"));
+        bls12_381_Fq2(bls12_381_Fq::zero(), bls12_381_Fq::one());
     bls12_381_Fq6::Frobenius_coeffs_c1[4] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939436"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "18f020655463874103f97d6e83d050d28eb60ebe01bacb9e587042afd3851b955d"
+            "ab22461fcda5d2cd03c9e48671f071"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c1[5] = bls12_381_Fq2(
-        bls12_381_Fq("0"),
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620350"));
+        bls12_381_Fq::zero(),
+        bls12_381_Fq::from_montgomery_hex(
+            "51ba4ab241b61603636b76660701c6ec26a2ff874fd029b16a8ca3ac61577f7f3b"
+            "8ddab7ece5a2a30f1361b798a64e8"));
     bls12_381_Fq6::Frobenius_coeffs_c2[0] =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("0"));
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c2[1] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939437"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "14e56d3f1564853a14e4f04fe2db9068a20d1b8c7e88102450880866309b7e2c2a"
+            "f322533285a5d5890dc9e4867545c3"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c2[2] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939436"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "18f020655463874103f97d6e83d050d28eb60ebe01bacb9e587042afd3851b955d"
+            "ab22461fcda5d2cd03c9e48671f071"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c2[3] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739341778982573590415655688281993900788533205813612"
-            "4031650490837864442687629129015664037894272559786"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b"
+            "7fff2ed47fffd43f5fffffffcaaae"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c2[4] = bls12_381_Fq2(
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620350"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "51ba4ab241b61603636b76660701c6ec26a2ff874fd029b16a8ca3ac61577f7f3b"
+            "8ddab7ece5a2a30f1361b798a64e8"),
+        bls12_381_Fq::zero());
     bls12_381_Fq6::Frobenius_coeffs_c2[5] = bls12_381_Fq2(
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620351"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "110f184e51c5f5947222a47bf7b5c04d5c13cc6f1ca47210ec08ff1232bda8ec10"
+            "0ddb891865a2cecfb361b798dba3a"),
+        bls12_381_Fq::zero());
 
     /* parameters for Fq12 */
 
-    bls12_381_Fq12::euler = bigint<12 * bls12_381_q_limbs>(
-        "8449447750135487786386536757818793037762212639342076082205056847631733"
-        "7611486762037414270042798116043101246277209976512094361633120467161014"
-        "0655544453405655390597288113542772613560509732197200272091941904878386"
-        "92659063939320510475"
-        "6684686564553744540192748080653129821509884735609423581664936489210967"
-        "0440467529068420483514604958227574975684523172972030890413264728910407"
-        "5914291222737139398079433126860286068573844453009747181852522430304241"
-        "3280382576694575299"
-        "4243167774120254336745536274773695755236419654903551716949533916736161"
-        "3569172920059467104043034274069321829696761906239463005630083855610676"
-        "3024021975665415739763789028633084871968346012196283360672552982454440"
-        "6779592032379877481"
-        "1619354467715920346231349235866829244117661464414438262378914602649540"
-        "0686951521638441608423046735329190594695892803338108752058997137128797"
-        "3778883772765769448885014782339635406211030364946185240866112535299846"
-        "0333970628572435583"
-        "1757875201144654542881444863180645429521461839597984159381168059700378"
-        "1998317840382782546961827784098634063653000816109224177006797686172283"
-        "6524688010589950951561114449900951002753319232147895757766930045754791"
-        "8189673190852298371"
-        "5647603567520167155789018111526068121587518840305926270907547770597694"
-        "1239754628313695901797410453781873141027101200728931074856266540267317"
-        "2430117685618695762741237977291546454709306808974723155022101617076402"
-        "8215685592439765640");
+    bls12_381_Fq12::euler = bigint<12 * bls12_381_q_limbs>::from_hex(
+        "a9d7da3e4d41b98e0c0a6f5979f969c910f1c59d1c6a7cde80f189c0bb2e948d28b250"
+        "0a3eec0b4199e9024af07be89b5740142ad94ae7a62fd282484a0682f3bcab7cf41e4d"
+        "efe60e3736e0399e1c32368cbda4314f658316ca84403aa9c357da8c31ae24b2eb1c11"
+        "2d8e9825258c2ef182ed231b811af52624e414f6cc0b9f0606dd1201a66099bb544414"
+        "a4b3d25c6586594e00307d2dd40c099be32f7e23fabcb9b2172d41ff7b11e347c23939"
+        "4d5576da57452673cfe6f4750d993f20565997f11bd653736ccf58333581fc061a0a32"
+        "99c9ed266bfd98a0f17c19dfee84aae978ffcd5ee716e3e052db7502e16f402cc8deee"
+        "7c3b1f70cec7ff1e1da8b55f99db22b015413422d416eb6e2ef7c9d2eb19a6ca28ec3f"
+        "73398151fc751c874ffa5f8fcc685f3620a40b97f86797ffa06b7cff6274a7e4e3d9fe"
+        "f22041e1682c25fad3d6090dd1e5fe57df2c7ae381e95c0565f5dd22981deb4f6148f7"
+        "f30460b1fd1724a76718f0d99572798c3c41f5e01fefac7c6d10a37257b3e65e4db7ea"
+        "f0e691f96165500f154ce3f5009559b3122d8b24b24ecdb03cd060def96ae8938d0b56"
+        "2c758be3afb5fce5d72dc08ffafc612af6d2c060e010f3fa18c3a5f8a59af1bab2b33f"
+        "06fb284214c568703a353b64c9d1aa87004693837888f9f086d00616e0dcb55f2012d3"
+        "5e540e4687cfd2eacb798cc0ebe87272834ce9785a1ec68d3055853f2c153daf03ffbe"
+        "0db6b5ed6125527902f635338a8136239591ff05220276fae408bc3a206569d8f13009"
+        "e5c62fb163a252aefaba88");
     bls12_381_Fq12::s = 4;
-    bls12_381_Fq12::t = bigint<12 * bls12_381_q_limbs>(
-        "1056180968766935973298317094727349129720276579917759510275632105953966"
-        "7201435845254676783755349764505387655784651247064011795204140058395126"
-        "7581943056675706923824661014192846576695063716524650034011492738109798"
-        "36582382992415063809"
-        "4585585820569218067524093510081641227688735591951177947708117061151370"
-        "8805058441133552560439325619778446871960565396621503861301658091113800"
-        "9489286402842142424759929140857535758571730556626218397731565303788030"
-        "1660047822086821912"
-        "4280395971765031792093192034346711969404552456862943964618691739592020"
-        "1696146615007433388005379284258665228712095238279932875703760481951334"
-        "5378002746958176967470473628579135608996043251524535420084069122806805"
-        "0847449004047484685"
-        "1452419308464490043278918654483353655514707683051804782797364325331192"
-        "5085868940204805201052880841916148824336986600417263594007374642141099"
-        "6722360471595721181110626847792454425776378795618273155108264066912480"
-        "7541746328571554447"
-        "8969734400143081817860180607897580678690182729949748019922646007462547"
-        "2749789730047847818370228473012329257956625102013653022125849710771535"
-        "4565586001323743868945139306237618875344164904018486969720866255719348"
-        "9773709148856537296"
-        "4455950445940020894473627263940758515198439855038240783863443471324711"
-        "7654969328539211987724676306722734142628387650091116384357033317533414"
-        "6553764710702336970342654747161443306838663351121840394377762702134550"
-        "3526960699054970705");
-    bls12_381_Fq12::t_minus_1_over_2 = bigint<12 * bls12_381_q_limbs>(
-        "5280904843834679866491585473636745648601382899588797551378160529769833"
-        "6007179226273383918776748822526938278923256235320058976020700291975633"
-        "7909715283378534619123305070964232883475318582623250170057463690548991"
-        "8291191496207531904"
-        "7292792910284609033762046755040820613844367795975588973854058530575685"
-        "4402529220566776280219662809889223435980282698310751930650829045556900"
-        "4744643201421071212379964570428767879285865278313109198865782651894015"
-        "0830023911043410956"
-        "2140197985882515896046596017173355984702276228431471982309345869796010"
-        "0848073307503716694002689642129332614356047619139966437851880240975667"
-        "2689001373479088483735236814289567804498021625762267710042034561403402"
-        "5423724502023742342"
-        "5726209654232245021639459327241676827757353841525902391398682162665596"
-        "2542934470102402600526440420958074412168493300208631797003687321070549"
-        "8361180235797860590555313423896227212888189397809136577554132033456240"
-        "3770873164285777223"
-        "9484867200071540908930090303948790339345091364974874009961323003731273"
-        "6374894865023923909185114236506164628978312551006826511062924855385767"
-        "7282793000661871934472569653118809437672082452009243484860433127859674"
-        "4886854574428268648"
-        "2227975222970010447236813631970379257599219927519120391931721735662355"
-        "8827484664269605993862338153361367071314193825045558192178516658766707"
-        "3276882355351168485171327373580721653419331675560920197188881351067275"
-        "1763480349527485352");
+    bls12_381_Fq12::t = bigint<12 * bls12_381_q_limbs>::from_hex(
+        "153afb47c9a83731c1814deb2f3f2d39221e38b3a38d4f9bd01e31381765d291a5164a"
+        "0147dd8168333d20495e0f7d136ae802855b295cf4c5fa50490940d05e77956f9e83c9"
+        "bdfcc1c6e6dc0733c38646d197b48629ecb062d950880755386afb518635c4965d6382"
+        "25b1d304a4b185de305da46370235ea4c49c829ed98173e0c0dba24034cc13376a8882"
+        "94967a4b8cb0cb29c0060fa5ba8181337c65efc47f57973642e5a83fef623c68f84727"
+        "29aaaedb4ae8a4ce79fcde8ea1b327e40acb32fe237aca6e6d99eb0666b03f80c34146"
+        "53393da4cd7fb3141e2f833bfdd0955d2f1ff9abdce2dc7c0a5b6ea05c2de805991bdd"
+        "cf8763ee19d8ffe3c3b516abf33b645602a826845a82dd6dc5def93a5d6334d9451d87"
+        "ee67302a3f8ea390e9ff4bf1f98d0be6c4148172ff0cf2fff40d6f9fec4e94fc9c7b3f"
+        "de44083c2d0584bf5a7ac121ba3cbfcafbe58f5c703d2b80acbebba45303bd69ec291e"
+        "fe608c163fa2e494ece31e1b32ae4f3187883ebc03fdf58f8da2146e4af67ccbc9b6fd"
+        "5e1cd23f2c2caa01e2a99c7ea012ab366245b1649649d9b6079a0c1bdf2d5d1271a16a"
+        "c58eb17c75f6bf9cbae5b811ff5f8c255eda580c1c021e7f431874bf14b35e37565667"
+        "e0df65084298ad0e0746a76c993a3550e008d2706f111f3e10da00c2dc1b96abe4025a"
+        "6bca81c8d0f9fa5d596f31981d7d0e4e50699d2f0b43d8d1a60ab0a7e582a7b5e07ff7"
+        "c1b6d6bdac24aa4f205ec6a6715026c472b23fe0a4404edf5c811787440cad3b1e2601"
+        "3cb8c5f62c744a55df5751");
+    bls12_381_Fq12::t_minus_1_over_2 = bigint<12 * bls12_381_q_limbs>::from_hex(
+        "a9d7da3e4d41b98e0c0a6f5979f969c910f1c59d1c6a7cde80f189c0bb2e948d28b250"
+        "0a3eec0b4199e9024af07be89b5740142ad94ae7a62fd282484a0682f3bcab7cf41e4d"
+        "efe60e3736e0399e1c32368cbda4314f658316ca84403aa9c357da8c31ae24b2eb1c11"
+        "2d8e9825258c2ef182ed231b811af52624e414f6cc0b9f0606dd1201a66099bb544414"
+        "a4b3d25c6586594e00307d2dd40c099be32f7e23fabcb9b2172d41ff7b11e347c23939"
+        "4d5576da57452673cfe6f4750d993f20565997f11bd653736ccf58333581fc061a0a32"
+        "99c9ed266bfd98a0f17c19dfee84aae978ffcd5ee716e3e052db7502e16f402cc8deee"
+        "7c3b1f70cec7ff1e1da8b55f99db22b015413422d416eb6e2ef7c9d2eb19a6ca28ec3f"
+        "73398151fc751c874ffa5f8fcc685f3620a40b97f86797ffa06b7cff6274a7e4e3d9fe"
+        "f22041e1682c25fad3d6090dd1e5fe57df2c7ae381e95c0565f5dd22981deb4f6148f7"
+        "f30460b1fd1724a76718f0d99572798c3c41f5e01fefac7c6d10a37257b3e65e4db7ea"
+        "f0e691f96165500f154ce3f5009559b3122d8b24b24ecdb03cd060def96ae8938d0b56"
+        "2c758be3afb5fce5d72dc08ffafc612af6d2c060e010f3fa18c3a5f8a59af1bab2b33f"
+        "06fb284214c568703a353b64c9d1aa87004693837888f9f086d00616e0dcb55f2012d3"
+        "5e540e4687cfd2eacb798cc0ebe87272834ce9785a1ec68d3055853f2c153daf03ffbe"
+        "0db6b5ed6125527902f635338a8136239591ff05220276fae408bc3a206569d8f13009"
+        "e5c62fb163a252aefaba8");
     bls12_381_Fq12::non_residue =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("1"));
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::one());
     bls12_381_Fq12::nqr =
         bls12_381_Fq12(bls12_381_Fq6::zero(), bls12_381_Fq6::one());
-    bls12_381_Fq temp_Fq12 = bls12_381_Fq(
-        "3357996710086603428986649435961018971596863377125478091385687488711898"
-        "724126407611022502097010210262797519903698974");
+    bls12_381_Fq temp_Fq12 = bls12_381_Fq::from_montgomery_hex(
+        "1625e5e17bc9179f778b4e627e760b169113d2b19bf1d81856819f35529e773a23e6dd"
+        "6b90c01db2cea38b144fd59a33");
     bls12_381_Fq12::nqr_to_t = bls12_381_Fq12(
         bls12_381_Fq6::zero(),
         bls12_381_Fq6(
@@ -345,106 +325,110 @@ void init_bls12_381_params()
             bls12_381_Fq2(temp_Fq12, temp_Fq12),
             bls12_381_Fq2::zero()));
     bls12_381_Fq12::Frobenius_coeffs_c1[0] =
-        bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("0"));
+        bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[1] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "385075437003716901195214707605136405715880742097068243867605052261"
-            "3628423219637725072182697113062777891589506424760"),
-        bls12_381_Fq(
-            "151655185184498381465642749684540099398075398968325446656007613510"
-            "403227271200139370504932015952886146304766135027"));
+        bls12_381_Fq::from_montgomery_hex(
+            "8f2220fb0fb66eb1ce393ea5daace4da35baecab2dc29ee97e83cccd117228fc66"
+            "95f92b50a831307089552b319d465"),
+        bls12_381_Fq::from_montgomery_hex(
+            "110eefda88847faf2e3813cbe5a0de89c11b9cba40a8e8d0cf4895d42599d39458"
+            "42a06bfc497cecb2f66aad4ce5d646"));
     bls12_381_Fq12::Frobenius_coeffs_c1[2] = bls12_381_Fq2(
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620351"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "110f184e51c5f5947222a47bf7b5c04d5c13cc6f1ca47210ec08ff1232bda8ec10"
+            "0ddb891865a2cecfb361b798dba3a"),
+        bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[3] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "297367740898656104344246534652010887917204288300924998917641501809"
-            "1420807192182638567116318576472649347015917690530"),
-        bls12_381_Fq(
-            "102873214623510634997532447921579527738483993692975789615564311803"
-            "2610843298655225875571310552543014690878354869257"));
+        bls12_381_Fq::from_montgomery_hex(
+            "bd592fc7d825ec81d794e4fac7cf0b992ad2afd19103e18382844c88b623732429"
+            "4213d86c181833e2f585da55c9ad1"),
+        bls12_381_Fq::from_montgomery_hex(
+            "e2b7eedbbfd87d22da2596696cebc1dd1ca2087da74d4a72f088dd86b4ebef1dc1"
+            "7dec12a927e7c7bcfa7a25aa30fda"));
     bls12_381_Fq12::Frobenius_coeffs_c1[4] = bls12_381_Fq2(
-        bls12_381_Fq("793479390729215512621379701633421447060886740281060493010"
-                     "456487427281649075476305620758731620350"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "51ba4ab241b61603636b76660701c6ec26a2ff874fd029b16a8ca3ac61577f7f3b"
+            "8ddab7ece5a2a30f1361b798a64e8"),
+        bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[5] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "312533259417105942490810809620464897857011828197757543583242263160"
-            "1824034463382777937621250592425535493320683825557"),
-        bls12_381_Fq(
-            "877076961050607968509681729531255177986764537961432449499635504522"
-            "207616027455086505066378536590128544573588734230"));
+        bls12_381_Fq::from_montgomery_hex(
+            "2e370eccc86f7dd0095ba654ed2226bef517c3266341429a04007fbba4b14a27c2"
+            "ac1aad1b6fe703726c30af242c66c"),
+        bls12_381_Fq::from_montgomery_hex(
+            "171da0fd6cf8eebd4a85ed50f4798a6b7525cf528d50fe95c6f0caa53c65e181a2"
+            "813e53df9d018f82d83cf50dbce43f"));
     bls12_381_Fq12::Frobenius_coeffs_c1[6] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739341778982573590415655688281993900788533205813612"
-            "4031650490837864442687629129015664037894272559786"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "40ab3263eff0206ef148d1ea0f4c069eca8f3318332bb7a07e83a49a2e99d6932b"
+            "7fff2ed47fffd43f5fffffffcaaae"),
+        bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[7] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "151655185184498381465642749684540099398075398968325446656007613510"
-            "403227271200139370504932015952886146304766135027"),
-        bls12_381_Fq(
-            "385075437003716901195214707605136405715880742097068243867605052261"
-            "3628423219637725072182697113062777891589506424760"));
+        bls12_381_Fq::from_montgomery_hex(
+            "110eefda88847faf2e3813cbe5a0de89c11b9cba40a8e8d0cf4895d42599d39458"
+            "42a06bfc497cecb2f66aad4ce5d646"),
+        bls12_381_Fq::from_montgomery_hex(
+            "8f2220fb0fb66eb1ce393ea5daace4da35baecab2dc29ee97e83cccd117228fc66"
+            "95f92b50a831307089552b319d465"));
     bls12_381_Fq12::Frobenius_coeffs_c1[8] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939436"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "18f020655463874103f97d6e83d050d28eb60ebe01bacb9e587042afd3851b955d"
+            "ab22461fcda5d2cd03c9e48671f071"),
+        bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[9] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "102873214623510634997532447921579527738483993692975789615564311803"
-            "2610843298655225875571310552543014690878354869257"),
-        bls12_381_Fq(
-            "297367740898656104344246534652010887917204288300924998917641501809"
-            "1420807192182638567116318576472649347015917690530"));
+        bls12_381_Fq::from_montgomery_hex(
+            "e2b7eedbbfd87d22da2596696cebc1dd1ca2087da74d4a72f088dd86b4ebef1dc1"
+            "7dec12a927e7c7bcfa7a25aa30fda"),
+        bls12_381_Fq::from_montgomery_hex(
+            "bd592fc7d825ec81d794e4fac7cf0b992ad2afd19103e18382844c88b623732429"
+            "4213d86c181833e2f585da55c9ad1"));
     bls12_381_Fq12::Frobenius_coeffs_c1[10] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939437"),
-        bls12_381_Fq("0"));
+        bls12_381_Fq::from_montgomery_hex(
+            "14e56d3f1564853a14e4f04fe2db9068a20d1b8c7e88102450880866309b7e2c2a"
+            "f322533285a5d5890dc9e4867545c3"),
+        bls12_381_Fq::zero());
     bls12_381_Fq12::Frobenius_coeffs_c1[11] = bls12_381_Fq2(
-        bls12_381_Fq(
-            "877076961050607968509681729531255177986764537961432449499635504522"
-            "207616027455086505066378536590128544573588734230"),
-        bls12_381_Fq(
-            "312533259417105942490810809620464897857011828197757543583242263160"
-            "1824034463382777937621250592425535493320683825557"));
+        bls12_381_Fq::from_montgomery_hex(
+            "171da0fd6cf8eebd4a85ed50f4798a6b7525cf528d50fe95c6f0caa53c65e181a2"
+            "813e53df9d018f82d83cf50dbce43f"),
+        bls12_381_Fq::from_montgomery_hex(
+            "2e370eccc86f7dd0095ba654ed2226bef517c3266341429a04007fbba4b14a27c2"
+            "ac1aad1b6fe703726c30af242c66c"));
 
     // Choice of short Weierstrass curve and its twist
     // E(Fq): y^2 = x^3 + 4
 
-    bls12_381_coeff_b = bls12_381_Fq("4");
-    bls12_381_twist = bls12_381_Fq2(bls12_381_Fq("1"), bls12_381_Fq("1"));
+    bls12_381_coeff_b = bls12_381_Fq::from_montgomery_hex(
+        "9d645513d83de7e8ec9733bbf78ab2fb1d37ebee6ba24d7478fe97a6b0a807f53cc003"
+        "2fc34000aaa270000000cfff3");
+    bls12_381_twist = bls12_381_Fq2(bls12_381_Fq::one(), bls12_381_Fq::one());
     bls12_381_twist_coeff_b = bls12_381_coeff_b * bls12_381_twist;
     bls12_381_twist_mul_by_b_c0 =
         bls12_381_coeff_b * bls12_381_Fq2::non_residue;
     bls12_381_twist_mul_by_b_c1 =
         bls12_381_coeff_b * bls12_381_Fq2::non_residue;
     bls12_381_twist_mul_by_q_X = bls12_381_Fq2(
-        bls12_381_Fq("0"),
-        bls12_381_Fq(
-            "400240955522166739262431043500668864393550311830558643827117139584"
-            "2971157480381377015405980053539358417135540939437"));
+        bls12_381_Fq::zero(),
+        bls12_381_Fq::from_montgomery_hex(
+            "14e56d3f1564853a14e4f04fe2db9068a20d1b8c7e88102450880866309b7e2c2a"
+            "f322533285a5d5890dc9e4867545c3"));
     bls12_381_twist_mul_by_q_Y = bls12_381_Fq2(
-        bls12_381_Fq(
-            "297367740898656104344246534652010887917204288300924998917641501809"
-            "1420807192182638567116318576472649347015917690530"),
-        bls12_381_Fq(
-            "102873214623510634997532447921579527738483993692975789615564311803"
-            "2610843298655225875571310552543014690878354869257"));
+        bls12_381_Fq::from_montgomery_hex(
+            "bd592fc7d825ec81d794e4fac7cf0b992ad2afd19103e18382844c88b623732429"
+            "4213d86c181833e2f585da55c9ad1"),
+        bls12_381_Fq::from_montgomery_hex(
+            "e2b7eedbbfd87d22da2596696cebc1dd1ca2087da74d4a72f088dd86b4ebef1dc1"
+            "7dec12a927e7c7bcfa7a25aa30fda"));
 
     /* choice of group G1 */
     bls12_381_G1::G1_zero = bls12_381_G1(
         bls12_381_Fq::zero(), bls12_381_Fq::one(), bls12_381_Fq::zero());
     bls12_381_G1::G1_one = bls12_381_G1(
-        bls12_381_Fq(
-            "368541675371338701678108831518307775796162079578254640989457837868"
-            "8607592378376318836054947676345821548104185464507"),
-        bls12_381_Fq(
-            "133950654494447647302047137994192122158493387593834962042654373641"
-            "6511423956333506472724655353366534992391756441569"),
+        bls12_381_Fq::from_montgomery_hex(
+            "120177419e0bfb75edce6ecc21dbf440f0ae6acdf3d0e747154f95c7143ba1c178"
+            "17fc679976fff55cb38790fd530c16"),
+        bls12_381_Fq::from_montgomery_hex(
+            "bbc3efc5008a26a0e1c8c3fad0059c051ac582950405194dd595f13570725ce8c2"
+            "2631a7918fd8ebaac93d50ce72271"),
         bls12_381_Fq::one());
 
     // Curve coeffs
@@ -452,8 +436,8 @@ void init_bls12_381_params()
     bls12_381_G1::coeff_b = bls12_381_coeff_b;
 
     // Cofactor
-    bls12_381_G1::h =
-        bigint<bls12_381_G1::h_limbs>("76329603384216526031706109802092473003");
+    bls12_381_G1::h = bigint<bls12_381_G1::h_limbs>::from_hex(
+        "396c8c005555e1568c00aaab0000aaab");
 
     // TODO: wNAF window table
     bls12_381_G1::wnaf_window_table.resize(0);
@@ -516,19 +500,19 @@ void init_bls12_381_params()
     // simple G2 generator
     bls12_381_G2::G2_one = bls12_381_G2(
         bls12_381_Fq2(
-            bls12_381_Fq(
-                "35270106958746661818713911601106014489002995279277524021990864"
-                "4239793785735715026873347600343865175952761926303160"),
-            bls12_381_Fq(
-                "30591443442442137099712598147537816369864703254766475586593732"
-                "06291635324768958432433509563104347017837885763365758")),
+            bls12_381_Fq::from_montgomery_hex(
+                "58191924350bcd76f67b7631863366b9894999d1a3caee9a1a893b53e2ae58"
+                "0b3f5fb2687b4961af5f28fa202940a10"),
+            bls12_381_Fq::from_montgomery_hex(
+                "11922a097360edf3c2b6ed0ef21585471b1ab6cc8541b3673bb17e18e28678"
+                "06aaa0c59dbccd60c3a5a9c0759e23f606")),
         bls12_381_Fq2(
-            bls12_381_Fq(
-                "19851506022872919355680545211771716383008689782156557308593786"
-                "65066344726373823718423869104263333984641494340347905"),
-            bls12_381_Fq(
-                "92755366549233245574720196577603788075774019345359297002502797"
-                "8793976877002675564980949289727957565575433344219582")),
+            bls12_381_Fq::from_montgomery_hex(
+                "83fd8e7e80dae507d3a975f0ef25a2bbefb5e96e0d495fe7e6856caa0a635a"
+                "597cfa1f5e369c5a4c730af860494c4a"),
+            bls12_381_Fq::from_montgomery_hex(
+                "b2bc2a163de1bf2e7175850a43ccaed79495c4ec93da33a86adac6a3be4eba"
+                "018aa270a2b1461dcadc0fc92df64b05d")),
         bls12_381_Fq2::one());
 
     // Curve twist coeffs
@@ -536,10 +520,9 @@ void init_bls12_381_params()
     bls12_381_G2::coeff_b = bls12_381_twist_coeff_b;
 
     // Cofactor
-    bls12_381_G2::h = bigint<bls12_381_G2::h_limbs>(
-        "3055023339312683442009997531931215042144660192541881426676640329822676"
-        "0418297188402650742735925997784783227283904161666128580382337837209635"
-        "5777062779109");
+    bls12_381_G2::h = bigint<bls12_381_G2::h_limbs>::from_hex(
+        "5d543a95414e7f1091d50792876a202cd91de4547085abaa68a205b2e5a7ddfa628f1c"
+        "b4d9e82ef21537e293a6691ae1616ec6e786f0c70cf1c38e31c7238e5");
 
     // TODO: wNAF window table
     bls12_381_G2::wnaf_window_table.resize(0);
@@ -597,31 +580,28 @@ void init_bls12_381_params()
 
     /* pairing parameters */
 
-    bls12_381_ate_loop_count =
-        bigint<bls12_381_q_limbs>("15132376222941642752");
+    bls12_381_ate_loop_count = bigint<bls12_381_q_limbs>::from_hex(
+        "d201000000010000");
     bls12_381_ate_is_loop_count_neg = true;
-    bls12_381_final_exponent = bigint<12 * bls12_381_q_limbs>(
-        "3222773615169341404628915645865101399083799695148284942183666880252886"
-        "6104110468279499868049758000889997324981410444769277898820837677957381"
-        "9485263026159588510513834876303014016798809919343532899164848730280942"
-        "6099566709175656181158672873996232868132703579017315101881499343633603"
-        "8161450133408682544227192007936328995451056537537844370437299488140679"
-        "7882676971082200626541916413184642520269678897559532260949334760604962"
-        "0863488981189822488426343796375986654688177690758785554937522144927901"
-        "2278585020295757520017608420442275148595733646547232481098283363849090"
-        "4279282696134323072515220044451592646885410572234451732790590013479358"
-        "3438412200741748482217220170835978720176385141031741227848439255783704"
-        "3084352295960009567628572373704943834654475316891297497679152853527631"
-        "7256904336520179281145394686565050419250614107803233314658825463117900"
-        "2507011991815292059423631593257659918194339143039088604607205814082013"
-        "7316404777379482541101192230582006561112154456180841405530221205747139"
-        "5719432072209245600258134364584636810093520285711072578721435517884103"
-        "5264838327332898024261573015427444767400084947803633543051169788056206"
-        "7146707140071135883955337534072489973546048014459978201490658654381329"
-        "2157922220645089192130209334926661588737007768565838519456601560804957"
-        "985667880395221049249803753582637708560");
-    bls12_381_final_exponent_z =
-        bigint<bls12_381_q_limbs>("15132376222941642752");
+    bls12_381_final_exponent = bigint<12 * bls12_381_q_limbs>::from_hex(
+        "2ee1db5dcc825b7e1bda9c0496a1c0a89ee0193d4977b3f7d4507d07363baa13f8d14a"
+        "917848517badc3a43d1073776ab353f2c30698e8cc7deada9c0aadff5e9cfee9a074e4"
+        "3b9a660835cc872ee83ff3a0f0f1c0ad0d6106feaf4e347aa68ad49466fa927e7bb937"
+        "5331807a0dce2630d9aa4b113f414386b0e8819328148978e2b0dd39099b86e1ab656d"
+        "2670d93e4d7acdd350da5359bc73ab61a0c5bf24c374693c49f570bcd2b01f3077ffb1"
+        "0bf24dde41064837f27611212596bc293c8d4c01f25118790f4684d0b9c40a68eb74bb"
+        "22a40ee7169cdc1041296532fef459f12438dfc8e2886ef965e61a474c5c85b0129127"
+        "a1b5ad0463434724538411d1676a53b5a62eb34c05739334f46c02c3f0bd0c55d3109c"
+        "d15948d0a1fad20044ce6ad4c6bec3ec03ef19592004cedd556952c6d8823b19dadd7c"
+        "2498345c6e5308f1c511291097db60b1749bf9b71a9f9e0100418a3ef0bc627751bbd8"
+        "1367066bca6a4c1b6dcfc5cceb73fc56947a403577dfa9e13c24ea820b09c1d9f7c317"
+        "59c3635de3f7a3639991708e88adce88177456c49637fd7961be1a4c7e79fb02faa732"
+        "e2f3ec2bea83d196283313492caa9d4aff1c910e9622d2a73f62537f2701aaef653931"
+        "4043f7bbce5b78c7869aeb2181a67e49eeed2161daf3f881bd88592d767f67c4717489"
+        "119226c2f011d4cab803e9d71650a6f80698e2f8491d12191a04406fbc8fbd5f48925f"
+        "98630e68bfb24c0bcb9b55df57510");
+    bls12_381_final_exponent_z = bigint<bls12_381_q_limbs>::from_hex(
+        "d201000000010000");
     bls12_381_final_exponent_is_z_neg = true;
 }
 
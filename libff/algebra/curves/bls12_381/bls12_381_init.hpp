@@ -24,8 +24,8 @@ const mp_size_t bls12_381_r_limbs =
 const mp_size_t bls12_381_q_limbs =
     (bls12_381_q_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<bls12_381_q_limbs> bls12_381_modulus_q;
-extern bigint<bls12_381_r_limbs> bls12_381_modulus_r;
+extern const bigint<bls12_381_q_limbs> bls12_381_modulus_q;
+extern const bigint<bls12_381_r_limbs> bls12_381_modulus_r;
 
 typedef Fp_model<bls12_381_r_limbs, bls12_381_modulus_r> bls12_381_Fr;
 typedef Fp_model<bls12_381_q_limbs, bls12_381_modulus_q> bls12_381_Fq;
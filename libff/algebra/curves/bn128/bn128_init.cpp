@@ -13,8 +13,12 @@
 namespace libff
 {
 
-bigint<bn128_r_limbs> bn128_modulus_r;
-bigint<bn128_q_limbs> bn128_modulus_q;
+constexpr bigint<bn128_r_limbs> bn128_modulus_r =
+    bigint<bn128_r_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001");
+constexpr bigint<bn128_q_limbs> bn128_modulus_q =
+    bigint<bn128_q_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47");
 
 bn::Fp bn128_coeff_b;
 size_t bn128_Fq_s;
@@ -38,74 +42,71 @@ void init_bn128_params()
         sizeof(mp_limb_t) == 4); // Montgomery assumes this
 
     /* parameters for scalar field Fr */
-    bn128_modulus_r = bigint_r("21888242871839275222246405745257275088548364400"
-                               "416034343698204186575808495617");
     assert(bn128_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bn128_Fr::Rsquared = bigint_r("9449366811492084466516642542697455484907"
-                                      "66851729442924617792859073125903783");
-        bn128_Fr::Rcubed = bigint_r("586654854594384522748989487204024472040386"
-                                    "8105578784105281690076696998248512");
+        bn128_Fr::Rsquared = bigint_r::from_hex(
+            "216d0b17f4e44a58c49833d53bb808553fe3ab1e35c59e31bb8e645ae216da7");
+        bn128_Fr::Rcubed = bigint_r::from_hex(
+            "cf8594b7fcc657c893cc664a19fcfed2a489cbe1cfbb6b85e94d8e1b4bf0040");
         bn128_Fr::inv = 0xc2e1f593efffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bn128_Fr::Rsquared = bigint_r("9449366811492084466516642542697455484907"
-                                      "66851729442924617792859073125903783");
-        bn128_Fr::Rcubed = bigint_r("586654854594384522748989487204024472040386"
-                                    "8105578784105281690076696998248512");
+        bn128_Fr::Rsquared = bigint_r::from_hex(
+            "216d0b17f4e44a58c49833d53bb808553fe3ab1e35c59e31bb8e645ae216da7");
+        bn128_Fr::Rcubed = bigint_r::from_hex(
+            "cf8594b7fcc657c893cc664a19fcfed2a489cbe1cfbb6b85e94d8e1b4bf0040");
         bn128_Fr::inv = 0xefffffff;
     }
     bn128_Fr::num_bits = 254;
-    bn128_Fr::euler = bigint_r("10944121435919637611123202872628637544274182200"
-                               "208017171849102093287904247808");
+    bn128_Fr::euler = bigint_r::from_hex(
+        "183227397098d014dc2822db40c0ac2e9419f4243cdcb848a1f0fac9f8000000");
     bn128_Fr::s = 28;
-    bn128_Fr::t = bigint_r(
-        "81540058820840996586704275553141814055101440848469862132140264610111");
-    bn128_Fr::t_minus_1_over_2 = bigint_r(
-        "40770029410420498293352137776570907027550720424234931066070132305055");
-    bn128_Fr::multiplicative_generator = bn128_Fr("5");
-    bn128_Fr::root_of_unity =
-        bn128_Fr("1910321906792171394429139282769207003614565195732928631530564"
-                 "2004821462161904");
-    bn128_Fr::nqr = bn128_Fr("5");
-    bn128_Fr::nqr_to_t = bn128_Fr("19103219067921713944291392827692070036145651"
-                                  "957329286315305642004821462161904");
+    bn128_Fr::t = bigint_r::from_hex(
+        "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f");
+    bn128_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "183227397098d014dc2822db40c0ac2e9419f4243cdcb848a1f0fac9f");
+    bn128_Fr::multiplicative_generator = bn128_Fr::from_montgomery_hex(
+        "15d0085520f5bbc347d8eb76d8dd0689eaba68a3a32a913f1b0d0ef99fffffe6");
+    bn128_Fr::root_of_unity = bn128_Fr::from_montgomery_hex(
+        "1860ef942963f9e756452ac01eb203d8a22bf3742445ffd6636e735580d13d9c");
+    bn128_Fr::nqr = bn128_Fr::from_montgomery_hex(
+        "15d0085520f5bbc347d8eb76d8dd0689eaba68a3a32a913f1b0d0ef99fffffe6");
+    bn128_Fr::nqr_to_t = bn128_Fr::from_montgomery_hex(
+        "1860ef942963f9e756452ac01eb203d8a22bf3742445ffd6636e735580d13d9c");
     bn128_Fr::static_init();
 
     /* parameters for base field Fq */
-    bn128_modulus_q = bigint_q("21888242871839275222246405745257275088696311157"
-                               "297823662689037894645226208583");
     assert(bn128_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735"
-                                      "540968419076528771170197431451843209");
-        bn128_Fq::Rcubed = bigint_q("149217865411596481859481527385630809590936"
-                                    "19838510245177710943249661917737183");
+        bn128_Fq::Rsquared = bigint_q::from_hex(
+            "6d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89");
+        bn128_Fq::Rcubed = bigint_q::from_hex(
+            "20fd6e902d592544ef7f0b0c0ada0afb62f210e6a7283db6b1cd6dafda1530df");
         bn128_Fq::inv = 0x87d20782e4866389;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735"
-                                      "540968419076528771170197431451843209");
-        bn128_Fq::Rcubed = bigint_q("149217865411596481859481527385630809590936"
-                                    "19838510245177710943249661917737183");
+        bn128_Fq::Rsquared = bigint_q::from_hex(
+            "6d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89");
+        bn128_Fq::Rcubed = bigint_q::from_hex(
+            "20fd6e902d592544ef7f0b0c0ada0afb62f210e6a7283db6b1cd6dafda1530df");
         bn128_Fq::inv = 0xe4866389;
     }
     bn128_Fq::num_bits = 254;
-    bn128_Fq::euler = bigint_q("10944121435919637611123202872628637544348155578"
-                               "648911831344518947322613104291");
+    bn128_Fq::euler = bigint_q::from_hex(
+        "183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3");
     bn128_Fq::s = 1;
-    bn128_Fq::t = bigint_q("109441214359196376111232028726286375443481555786489"
-                           "11831344518947322613104291");
-    bn128_Fq::t_minus_1_over_2 =
-        bigint_q("5472060717959818805561601436314318772174077789324455915672259"
-                 "473661306552145");
-    bn128_Fq::multiplicative_generator = bn128_Fq("3");
-    bn128_Fq::root_of_unity =
-        bn128_Fq("2188824287183927522224640574525727508869631115729782366268903"
-                 "7894645226208582");
-    bn128_Fq::nqr = bn128_Fq("3");
-    bn128_Fq::nqr_to_t = bn128_Fq("21888242871839275222246405745257275088696311"
-                                  "157297823662689037894645226208582");
+    bn128_Fq::t = bigint_q::from_hex(
+        "183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3");
+    bn128_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "c19139cb84c680a6e14116da060561765e05aa45a1c72a34f082305b61f3f51");
+    bn128_Fq::multiplicative_generator = bn128_Fq::from_montgomery_hex(
+        "2a1f6744ce179d8e334bea4e696bd2841f6ac17ae15521b97a17caa950ad28d7");
+    bn128_Fq::root_of_unity = bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
+    bn128_Fq::nqr = bn128_Fq::from_montgomery_hex(
+        "2a1f6744ce179d8e334bea4e696bd2841f6ac17ae15521b97a17caa950ad28d7");
+    bn128_Fq::nqr_to_t = bn128_Fq::from_montgomery_hex(
+        "2259d6b14729c0fa51e1a247090812318d087f6872aabf4f68c3488912edefaa");
     bn128_Fq::static_init();
 
     /* additional parameters for square roots in Fq/Fq2 */
@@ -144,7 +145,7 @@ void init_bn128_params()
     bn128_G1::G1_one.Z = bn::Fp(1);
 
     // Cofactor
-    bn128_G1::h = bigint<bn128_G1::h_limbs>("1");
+    bn128_G1::h = bigint<bn128_G1::h_limbs>::from_hex("1");
 
     // WNAF
     bn128_G1::wnaf_window_table.resize(0);
@@ -218,9 +219,8 @@ void init_bn128_params()
     bn128_G2::G2_one.Z = bn::Fp2(bn::Fp(1), bn::Fp(0));
 
     // Cofactor
-    bn128_G2::h =
-        bigint<bn128_G2::h_limbs>("21888242871839275222246405745257275088844257"
-                                  "914179612981679871602714643921549");
+    bn128_G2::h = bigint<bn128_G2::h_limbs>::from_hex(
+        "30644e72e131a029b85045b68181585e06ceecda572a2489345f2299c0f9fa8d");
 
     // WNAF
     bn128_G2::wnaf_window_table.resize(0);
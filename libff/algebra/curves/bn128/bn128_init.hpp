@@ -23,8 +23,8 @@ const mp_size_t bn128_r_limbs =
 const mp_size_t bn128_q_limbs =
     (bn128_q_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<bn128_r_limbs> bn128_modulus_r;
-extern bigint<bn128_q_limbs> bn128_modulus_q;
+extern const bigint<bn128_r_limbs> bn128_modulus_r;
+extern const bigint<bn128_q_limbs> bn128_modulus_q;
 
 extern bn::Fp bn128_coeff_b;
 extern size_t bn128_Fq_s;
@@ -11,8 +11,15 @@
 namespace libff
 {
 
-bigint<bw6_761_r_limbs> bw6_761_modulus_r;
-bigint<bw6_761_q_limbs> bw6_761_modulus_q;
+constexpr bigint<bw6_761_r_limbs> bw6_761_modulus_r =
+    bigint<bw6_761_r_limbs>::from_hex(
+        "1ae3a4617c510eac63b05c06ca1493b1a22d9f300f5138f1ef3622fba094800170b5d4"
+        "4300000008508c00000000001");
+constexpr bigint<bw6_761_q_limbs> bw6_761_modulus_q =
+    bigint<bw6_761_q_limbs>::from_hex(
+        "122e824fb83ce0ad187c94004faff3eb926186a81d14688528275ef8087be41707ba63"
+        "8e584e91903cebaff25b423048689c8ed12f9fd9071dcd3dc73ebff2e98a116c25667a"
+        "8f8160cf8aeeaf0a437e6913e6870000082f49d00000000008b");
 
 bw6_761_Fq bw6_761_coeff_b;
 bw6_761_Fq bw6_761_twist;
@@ -35,264 +42,244 @@ void init_bw6_761_params()
     // Parameters for scalar field Fr
     // r =
     // 0x1ae3a4617c510eac63b05c06ca1493b1a22d9f300f5138f1ef3622fba094800170b5d44300000008508c00000000001
-    bw6_761_modulus_r =
-        bigint_r("2586644260129690940106527336948935335363935127549146605398842"
-                 "62666720468348340822774968888139573360124440321458177");
     assert(bw6_761_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bw6_761_Fr::Rsquared = bigint_r(
-            "661274283768726978163325701168662324052305289846649183196063154202"
-            "33909940404532140033099444330447428417853902114");
-        bw6_761_Fr::Rcubed = bigint_r(
-            "157734475176213061358192738313701451942220138363611391489992831740"
-            "412033225490229541667992423878570205050777755168");
+        bw6_761_Fr::Rsquared = bigint_r::from_hex(
+            "6dfccb1e914b88837e92f041790bf9bfdf7d03827dc3ac22a5f11162d6b46d0329"
+            "fcaab00431b1b786686c9400cd22");
+        bw6_761_Fr::Rcubed = bigint_r::from_hex(
+            "1065ab4c0e7dda53f72540713590cb96a2a9516c804a20e2be8b1180449f513e50"
+            "f4148be329585581f532f8815de20");
         bw6_761_Fr::inv = 0x8508bfffffffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bw6_761_Fr::Rsquared = bigint_r(
-            "661274283768726978163325701168662324052305289846649183196063154202"
-            "33909940404532140033099444330447428417853902114");
-        bw6_761_Fr::Rcubed = bigint_r(
-            "157734475176213061358192738313701451942220138363611391489992831740"
-            "412033225490229541667992423878570205050777755168");
+        bw6_761_Fr::Rsquared = bigint_r::from_hex(
+            "6dfccb1e914b88837e92f041790bf9bfdf7d03827dc3ac22a5f11162d6b46d0329"
+            "fcaab00431b1b786686c9400cd22");
+        bw6_761_Fr::Rcubed = bigint_r::from_hex(
+            "1065ab4c0e7dda53f72540713590cb96a2a9516c804a20e2be8b1180449f513e50"
+            "f4148be329585581f532f8815de20");
         bw6_761_Fr::inv = 0xffffffff;
     }
     bw6_761_Fr::num_bits = 377;
-    bw6_761_Fr::euler =
-        bigint_r("1293322130064845470053263668474467667681967563774573302699421"
-                 "31333360234174170411387484444069786680062220160729088");
+    bw6_761_Fr::euler = bigint_r::from_hex(
+        "d71d230be28875631d82e03650a49d8d116cf9807a89c78f79b117dd04a4000b85aea2"
+        "180000004284600000000000");
     bw6_761_Fr::s = 46;
-    bw6_761_Fr::t =
-        bigint_r("3675842578061421676390135839012792950148785745837396071634149"
-                 "488243117337281387659330802195819009059");
-    bw6_761_Fr::t_minus_1_over_2 =
-        bigint_r("1837921289030710838195067919506396475074392872918698035817074"
-                 "744121558668640693829665401097909504529");
-    bw6_761_Fr::multiplicative_generator = bw6_761_Fr("15");
-    bw6_761_Fr::root_of_unity =
-        bw6_761_Fr("32863578547254505029601261939868325669770508939375122462904"
-                   "745766352256812585773382134936404344547323199885654433");
-    bw6_761_Fr::nqr = bw6_761_Fr("5");
-    bw6_761_Fr::nqr_to_t =
-        bw6_761_Fr("33774956008227656219775876656288133547078610493828613777258"
-                   "829345740556592044969439504850374928261397247202212840");
+    bw6_761_Fr::t = bigint_r::from_hex(
+        "6b8e9185f1443ab18ec1701b28524ec688b67cc03d44e3c7bcd88bee82520005c2d751"
+        "0c00000021423");
+    bw6_761_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "35c748c2f8a21d58c760b80d94292763445b3e601ea271e3de6c45f741290002e16ba8"
+        "8600000010a11");
+    bw6_761_Fr::multiplicative_generator = bw6_761_Fr::from_montgomery_hex(
+        "19016a3edcd115f6968af36d106a4b2d10f7bf375757f17dc8ffe3035319f32669be3a"
+        "3bffffb5d15eefffffffff714");
+    bw6_761_Fr::root_of_unity = bw6_761_Fr::from_montgomery_hex(
+        "fda47f566e4289b7f9a1cc67b4e064d82b4258b1e4da96259d41860d7882d6720bc7a4"
+        "bf05c59cdfcae622791aab1e");
+    bw6_761_Fr::nqr = bw6_761_Fr::from_montgomery_hex(
+        "114c5a35730b618ba8be6fd148d4f4f4e661ca22778db8cfe81201ffa68f7bb7f37c04"
+        "d4ffffe7488fd3ffffffffd07");
+    bw6_761_Fr::nqr_to_t = bw6_761_Fr::from_montgomery_hex(
+        "ba7904c8cf8495cce5a0cba0df931b2c1a6dd31d8d5057a818ea191f8a0eaf254e4780"
+        "a6722e5168f876aa8bb191f2");
     bw6_761_Fr::static_init();
 
     // Parameters for base field Fq
     // q =
     // 0x122e824fb83ce0ad187c94004faff3eb926186a81d14688528275ef8087be41707ba638e584e91903cebaff25b423048689c8ed12f9fd9071dcd3dc73ebff2e98a116c25667a8f8160cf8aeeaf0a437e6913e6870000082f49d00000000008b
-    bw6_761_modulus_q =
-        bigint_q("6891450384315732539396789682275657542479668912536150109513790"
-                 "1602096234222434917360876831832894116876408645677537866134511"
-                 "6175912055424775934951169912530159895160509937850885037254363"
-                 "1423596795951899700429969112842764913119068299");
     assert(bw6_761_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        bw6_761_Fq::Rsquared = bigint_q(
-            "410173710550729835244256131339319232418037181415529408988358678008"
-            "337131002543531210418765667118526087296627284304957029592342298086"
-            "677137781899438438783090920915449892454598380340650741080836049574"
-            "9428678951279422657716620863065");
-        bw6_761_Fq::Rcubed = bigint_q(
-            "297415514632118086526834853439131925910825545338380841392089322640"
-            "624198677430665521626961318971291885148318712859327336480040754936"
-            "765047304839676586453060891603903912680899124818868997690823101153"
-            "644786484398736894438670450156");
+        bw6_761_Fq::Rsquared = bigint_q::from_hex(
+            "ad253c2da8d8078f1b0953b886cda4121e5c630b103f50ac731bfa0c536dfeac52"
+            "e458c6e57af92c7a26bf8c995976972c69400d5930ae4afb427b73a1ed40d6ec28"
+            "f848329d887fa1e825c1d2b4597b14c9b2f79484abc686392d2d1fa659");
+        bw6_761_Fq::Rcubed = bigint_q::from_hex(
+            "c8e01d806a287fc83c30d5eb54d4181f6c11c53622555fe3845e4652b05270ab76"
+            "47e419244316fa0d71c4337e2819327f537e5458903fd78b3bfc15d1c3547da46d"
+            "d1c3e37331221c21aeec79db8eccfa22f5872ee0d818e6b2fcbe1bdec");
 
         bw6_761_Fq::inv = 0xa5593568fa798dd;
     }
     if (sizeof(mp_limb_t) == 4) {
-        bw6_761_Fq::Rsquared = bigint_q(
-            "410173710550729835244256131339319232418037181415529408988358678008"
-            "337131002543531210418765667118526087296627284304957029592342298086"
-            "677137781899438438783090920915449892454598380340650741080836049574"
-            "9428678951279422657716620863065");
-        bw6_761_Fq::Rcubed = bigint_q(
-            "297415514632118086526834853439131925910825545338380841392089322640"
-            "624198677430665521626961318971291885148318712859327336480040754936"
-            "765047304839676586453060891603903912680899124818868997690823101153"
-            "644786484398736894438670450156");
+        bw6_761_Fq::Rsquared = bigint_q::from_hex(
+            "ad253c2da8d8078f1b0953b886cda4121e5c630b103f50ac731bfa0c536dfeac52"
+            "e458c6e57af92c7a26bf8c995976972c69400d5930ae4afb427b73a1ed40d6ec28"
+            "f848329d887fa1e825c1d2b4597b14c9b2f79484abc686392d2d1fa659");
+        bw6_761_Fq::Rcubed = bigint_q::from_hex(
+            "c8e01d806a287fc83c30d5eb54d4181f6c11c53622555fe3845e4652b05270ab76"
+            "47e419244316fa0d71c4337e2819327f537e5458903fd78b3bfc15d1c3547da46d"
+            "d1c3e37331221c21aeec79db8eccfa22f5872ee0d818e6b2fcbe1bdec");
         bw6_761_Fq::inv = 0x8fa798dd;
     }
     bw6_761_Fq::num_bits = 761;
-    bw6_761_Fq::euler =
-        bigint_q("3445725192157866269698394841137828771239834456268075054756895"
-                 "0801048117111217458680438415916447058438204322838768933067255"
-                 "8087956027712387967475584956265079947580254968925442518627181"
-                 "5711798397975949850214984556421382456559534149");
+    bw6_761_Fq::euler = bigint_q::from_hex(
+        "9174127dc1e70568c3e4a0027d7f9f5c930c3540e8a34429413af7c043df20b83dd31c"
+        "72c2748c81e75d7f92da11824344e476897cfec838ee69ee39f5ff974c508b612b33d4"
+        "7c0b067c577578521bf3489f34380000417a4e800000000045");
     bw6_761_Fq::s = 1;
-    bw6_761_Fq::t =
-        bigint_q("3445725192157866269698394841137828771239834456268075054756895"
-                 "0801048117111217458680438415916447058438204322838768933067255"
-                 "8087956027712387967475584956265079947580254968925442518627181"
-                 "5711798397975949850214984556421382456559534149");
-    bw6_761_Fq::t_minus_1_over_2 =
-        bigint_q("1722862596078933134849197420568914385619917228134037527378447"
-                 "5400524058555608729340219207958223529219102161419384466533627"
-                 "9043978013856193983737792478132539973790127484462721259313590"
-                 "7855899198987974925107492278210691228279767074");
-    bw6_761_Fq::multiplicative_generator = bw6_761_Fq("2");
-    bw6_761_Fq::root_of_unity =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298");
-    bw6_761_Fq::nqr = bw6_761_Fq("2");
-    bw6_761_Fq::nqr_to_t =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298");
+    bw6_761_Fq::t = bigint_q::from_hex(
+        "9174127dc1e70568c3e4a0027d7f9f5c930c3540e8a34429413af7c043df20b83dd31c"
+        "72c2748c81e75d7f92da11824344e476897cfec838ee69ee39f5ff974c508b612b33d4"
+        "7c0b067c577578521bf3489f34380000417a4e800000000045");
+    bw6_761_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "48ba093ee0f382b461f250013ebfcfae49861aa07451a214a09d7be021ef905c1ee98e"
+        "39613a4640f3aebfc96d08c121a2723b44be7f641c7734f71cfaffcba62845b09599ea"
+        "3e05833e2bbabc290df9a44f9a1c000020bd27400000000022");
+    bw6_761_Fq::multiplicative_generator = bw6_761_Fq::from_montgomery_hex(
+        "a3eefde24fd0fbaf503d773ecb53be8b0914c7ce22045ef6acb100116390f846a5cffc"
+        "8c5e42074e9b4b7fb95a720b81cccf44a4904817d9d3967c3b297017b4d5fe641dc8fb"
+        "e93d32dc8704ff55bcb4b04c6b1fff19ce0405ffffffff0baa");
+    bw6_761_Fq::root_of_unity = bw6_761_Fq::from_montgomery_hex(
+        "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28be3a"
+        "9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be36179047832b"
+        "0377738a6b6870f9598c391832e000739bf29a000000007ab6");
+    bw6_761_Fq::nqr = bw6_761_Fq::from_montgomery_hex(
+        "a3eefde24fd0fbaf503d773ecb53be8b0914c7ce22045ef6acb100116390f846a5cffc"
+        "8c5e42074e9b4b7fb95a720b81cccf44a4904817d9d3967c3b297017b4d5fe641dc8fb"
+        "e93d32dc8704ff55bcb4b04c6b1fff19ce0405ffffffff0baa");
+    bw6_761_Fq::nqr_to_t = bw6_761_Fq::from_montgomery_hex(
+        "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28be3a"
+        "9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be36179047832b"
+        "0377738a6b6870f9598c391832e000739bf29a000000007ab6");
     bw6_761_Fq::static_init();
 
     // Parameters for Fq3
-    bw6_761_Fq3::euler = bigint<3 * bw6_761_q_limbs>(
-        "1636446854262954003249141699409548889559206196373633220512096143268984"
-        "5397014880568641901171928604942518055908462554673180677727867910667998"
-        "4663099143697116161447047621868304705520956489172590015220902479424161"
-        "5633521368602921395669003930971333893630420619714613478078837246039873"
-        "3124493326270446151854198371345979937646860351442184846671768256523932"
-        "2945704382553665794724881767934477627356011124130848888786345848916593"
-        "9567481576923242781572039862743001907835119097653682898829629358506603"
-        "8893699793468601168791027807574316427084928535262789988925129164000203"
-        "2048904566729137025370148302740362549750397891505412715221417910833483"
-        "274288268810463328915955262815220574933205354950574767449");
+    bw6_761_Fq3::euler = bigint<3 * bw6_761_q_limbs>::from_hex(
+        "bbd304b41de2524fcac979bfb80f412d1d0e85a7c22cc546ccd77072556bd9f017ffe8"
+        "3c27fe71ea8cc9acc246e52f12d6973d21e31d1f6d5e7945ebe307e8638f311c9e3052"
+        "9c1ee06ed50b50eeeb294487c4acedd0ebba5b4cea2885610abd65401afb574cfcb63d"
+        "1f89062d116a3f6e4125be3467c32d49abe806149fa5a7ecfb16a6f49570eabb1282cf"
+        "a244ffd7f27328c07db587cdc9c2c8eea4dabd07f90212b2f32e7e21afe78b8211d81a"
+        "08698800b0455935bc53ab56bf7cd65e48518be841e7251f62930bd864e0c0dbbf201a"
+        "4249e2ce1b37a713ba53de9eae95848737502d25ec737d12c726dee66094aa0f7635c0"
+        "f81973a873366dc376f778926d833017d26e563233cabdcbef3733b7e839e9576bcf80"
+        "0000147d59");
     bw6_761_Fq3::s = 1;
-    bw6_761_Fq3::t = bigint<3 * bw6_761_q_limbs>(
-        "1636446854262954003249141699409548889559206196373633220512096143268984"
-        "5397014880568641901171928604942518055908462554673180677727867910667998"
-        "4663099143697116161447047621868304705520956489172590015220902479424161"
-        "5633521368602921395669003930971333893630420619714613478078837246039873"
-        "3124493326270446151854198371345979937646860351442184846671768256523932"
-        "2945704382553665794724881767934477627356011124130848888786345848916593"
-        "9567481576923242781572039862743001907835119097653682898829629358506603"
-        "8893699793468601168791027807574316427084928535262789988925129164000203"
-        "2048904566729137025370148302740362549750397891505412715221417910833483"
-        "274288268810463328915955262815220574933205354950574767449");
-    bw6_761_Fq3::t_minus_1_over_2 = bigint<3 * bw6_761_q_limbs>(
-        "8182234271314770016245708497047744447796030981868166102560480716344922"
-        "6985074402843209505859643024712590279542312773365903388639339553339992"
-        "3315495718485580807235238109341523527604782445862950076104512397120807"
-        "8167606843014606978345019654856669468152103098573067390394186230199366"
-        "5622466631352230759270991856729899688234301757210924233358841282619661"
-        "4728521912768328973624408839672388136780055620654244443931729244582969"
-        "7837407884616213907860199313715009539175595488268414494148146792533019"
-        "4468498967343005843955139037871582135424642676313949944625645820001016"
-        "0244522833645685126850741513701812748751989457527063576107089554167416"
-        "37144134405231664457977631407610287466602677475287383724");
+    bw6_761_Fq3::t = bigint<3 * bw6_761_q_limbs>::from_hex(
+        "bbd304b41de2524fcac979bfb80f412d1d0e85a7c22cc546ccd77072556bd9f017ffe8"
+        "3c27fe71ea8cc9acc246e52f12d6973d21e31d1f6d5e7945ebe307e8638f311c9e3052"
+        "9c1ee06ed50b50eeeb294487c4acedd0ebba5b4cea2885610abd65401afb574cfcb63d"
+        "1f89062d116a3f6e4125be3467c32d49abe806149fa5a7ecfb16a6f49570eabb1282cf"
+        "a244ffd7f27328c07db587cdc9c2c8eea4dabd07f90212b2f32e7e21afe78b8211d81a"
+        "08698800b0455935bc53ab56bf7cd65e48518be841e7251f62930bd864e0c0dbbf201a"
+        "4249e2ce1b37a713ba53de9eae95848737502d25ec737d12c726dee66094aa0f7635c0"
+        "f81973a873366dc376f778926d833017d26e563233cabdcbef3733b7e839e9576bcf80"
+        "0000147d59");
+    bw6_761_Fq3::t_minus_1_over_2 = bigint<3 * bw6_761_q_limbs>::from_hex(
+        "5de9825a0ef12927e564bcdfdc07a0968e8742d3e11662a3666bb8392ab5ecf80bfff4"
+        "1e13ff38f54664d661237297896b4b9e90f18e8fb6af3ca2f5f183f431c7988e4f1829"
+        "4e0f70376a85a8777594a243e25676e875dd2da6751442b0855eb2a00d7daba67e5b1e"
+        "8fc4831688b51fb72092df1a33e196a4d5f4030a4fd2d3f67d8b537a4ab8755d894167"
+        "d1227febf93994603edac3e6e4e16477526d5e83fc81095979973f10d7f3c5c108ec0d"
+        "0434c4005822ac9ade29d5ab5fbe6b2f2428c5f420f3928fb14985ec3270606ddf900d"
+        "2124f1670d9bd389dd29ef4f574ac2439ba81692f639be8963936f73304a5507bb1ae0"
+        "7c0cb9d4399b36e1bb7bbc4936c1980be9372b1919e55ee5f79b99dbf41cf4abb5e7c0"
+        "00000a3eac");
     bw6_761_Fq3::nqr =
-        bw6_761_Fq3(bw6_761_Fq("0"), bw6_761_Fq("1"), bw6_761_Fq("0"));
+        bw6_761_Fq3(bw6_761_Fq::zero(), bw6_761_Fq::one(), bw6_761_Fq::zero());
     bw6_761_Fq3::nqr_to_t = bw6_761_Fq3(
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298"),
-        bw6_761_Fq("0"),
-        bw6_761_Fq("0"));
-    bw6_761_Fq3::non_residue =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068295");
+        bw6_761_Fq::from_montgomery_hex(
+            "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28"
+            "be3a9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be3617"
+            "9047832b0377738a6b6870f9598c391832e000739bf29a000000007ab6"),
+        bw6_761_Fq::zero(),
+        bw6_761_Fq::zero());
+    bw6_761_Fq3::non_residue = bw6_761_Fq::from_montgomery_hex(
+        "fdf24e3267fa1e446f17918c5f57005c3a0745675e8452b7ab89dede485a9253abac78"
+        "b24d4e236a66defed8b361f20979f350dcd36af130127ac071851e2dc79630bc713d5a"
+        "1db1b4384fcbe29cf663c1e3faa001cd69e12e00000001e9c2");
     bw6_761_Fq3::nqr =
-        bw6_761_Fq3(bw6_761_Fq("0"), bw6_761_Fq("1"), bw6_761_Fq("0"));
+        bw6_761_Fq3(bw6_761_Fq::zero(), bw6_761_Fq::one(), bw6_761_Fq::zero());
     bw6_761_Fq3::nqr_to_t = bw6_761_Fq3(
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298"),
-        bw6_761_Fq("0"),
-        bw6_761_Fq("0"));
-    bw6_761_Fq3::Frobenius_coeffs_c1[0] = bw6_761_Fq("1");
-    bw6_761_Fq3::Frobenius_coeffs_c1[1] =
-        bw6_761_Fq("49224645602255232421181789425750803910820025302323243810630"
-                   "48548642823052024664478336818169867474395270858391911405337"
-                   "70724773573982666493944449046954210939153048282672820358254"
-                   "9674992333383150446779312029624171857054392282775648");
-    bw6_761_Fq3::Frobenius_coeffs_c1[2] =
-        bw6_761_Fq("19689858240902092972786107397005771513976663823038257284507"
-                   "41611566800370218827257750865013421937292370006175842381275"
-                   "74391402338072758281990502122958319220742112227265030526782"
-                   "2868639090213645505120388400344940985710520836292650");
-    bw6_761_Fq3::Frobenius_coeffs_c2[0] = bw6_761_Fq("1");
-    bw6_761_Fq3::Frobenius_coeffs_c2[1] =
-        bw6_761_Fq("19689858240902092972786107397005771513976663823038257284507"
-                   "41611566800370218827257750865013421937292370006175842381275"
-                   "74391402338072758281990502122958319220742112227265030526782"
-                   "2868639090213645505120388400344940985710520836292650");
-    bw6_761_Fq3::Frobenius_coeffs_c2[2] =
-        bw6_761_Fq("49224645602255232421181789425750803910820025302323243810630"
-                   "48548642823052024664478336818169867474395270858391911405337"
-                   "70724773573982666493944449046954210939153048282672820358254"
-                   "9674992333383150446779312029624171857054392282775648");
+        bw6_761_Fq::from_montgomery_hex(
+            "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28"
+            "be3a9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be3617"
+            "9047832b0377738a6b6870f9598c391832e000739bf29a000000007ab6"),
+        bw6_761_Fq::zero(),
+        bw6_761_Fq::zero());
+    bw6_761_Fq3::Frobenius_coeffs_c1[0] = bw6_761_Fq::one();
+    bw6_761_Fq3::Frobenius_coeffs_c1[1] = bw6_761_Fq::from_montgomery_hex(
+        "1100249ae760b932d658fd49661c4720411f03c36cf5c3c5bd7d20b4f9a3ce29f43ed0"
+        "e063a81d0d3ac39de759c0ffd0425bedbac1dfdc7ef6c92fb771d59f14b6163bba7527"
+        "a5649b046fd9ce14bbcd59782096496171f7f96b51bd840c549");
+    bw6_761_Fq3::Frobenius_coeffs_c1[2] = bw6_761_Fq::from_montgomery_hex(
+        "e3d6815769a8049e01e3efd42e902c28b5b634e5c22ea4cdd6c153a8c377241e607765"
+        "7ea02f5d8ca3965ff91efd0648076b5c278dd94d0763497f5325ec600b75ca96f69859"
+        "a543d03c1cb68051d49d32d491eb6a5cff67a04ae427bfb5f8");
+    bw6_761_Fq3::Frobenius_coeffs_c2[0] = bw6_761_Fq::one();
+    bw6_761_Fq3::Frobenius_coeffs_c2[1] = bw6_761_Fq::from_montgomery_hex(
+        "e3d6815769a8049e01e3efd42e902c28b5b634e5c22ea4cdd6c153a8c377241e607765"
+        "7ea02f5d8ca3965ff91efd0648076b5c278dd94d0763497f5325ec600b75ca96f69859"
+        "a543d03c1cb68051d49d32d491eb6a5cff67a04ae427bfb5f8");
+    bw6_761_Fq3::Frobenius_coeffs_c2[2] = bw6_761_Fq::from_montgomery_hex(
+        "1100249ae760b932d658fd49661c4720411f03c36cf5c3c5bd7d20b4f9a3ce29f43ed0"
+        "e063a81d0d3ac39de759c0ffd0425bedbac1dfdc7ef6c92fb771d59f14b6163bba7527"
+        "a5649b046fd9ce14bbcd59782096496171f7f96b51bd840c549");
 
     // Parameters for the field Fq^6
-    bw6_761_Fq6::non_residue =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068295");
-    bw6_761_Fq6::Frobenius_coeffs_c1[0] = bw6_761_Fq("1");
-    bw6_761_Fq6::Frobenius_coeffs_c1[1] =
-        bw6_761_Fq("49224645602255232421181789425750803910820025302323243810630"
-                   "48548642823052024664478336818169867474395270858391911405337"
-                   "70724773573982666493944449046954210939153048282672820358254"
-                   "9674992333383150446779312029624171857054392282775649");
-    bw6_761_Fq6::Frobenius_coeffs_c1[2] =
-        bw6_761_Fq("49224645602255232421181789425750803910820025302323243810630"
-                   "48548642823052024664478336818169867474395270858391911405337"
-                   "70724773573982666493944449046954210939153048282672820358254"
-                   "9674992333383150446779312029624171857054392282775648");
-    bw6_761_Fq6::Frobenius_coeffs_c1[3] =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298");
-    bw6_761_Fq6::Frobenius_coeffs_c1[4] =
-        bw6_761_Fq("19689858240902092972786107397005771513976663823038257284507"
-                   "41611566800370218827257750865013421937292370006175842381275"
-                   "74391402338072758281990502122958319220742112227265030526782"
-                   "2868639090213645505120388400344940985710520836292650");
-    bw6_761_Fq6::Frobenius_coeffs_c1[5] =
-        bw6_761_Fq("19689858240902092972786107397005771513976663823038257284507"
-                   "41611566800370218827257750865013421937292370006175842381275"
-                   "74391402338072758281990502122958319220742112227265030526782"
-                   "2868639090213645505120388400344940985710520836292651");
+    bw6_761_Fq6::non_residue = bw6_761_Fq::from_montgomery_hex(
+        "fdf24e3267fa1e446f17918c5f57005c3a0745675e8452b7ab89dede485a9253abac78"
+        "b24d4e236a66defed8b361f20979f350dcd36af130127ac071851e2dc79630bc713d5a"
+        "1db1b4384fcbe29cf663c1e3faa001cd69e12e00000001e9c2");
+    bw6_761_Fq6::Frobenius_coeffs_c1[0] = bw6_761_Fq::one();
+    bw6_761_Fq6::Frobenius_coeffs_c1[1] = bw6_761_Fq::from_montgomery_hex(
+        "3f11a3a41a26063385e55030cc6f12907062359c0f17e384abb49bd7c4471d521b2ed3"
+        "66e4b9bb772b249f2c9525fe3e825d90eb6c24436a798a5d20c612ce8d2b4c2b5fcf4f"
+        "52d23cbc9234705263495e69d68495a3838cfcb51bd8404a93");
+    bw6_761_Fq6::Frobenius_coeffs_c1[2] = bw6_761_Fq::from_montgomery_hex(
+        "1100249ae760b932d658fd49661c4720411f03c36cf5c3c5bd7d20b4f9a3ce29f43ed0"
+        "e063a81d0d3ac39de759c0ffd0425bedbac1dfdc7ef6c92fb771d59f14b6163bba7527"
+        "a5649b046fd9ce14bbcd59782096496171f7f96b51bd840c549");
+    bw6_761_Fq6::Frobenius_coeffs_c1[3] = bw6_761_Fq::from_montgomery_hex(
+        "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28be3a"
+        "9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be36179047832b"
+        "0377738a6b6870f9598c391832e000739bf29a000000007ab6");
+    bw6_761_Fq6::Frobenius_coeffs_c1[4] = bw6_761_Fq::from_montgomery_hex(
+        "e3d6815769a8049e01e3efd42e902c28b5b634e5c22ea4cdd6c153a8c377241e607765"
+        "7ea02f5d8ca3965ff91efd0648076b5c278dd94d0763497f5325ec600b75ca96f69859"
+        "a543d03c1cb68051d49d32d491eb6a5cff67a04ae427bfb5f8");
+    bw6_761_Fq6::Frobenius_coeffs_c1[5] = bw6_761_Fq::from_montgomery_hex(
+        "12e5db4d0dc277a422396b6e993accb514282e4b01ea4bf6aaa3e430ed815ed137b92a"
+        "df4a674830228120b018130782640a1166dbffc8827040e0fccea53d4d3fb306af152e"
+        "a1cc5cb1b14e0f587b10f9bc5f0b69e96375064ae427bf3b42");
 
     bw6_761_Fq6::my_Fp2::non_residue = bw6_761_Fq3::non_residue;
 
     // Choice of short Weierstrass curve and its twist
     // E: y^2 = x^3 - 1
     // bw6_761_coeff_b = -1
-    bw6_761_coeff_b =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068298");
+    bw6_761_coeff_b = bw6_761_Fq::from_montgomery_hex(
+        "d0f0a60a5be58cf9dfaa846595555f73a18e069ac04458d72c1d6f77d5f5c54d28be3a"
+        "9f55c8155c81153f4906e9fec5a3614ac0b1d98484f3089e56574722be36179047832b"
+        "0377738a6b6870f9598c391832e000739bf29a000000007ab6");
     // E': y^2 = x^3 - 1 * (-4) = y^2 = x^3 + 4
     // bw6_761_twist = -4
-    bw6_761_twist =
-        bw6_761_Fq("68914503843157325393967896822756575424796689125361501095137"
-                   "90160209623422243491736087683183289411687640864567753786613"
-                   "45116175912055424775934951169912530159895160509937850885037"
-                   "2543631423596795951899700429969112842764913119068295");
+    bw6_761_twist = bw6_761_Fq::from_montgomery_hex(
+        "fdf24e3267fa1e446f17918c5f57005c3a0745675e8452b7ab89dede485a9253abac78"
+        "b24d4e236a66defed8b361f20979f350dcd36af130127ac071851e2dc79630bc713d5a"
+        "1db1b4384fcbe29cf663c1e3faa001cd69e12e00000001e9c2");
     // We use a M-twist here, hence:
     // bw6_761_twist_coeff_b = bw6_761_coeff_b * bw6_761_twist;
-    bw6_761_twist_coeff_b = bw6_761_Fq("4");
+    bw6_761_twist_coeff_b = bw6_761_Fq::from_montgomery_hex(
+        "24f5d6c91bd3ec8d18b1ae789ba83e5cec11251a72c2359ad6ec10a23f63af1ccff9c0"
+        "33379af59967dc004d00c1127d0fd59c3626929f41ca591c0266e100d10ae605e52a4e"
+        "da6458c05f1f0e074182cf5a6dcffe3319136efffffffe16c9");
 
     // Choice of group G1
     // Identities
     bw6_761_G1::G1_zero =
         bw6_761_G1(bw6_761_Fq::zero(), bw6_761_Fq::one(), bw6_761_Fq::zero());
     bw6_761_G1::G1_one = bw6_761_G1(
-        bw6_761_Fq("62387722575946793680321456936228128387790058097608247331387"
-                   "87810501188623461307351759238099287535516224314149266511977"
-                   "13214082863595094002179048950761175436631780181109081136794"
-                   "5064510304504157188661901055903167026722666149426237"),
-        bw6_761_Fq("21017351265208974239115045622158349511481275559133679971627"
-                   "89335052900271653517958562461315794228241561913734371411178"
-                   "22693652768320387955309393418595047097184897208532179795812"
-                   "4416462268292467002957525517188485984766314758624099"),
+        bw6_761_Fq::from_montgomery_hex(
+            "f4d17cd48beca591d4e7365c43edac0f481c06a8d02a043a4b78d67ba5f6ab6913"
+            "b4bfbc9e949addf8cb12306266fe352785830727aea5f1a9ac17cf8685c91a585c"
+            "895a42298564648b044098b4d24bb886eddbc3fc21d6e42d7614c2d770"),
+        bw6_761_Fq::from_montgomery_hex(
+            "9d1eb23b7cf684e217e407e218695f42326e7db7357c998f95d3fcf765da8eaa6a"
+            "9ec7a38dd791d7ee0c9e273de139e9bf99a43a0885d28fe37f21a33897bed544c4"
+            "df10b9889a1eba7a37cb9eab4d870d844e1ee6dd0897e805c4bd16411f"),
         bw6_761_Fq::one());
 
     // Curve coeffs
@@ -300,9 +287,9 @@ void init_bw6_761_params()
     bw6_761_G1::coeff_b = bw6_761_coeff_b;
 
     // Cofactor
-    bw6_761_G1::h = bigint<bw6_761_G1::h_limbs>(
-        "2664243587933581668398767770148807386775111827005265065594210250231297"
-        "7592501693353047140953112195348280268661194876");
+    bw6_761_G1::h = bigint<bw6_761_G1::h_limbs>::from_hex(
+        "ad1972339049ce762c77d5ac34cb12efc856a0853c9db94cc61c554757551c0c832ba4"
+        "061000003b3de580000000007c");
 
     // WNAF
     //
@@ -366,14 +353,14 @@ void init_bw6_761_params()
     bw6_761_G2::G2_zero =
         bw6_761_G2(bw6_761_Fq::zero(), bw6_761_Fq::one(), bw6_761_Fq::zero());
     bw6_761_G2::G2_one = bw6_761_G2(
-        bw6_761_Fq("64453329105969793360358881527740716268988861397741013649339"
-                   "48236926875073754470830732273879639675437155036544153105017"
-                   "72959260056063167855429956276229474392791242909663615640117"
-                   "1909259073181112518725201388196280039960074422214428"),
-        bw6_761_Fq("56292365808953971938692216344454738775758653474108026394695"
-                   "34015951552119346305989993003963171041825980447937581532149"
-                   "72605680357108252243146746187917218885078195819486220416605"
-                   "630144001533548163105316661692978285266378674355041"),
+        bw6_761_Fq::from_montgomery_hex(
+            "11027e203edd9f473a8b8cc0ad09e0c8ccc2ae90a0f094f8165c00a39341e95ffc"
+            "8e7ad0605e7800943fce635b02ee94df125e09b92d1a6be31a1e0fb768fe317a76"
+            "82def1ecb9dc2b3c0d6646c5673864e451b8a9c05dd3d902a84cd9f4f78"),
+        bw6_761_Fq::from_montgomery_hex(
+            "114976e5b0db28072a63c78744098408d6a0fc1fbcad35efa355d17afe6945fac0"
+            "bd1e822b8d6dab6360bb9560b369fdbdf642af5694c363abbdaa9bb6b1291acb6a"
+            "09fda11d0aba27b70c9c945a38c6b957244aa8f4e6b9a159be4e773f67c"),
         bw6_761_Fq::one());
 
     // Curve coeffs
@@ -381,9 +368,9 @@ void init_bw6_761_params()
     bw6_761_G2::coeff_b = bw6_761_twist_coeff_b;
 
     // Cofactor
-    bw6_761_G2::h = bigint<bw6_761_G2::h_limbs>(
-        "2664243587933581668398767770148807386775111827005265065594210250231297"
-        "7592501693353047140953112195348280268661194869");
+    bw6_761_G2::h = bigint<bw6_761_G2::h_limbs>::from_hex(
+        "ad1972339049ce762c77d5ac34cb12efc856a0853c9db94cc61c554757551c0c832ba4"
+        "061000003b3de5800000000075");
 
     // wNAF window table
     bw6_761_G2::wnaf_window_table.resize(0);
@@ -444,13 +431,13 @@ void init_bw6_761_params()
     // ate_opt(P,Q) = (f_{u^3-u^2-u,Q}(P)f^{q}_{u+1,Q}(P))^(q^6 - 1)/r
     //
     // u+1
-    bw6_761_ate_loop_count1 = bigint_q("9586122913090633730");
+    bw6_761_ate_loop_count1 = bigint_q::from_hex("8508c00000000002");
     // u^3-u^2-u
-    bw6_761_ate_loop_count2 =
-        bigint_q("880904806456922042166256752416502360955572640081583800319");
+    bw6_761_ate_loop_count2 = bigint_q::from_hex(
+        "23ed1347970dec008a442f991fffffffffffffffffffffff");
     bw6_761_ate_is_loop_count_neg = false;
     // u
-    bw6_761_final_exponent_z = bigint_q("9586122913090633729");
+    bw6_761_final_exponent_z = bigint_q::from_hex("8508c00000000001");
     bw6_761_final_exponent_is_z_neg = false;
 }
 
@@ -17,8 +17,8 @@ const mp_size_t bw6_761_r_limbs =
 const mp_size_t bw6_761_q_limbs =
     (bw6_761_q_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<bw6_761_r_limbs> bw6_761_modulus_r;
-extern bigint<bw6_761_q_limbs> bw6_761_modulus_q;
+extern const bigint<bw6_761_r_limbs> bw6_761_modulus_r;
+extern const bigint<bw6_761_q_limbs> bw6_761_modulus_q;
 
 typedef Fp_model<bw6_761_r_limbs, bw6_761_modulus_r> bw6_761_Fr;
 typedef Fp_model<bw6_761_q_limbs, bw6_761_modulus_q> bw6_761_Fq;
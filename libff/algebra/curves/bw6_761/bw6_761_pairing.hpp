@@ -2,6 +2,7 @@
 #define BW6_761_PAIRING_HPP_
 
 #include <libff/algebra/curves/bw6_761/bw6_761_init.hpp>
+#include <libff/algebra/curves/pairing_serialization.hpp>
 #include <vector>
 
 namespace libff
@@ -97,6 +98,33 @@ bw6_761_Fq6 bw6_761_pairing(const bw6_761_G1 &P, const bw6_761_G2 &Q);
 
 bw6_761_GT bw6_761_reduced_pairing(const bw6_761_G1 &P, const bw6_761_G2 &Q);
 
+namespace internal
+{
+
+// The BW6-761 precomputed G2 value holds two precomputed iterations, each of
+// which has the generic { QX, QY, coeffs } layout.
+template<form_t Form> class g2_precomp_codec<Form, bw6_761_ate_G2_precomp>
+{
+public:
+    using iteration_codec =
+        g2_precomp_codec<Form, bw6_761_ate_G2_precomp_iteration>;
+
+    static void write(
+        const bw6_761_ate_G2_precomp &precomp, std::ostream &out_s)
+    {
+        iteration_codec::write(precomp.precomp_1, out_s);
+        iteration_codec::write(precomp.precomp_2, out_s);
+    }
+
+    static void read(bw6_761_ate_G2_precomp &precomp, std::istream &in_s)
+    {
+        iteration_codec::read(precomp.precomp_1, in_s);
+        iteration_codec::read(precomp.precomp_2, in_s);
+    }
+};
+
+} // namespace internal
+
 } // namespace libff
 
 #endif // BW6_761_PAIRING_HPP_
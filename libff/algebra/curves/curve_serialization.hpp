@@ -12,16 +12,81 @@
 #include "libff/algebra/serialization.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace libff
 {
 
+/// Checks performed on group elements as they are read by group_read and
+/// group_read_vector.
+enum group_check_t : uint8_t {
+    group_check_none = 0,
+    /// Check that each element is well-formed (i.e. on the curve).
+    group_check_well_formed = 1,
+    /// Check that each element is well-formed and in the prime-order
+    /// subgroup.
+    group_check_subgroup = 2,
+};
+
+/// Size in bytes of the encoding_binary encoding of elements of GroupT, with
+/// the given compression (for either form).
+template<compression_t Comp, typename GroupT>
+constexpr size_t group_binary_size();
+
+/// Encode v to the start of a caller-owned buffer of buffer_size bytes,
+/// returning the number of bytes written. Throws std::runtime_error if the
+/// buffer is too small.
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+size_t group_encode(const GroupT &v, void *buffer, const size_t buffer_size);
+
+/// Decode v from the start of a buffer of buffer_size bytes, returning the
+/// number of bytes consumed. Unlike group_read, no checks are performed on
+/// the decoded element (other than those inherent to decoding compressed
+/// elements). Throws std::runtime_error if the buffer is too small
+/// or the encoding is invalid.
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+size_t group_decode(GroupT &v, const void *buffer, const size_t buffer_size);
+
+/// Read a single group element, performing the given check. Compressed
+/// elements are always checked to be on the curve as they are decoded.
+/// Uncompressed elements are by default checked against the affine curve
+/// equation, at the cost of a few field multiplications. Pass
+/// group_check_none only for trusted data. Throws std::runtime_error if the
+/// data is invalid or the check fails.
 template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
-void group_read(GroupT &v, std::istream &in_s);
+void group_read(
+    GroupT &v,
+    std::istream &in_s,
+    const group_check_t check = group_check_well_formed);
 
 template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
 void group_write(const GroupT &v, std::ostream &out_s);
 
+/// Write a vector of group elements. Elements are converted to affine form
+/// together (requiring one field inversion per chunk of elements, rather than
+/// one per element) and encoded in parallel if MULTICORE is enabled. This is
+/// done in fixed-size blocks, so that memory use does not grow with the size
+/// of the vector.
+///
+/// For encoding_binary, the output is the number of elements (4-byte,
+/// big-endian), followed by the group_write encoding of each element. For
+/// encoding_json, the output is a json array of the group_write encodings.
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void group_write_vector(const std::vector<GroupT> &v, std::ostream &out_s);
+
+/// Read a vector of group elements written by group_write_vector, performing
+/// the given checks on each element. For binary encodings, the data is read
+/// in large blocks, and the elements of each block are decoded and checked in
+/// parallel (if MULTICORE is enabled). For encoding_json, elements are parsed
+/// sequentially and checked in parallel. As for group_read, elements are by
+/// default checked to be well-formed. Throws std::runtime_error if the data
+/// is invalid or any check fails.
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void group_read_vector(
+    std::vector<GroupT> &v,
+    std::istream &in_s,
+    const group_check_t check = group_check_well_formed);
+
 } // namespace libff
 
 #include "libff/algebra/curves/curve_serialization.tcc"
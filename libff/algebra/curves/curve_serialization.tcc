@@ -11,7 +11,14 @@
 
 #include "libff/algebra/curves/curve_serialization.hpp"
 #include "libff/algebra/curves/curve_utils.hpp"
+#include "libff/algebra/curves/subgroup_check.hpp"
 #include "libff/algebra/fields/field_serialization.hpp"
+#include "libff/common/parallel.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace libff
 {
@@ -22,8 +29,17 @@ namespace internal
 // Generic class to implement group element read and write methods for various
 // combinations of parameters. Expected to define at least methods:
 //
-//   static void write(const GroupT &group_el, std::ostream &out_s);
-//   static void read(GroupT &group_el, std::istream &in_s);
+//   template<typename OStreamT>
+//   static void write(const GroupT &group_el, OStreamT &out_s);
+//   template<typename OStreamT>
+//   static void write_affine(const GroupT &affine_el, OStreamT &out_s);
+//   template<typename IStreamT>
+//   static void read(GroupT &group_el, IStreamT &in_s);
+//
+// where write_affine requires that affine_el is already in affine form (as
+// returned by to_affine_coordinates), and the stream types are std::ostream
+// and std::istream, or buffer_writer and buffer_reader. Binary codecs also
+// define binary_size(), the size in bytes of the encoding of any element.
 template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
 class group_element_codec;
 
@@ -32,20 +48,29 @@ template<form_t Form, typename GroupT>
 class group_element_codec<encoding_json, Form, compression_off, GroupT>
 {
 public:
-    static void write(const GroupT &group_el, std::ostream &out_s)
+    using base_field =
+        typename std::decay<decltype(std::declval<GroupT>().X)>::type;
+    using field_codec = field_element_codec<encoding_json, Form, base_field>;
+
+    template<typename OStreamT>
+    static void write(const GroupT &group_el, OStreamT &out_s)
     {
         GroupT affine_p = group_el;
         affine_p.to_affine_coordinates();
-        out_s << "[";
-        field_write<encoding_json, Form>(affine_p.X, out_s);
-        out_s << ",";
-        field_write<encoding_json, Form>(affine_p.Y, out_s);
-        out_s << "]";
+        write_affine(affine_p, out_s);
     }
-    static void read(GroupT &group_el, std::istream &in_s)
+    template<typename OStreamT>
+    static void write_affine(const GroupT &affine_el, OStreamT &out_s)
+    {
+        out_s << '[';
+        field_codec::write(affine_el.X, out_s);
+        out_s << ',';
+        field_codec::write(affine_el.Y, out_s);
+        out_s << ']';
+    }
+    template<typename IStreamT>
+    static void read(GroupT &group_el, IStreamT &in_s)
     {
-        using base_field = typename std::decay<decltype(group_el.X)>::type;
-
         char sep;
 
         in_s >> sep;
@@ -53,14 +78,14 @@ public:
             throw std::runtime_error(
                 "expected opening bracket reading group element");
         }
-        field_read<encoding_json, Form>(group_el.X, in_s);
+        field_codec::read(group_el.X, in_s);
 
         in_s >> sep;
         if (sep != ',') {
             throw std::runtime_error("expected comma reading group element");
         }
 
-        field_read<encoding_json, Form>(group_el.Y, in_s);
+        field_codec::read(group_el.Y, in_s);
         in_s >> sep;
         if (sep != ']') {
             throw std::runtime_error(
@@ -80,18 +105,32 @@ template<form_t Form, typename GroupT>
 class group_element_codec<encoding_binary, Form, compression_off, GroupT>
 {
 public:
-    static void write(const GroupT &group_el, std::ostream &out_s)
+    using base_field =
+        typename std::decay<decltype(std::declval<GroupT>().X)>::type;
+    using field_codec = field_element_codec<encoding_binary, Form, base_field>;
+
+    static constexpr size_t binary_size()
+    {
+        return 2 * field_codec::binary_size();
+    }
+    template<typename OStreamT>
+    static void write(const GroupT &group_el, OStreamT &out_s)
     {
         GroupT affine_p = group_el;
         affine_p.to_affine_coordinates();
-        field_write<encoding_binary, Form>(affine_p.X, out_s);
-        field_write<encoding_binary, Form>(affine_p.Y, out_s);
+        write_affine(affine_p, out_s);
     }
-    static void read(GroupT &group_el, std::istream &in_s)
+    template<typename OStreamT>
+    static void write_affine(const GroupT &affine_el, OStreamT &out_s)
     {
-        using base_field = typename std::decay<decltype(group_el.X)>::type;
-        field_read<encoding_binary, Form>(group_el.X, in_s);
-        field_read<encoding_binary, Form>(group_el.Y, in_s);
+        field_codec::write(affine_el.X, out_s);
+        field_codec::write(affine_el.Y, out_s);
+    }
+    template<typename IStreamT>
+    static void read(GroupT &group_el, IStreamT &in_s)
+    {
+        field_codec::read(group_el.X, in_s);
+        field_codec::read(group_el.Y, in_s);
         if (group_el.X.is_zero() && group_el.Y == base_field::one()) {
             group_el.Z = base_field::zero();
         } else {
@@ -111,72 +150,586 @@ template<form_t Form, typename GroupT>
 class group_element_codec<encoding_binary, Form, compression_on, GroupT>
 {
 public:
-    static void write(const GroupT &group_el, std::ostream &out_s)
+    using coordinate_field =
+        typename std::decay<decltype(std::declval<GroupT>().X)>::type;
+
+    static constexpr size_t binary_size()
+    {
+        return field_binary_size<coordinate_field>();
+    }
+    template<typename OStreamT>
+    static void write(const GroupT &group_el, OStreamT &out_s)
     {
         if (!group_el.is_zero()) {
             GroupT affine(group_el);
             affine.to_affine_coordinates();
-
+            write_affine(affine, out_s);
+        } else {
+            write_zero(group_el, out_s);
+        }
+    }
+    template<typename OStreamT>
+    static void write_affine(const GroupT &affine_el, OStreamT &out_s)
+    {
+        if (!affine_el.is_zero()) {
             const mp_limb_t flags =
-                field_get_component_0(affine.Y).mont_repr.data[0] & 1;
+                field_get_component_0(affine_el.Y).mont_repr.data[0] & 1;
             field_write_with_flags<encoding_binary, Form>(
-                affine.X, flags, out_s);
+                affine_el.X, flags, out_s);
         } else {
-            // Use Montgomery encoding, to avoid wasting time reducing.
-            field_write_with_flags<encoding_binary, form_montgomery>(
-                group_el.X, 0x2, out_s);
+            write_zero(affine_el, out_s);
         }
     }
-    static void read(GroupT &group_el, std::istream &in_s)
+    template<typename IStreamT>
+    static void read(GroupT &group_el, IStreamT &in_s)
     {
-        using Fq = typename std::decay<decltype(group_el.X)>::type;
-
         mp_limb_t flags;
+        if (read_x(group_el, flags, in_s) && !recover_y(group_el, flags)) {
+            throw std::runtime_error("curve eqn has no solution at x");
+        }
+    }
+
+    /// Read the x coordinate and flags of an element. Returns false if the
+    /// element is zero (in which case group_el is fully decoded), otherwise
+    /// recover_y must be called to complete decoding.
+    template<typename IStreamT>
+    static bool read_x(GroupT &group_el, mp_limb_t &flags, IStreamT &in_s)
+    {
         field_read_with_flags<encoding_binary, Form>(group_el.X, flags, in_s);
-        if (0 == (flags & 0x2)) {
-
-#ifdef DEBUG
-            // This check has efficiency penalty under normal
-            // execution, so we only enable it in debug for
-            // now. TODO: this is a temporary solution that needs to
-            // be fixed in the long term: see issues #55
-            // https://github.com/clearmatics/libff/issues/55 and #70
-            // https://github.com/clearmatics/libff/issues/70
-            Fq x = group_el.X;
-            Fq x_squared = x * x;
-            Fq x_cubed = x_squared * x;
-            Fq y_squared = x_cubed + (GroupT::coeff_a * x) + GroupT::coeff_b;
-            if ((y_squared ^ Fq::euler) != Fq::one()) {
-                throw std::runtime_error("curve eqn has no solution at x");
+        if (0 != (flags & 0x2)) {
+            group_el = GroupT::zero();
+            return false;
+        }
+
+        return true;
+    }
+
+    /// Compute the y coordinate of an element from its x coordinate, choosing
+    /// the root indicated by the flags. Returns false if there is no point on
+    /// the curve with this x coordinate.
+    static bool recover_y(GroupT &group_el, const mp_limb_t flags)
+    {
+        if (!field_sqrt_if_square(
+                curve_y_squared_at_x<GroupT>(group_el.X), group_el.Y)) {
+            return false;
+        }
+
+        const mp_limb_t Y_lsb =
+            field_get_component_0(group_el.Y).mont_repr.data[0] & 1;
+        if (!group_el.Y.is_zero() && (flags & 1) != Y_lsb) {
+            group_el.Y = -group_el.Y;
+        }
+
+        group_el.Z = coordinate_field::one();
+        return true;
+    }
+
+protected:
+    template<typename OStreamT>
+    static void write_zero(const GroupT &zero_el, OStreamT &out_s)
+    {
+        // Use Montgomery encoding, to avoid wasting time reducing.
+        field_write_with_flags<encoding_binary, form_montgomery>(
+            zero_el.X, 0x2, out_s);
+    }
+};
+
+/// Convert all elements of a vector to affine form in place, using one field
+/// inversion per chunk. Chunks are processed in parallel (see parallel_for)
+/// if MULTICORE is enabled.
+template<typename GroupT>
+void group_batch_to_affine(std::vector<GroupT> &vec, const size_t num_chunks)
+{
+    const size_t chunk_size = (vec.size() + num_chunks - 1) / num_chunks;
+
+    parallel_for(0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+        for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+            const size_t begin = std::min(chunk * chunk_size, vec.size());
+            const size_t end = std::min(begin + chunk_size, vec.size());
+
+            std::vector<GroupT> non_zero;
+            non_zero.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                if (vec[i].is_zero()) {
+                    // No inversion is required for zero.
+                    vec[i].to_affine_coordinates();
+                } else {
+                    non_zero.push_back(vec[i]);
+                }
             }
-#endif // #ifdef DEBUG
 
-            group_el.Y = curve_point_y_at_x<GroupT>(group_el.X);
-            const mp_limb_t Y_lsb =
-                field_get_component_0(group_el.Y).mont_repr.data[0] & 1;
-            if ((flags & 1) != Y_lsb) {
-                group_el.Y = -group_el.Y;
+            // For all curves which support serialization, special form is
+            // affine form.
+            GroupT::batch_to_special_all_non_zeros(non_zero);
+            auto it = non_zero.begin();
+            for (size_t i = begin; i < end; ++i) {
+                if (!vec[i].is_zero()) {
+                    vec[i] = *it;
+                    ++it;
+                }
             }
+        }
+    });
+}
 
-            group_el.Z = Fq::one();
-        } else {
-            group_el = GroupT::zero();
+/// Number of chunks to use when processing num_elements in parallel, where
+/// each chunk should contain at least min_chunk_size elements.
+inline size_t group_vector_num_chunks(
+    const size_t num_elements, const size_t min_chunk_size)
+{
+    const size_t max_chunks = 4 * parallel_num_threads();
+    return std::max<size_t>(
+        1, std::min(max_chunks, num_elements / min_chunk_size));
+}
+
+inline size_t group_write_vector_num_chunks(const size_t num_elements)
+{
+    // Chunks must be large enough that the cost of the inversion is
+    // amortized.
+    return group_vector_num_chunks(num_elements, 1024);
+}
+
+/// Apply the given check to all elements, using batch_is_well_formed and
+/// batch_is_in_safe_subgroup. Well-formedness is not checked if the elements
+/// are already known to be well-formed. Throws std::runtime_error if any check
+/// fails.
+template<typename GroupT>
+void group_elements_check(
+    const GroupT *elements,
+    const size_t num_elements,
+    const group_check_t check,
+    const bool well_formed = false)
+{
+    if (check == group_check_none) {
+        return;
+    }
+
+    if ((!well_formed && !batch_is_well_formed(elements, num_elements)) ||
+        (check == group_check_subgroup &&
+         !batch_is_in_safe_subgroup(elements, num_elements))) {
+        throw std::runtime_error("invalid group element");
+    }
+}
+
+/// Apply the given check to a single element (see group_elements_check).
+template<typename GroupT>
+void group_element_check(
+    const GroupT &element,
+    const group_check_t check,
+    const bool well_formed = false)
+{
+    if (check == group_check_none) {
+        return;
+    }
+
+    if ((!well_formed && !element_is_well_formed(element, 0)) ||
+        (check == group_check_subgroup && !element.is_in_safe_subgroup())) {
+        throw std::runtime_error("invalid group element");
+    }
+}
+
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+class group_vector_codec
+{
+public:
+    // Binary encodings: 4-byte big-endian size, followed by the (fixed-size)
+    // encoding of each element. Elements are converted to affine form and
+    // encoded in blocks (so that neither a copy of the vector nor its full
+    // encoding is held in memory), each of which is processed in parallel.
+    static void write(const std::vector<GroupT> &vec, std::ostream &out_s)
+    {
+        const size_t block_size = 1 << 16;
+        const size_t element_size =
+            group_element_codec<Enc, Form, Comp, GroupT>::binary_size();
+
+        size_write_binary(vec.size(), out_s);
+
+        std::vector<GroupT> affine_block;
+        std::vector<char> buffer;
+        for (size_t block_begin = 0; block_begin < vec.size();
+             block_begin += block_size) {
+            const size_t block_end =
+                std::min(block_begin + block_size, vec.size());
+            affine_block.assign(
+                vec.begin() + block_begin, vec.begin() + block_end);
+
+            const size_t num_chunks =
+                group_write_vector_num_chunks(affine_block.size());
+            group_batch_to_affine(affine_block, num_chunks);
+            buffer.resize(affine_block.size() * element_size);
+            encode(
+                affine_block.data(),
+                affine_block.size(),
+                num_chunks,
+                buffer.data());
+            out_s.write(buffer.data(), buffer.size());
+        }
+    }
+
+    /// Encode num_elements (affine) elements to contiguous (fixed-size)
+    /// encodings in buffer, processing num_chunks chunks in parallel.
+    static void encode(
+        const GroupT *affine,
+        const size_t num_elements,
+        const size_t num_chunks,
+        char *buffer)
+    {
+        using codec = group_element_codec<Enc, Form, Comp, GroupT>;
+
+        const size_t element_size = codec::binary_size();
+        const size_t chunk_size = (num_elements + num_chunks - 1) / num_chunks;
+        const bool success = parallel_reduce(
+            0,
+            num_chunks,
+            1,
+            true,
+            [&](size_t chunks_begin, size_t chunks_end) {
+                bool success = true;
+                for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+                    const size_t begin =
+                        std::min(chunk * chunk_size, num_elements);
+                    const size_t end =
+                        std::min(begin + chunk_size, num_elements);
+                    buffer_writer chunk_s(
+                        buffer + begin * element_size,
+                        (end - begin) * element_size);
+                    for (size_t i = begin; i < end; ++i) {
+                        codec::write_affine(affine[i], chunk_s);
+                    }
+
+                    success =
+                        chunk_s.num_written() == (end - begin) * element_size &&
+                        success;
+                }
+                return success;
+            },
+            [](bool a, bool b) { return a && b; });
+
+        if (!success) {
+            throw std::runtime_error("unexpected group element size");
+        }
+    }
+
+    // Elements are read in blocks, so that a corrupt size cannot trigger an
+    // arbitrarily large allocation. Each block is decoded in parallel.
+    static void read(
+        std::vector<GroupT> &vec, const group_check_t check, std::istream &in_s)
+    {
+        const size_t block_size = 1 << 16;
+        const size_t element_size =
+            group_element_codec<Enc, Form, Comp, GroupT>::binary_size();
+        const size_t num_elements = size_read_binary(in_s);
+
+        std::vector<char> buffer;
+        vec.clear();
+        for (size_t block_begin = 0; block_begin < num_elements;
+             block_begin += block_size) {
+            const size_t block_num_elements =
+                std::min(block_size, num_elements - block_begin);
+            buffer.resize(block_num_elements * element_size);
+            in_s.read(buffer.data(), buffer.size());
+            if (!in_s) {
+                throw std::runtime_error("truncated group element vector");
+            }
+
+            vec.resize(block_begin + block_num_elements);
+            decode(
+                buffer.data(),
+                block_num_elements,
+                check,
+                vec.data() + block_begin);
+        }
+    }
+
+    /// Decode num_elements contiguous (fixed-size) encoded elements from
+    /// buffer, in parallel.
+    static void decode(
+        const char *buffer,
+        const size_t num_elements,
+        const group_check_t check,
+        GroupT *out)
+    {
+        // Compressed elements are always decoded to points on the curve.
+        decode_elements(
+            buffer,
+            num_elements,
+            out,
+            std::integral_constant<bool, Comp == compression_on>());
+        group_elements_check(out, num_elements, check, Comp == compression_on);
+    }
+
+protected:
+    static void decode_elements(
+        const char *buffer,
+        const size_t num_elements,
+        GroupT *out,
+        std::false_type)
+    {
+        using codec = group_element_codec<Enc, Form, Comp, GroupT>;
+
+        const size_t element_size = codec::binary_size();
+        const size_t num_chunks = group_vector_num_chunks(num_elements, 256);
+        const size_t chunk_size = (num_elements + num_chunks - 1) / num_chunks;
+
+        parallel_for(
+            0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+                for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+                    const size_t begin =
+                        std::min(chunk * chunk_size, num_elements);
+                    const size_t end =
+                        std::min(begin + chunk_size, num_elements);
+                    buffer_reader chunk_s(
+                        buffer + begin * element_size,
+                        (end - begin) * element_size);
+                    for (size_t i = begin; i < end; ++i) {
+                        codec::read(out[i], chunk_s);
+                    }
+                }
+            });
+    }
+
+    // Compressed elements are checked to be on the curve as they are decoded,
+    // since field_sqrt_if_square determines whether y^2 is a square at almost
+    // no extra cost.
+    static void decode_elements(
+        const char *buffer,
+        const size_t num_elements,
+        GroupT *out,
+        std::true_type)
+    {
+        using codec = group_element_codec<Enc, Form, Comp, GroupT>;
+
+        const size_t element_size = codec::binary_size();
+        const size_t num_chunks = group_vector_num_chunks(num_elements, 256);
+        const size_t chunk_size = (num_elements + num_chunks - 1) / num_chunks;
+        const bool success = parallel_reduce(
+            0,
+            num_chunks,
+            1,
+            true,
+            [&](size_t chunks_begin, size_t chunks_end) {
+                bool success = true;
+                for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+                    const size_t begin =
+                        std::min(chunk * chunk_size, num_elements);
+                    const size_t end =
+                        std::min(begin + chunk_size, num_elements);
+                    buffer_reader chunk_s(
+                        buffer + begin * element_size,
+                        (end - begin) * element_size);
+                    for (size_t i = begin; i < end; ++i) {
+                        mp_limb_t flags;
+                        if (codec::read_x(out[i], flags, chunk_s)) {
+                            success =
+                                codec::recover_y(out[i], flags) && success;
+                        }
+                    }
+                }
+                return success;
+            },
+            [](bool a, bool b) { return a && b; });
+
+        if (!success) {
+            throw std::runtime_error("curve eqn has no solution at x");
+        }
+    }
+};
+
+// Json encoding of vectors: a json array of elements. Elements are converted
+// to affine form in blocks (as for binary encodings), and chunks of each block
+// are encoded in parallel, and written in order.
+template<form_t Form, typename GroupT>
+class group_vector_codec<encoding_json, Form, compression_off, GroupT>
+{
+public:
+    static void write(const std::vector<GroupT> &vec, std::ostream &out_s)
+    {
+        using codec =
+            group_element_codec<encoding_json, Form, compression_off, GroupT>;
+
+        const size_t block_size = 1 << 16;
+
+        out_s << "[";
+
+        std::vector<GroupT> affine_block;
+        std::vector<std::string> chunk_strings;
+        for (size_t block_begin = 0; block_begin < vec.size();
+             block_begin += block_size) {
+            const size_t block_end =
+                std::min(block_begin + block_size, vec.size());
+            affine_block.assign(
+                vec.begin() + block_begin, vec.begin() + block_end);
+
+            const size_t num_elements = affine_block.size();
+            const size_t num_chunks =
+                group_write_vector_num_chunks(num_elements);
+            group_batch_to_affine(affine_block, num_chunks);
+
+            const size_t chunk_size =
+                (num_elements + num_chunks - 1) / num_chunks;
+            chunk_strings.assign(num_chunks, std::string());
+            parallel_for(
+                0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+                    for (size_t chunk = chunks_begin; chunk < chunks_end;
+                         ++chunk) {
+                        const size_t begin =
+                            std::min(chunk * chunk_size, num_elements);
+                        const size_t end =
+                            std::min(begin + chunk_size, num_elements);
+                        std::ostringstream chunk_s;
+                        for (size_t i = begin; i < end; ++i) {
+                            if (block_begin + i != 0) {
+                                chunk_s << ",";
+                            }
+                            codec::write_affine(affine_block[i], chunk_s);
+                        }
+                        chunk_strings[chunk] = chunk_s.str();
+                    }
+                });
+
+            for (const std::string &chunk_string : chunk_strings) {
+                out_s.write(chunk_string.data(), chunk_string.size());
+            }
+        }
+
+        out_s << "]";
+    }
+
+    // Elements are parsed sequentially, after which any checks are performed
+    // in parallel.
+    static void read(
+        std::vector<GroupT> &vec, const group_check_t check, std::istream &in_s)
+    {
+        using codec =
+            group_element_codec<encoding_json, Form, compression_off, GroupT>;
+
+        vec.clear();
+        char sep;
+        in_s >> sep;
+        if (sep != '[') {
+            throw std::runtime_error(
+                "expected opening bracket reading group element vector");
+        }
+
+        in_s >> std::ws;
+        if (in_s.peek() == ']') {
+            in_s.get();
+            return;
+        }
+
+        do {
+            vec.emplace_back();
+            codec::read(vec.back(), in_s);
+            in_s >> sep;
+        } while (in_s && sep == ',');
+
+        if (!in_s || sep != ']') {
+            throw std::runtime_error(
+                "expected closing bracket reading group element vector");
+        }
+
+        group_elements_check(vec.data(), vec.size(), check);
+    }
+};
+
+// Reading and writing of group elements via std::istream and std::ostream.
+// Json is parsed from (written to) the stream directly.
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+class group_stream_codec
+{
+public:
+    using codec = group_element_codec<Enc, Form, Comp, GroupT>;
+
+    static void write(const GroupT &group_el, std::ostream &out_s)
+    {
+        codec::write(group_el, out_s);
+    }
+    static void read(GroupT &group_el, std::istream &in_s)
+    {
+        codec::read(group_el, in_s);
+    }
+};
+
+// Binary encodings have a fixed size, so elements are encoded to (decoded
+// from) a local buffer by group_encode (group_decode), and the stream is
+// accessed with a single call.
+template<form_t Form, compression_t Comp, typename GroupT>
+class group_stream_codec<encoding_binary, Form, Comp, GroupT>
+{
+public:
+    using codec = group_element_codec<encoding_binary, Form, Comp, GroupT>;
+
+    static void write(const GroupT &group_el, std::ostream &out_s)
+    {
+        char buffer[codec::binary_size()];
+        group_encode<encoding_binary, Form, Comp>(
+            group_el, buffer, sizeof(buffer));
+        out_s.write(buffer, sizeof(buffer));
+    }
+    static void read(GroupT &group_el, std::istream &in_s)
+    {
+        char buffer[codec::binary_size()];
+        if (in_s.read(buffer, sizeof(buffer))) {
+            group_decode<encoding_binary, Form, Comp>(
+                group_el, buffer, sizeof(buffer));
         }
     }
 };
 
 } // namespace internal
 
+template<compression_t Comp, typename GroupT>
+constexpr size_t group_binary_size()
+{
+    return internal::
+        group_element_codec<encoding_binary, form_plain, Comp, GroupT>::
+            binary_size();
+}
+
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+size_t group_encode(const GroupT &v, void *buffer, const size_t buffer_size)
+{
+    buffer_writer out_s(buffer, buffer_size);
+    internal::group_element_codec<Enc, Form, Comp, GroupT>::write(v, out_s);
+    return out_s.num_written();
+}
+
 template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
-void group_read(GroupT &v, std::istream &in_s)
+size_t group_decode(GroupT &v, const void *buffer, const size_t buffer_size)
 {
+    buffer_reader in_s(buffer, buffer_size);
     internal::group_element_codec<Enc, Form, Comp, GroupT>::read(v, in_s);
+    return in_s.num_read();
+}
+
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void group_read(GroupT &v, std::istream &in_s, const group_check_t check)
+{
+    internal::group_stream_codec<Enc, Form, Comp, GroupT>::read(v, in_s);
+    // Compressed elements are always decoded to points on the curve.
+    if (in_s) {
+        internal::group_element_check(v, check, Comp == compression_on);
+    }
 }
 
 template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
 void group_write(const GroupT &v, std::ostream &out_s)
 {
-    internal::group_element_codec<Enc, Form, Comp, GroupT>::write(v, out_s);
+    internal::group_stream_codec<Enc, Form, Comp, GroupT>::write(v, out_s);
+}
+
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void group_read_vector(
+    std::vector<GroupT> &v, std::istream &in_s, const group_check_t check)
+{
+    internal::group_vector_codec<Enc, Form, Comp, GroupT>::read(
+        v, check, in_s);
+}
+
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void group_write_vector(const std::vector<GroupT> &v, std::ostream &out_s)
+{
+    internal::group_vector_codec<Enc, Form, Comp, GroupT>::write(v, out_s);
 }
 
 } // namespace libff
@@ -7,9 +7,11 @@
 
 #ifndef CURVE_UTILS_HPP_
 #define CURVE_UTILS_HPP_
+#include <cstddef>
 #include <cstdint>
 #include <libff/algebra/curves/public_params.hpp>
 #include <libff/algebra/fields/bigint.hpp>
+#include <libff/common/parallel.hpp>
 
 namespace libff
 {
@@ -17,9 +19,15 @@ namespace libff
 template<typename GroupT, mp_size_t m>
 GroupT scalar_mul(const GroupT &base, const bigint<m> &scalar);
 
+// The right hand side x^3 + a*x + b of the curve equation of GroupT (that is,
+// y^2 for points on the curve with the given x coordinate).
+template<typename GroupT>
+decltype(((GroupT *)nullptr)->X) curve_y_squared_at_x(
+    const decltype(((GroupT *)nullptr)->X) &x);
+
 // Utility function to compute Y coordinate of a point on the curve E(Fq) with
-// the given x coordinate. This function does not check whether E(Fq) has a
-// solution at x, and will hang indefinitely if it does not.
+// the given x coordinate. If the curve has no solution, this function throws
+// an exception.
 template<typename GroupT>
 decltype(((GroupT *)nullptr)->X) curve_point_y_at_x(
     const decltype(((GroupT *)nullptr)->X) &x);
@@ -31,10 +39,17 @@ template<typename GroupT>
 GroupT g1_curve_point_at_x(const typename GroupT::base_field &x);
 
 // Utility function to compute a point on the twisted curve E'(Fqe) with the
-// given x coordinate.
+// given x coordinate. If the curve has no solution, this function throws an
+// exception.
 template<typename GroupT>
 GroupT g2_curve_point_at_x(const typename GroupT::twist_field &x);
 
+// Returns true if all elements are well-formed (see is_well_formed()).
+// Elements in special (affine) form are checked directly against the affine
+// curve equation. Elements are checked in parallel if MULTICORE is enabled.
+template<typename GroupT>
+bool batch_is_well_formed(const GroupT *elements, const size_t num_elements);
+
 } // namespace libff
 #include <libff/algebra/curves/curve_utils.tcc>
 
@@ -32,42 +32,77 @@ GroupT scalar_mul(const GroupT &base, const bigint<m> &scalar)
 }
 
 template<typename GroupT>
-decltype(((GroupT *)nullptr)->X) curve_point_y_at_x(
+decltype(((GroupT *)nullptr)->X) curve_y_squared_at_x(
     const decltype(((GroupT *)nullptr)->X) &x)
 {
-    using base_field = decltype(((GroupT *)nullptr)->X);
-    const base_field x_squared = x * x;
-    const base_field x_cubed = x_squared * x;
-    const base_field y_squared =
-        x_cubed + (GroupT::coeff_a * x) + GroupT::coeff_b;
-    // TODO Check that y_squared is a quadratic residue (ensuring that sqrt()
-    // terminates).
-    return y_squared.sqrt();
+    return x.squared() * x + (GroupT::coeff_a * x) + GroupT::coeff_b;
 }
 
 template<typename GroupT>
-GroupT g1_curve_point_at_x(const typename GroupT::base_field &x)
+decltype(((GroupT *)nullptr)->X) curve_point_y_at_x(
+    const decltype(((GroupT *)nullptr)->X) &x)
 {
-    const typename GroupT::base_field x_squared = x * x;
-    const typename GroupT::base_field x_cubed = x_squared * x;
-    const typename GroupT::base_field y_squared =
-        x_cubed + (GroupT::coeff_a * x) + GroupT::coeff_b;
-    // Check that y_squared is a quadratic residue (ensuring that sqrt()
-    // terminates).
-    if ((y_squared ^ GroupT::base_field::euler) != GroupT::base_field::one()) {
+    decltype(((GroupT *)nullptr)->X) y;
+    if (!field_sqrt_if_square(curve_y_squared_at_x<GroupT>(x), y)) {
         throw std::runtime_error("curve eqn has no solution at x");
     }
+    return y;
+}
 
-    const typename GroupT::base_field y = y_squared.sqrt();
-    return GroupT(x, y, GroupT::base_field::one());
+template<typename GroupT>
+GroupT g1_curve_point_at_x(const typename GroupT::base_field &x)
+{
+    return GroupT(x, curve_point_y_at_x<GroupT>(x), GroupT::base_field::one());
 }
 
 template<typename GroupT>
 GroupT g2_curve_point_at_x(const typename GroupT::twist_field &x)
 {
-    // TODO: Generic check (over all fields) that y_squared.sqrt() terminates.
     return GroupT(x, curve_point_y_at_x<GroupT>(x), GroupT::twist_field::one());
 }
 
+namespace internal
+{
+
+// Check special elements against the affine curve equation, for groups with
+// curves of the form y^2 = x^3 + a*x + b.
+template<typename GroupT>
+auto element_is_well_formed(const GroupT &el, int)
+    -> decltype(GroupT::coeff_b, bool())
+{
+    if (el.is_zero() || !el.is_special()) {
+        return el.is_well_formed();
+    }
+
+    return el.Y.squared() == curve_y_squared_at_x<GroupT>(el.X);
+}
+
+template<typename GroupT>
+bool element_is_well_formed(const GroupT &el, long)
+{
+    return el.is_well_formed();
+}
+
+} // namespace internal
+
+template<typename GroupT>
+bool batch_is_well_formed(const GroupT *elements, const size_t num_elements)
+{
+    return parallel_reduce(
+        0,
+        num_elements,
+        0,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t i = begin; i < end; ++i) {
+                success =
+                    internal::element_is_well_formed(elements[i], 0) && success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
+}
+
 } // namespace libff
 #endif // CURVE_UTILS_TCC_
@@ -12,8 +12,12 @@
 namespace libff
 {
 
-bigint<edwards_r_limbs> edwards_modulus_r;
-bigint<edwards_q_limbs> edwards_modulus_q;
+constexpr bigint<edwards_r_limbs> edwards_modulus_r =
+    bigint<edwards_r_limbs>::from_hex(
+        "10357f274a8e56c4e2e493b92e12cc1de5532780000001");
+constexpr bigint<edwards_q_limbs> edwards_modulus_q =
+    bigint<edwards_q_limbs>::from_hex(
+        "40d5fc9d2a395b138b924ed6342d41b6eb690b80000001");
 
 edwards_Fq edwards_coeff_a;
 edwards_Fq edwards_coeff_d;
@@ -46,126 +50,131 @@ void init_edwards_params()
 
     /* parameters for scalar field Fr */
 
-    edwards_modulus_r =
-        bigint_r("1552511030102430251236801561344621993261920897571225601");
     assert(edwards_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        edwards_Fr::Rsquared =
-            bigint_r("621738487827897760168419760282818735947979812540885779");
-        edwards_Fr::Rcubed =
-            bigint_r("899968968216802386013510389846941393831065658679774050");
+        edwards_Fr::Rsquared = bigint_r::from_hex(
+            "67dc2bc868e4573fb10e45fef0d1d70518837ba19ab13");
+        edwards_Fr::Rcubed = bigint_r::from_hex(
+            "96567c1a3452f0cc48a73504e02d6b598a5139b464b62");
         edwards_Fr::inv = 0xdde553277fffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        edwards_Fr::Rsquared =
-            bigint_r("621738487827897760168419760282818735947979812540885779");
-        edwards_Fr::Rcubed =
-            bigint_r("899968968216802386013510389846941393831065658679774050");
+        edwards_Fr::Rsquared = bigint_r::from_hex(
+            "67dc2bc868e4573fb10e45fef0d1d70518837ba19ab13");
+        edwards_Fr::Rcubed = bigint_r::from_hex(
+            "96567c1a3452f0cc48a73504e02d6b598a5139b464b62");
         edwards_Fr::inv = 0x7fffffff;
     }
     edwards_Fr::num_bits = 181;
-    edwards_Fr::euler =
-        bigint_r("776255515051215125618400780672310996630960448785612800");
+    edwards_Fr::euler = bigint_r::from_hex(
+        "81abf93a5472b62717249dc9709660ef2a993c0000000");
     edwards_Fr::s = 31;
-    edwards_Fr::t = bigint_r("722944284836962004768104088187507350585386575");
-    edwards_Fr::t_minus_1_over_2 =
-        bigint_r("361472142418481002384052044093753675292693287");
-    edwards_Fr::multiplicative_generator = edwards_Fr("19");
-    edwards_Fr::root_of_unity =
-        edwards_Fr("695314865466598274460565335217615316274564719601897184");
-    edwards_Fr::nqr = edwards_Fr("11");
-    edwards_Fr::nqr_to_t =
-        edwards_Fr("1326707053668679463752768729767248251415639579872144553");
+    edwards_Fr::t = bigint_r::from_hex(
+        "206afe4e951cad89c5c927725c25983bcaa64f");
+    edwards_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "10357f274a8e56c4e2e493b92e12cc1de55327");
+    edwards_Fr::multiplicative_generator = edwards_Fr::from_montgomery_hex(
+        "ad0058f5f327eba6907738a5f5504eca336e9fffed3ec");
+    edwards_Fr::root_of_unity = edwards_Fr::from_montgomery_hex(
+        "cf97e0daacc2bf5bd4f8ce8b9902dd4d7bf66a1423c0d");
+    edwards_Fr::nqr = edwards_Fr::from_montgomery_hex(
+        "1fe90ea596390d9cb33f398a454b2304a90a57fff5245");
+    edwards_Fr::nqr_to_t = edwards_Fr::from_montgomery_hex(
+        "500f924a6934f1fc42f5b5bbba648841a170c2a23dddc");
     edwards_Fr::static_init();
 
     /* parameters for base field Fq */
 
-    edwards_modulus_q =
-        bigint_q("6210044120409721004947206240885978274523751269793792001");
     assert(edwards_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        edwards_Fq::Rsquared =
-            bigint_q("5943559676554581037560514598978484097352477055348195432");
-        edwards_Fq::Rcubed =
-            bigint_q("1081560488703514202058739223469726982199727506489234349");
+        edwards_Fq::Rsquared = bigint_q::from_hex(
+            "3e0dbc8eec1f76e0bf35ff926ac105f6d1824a80e54068");
+        edwards_Fq::Rcubed = bigint_q::from_hex(
+            "b4ac1b77ca0d59f20e4d04d7048823fe112e6248253ad");
         edwards_Fq::inv = 0x76eb690b7fffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        edwards_Fq::Rsquared =
-            bigint_q("5943559676554581037560514598978484097352477055348195432");
-        edwards_Fq::Rcubed =
-            bigint_q("1081560488703514202058739223469726982199727506489234349");
+        edwards_Fq::Rsquared = bigint_q::from_hex(
+            "3e0dbc8eec1f76e0bf35ff926ac105f6d1824a80e54068");
+        edwards_Fq::Rcubed = bigint_q::from_hex(
+            "b4ac1b77ca0d59f20e4d04d7048823fe112e6248253ad");
         edwards_Fq::inv = 0x7fffffff;
     }
     edwards_Fq::num_bits = 183;
-    edwards_Fq::euler =
-        bigint_q("3105022060204860502473603120442989137261875634896896000");
+    edwards_Fq::euler = bigint_q::from_hex(
+        "206afe4e951cad89c5c9276b1a16a0db75b485c0000000");
     edwards_Fq::s = 31;
-    edwards_Fq::t = bigint_q("2891777139347848019072416350658041552884388375");
-    edwards_Fq::t_minus_1_over_2 =
-        bigint_q("1445888569673924009536208175329020776442194187");
-    edwards_Fq::multiplicative_generator = edwards_Fq("61");
-    edwards_Fq::root_of_unity =
-        edwards_Fq("4692813029219384139894873043933463717810008194158530536");
-    edwards_Fq::nqr = edwards_Fq("23");
-    edwards_Fq::nqr_to_t =
-        edwards_Fq("2626736066325740702418554487368721595489070118548299138");
+    edwards_Fq::t = bigint_q::from_hex(
+        "81abf93a5472b62717249dac685a836dd6d217");
+    edwards_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "40d5fc9d2a395b138b924ed6342d41b6eb690b");
+    edwards_Fq::multiplicative_generator = edwards_Fq::from_montgomery_hex(
+        "2cf38a9445c61e81fb800cad23da8d890dc434ffff0f26");
+    edwards_Fq::root_of_unity = edwards_Fq::from_montgomery_hex(
+        "137b4e4ce7803d71947afda8e32b4b5f446c116453b1f7");
+    edwards_Fq::nqr = edwards_Fq::from_montgomery_hex(
+        "17537f758761210d2968a39db2204c9dcc9ba7ffffa530");
+    edwards_Fq::nqr_to_t = edwards_Fq::from_montgomery_hex(
+        "c9570dce5a9b3a7ceecfa336b0aa2bec3c10b2792b3e");
     edwards_Fq::static_init();
 
     /* parameters for twist field Fq3 */
 
-    edwards_Fq3::euler = bigint<3 * edwards_q_limbs>(
-        "1197440827139715029629926131910678366982050433739789489038399345641529"
-        "9485805128465854550297120332503183164742441311116131831414476564652505"
-        "7914792711854057586688000");
+    edwards_Fq3::euler = bigint<3 * edwards_q_limbs>::from_hex(
+        "214530cde421990256a87901ddc6307e4ed27faf4f877968efca129ef23243b915ef07"
+        "4f565027daa0127ecf4ec788245754250524ea78ad2c1a16b28f2611d9140000000");
     edwards_Fq3::s = 31;
-    edwards_Fq3::t = bigint<3 * edwards_q_limbs>(
-        "1115203674081447561858153093523046343570622088145268605126439915636116"
-        "5908915110366283497118503164968623933142462103735778323760700006645643"
-        "8894190557165125");
-    edwards_Fq3::t_minus_1_over_2 = bigint<3 * edwards_q_limbs>(
-        "5576018370407237809290765467615231717853110440726343025632199578180582"
-        "9544575551831417485592515824843119665712310518678891618803500033228219"
-        "447095278582562");
-    edwards_Fq3::non_residue = edwards_Fq("61");
-    edwards_Fq3::nqr =
-        edwards_Fq3(edwards_Fq("23"), edwards_Fq("0"), edwards_Fq("0"));
+    edwards_Fq3::t = bigint<3 * edwards_q_limbs>::from_hex(
+        "8514c337908664095aa1e4077718c1f93b49febd3e1de5a3bf284a7bc8c90ee457bc1d"
+        "3d59409f6a8049fb3d3b1e20915d50941493a9e2b4b0685aca3c9847645");
+    edwards_Fq3::t_minus_1_over_2 = bigint<3 * edwards_q_limbs>::from_hex(
+        "428a619bc8433204ad50f203bb8c60fc9da4ff5e9f0ef2d1df94253de46487722bde0e"
+        "9eaca04fb54024fd9e9d8f1048aea84a0a49d4f15a58342d651e4c23b22");
+    edwards_Fq3::non_residue = edwards_Fq::from_montgomery_hex(
+        "2cf38a9445c61e81fb800cad23da8d890dc434ffff0f26");
+    edwards_Fq3::nqr = edwards_Fq3(
+        edwards_Fq::from_montgomery_hex(
+            "17537f758761210d2968a39db2204c9dcc9ba7ffffa530"),
+        edwards_Fq::zero(),
+        edwards_Fq::zero());
     edwards_Fq3::nqr_to_t = edwards_Fq3(
-        edwards_Fq("104810943629412208121981114244673004633270996333237516"),
-        edwards_Fq("0"),
-        edwards_Fq("0"));
-    edwards_Fq3::Frobenius_coeffs_c1[0] = edwards_Fq("1");
-    edwards_Fq3::Frobenius_coeffs_c1[1] =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832061");
-    edwards_Fq3::Frobenius_coeffs_c1[2] =
-        edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq3::Frobenius_coeffs_c2[0] = edwards_Fq("1");
-    edwards_Fq3::Frobenius_coeffs_c2[1] =
-        edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq3::Frobenius_coeffs_c2[2] =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832061");
+        edwards_Fq::from_montgomery_hex(
+            "2d330f0b40aca3719ec71d1f0589bdfc5aaaa5b38e7fde"),
+        edwards_Fq::zero(),
+        edwards_Fq::zero());
+    edwards_Fq3::Frobenius_coeffs_c1[0] = edwards_Fq::one();
+    edwards_Fq3::Frobenius_coeffs_c1[1] = edwards_Fq::from_montgomery_hex(
+        "103664df88480d7b67026cbe7cb69d1a64cb845deb00e4");
+    edwards_Fq3::Frobenius_coeffs_c1[2] = edwards_Fq::from_montgomery_hex(
+        "3db4386b6273fbc8575d3a07c6312a003675f1a2150310");
+    edwards_Fq3::Frobenius_coeffs_c2[0] = edwards_Fq::one();
+    edwards_Fq3::Frobenius_coeffs_c2[1] = edwards_Fq::from_montgomery_hex(
+        "3db4386b6273fbc8575d3a07c6312a003675f1a2150310");
+    edwards_Fq3::Frobenius_coeffs_c2[2] = edwards_Fq::from_montgomery_hex(
+        "103664df88480d7b67026cbe7cb69d1a64cb845deb00e4");
 
     /* parameters for Fq6 */
 
-    edwards_Fq6::non_residue = edwards_Fq("61");
-    edwards_Fq6::Frobenius_coeffs_c1[0] = edwards_Fq("1");
-    edwards_Fq6::Frobenius_coeffs_c1[1] =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832062");
-    edwards_Fq6::Frobenius_coeffs_c1[2] =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832061");
-    edwards_Fq6::Frobenius_coeffs_c1[3] =
-        edwards_Fq("6210044120409721004947206240885978274523751269793792000");
-    edwards_Fq6::Frobenius_coeffs_c1[4] =
-        edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq6::Frobenius_coeffs_c1[5] =
-        edwards_Fq("5136291436651207728317994048073823738016144056504959940");
+    edwards_Fq6::non_residue = edwards_Fq::from_montgomery_hex(
+        "2cf38a9445c61e81fb800cad23da8d890dc434ffff0f26");
+    edwards_Fq6::Frobenius_coeffs_c1[0] = edwards_Fq::one();
+    edwards_Fq6::Frobenius_coeffs_c1[1] = edwards_Fq::from_montgomery_hex(
+        "321c431c7c55f4b343514ce6dfc17b6b4f319ddeafcf1");
+    edwards_Fq6::Frobenius_coeffs_c1[2] = edwards_Fq::from_montgomery_hex(
+        "103664df88480d7b67026cbe7cb69d1a64cb845deb00e4");
+    edwards_Fq6::Frobenius_coeffs_c1[3] = edwards_Fq::from_montgomery_hex(
+        "d14a0adc082ae3032cd57f00eba8563afd86a800003f3");
+    edwards_Fq6::Frobenius_coeffs_c1[4] = edwards_Fq::from_montgomery_hex(
+        "3db4386b6273fbc8575d3a07c6312a003675f1a2150310");
+    edwards_Fq6::Frobenius_coeffs_c1[5] = edwards_Fq::from_montgomery_hex(
+        "309f97bda1f14d98248fe217b776a49c869d872214ff1d");
     edwards_Fq6::my_Fp2::non_residue = edwards_Fq3::non_residue;
 
     /* choice of Edwards curve and its twist */
 
     edwards_coeff_a = edwards_Fq::one();
-    edwards_coeff_d =
-        edwards_Fq("600581931845324488256649384912508268813600056237543024");
+    edwards_coeff_d = edwards_Fq::from_montgomery_hex(
+        "2007dad98cc7076a7c2e3ac25d94aa80c78eb4af839dbb");
     edwards_twist =
         edwards_Fq3(edwards_Fq::zero(), edwards_Fq::one(), edwards_Fq::zero());
     edwards_twist_coeff_a = edwards_coeff_a * edwards_twist;
@@ -176,17 +185,19 @@ void init_edwards_params()
     edwards_twist_mul_by_d_c0 = edwards_coeff_d * edwards_Fq3::non_residue;
     edwards_twist_mul_by_d_c1 = edwards_coeff_d;
     edwards_twist_mul_by_d_c2 = edwards_coeff_d;
-    edwards_twist_mul_by_q_Y =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832062");
-    edwards_twist_mul_by_q_Z =
-        edwards_Fq("1073752683758513276629212192812154536507607213288832062");
+    edwards_twist_mul_by_q_Y = edwards_Fq::from_montgomery_hex(
+        "321c431c7c55f4b343514ce6dfc17b6b4f319ddeafcf1");
+    edwards_twist_mul_by_q_Z = edwards_Fq::from_montgomery_hex(
+        "321c431c7c55f4b343514ce6dfc17b6b4f319ddeafcf1");
 
     /* choice of group G1 */
 
     edwards_G1::G1_zero = edwards_G1(edwards_Fq::zero(), edwards_Fq::one());
     edwards_G1::G1_one = edwards_G1(
-        edwards_Fq("3713709671941291996998665608188072510389821008693530490"),
-        edwards_Fq("4869953702976555123067178261685365085639705297852816679"));
+        edwards_Fq::from_montgomery_hex(
+            "3b1f51f0e532ac41985d6bf3d13c9783404532a5e4e1c2"),
+        edwards_Fq::from_montgomery_hex(
+            "2e3974749392b4026bd1ce5f27c4db30273ff7784c6ad"));
 
     edwards_G1::wnaf_window_table.resize(0);
     edwards_G1::wnaf_window_table.push_back(9);
@@ -245,19 +256,19 @@ void init_edwards_params()
     edwards_G2::G2_zero = edwards_G2(edwards_Fq3::zero(), edwards_Fq3::one());
     edwards_G2::G2_one = edwards_G2(
         edwards_Fq3(
-            edwards_Fq(
-                "4531683359223370252210990718516622098304721701253228128"),
-            edwards_Fq(
-                "5339624155305731263217400504407647531329993548123477368"),
-            edwards_Fq(
-                "3964037981777308726208525982198654699800283729988686552")),
+            edwards_Fq::from_montgomery_hex(
+                "1d35c759ea5a19122302646f374269c7f21bd471d82177"),
+            edwards_Fq::from_montgomery_hex(
+                "12d4779083b9e0241c118c26606397f787443d2204a376"),
+            edwards_Fq::from_montgomery_hex(
+                "2ae4377676fadf7a8cf7c4458a8eb9368f75edc6566fdc")),
         edwards_Fq3(
-            edwards_Fq(
-                "364634864866983740775341816274081071386963546650700569"),
-            edwards_Fq(
-                "3264380230116139014996291397901297105159834497864380415"),
-            edwards_Fq(
-                "3504781284999684163274269077749440837914479176282903747")));
+            edwards_Fq::from_montgomery_hex(
+                "20d4c2e7225522a8aa15bbb6d8cb0673165b114f96d4cc"),
+            edwards_Fq::from_montgomery_hex(
+                "403990d98d364d327ef573012e44eaf3daa0d56e67725e"),
+            edwards_Fq::from_montgomery_hex(
+                "1046b3eb956cd11ad2e744291ebe704cb89793daabfb00")));
 
     edwards_G2::wnaf_window_table.resize(0);
     edwards_G2::wnaf_window_table.push_back(6);
@@ -313,15 +324,15 @@ void init_edwards_params()
 
     /* pairing parameters */
 
-    edwards_ate_loop_count = bigint_q("4492509698523932320491110403");
-    edwards_final_exponent = bigint<6 * edwards_q_limbs>(
-        "3694310717796169464961879734644687013874865157861174841512820742949159"
-        "3976636391130175425245705674550269561361208979548749447898941828686017"
-        "7657304194168755396159416512697939289624688998560831692274575039424707"
-        "21108165443528513330156264699608120624990672333642644221591552000");
-    edwards_final_exponent_last_chunk_abs_of_w0 =
-        bigint_q("17970038794095729281964441603");
+    edwards_ate_loop_count = bigint_q::from_hex("e841deec0a9e39280000003");
+    edwards_final_exponent = bigint<6 * edwards_q_limbs>::from_hex(
+        "11128ff78ce1ba3ed7bdc08dc0e8027077fc9348f971a3ef1053c9d33b1aa7ceba8603"
+        "0d02292f9f5e784fde9ee9d0176dbe7da7ecbbcb64cdc0acd4e64d7156c2f84ee1aafa"
+        "1098707148db1e4797e330e5d507e78d8246a4843b4a174e7cd7ca937bdc5d67a6176f"
+        "9a48984764500000000");
+    edwards_final_exponent_last_chunk_abs_of_w0 = bigint_q::from_hex(
+        "3a1077bb02a78e4a00000003");
     edwards_final_exponent_last_chunk_is_w0_neg = true;
-    edwards_final_exponent_last_chunk_w1 = bigint_q("4");
+    edwards_final_exponent_last_chunk_w1 = bigint_q::from_hex("4");
 }
 } // namespace libff
@@ -23,8 +23,8 @@ const mp_size_t edwards_r_limbs =
 const mp_size_t edwards_q_limbs =
     (edwards_q_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<edwards_r_limbs> edwards_modulus_r;
-extern bigint<edwards_q_limbs> edwards_modulus_q;
+extern const bigint<edwards_r_limbs> edwards_modulus_r;
+extern const bigint<edwards_q_limbs> edwards_modulus_q;
 
 typedef Fp_model<edwards_r_limbs, edwards_modulus_r> edwards_Fr;
 typedef Fp_model<edwards_q_limbs, edwards_modulus_q> edwards_Fq;
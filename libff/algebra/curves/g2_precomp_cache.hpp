@@ -0,0 +1,100 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_HPP__
+#define __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_HPP__
+
+#include "libff/algebra/curves/public_params.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libff
+{
+
+/// Thread-safe, bounded, least-recently-used cache of precomputed G2 values,
+/// keyed on the affine coordinates of the G2 point. Pairing-based verifiers
+/// typically pair against a small set of fixed G2 points (for example the
+/// elements of a verification key), and the line coefficients computed by
+/// ppT::precompute_G2 need only be computed once for each such point.
+///
+/// Entries are returned as shared pointers, so values remain valid for the
+/// caller even if they are evicted from the cache by another thread.
+template<typename ppT> class g2_precomp_cache
+{
+public:
+    using precomp_ptr = std::shared_ptr<const G2_precomp<ppT>>;
+
+    /// The default maximum number of entries held by the cache.
+    static const size_t default_capacity = 64;
+
+    g2_precomp_cache(const g2_precomp_cache &) = delete;
+    g2_precomp_cache &operator=(const g2_precomp_cache &) = delete;
+
+    explicit g2_precomp_cache(size_t capacity = default_capacity);
+
+    /// Return the precomputed value for Q, computing (and inserting) it if it
+    /// is not already present.
+    precomp_ptr get(const G2<ppT> &Q);
+
+    /// Change the maximum number of entries, evicting least-recently-used
+    /// entries if necessary. A capacity of 0 disables caching.
+    void set_capacity(size_t capacity);
+
+    size_t capacity() const;
+    size_t size() const;
+    size_t num_hits() const;
+    size_t num_misses() const;
+
+    void clear();
+
+    /// A process-wide cache instance for the curve ppT.
+    static g2_precomp_cache<ppT> &global();
+
+protected:
+    using lru_list = std::list<std::pair<std::string, precomp_ptr>>;
+
+    static std::string key_for(const G2<ppT> &Q);
+    void evict_to(size_t capacity);
+
+    mutable std::mutex _mutex;
+    size_t _capacity;
+    size_t _num_hits;
+    size_t _num_misses;
+    // Most-recently-used entries are at the front of the list.
+    lru_list _entries;
+    std::unordered_map<std::string, typename lru_list::iterator> _index;
+};
+
+/// Precompute Q using the global cache for ppT.
+template<typename ppT>
+std::shared_ptr<const G2_precomp<ppT>> cached_precompute_G2(const G2<ppT> &Q);
+
+/// As ppT::reduced_pairing, but using the global cache for the precomputation
+/// of Q.
+template<typename ppT>
+GT<ppT> cached_reduced_pairing(const G1<ppT> &P, const G2<ppT> &Q);
+
+/// The product of ppT::reduced_pairing(P[i], Q[i]) for all i, using the global
+/// cache for the precomputation of each Q[i]. Miller loops are evaluated in
+/// parallel (two at a time, using ppT::double_miller_loop), and a single
+/// final exponentiation is performed. Throws std::invalid_argument if P and Q
+/// have different sizes.
+template<typename ppT>
+GT<ppT> cached_reduced_pairing_product(
+    const std::vector<G1<ppT>> &P, const std::vector<G2<ppT>> &Q);
+
+} // namespace libff
+
+#include "libff/algebra/curves/g2_precomp_cache.tcc"
+
+#endif // __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_HPP__
@@ -0,0 +1,196 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_TCC__
+#define __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_TCC__
+
+#include "libff/algebra/curves/g2_precomp_cache.hpp"
+#include "libff/common/parallel.hpp"
+
+#include <stdexcept>
+
+namespace libff
+{
+
+template<typename ppT> const size_t g2_precomp_cache<ppT>::default_capacity;
+
+template<typename ppT>
+g2_precomp_cache<ppT>::g2_precomp_cache(size_t capacity)
+    : _capacity(capacity), _num_hits(0), _num_misses(0)
+{
+}
+
+template<typename ppT>
+typename g2_precomp_cache<ppT>::precomp_ptr g2_precomp_cache<ppT>::get(
+    const G2<ppT> &Q)
+{
+    const std::string key = key_for(Q);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _index.find(key);
+        if (it != _index.end()) {
+            _entries.splice(_entries.begin(), _entries, it->second);
+            ++_num_hits;
+            return it->second->second;
+        }
+        ++_num_misses;
+    }
+
+    // Compute outside of the lock, so that other threads are not blocked.
+    // Concurrent misses on the same key may both compute the value, in which
+    // case the first result to be inserted is kept.
+    precomp_ptr precomp =
+        std::make_shared<const G2_precomp<ppT>>(ppT::precompute_G2(Q));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_capacity == 0) {
+        return precomp;
+    }
+
+    auto it = _index.find(key);
+    if (it != _index.end()) {
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->second;
+    }
+
+    evict_to(_capacity - 1);
+    _entries.emplace_front(key, precomp);
+    _index[key] = _entries.begin();
+    return precomp;
+}
+
+template<typename ppT> void g2_precomp_cache<ppT>::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    evict_to(capacity);
+}
+
+template<typename ppT> size_t g2_precomp_cache<ppT>::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
+
+template<typename ppT> size_t g2_precomp_cache<ppT>::size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+template<typename ppT> size_t g2_precomp_cache<ppT>::num_hits() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _num_hits;
+}
+
+template<typename ppT> size_t g2_precomp_cache<ppT>::num_misses() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _num_misses;
+}
+
+template<typename ppT> void g2_precomp_cache<ppT>::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _index.clear();
+    _num_hits = 0;
+    _num_misses = 0;
+}
+
+template<typename ppT> g2_precomp_cache<ppT> &g2_precomp_cache<ppT>::global()
+{
+    static g2_precomp_cache<ppT> cache;
+    return cache;
+}
+
+template<typename ppT>
+std::string g2_precomp_cache<ppT>::key_for(const G2<ppT> &Q)
+{
+    // The key is the raw (Montgomery) representation of the affine
+    // coordinates, which uniquely identifies the point.
+    G2<ppT> affine_Q(Q);
+    affine_Q.to_affine_coordinates();
+
+    std::string key;
+    key.reserve(sizeof(affine_Q.X) + sizeof(affine_Q.Y));
+    key.append((const char *)&affine_Q.X, sizeof(affine_Q.X));
+    key.append((const char *)&affine_Q.Y, sizeof(affine_Q.Y));
+    return key;
+}
+
+template<typename ppT> void g2_precomp_cache<ppT>::evict_to(size_t capacity)
+{
+    // Caller must hold _mutex.
+    while (_entries.size() > capacity) {
+        _index.erase(_entries.back().first);
+        _entries.pop_back();
+    }
+}
+
+template<typename ppT>
+std::shared_ptr<const G2_precomp<ppT>> cached_precompute_G2(const G2<ppT> &Q)
+{
+    return g2_precomp_cache<ppT>::global().get(Q);
+}
+
+template<typename ppT>
+GT<ppT> cached_reduced_pairing(const G1<ppT> &P, const G2<ppT> &Q)
+{
+    const G1_precomp<ppT> prec_P = ppT::precompute_G1(P);
+    const std::shared_ptr<const G2_precomp<ppT>> prec_Q =
+        cached_precompute_G2<ppT>(Q);
+    return ppT::final_exponentiation(ppT::miller_loop(prec_P, *prec_Q));
+}
+
+template<typename ppT>
+GT<ppT> cached_reduced_pairing_product(
+    const std::vector<G1<ppT>> &P, const std::vector<G2<ppT>> &Q)
+{
+    if (P.size() != Q.size()) {
+        throw std::invalid_argument("mismatched number of G1 and G2 elements");
+    }
+
+    // Each task evaluates (an even number of) Miller loops.
+    const Fqk<ppT> miller_product = parallel_reduce(
+        0,
+        P.size(),
+        2,
+        Fqk<ppT>::one(),
+        [&P, &Q](size_t begin, size_t end) {
+            Fqk<ppT> product = Fqk<ppT>::one();
+            for (size_t i = begin; i < end; i += 2) {
+                const G1_precomp<ppT> prec_P = ppT::precompute_G1(P[i]);
+                const std::shared_ptr<const G2_precomp<ppT>> prec_Q =
+                    cached_precompute_G2<ppT>(Q[i]);
+                if (i + 1 == end) {
+                    product = product * ppT::miller_loop(prec_P, *prec_Q);
+                    continue;
+                }
+
+                const G1_precomp<ppT> prec_P_next =
+                    ppT::precompute_G1(P[i + 1]);
+                const std::shared_ptr<const G2_precomp<ppT>> prec_Q_next =
+                    cached_precompute_G2<ppT>(Q[i + 1]);
+                product =
+                    product *
+                    ppT::double_miller_loop(
+                        prec_P, *prec_Q, prec_P_next, *prec_Q_next);
+            }
+            return product;
+        },
+        [](const Fqk<ppT> &a, const Fqk<ppT> &b) { return a * b; });
+
+    return ppT::final_exponentiation(miller_product);
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_CURVES_G2_PRECOMP_CACHE_TCC__
@@ -0,0 +1,356 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/curves/group_container.hpp"
+
+#include "libff/common/parallel.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace libff
+{
+
+static const char CONTAINER_MAGIC[8] = {'l', 'i', 'b', 'f', 'f', 'g', 'c', 0};
+static const uint32_t CONTAINER_VERSION = 1;
+static const size_t CONTAINER_HEADER_SIZE = 64;
+static const size_t CONTAINER_SECTION_ENTRY_SIZE = 64;
+static const size_t CHECKSUM_BLOCK_SIZE = 1 << 20;
+
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+static const uint64_t FNV_PRIME = 0x100000001b3ull;
+
+static uint64_t fnv1a_update(uint64_t hash, const char *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void put_u32(char *dest, const uint32_t v)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        dest[i] = (char)(v >> (8 * (3 - i)));
+    }
+}
+
+static void put_u64(char *dest, const uint64_t v)
+{
+    for (size_t i = 0; i < 8; ++i) {
+        dest[i] = (char)(v >> (8 * (7 - i)));
+    }
+}
+
+static uint32_t get_u32(const char *src)
+{
+    uint32_t v = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        v = (v << 8) | (uint8_t)src[i];
+    }
+    return v;
+}
+
+static uint64_t get_u64(const char *src)
+{
+    uint64_t v = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        v = (v << 8) | (uint8_t)src[i];
+    }
+    return v;
+}
+
+/// Combine the hash of a block into the overall hash.
+static uint64_t checksum_combine(const uint64_t hash, const uint64_t block_hash)
+{
+    char bytes[8];
+    put_u64(bytes, block_hash);
+    return fnv1a_update(hash, bytes, sizeof(bytes));
+}
+
+uint64_t group_container_checksum(const void *data, const size_t size)
+{
+    const char *bytes = (const char *)data;
+    const size_t num_blocks =
+        (size + CHECKSUM_BLOCK_SIZE - 1) / CHECKSUM_BLOCK_SIZE;
+    std::vector<uint64_t> block_hashes(num_blocks);
+
+    parallel_for(0, num_blocks, 1, [&](size_t range_begin, size_t range_end) {
+        for (size_t i = range_begin; i < range_end; ++i) {
+            const size_t begin = i * CHECKSUM_BLOCK_SIZE;
+            const size_t block_size =
+                std::min(CHECKSUM_BLOCK_SIZE, size - begin);
+            block_hashes[i] =
+                fnv1a_update(FNV_OFFSET_BASIS, bytes + begin, block_size);
+        }
+    });
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const uint64_t block_hash : block_hashes) {
+        hash = checksum_combine(hash, block_hash);
+    }
+    return hash;
+}
+
+namespace internal
+{
+
+group_container_hasher::group_container_hasher()
+    : _hash(FNV_OFFSET_BASIS), _block_hash(FNV_OFFSET_BASIS), _block_fill(0)
+{
+}
+
+void group_container_hasher::update(const char *data, size_t size)
+{
+    while (size > 0) {
+        const size_t n = std::min(size, CHECKSUM_BLOCK_SIZE - _block_fill);
+        _block_hash = fnv1a_update(_block_hash, data, n);
+        _block_fill += n;
+        data += n;
+        size -= n;
+
+        if (_block_fill == CHECKSUM_BLOCK_SIZE) {
+            _hash = checksum_combine(_hash, _block_hash);
+            _block_hash = FNV_OFFSET_BASIS;
+            _block_fill = 0;
+        }
+    }
+}
+
+uint64_t group_container_hasher::digest() const
+{
+    if (_block_fill == 0) {
+        return _hash;
+    }
+    return checksum_combine(_hash, _block_hash);
+}
+
+} // namespace internal
+
+const size_t group_container_writer::default_alignment;
+
+group_container_writer::group_container_writer(
+    const std::string &filename, const size_t alignment)
+    : _out_s(filename.c_str(), std::ios_base::out | std::ios_base::binary)
+    , _alignment(alignment)
+    , _offset(0)
+    , _section_offset(0)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::runtime_error("container alignment must be a power of 2");
+    }
+    if (!_out_s) {
+        throw std::runtime_error("failed to open " + filename);
+    }
+
+    // The header is written by close(). Until then, the zeroed header marks
+    // the file as invalid.
+    const char header[CONTAINER_HEADER_SIZE] = {0};
+    _out_s.write(header, sizeof(header));
+    _offset = sizeof(header);
+}
+
+void group_container_writer::close()
+{
+    // Section table
+    const size_t table_offset = _offset;
+    std::vector<char> table(_sections.size() * CONTAINER_SECTION_ENTRY_SIZE, 0);
+    for (size_t i = 0; i < _sections.size(); ++i) {
+        const group_container_section &section = _sections[i];
+        char *entry = &table[i * CONTAINER_SECTION_ENTRY_SIZE];
+        put_u64(entry, section.group_id);
+        entry[8] = (char)section.form;
+        entry[9] = (char)section.compression;
+        put_u32(entry + 12, (uint32_t)section.element_size);
+        put_u64(entry + 16, section.num_elements);
+        put_u64(entry + 24, section.payload_offset);
+        put_u64(entry + 32, section.payload_size);
+        put_u64(entry + 40, section.payload_checksum);
+    }
+    _out_s.write(table.data(), table.size());
+
+    // Header
+    char header[CONTAINER_HEADER_SIZE] = {0};
+    memcpy(header, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+    put_u32(header + 8, CONTAINER_VERSION);
+    put_u32(header + 12, (uint32_t)_alignment);
+    put_u32(header + 16, (uint32_t)_sections.size());
+    put_u64(header + 24, table_offset);
+    put_u64(header + 32, group_container_checksum(table.data(), table.size()));
+    _out_s.seekp(0);
+    _out_s.write(header, sizeof(header));
+
+    _out_s.close();
+    if (!_out_s) {
+        throw std::runtime_error("failed to write container");
+    }
+}
+
+void group_container_writer::begin_section()
+{
+    // Pad to the alignment.
+    const size_t padding = (_alignment - (_offset % _alignment)) % _alignment;
+    const std::vector<char> zeros(padding, 0);
+    _out_s.write(zeros.data(), zeros.size());
+    _offset += padding;
+
+    _section_offset = _offset;
+    _hasher = internal::group_container_hasher();
+}
+
+void group_container_writer::write_payload(const char *data, const size_t size)
+{
+    _out_s.write(data, size);
+    _hasher.update(data, size);
+    _offset += size;
+}
+
+void group_container_writer::end_section(
+    const uint64_t group_id,
+    const form_t form,
+    const compression_t compression,
+    const size_t element_size,
+    const size_t num_elements)
+{
+    group_container_section section;
+    section.group_id = group_id;
+    section.form = form;
+    section.compression = compression;
+    section.element_size = element_size;
+    section.num_elements = num_elements;
+    section.payload_offset = _section_offset;
+    section.payload_size = _offset - _section_offset;
+    section.payload_checksum = _hasher.digest();
+    _sections.push_back(section);
+}
+
+/// Parse and validate the header and section table of a mapped container.
+static std::vector<group_container_section> container_parse(
+    const char *data, const size_t size)
+{
+    if (size < CONTAINER_HEADER_SIZE ||
+        0 != memcmp(data, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC))) {
+        throw std::runtime_error("invalid container");
+    }
+    if (get_u32(data + 8) != CONTAINER_VERSION) {
+        throw std::runtime_error("unsupported container version");
+    }
+
+    const size_t alignment = get_u32(data + 12);
+    const size_t num_sections = get_u32(data + 16);
+    const uint64_t table_offset = get_u64(data + 24);
+    const uint64_t table_size = num_sections * CONTAINER_SECTION_ENTRY_SIZE;
+    if (alignment == 0 || table_offset > size ||
+        table_size > size - table_offset) {
+        throw std::runtime_error("invalid container");
+    }
+
+    const char *table = data + table_offset;
+    if (get_u64(data + 32) != group_container_checksum(table, table_size)) {
+        throw std::runtime_error("corrupt container section table");
+    }
+
+    std::vector<group_container_section> sections(num_sections);
+    for (size_t i = 0; i < num_sections; ++i) {
+        const char *entry = table + i * CONTAINER_SECTION_ENTRY_SIZE;
+        group_container_section &section = sections[i];
+        section.group_id = get_u64(entry);
+        section.form = (form_t)entry[8];
+        section.compression = (compression_t)entry[9];
+        section.element_size = get_u32(entry + 12);
+        section.num_elements = get_u64(entry + 16);
+        section.payload_offset = get_u64(entry + 24);
+        section.payload_size = get_u64(entry + 32);
+        section.payload_checksum = get_u64(entry + 40);
+
+        if (section.form > form_montgomery ||
+            section.compression > compression_on ||
+            section.element_size == 0 ||
+            section.payload_offset % alignment != 0 ||
+            section.payload_offset > table_offset ||
+            section.payload_size > table_offset - section.payload_offset ||
+            section.num_elements !=
+                section.payload_size / section.element_size ||
+            section.payload_size % section.element_size != 0) {
+            throw std::runtime_error("invalid container section");
+        }
+    }
+
+    return sections;
+}
+
+group_container_reader::group_container_reader(const std::string &filename)
+    : _data(nullptr), _size(0)
+{
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("failed to open " + filename);
+    }
+
+    struct stat s;
+    if (0 != fstat(fd, &s) || (size_t)s.st_size < CONTAINER_HEADER_SIZE) {
+        ::close(fd);
+        throw std::runtime_error("invalid container");
+    }
+
+    _size = (size_t)s.st_size;
+    void *data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == data) {
+        throw std::runtime_error(
+            std::string("mmap failed: ") + strerror(errno));
+    }
+    _data = (const char *)data;
+
+    try {
+        _sections = container_parse(_data, _size);
+    } catch (...) {
+        munmap((void *)_data, _size);
+        throw;
+    }
+}
+
+group_container_reader::~group_container_reader()
+{
+    munmap((void *)_data, _size);
+}
+
+size_t group_container_reader::num_sections() const
+{
+    return _sections.size();
+}
+
+const group_container_section &group_container_reader::section_info(
+    const size_t idx) const
+{
+    if (idx >= _sections.size()) {
+        throw std::runtime_error("invalid container section index");
+    }
+    return _sections[idx];
+}
+
+bool group_container_reader::verify_checksums() const
+{
+    for (const group_container_section &section : _sections) {
+        const uint64_t checksum = group_container_checksum(
+            _data + section.payload_offset, section.payload_size);
+        if (checksum != section.payload_checksum) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace libff
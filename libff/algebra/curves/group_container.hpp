@@ -0,0 +1,204 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_HPP__
+#define __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_HPP__
+
+#include "libff/algebra/curves/curve_serialization.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace libff
+{
+
+// Container files hold one or more sections, each of which is a vector of
+// group elements in a fixed-size binary encoding (encoding_binary, with any
+// form and compression). The layout of the file is:
+//
+//   header        (64 bytes)
+//   section 0     (payload, starting at a multiple of the alignment)
+//   ...
+//   section N-1   (payload, starting at a multiple of the alignment)
+//   section table (64 bytes per section)
+//
+// All integers are big-endian. The header holds:
+//
+//   magic (8 bytes), version (4), alignment (4), num_sections (4),
+//   reserved (4), section table offset (8), section table checksum (8),
+//   reserved (24)
+//
+// and each section table entry holds:
+//
+//   group id (8 bytes), form (1), compression (1), reserved (2),
+//   element size (4), number of elements (8), payload offset (8),
+//   payload size (8), payload checksum (8), reserved (16)
+//
+// The group id identifies both the curve and the group (see
+// group_container_group_id). Since payloads are aligned, a file can be
+// memory-mapped and elements decoded directly from the mapping, without
+// parsing or copying the file.
+
+/// Description of a section of a container file.
+class group_container_section
+{
+public:
+    uint64_t group_id;
+    form_t form;
+    compression_t compression;
+    size_t element_size;
+    size_t num_elements;
+    size_t payload_offset;
+    size_t payload_size;
+    uint64_t payload_checksum;
+};
+
+/// Identifier for the group GroupT, recorded in container sections. This is
+/// the checksum of the encoding of GroupT::one(), and so identifies both the
+/// curve and the group within it.
+template<typename GroupT> uint64_t group_container_group_id();
+
+/// Checksum used for container payloads: the 64-bit FNV-1a hash of each 1 MiB
+/// block of data is computed (in parallel if MULTICORE is enabled), and the
+/// block hashes are combined with FNV-1a.
+uint64_t group_container_checksum(const void *data, const size_t size);
+
+namespace internal
+{
+
+/// Incremental computation of group_container_checksum.
+class group_container_hasher
+{
+public:
+    group_container_hasher();
+    void update(const char *data, size_t size);
+    uint64_t digest() const;
+
+protected:
+    uint64_t _hash;
+    uint64_t _block_hash;
+    size_t _block_fill;
+};
+
+} // namespace internal
+
+/// Write container files. Sections are written in order with write_section,
+/// each being encoded in blocks (so that arbitrarily large vectors can be
+/// written without duplicating them in memory). close() must be called to
+/// write the section table and header, otherwise the file is invalid.
+class group_container_writer
+{
+public:
+    static const size_t default_alignment = 4096;
+
+    group_container_writer(const group_container_writer &) = delete;
+    group_container_writer &operator=(const group_container_writer &) = delete;
+
+    group_container_writer(
+        const std::string &filename,
+        const size_t alignment = default_alignment);
+
+    template<form_t Form, compression_t Comp, typename GroupT>
+    void write_section(const std::vector<GroupT> &v);
+
+    void close();
+
+protected:
+    void begin_section();
+    void write_payload(const char *data, const size_t size);
+    void end_section(
+        const uint64_t group_id,
+        const form_t form,
+        const compression_t compression,
+        const size_t element_size,
+        const size_t num_elements);
+
+    std::ofstream _out_s;
+    size_t _alignment;
+    size_t _offset;
+    size_t _section_offset;
+    internal::group_container_hasher _hasher;
+    std::vector<group_container_section> _sections;
+};
+
+template<typename GroupT> class group_container_section_view;
+
+/// Read-only access to a memory-mapped container file. Opening a file reads
+/// and validates only the header and section table, so the cost does not
+/// depend on the size of the file. Payload checksums are only verified on
+/// request (see verify_checksums). Throws std::runtime_error if the file
+/// cannot be mapped or is not a valid container.
+class group_container_reader
+{
+public:
+    group_container_reader(const group_container_reader &) = delete;
+    group_container_reader &operator=(const group_container_reader &) = delete;
+
+    explicit group_container_reader(const std::string &filename);
+    ~group_container_reader();
+
+    size_t num_sections() const;
+    const group_container_section &section_info(const size_t idx) const;
+
+    /// Access the elements of a section, which must hold elements of GroupT.
+    /// The view refers to the mapped file, and so must not outlive this
+    /// object.
+    template<typename GroupT>
+    group_container_section_view<GroupT> section(const size_t idx) const;
+
+    /// Returns true if the checksum of every payload is correct.
+    bool verify_checksums() const;
+
+protected:
+    const char *_data;
+    size_t _size;
+    std::vector<group_container_section> _sections;
+};
+
+/// Elements of a single section of a group_container_reader.
+template<typename GroupT> class group_container_section_view
+{
+public:
+    group_container_section_view(
+        const group_container_section &info, const char *payload);
+
+    size_t size() const;
+
+    /// Decode the element at idx. No checks are performed on the element.
+    GroupT element(const size_t idx) const;
+
+    /// Decode the elements in the range [begin, end), in parallel if
+    /// MULTICORE is enabled, performing the given checks on each. Throws
+    /// std::runtime_error if any check fails.
+    void read(
+        std::vector<GroupT> &v,
+        const group_check_t check = group_check_none,
+        const size_t begin = 0,
+        const size_t end = (size_t)-1) const;
+
+    /// The raw (mapped) payload.
+    const char *data() const;
+
+protected:
+    template<form_t Form, compression_t Comp>
+    void decode(
+        const size_t begin,
+        const size_t num_elements,
+        const group_check_t check,
+        GroupT *out) const;
+
+    group_container_section _info;
+    const char *_payload;
+};
+
+} // namespace libff
+
+#include "libff/algebra/curves/group_container.tcc"
+
+#endif // __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_HPP__
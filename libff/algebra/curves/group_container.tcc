@@ -0,0 +1,179 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_TCC__
+#define __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_TCC__
+
+#include "libff/algebra/curves/group_container.hpp"
+
+#include <cassert>
+
+namespace libff
+{
+
+template<typename GroupT> uint64_t group_container_group_id()
+{
+    char buffer[group_binary_size<compression_off, GroupT>()];
+    group_encode<encoding_binary, form_plain, compression_off>(
+        GroupT::one(), buffer, sizeof(buffer));
+    return group_container_checksum(buffer, sizeof(buffer));
+}
+
+template<form_t Form, compression_t Comp, typename GroupT>
+void group_container_writer::write_section(const std::vector<GroupT> &v)
+{
+    using codec =
+        internal::group_vector_codec<encoding_binary, Form, Comp, GroupT>;
+
+    // Elements are converted to affine form and encoded in blocks, each of
+    // which is processed in parallel.
+    const size_t block_size = 1 << 16;
+    const size_t element_size = group_binary_size<Comp, GroupT>();
+
+    begin_section();
+
+    std::vector<GroupT> affine_block;
+    std::vector<char> buffer;
+    for (size_t block_begin = 0; block_begin < v.size();
+         block_begin += block_size) {
+        const size_t block_end = std::min(block_begin + block_size, v.size());
+        affine_block.assign(v.begin() + block_begin, v.begin() + block_end);
+
+        const size_t num_chunks =
+            internal::group_write_vector_num_chunks(affine_block.size());
+        internal::group_batch_to_affine(affine_block, num_chunks);
+        buffer.resize(affine_block.size() * element_size);
+        codec::encode(
+            affine_block.data(),
+            affine_block.size(),
+            num_chunks,
+            buffer.data());
+        write_payload(buffer.data(), buffer.size());
+    }
+
+    end_section(
+        group_container_group_id<GroupT>(), Form, Comp, element_size, v.size());
+}
+
+template<typename GroupT>
+group_container_section_view<GroupT> group_container_reader::section(
+    const size_t idx) const
+{
+    const group_container_section &info = section_info(idx);
+    if (info.group_id != group_container_group_id<GroupT>()) {
+        throw std::runtime_error("unexpected group in container section");
+    }
+
+    const size_t expected_element_size =
+        (info.compression == compression_on)
+            ? group_binary_size<compression_on, GroupT>()
+            : group_binary_size<compression_off, GroupT>();
+    if (info.element_size != expected_element_size) {
+        throw std::runtime_error("unexpected container element size");
+    }
+
+    return group_container_section_view<GroupT>(
+        info, _data + info.payload_offset);
+}
+
+template<typename GroupT>
+group_container_section_view<GroupT>::group_container_section_view(
+    const group_container_section &info, const char *payload)
+    : _info(info), _payload(payload)
+{
+}
+
+template<typename GroupT>
+size_t group_container_section_view<GroupT>::size() const
+{
+    return _info.num_elements;
+}
+
+template<typename GroupT>
+GroupT group_container_section_view<GroupT>::element(const size_t idx) const
+{
+    assert(idx < _info.num_elements);
+    const char *src = _payload + idx * _info.element_size;
+    const size_t size = _info.element_size;
+
+    GroupT result;
+    if (_info.form == form_plain) {
+        if (_info.compression == compression_on) {
+            group_decode<encoding_binary, form_plain, compression_on>(
+                result, src, size);
+        } else {
+            group_decode<encoding_binary, form_plain, compression_off>(
+                result, src, size);
+        }
+    } else {
+        if (_info.compression == compression_on) {
+            group_decode<encoding_binary, form_montgomery, compression_on>(
+                result, src, size);
+        } else {
+            group_decode<encoding_binary, form_montgomery, compression_off>(
+                result, src, size);
+        }
+    }
+
+    return result;
+}
+
+template<typename GroupT>
+void group_container_section_view<GroupT>::read(
+    std::vector<GroupT> &v,
+    const group_check_t check,
+    const size_t begin,
+    const size_t end) const
+{
+    const size_t range_end = std::min(end, _info.num_elements);
+    if (begin > range_end) {
+        throw std::runtime_error("invalid container section range");
+    }
+
+    const size_t num_elements = range_end - begin;
+    v.resize(num_elements);
+    if (_info.form == form_plain) {
+        if (_info.compression == compression_on) {
+            decode<form_plain, compression_on>(
+                begin, num_elements, check, v.data());
+        } else {
+            decode<form_plain, compression_off>(
+                begin, num_elements, check, v.data());
+        }
+    } else {
+        if (_info.compression == compression_on) {
+            decode<form_montgomery, compression_on>(
+                begin, num_elements, check, v.data());
+        } else {
+            decode<form_montgomery, compression_off>(
+                begin, num_elements, check, v.data());
+        }
+    }
+}
+
+template<typename GroupT>
+const char *group_container_section_view<GroupT>::data() const
+{
+    return _payload;
+}
+
+template<typename GroupT>
+template<form_t Form, compression_t Comp>
+void group_container_section_view<GroupT>::decode(
+    const size_t begin,
+    const size_t num_elements,
+    const group_check_t check,
+    GroupT *out) const
+{
+    internal::group_vector_codec<encoding_binary, Form, Comp, GroupT>::decode(
+        _payload + begin * _info.element_size, num_elements, check, out);
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_CURVES_GROUP_CONTAINER_TCC__
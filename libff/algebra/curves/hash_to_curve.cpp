@@ -0,0 +1,345 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/curves/hash_to_curve.hpp"
+
+#include <algorithm>
+#include <openssl/evp.h>
+#include <stdexcept>
+
+namespace libff
+{
+
+static const size_t SHA256_OUTPUT_SIZE = 32;
+static const size_t SHA256_BLOCK_SIZE = 64;
+static const size_t MAX_DST_SIZE = 255;
+
+static void sha256_init(EVP_MD_CTX *ctx)
+{
+    if (1 != EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr)) {
+        throw std::runtime_error("EVP_DigestInit_ex failed");
+    }
+}
+
+static void sha256_update(EVP_MD_CTX *ctx, const void *data, const size_t size)
+{
+    if (1 != EVP_DigestUpdate(ctx, data, size)) {
+        throw std::runtime_error("EVP_DigestUpdate failed");
+    }
+}
+
+static void sha256_final(EVP_MD_CTX *ctx, uint8_t *out)
+{
+    if (1 != EVP_DigestFinal_ex(ctx, out, nullptr)) {
+        throw std::runtime_error("EVP_DigestFinal_ex failed");
+    }
+}
+
+expand_message_xmd_sha256::expand_message_xmd_sha256(const std::string &dst)
+    : _ctx(EVP_MD_CTX_new())
+{
+    if (_ctx == nullptr) {
+        throw std::runtime_error("EVP_MD_CTX_new failed");
+    }
+
+    // DST_prime = DST || I2OSP(len(DST), 1), where long tags are replaced by
+    // H("H2C-OVERSIZE-DST-" || DST).
+    if (dst.size() > MAX_DST_SIZE) {
+        const std::string prefix = "H2C-OVERSIZE-DST-";
+        uint8_t dst_hash[SHA256_OUTPUT_SIZE];
+        sha256_init(_ctx);
+        sha256_update(_ctx, prefix.data(), prefix.size());
+        sha256_update(_ctx, dst.data(), dst.size());
+        sha256_final(_ctx, dst_hash);
+        _dst_prime.assign((const char *)dst_hash, sizeof(dst_hash));
+    } else {
+        _dst_prime = dst;
+    }
+    _dst_prime.push_back((char)_dst_prime.size());
+
+    // msg_prime begins with Z_pad = I2OSP(0, s_in_bytes).
+    const uint8_t z_pad[SHA256_BLOCK_SIZE] = {0};
+    sha256_init(_ctx);
+    sha256_update(_ctx, z_pad, sizeof(z_pad));
+}
+
+expand_message_xmd_sha256::~expand_message_xmd_sha256()
+{
+    EVP_MD_CTX_free(_ctx);
+}
+
+void expand_message_xmd_sha256::update(const void *data, const size_t size)
+{
+    sha256_update(_ctx, data, size);
+}
+
+void expand_message_xmd_sha256::finalize(
+    uint8_t *out, const size_t len_in_bytes)
+{
+    const size_t ell = (len_in_bytes + SHA256_OUTPUT_SIZE - 1) /
+                       SHA256_OUTPUT_SIZE;
+    if (ell > 255) {
+        throw std::runtime_error("expand_message_xmd output too long");
+    }
+
+    // b_0 = H(Z_pad || msg || I2OSP(len_in_bytes, 2) || I2OSP(0, 1) ||
+    //         DST_prime)
+    const uint8_t suffix[3] = {
+        (uint8_t)(len_in_bytes >> 8), (uint8_t)len_in_bytes, 0};
+    uint8_t b_0[SHA256_OUTPUT_SIZE];
+    sha256_update(_ctx, suffix, sizeof(suffix));
+    sha256_update(_ctx, _dst_prime.data(), _dst_prime.size());
+    sha256_final(_ctx, b_0);
+
+    // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime), where
+    // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime).
+    uint8_t b_i[SHA256_OUTPUT_SIZE] = {0};
+    for (size_t i = 1; i <= ell; ++i) {
+        for (size_t j = 0; j < SHA256_OUTPUT_SIZE; ++j) {
+            b_i[j] ^= b_0[j];
+        }
+        const uint8_t i_byte = (uint8_t)i;
+        sha256_init(_ctx);
+        sha256_update(_ctx, b_i, sizeof(b_i));
+        sha256_update(_ctx, &i_byte, 1);
+        sha256_update(_ctx, _dst_prime.data(), _dst_prime.size());
+        sha256_final(_ctx, b_i);
+
+        const size_t offset = (i - 1) * SHA256_OUTPUT_SIZE;
+        const size_t size =
+            std::min(SHA256_OUTPUT_SIZE, len_in_bytes - offset);
+        std::copy(b_i, b_i + size, out + offset);
+    }
+}
+
+namespace internal
+{
+
+template<size_t L> static bls12_381_Fq fq(const char (&hex)[L])
+{
+    return bls12_381_Fq(bigint<bls12_381_q_limbs>::from_hex(hex));
+}
+
+template<size_t L1, size_t L2>
+static bls12_381_Fq2 fq2(const char (&c0)[L1], const char (&c1)[L2])
+{
+    return bls12_381_Fq2(fq(c0), fq(c1));
+}
+
+// The 11-isogeny of RFC 9380, appendix E.2, from the curve E': y^2 = x^3 + A'
+// x + B' with the constant Z = 11 (section 8.8.1).
+template<> const sswu_curve_params<bls12_381_Fq> &sswu_params<bls12_381_G1>()
+{
+    static const std::vector<bls12_381_Fq> x_num{
+        fq("11a05f2b1e833340b809101dd99815856b303e88a2d7005ff2627b56cdb4e2c8561"
+           "0c2d5f2e62d6eaeac1662734649b7"),
+        fq("17294ed3e943ab2f0588bab22147a81c7c17e75b2f6a8417f565e33c70d1e86b483"
+           "8f2a6f318c356e834eef1b3cb83bb"),
+        fq("d54005db97678ec1d1048c5d10a9a1bce032473295983e56878e501ec68e25c958c"
+           "3e3d2a09729fe0179f9dac9edcb0"),
+        fq("1778e7166fcc6db74e0609d307e55412d7f5e4656a8dbf25f1b33289f1b33083533"
+           "6e25ce3107193c5b388641d9b6861"),
+        fq("e99726a3199f4436642b4b3e4118e5499db995a1257fb3f086eeb65982fac18985a"
+           "286f301e77c451154ce9ac8895d9"),
+        fq("1630c3250d7313ff01d1201bf7a74ab5db3cb17dd952799b9ed3ab9097e68f90a08"
+           "70d2dcae73d19cd13c1c66f652983"),
+        fq("d6ed6553fe44d296a3726c38ae652bfb11586264f0f8ce19008e218f9c86b2a8da2"
+           "5128c1052ecaddd7f225a139ed84"),
+        fq("17b81e7701abdbe2e8743884d1117e53356de5ab275b4db1a682c62ef0f2753339b"
+           "7c8f8c8f475af9ccb5618e3f0c88e"),
+        fq("80d3cf1f9a78fc47b90b33563be990dc43b756ce79f5574a2c596c928c5d1de4fa2"
+           "95f296b74e956d71986a8497e317"),
+        fq("169b1f8e1bcfa7c42e0c37515d138f22dd2ecb803a0c5c99676314baf4bb1b7fa31"
+           "90b2edc0327797f241067be390c9e"),
+        fq("10321da079ce07e272d8ec09d2565b0dfa7dccdde6787f96d50af36003b14866f69"
+           "b771f8c285decca67df3f1605fb7b"),
+        fq("6e08c248e260e70bd1e962381edee3d31d79d7e22c837bc23c0bf1bc24c6b68c24b"
+           "1b80b64d391fa9c8ba2e8ba2d229")};
+    static const std::vector<bls12_381_Fq> x_den{
+        fq("8ca8d548cff19ae18b2e62f4bd3fa6f01d5ef4ba35b48ba9c9588617fc8ac62b558"
+           "d681be343df8993cf9fa40d21b1c"),
+        fq("12561a5deb559c4348b4711298e536367041e8ca0cf0800c0126c2588c48bf5713d"
+           "aa8846cb026e9e5c8276ec82b3bff"),
+        fq("b2962fe57a3225e8137e629bff2991f6f89416f5a718cd1fca64e00b11aceacd6a3"
+           "d0967c94fedcfcc239ba5cb83e19"),
+        fq("3425581a58ae2fec83aafef7c40eb545b08243f16b1655154cca8abc28d6fd04976"
+           "d5243eecf5c4130de8938dc62cd8"),
+        fq("13a8e162022914a80a6f1d5f43e7a07dffdfc759a12062bb8d6b44e833b306da9bd"
+           "29ba81f35781d539d395b3532a21e"),
+        fq("e7355f8e4e667b955390f7f0506c6e9395735e9ce9cad4d0a43bcef24b8982f7400"
+           "d24bc4228f11c02df9a29f6304a5"),
+        fq("772caacf16936190f3e0c63e0596721570f5799af53a1894e2e073062aede9cea73"
+           "b3538f0de06cec2574496ee84a3a"),
+        fq("14a7ac2a9d64a8b230b3f5b074cf01996e7f63c21bca68a81996e1cdf9822c580fa"
+           "5b9489d11e2d311f7d99bbdcc5a5e"),
+        fq("a10ecf6ada54f825e920b3dafc7a3cce07f8d1d7161366b74100da67f3988350382"
+           "6692abba43704776ec3a79a1d641"),
+        fq("95fc13ab9e92ad4476d6e3eb3a56680f682b4ee96f7d03776df533978f31c159317"
+           "4e4b4b7865002d6384d168ecdd0a"),
+        fq("1")};
+    static const std::vector<bls12_381_Fq> y_num{
+        fq("90d97c81ba24ee0259d1f094980dcfa11ad138e48a869522b52af6c956543d3cd0c"
+           "7aee9b3ba3c2be9845719707bb33"),
+        fq("134996a104ee5811d51036d776fb46831223e96c254f383d0f906343eb67ad34d6c"
+           "56711962fa8bfe097e75a2e41c696"),
+        fq("cc786baa966e66f4a384c86a3b49942552e2d658a31ce2c344be4b91400da7d26d5"
+           "21628b00523b8dfe240c72de1f6"),
+        fq("1f86376e8981c217898751ad8746757d42aa7b90eeb791c09e4a3ec03251cf9de40"
+           "5aba9ec61deca6355c77b0e5f4cb"),
+        fq("8cc03fdefe0ff135caf4fe2a21529c4195536fbe3ce50b879833fd221351adc2ee7"
+           "f8dc099040a841b6daecf2e8fedb"),
+        fq("16603fca40634b6a2211e11db8f0a6a074a7d0d4afadb7bd76505c3d3ad5544e203"
+           "f6326c95a807299b23ab13633a5f0"),
+        fq("4ab0b9bcfac1bbcb2c977d027796b3ce75bb8ca2be184cb5231413c4d634f3747a8"
+           "7ac2460f415ec961f8855fe9d6f2"),
+        fq("987c8d5333ab86fde9926bd2ca6c674170a05bfe3bdd81ffd038da6c26c842642f6"
+           "4550fedfe935a15e4ca31870fb29"),
+        fq("9fc4018bd96684be88c9e221e4da1bb8f3abd16679dc26c1e8b6e6a1f20cabe69d6"
+           "5201c78607a360370e577bdba587"),
+        fq("e1bba7a1186bdb5223abde7ada14a23c42a0ca7915af6fe06985e7ed1e4d43b9b3f"
+           "7055dd4eba6f2bafaaebca731c30"),
+        fq("19713e47937cd1be0dfd0b8f1d43fb93cd2fcbcb6caf493fd1183e416389e61031b"
+           "f3a5cce3fbafce813711ad011c132"),
+        fq("18b46a908f36f6deb918c143fed2edcc523559b8aaf0c2462e6bfe7f911f643249d"
+           "9cdf41b44d606ce07c8a4d0074d8e"),
+        fq("b182cac101b9399d155096004f53f447aa7b12a3426b08ec02710e807b4633f06c8"
+           "51c1919211f20d4c04f00b971ef8"),
+        fq("245a394ad1eca9b72fc00ae7be315dc757b3b080d4c158013e6632d3c40659cc6cf"
+           "90ad1c232a6442d9d3f5db980133"),
+        fq("5c129645e44cf1102a159f748c4a3fc5e673d81d7e86568d9ab0f5d396a7ce46ba1"
+           "049b6579afb7866b1e715475224b"),
+        fq("15e6be4e990f03ce4ea50b3b42df2eb5cb181d8f84965a3957add4fa95af01b2b66"
+           "5027efec01c7704b456be69c8b604")};
+    static const std::vector<bls12_381_Fq> y_den{
+        fq("16112c4c3a9c98b252181140fad0eae9601a6de578980be6eec3232b5be72e7a07f"
+           "3688ef60c206d01479253b03663c1"),
+        fq("1962d75c2381201e1a0cbd6c43c348b885c84ff731c4d59ca4a10356f453e01f78a"
+           "4260763529e3532f6102c2e49a03d"),
+        fq("58df3306640da276faaae7d6e8eb15778c4855551ae7f310c35a5dd279cd2eca675"
+           "7cd636f96f891e2538b53dbf67f2"),
+        fq("16b7d288798e5395f20d23bf89edb4d1d115c5dbddbcd30e123da489e726af41727"
+           "364f2c28297ada8d26d98445f5416"),
+        fq("be0e079545f43e4b00cc912f8228ddcc6d19c9f0f69bbb0542eda0fc9dec916a20b"
+           "15dc0fd2ededda39142311a5001d"),
+        fq("8d9e5297186db2d9fb266eaac783182b70152c65550d881c5ecd87b6f0f5a6449f3"
+           "8db9dfa9cce202c6477faaf9b7ac"),
+        fq("166007c08a99db2fc3ba8734ace9824b5eecfdfa8d0cf8ef5dd365bc400a0051d5f"
+           "a9c01a58b1fb93d1a1399126a775c"),
+        fq("16a3ef08be3ea7ea03bcddfabba6ff6ee5a4375efa1f4fd7feb34fd206357132b92"
+           "0f5b00801dee460ee415a15812ed9"),
+        fq("1866c8ed336c61231a1be54fd1d74cc4f9fb0ce4c6af5920abc5750c4bf39b4852c"
+           "fe2f7bb9248836b233d9d55535d4a"),
+        fq("167a55cda70a6e1cea820597d94a84903216f763e13d87bb5308592e7ea7d4fbc73"
+           "85ea3d529b35e346ef48bb8913f55"),
+        fq("4d2f259eea405bd48f010a01ad2911d9c6dd039bb61a6290e591b36e636a5c871a5"
+           "c29f4f83060400f8b49cba8f6aa8"),
+        fq("accbb67481d033ff5852c1e48c50c477f94ff8aefce42d28c0f9a88cea7913516f9"
+           "68986f7ebbea9684b529e2561092"),
+        fq("ad6b9514c767fe3c3613144b45f1496543346d98adf02267d5ceef9a00d9b869300"
+           "0763e3b90ac11e99b138573345cc"),
+        fq("2660400eb2e4f3b628bdd0d53cd76f2bf565b94e72927c1cb748df27942480e4205"
+           "17bd8714cc80d1fadc1326ed06f7"),
+        fq("e0fa1d816ddc03e6b24255e0d7819c171c40f65e273b853324efcd6356caa205ca2"
+           "f570f13497804415473a1d634b8f"),
+        fq("1")};
+    static const sswu_curve_params<bls12_381_Fq> params(
+        fq("144698a3b8e9433d693a02c96d4982b0ea985383ee66a8d8e8981aefd881ac98936"
+           "f8da0e0f97f5cf428082d584c1d"),
+        fq("12e2908d11688030018b12e8753eee3b2016c1f0f24f4070a0b9c14fcef35ef55a2"
+           "3215a316ceaa5d1cc48e98e172be0"),
+        fq("b"),
+        x_num,
+        x_den,
+        y_num,
+        y_den);
+    return params;
+}
+
+// The 3-isogeny of RFC 9380, appendix E.3, from the curve E': y^2 = x^3 +
+// 240 * I * x + 1012 * (1 + I) with the constant Z = -(2 + I) (section
+// 8.8.2).
+template<>
+const sswu_curve_params<bls12_381_Fq2> &sswu_params<bls12_381_G2>()
+{
+    static const std::vector<bls12_381_Fq2> x_num{
+        fq2(
+            "5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2"
+            "638e343d9c71c6238aaaaaaaa97d6",
+            "5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2"
+            "638e343d9c71c6238aaaaaaaa97d6"),
+        fq2(
+            "0",
+            "11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a41814"
+            "72aaa9cb8d555526a9ffffffffc71a"),
+        fq2(
+            "11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a41814"
+            "72aaa9cb8d555526a9ffffffffc71e",
+            "8ab05f8bdd54cde190937e76bc3e447cc27c3d6fbd7063fcd104635a790520c0a3"
+            "95554e5c6aaaa9354ffffffffe38d"),
+        fq2(
+            "171d6541fa38ccfaed6dea691f5fb614cb14b4e7f4e810aa22d6108f142b857570"
+            "98e38d0f671c7188e2aaaaaaaa5ed1",
+            "0")};
+    static const std::vector<bls12_381_Fq2> x_den{
+        fq2(
+            "0",
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffaa63"),
+        fq2(
+            "c",
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffaa9f"),
+        fq2("1", "0")};
+    static const std::vector<bls12_381_Fq2> y_num{
+        fq2(
+            "1530477c7ab4113b59a4c18b076d11930f7da5d4a07f649bf54439d87d27e500fc"
+            "8c25ebf8c92f6812cfc71c71c6d706",
+            "1530477c7ab4113b59a4c18b076d11930f7da5d4a07f649bf54439d87d27e500fc"
+            "8c25ebf8c92f6812cfc71c71c6d706"),
+        fq2(
+            "0",
+            "5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2"
+            "638e343d9c71c6238aaaaaaaa97be"),
+        fq2(
+            "11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a41814"
+            "72aaa9cb8d555526a9ffffffffc71c",
+            "8ab05f8bdd54cde190937e76bc3e447cc27c3d6fbd7063fcd104635a790520c0a3"
+            "95554e5c6aaaa9354ffffffffe38f"),
+        fq2(
+            "124c9ad43b6cf79bfbf7043de3811ad0761b0f37a1e26286b0e977c69aa274524e"
+            "79097a56dc4bd9e1b371c71c718b10",
+            "0")};
+    static const std::vector<bls12_381_Fq2> y_den{
+        fq2(
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffa8fb",
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffa8fb"),
+        fq2(
+            "0",
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffa9d3"),
+        fq2(
+            "12",
+            "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241e"
+            "abfffeb153ffffb9feffffffffaa99"),
+        fq2("1", "0")};
+    static const sswu_curve_params<bls12_381_Fq2> params(
+        fq2("0", "f0"),
+        fq2("3f4", "3f4"),
+        -fq2("2", "1"),
+        x_num,
+        x_den,
+        y_num,
+        y_den);
+    return params;
+}
+
+} // namespace internal
+
+} // namespace libff
@@ -0,0 +1,93 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_HPP__
+#define __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_HPP__
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct evp_md_ctx_st;
+
+namespace libff
+{
+
+/// Incremental implementation of expand_message_xmd (RFC 9380, section
+/// 5.3.1) using SHA-256. The message is passed to update() in any number of
+/// parts, after which finalize() produces the output.
+class expand_message_xmd_sha256
+{
+public:
+    expand_message_xmd_sha256(const expand_message_xmd_sha256 &) = delete;
+    expand_message_xmd_sha256 &operator=(const expand_message_xmd_sha256 &) =
+        delete;
+
+    /// Domain separation tags longer than 255 bytes are hashed as described
+    /// in RFC 9380, section 5.3.3.
+    explicit expand_message_xmd_sha256(const std::string &dst);
+    ~expand_message_xmd_sha256();
+
+    void update(const void *data, const size_t size);
+
+    /// Write len_in_bytes (at most 8160) uniform bytes to out. Must be called
+    /// at most once. Throws std::runtime_error if len_in_bytes is too large.
+    void finalize(uint8_t *out, const size_t len_in_bytes);
+
+protected:
+    evp_md_ctx_st *_ctx;
+    std::string _dst_prime;
+};
+
+/// The simplified SWU map (RFC 9380, section 6.6.3) from an element u of the
+/// field of coordinates of GroupT, to a point on the curve (not necessarily
+/// in the prime-order subgroup). The map is applied to an isogenous curve and
+/// composed with the isogeny, and requires no inversion. The point is
+/// returned in Jacobian form. Supported for the G1 and G2 groups of
+/// bls12_381.
+template<typename GroupT, typename FieldT>
+GroupT map_to_curve_simple_swu(const FieldT &u);
+
+/// Incremental hash_to_curve (RFC 9380, section 3) for the random oracle
+/// encoding, following the BLS12381G1_XMD:SHA-256_SSWU_RO_ and
+/// BLS12381G2_XMD:SHA-256_SSWU_RO_ suites (RFC 9380, section 8.8). Supported
+/// for the G1 and G2 groups of bls12_381 (RFC 9380 defines no suite for
+/// bls12_377).
+template<typename GroupT> class hash_to_curve_hasher
+{
+public:
+    explicit hash_to_curve_hasher(const std::string &dst);
+
+    void update(const void *data, const size_t size);
+
+    /// Compute the result. Must be called at most once.
+    GroupT finalize();
+
+protected:
+    expand_message_xmd_sha256 _expander;
+};
+
+/// Hash a message to a point in the prime-order subgroup of GroupT (see
+/// hash_to_curve_hasher).
+template<typename GroupT>
+GroupT hash_to_curve(const std::string &msg, const std::string &dst);
+
+/// Hash each of a set of messages to a point, as for hash_to_curve. Messages
+/// are processed in parallel if MULTICORE is enabled. The map itself requires
+/// no inversion, and all results are converted to affine form with batched
+/// inversions (see batch_to_special).
+template<typename GroupT>
+std::vector<GroupT> batch_hash_to_curve(
+    const std::vector<std::string> &msgs, const std::string &dst);
+
+} // namespace libff
+
+#include "libff/algebra/curves/hash_to_curve.tcc"
+
+#endif // __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_HPP__
@@ -0,0 +1,467 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_TCC__
+#define __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_TCC__
+
+#include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#include "libff/algebra/curves/hash_to_curve.hpp"
+#include "libff/algebra/fields/field_utils.hpp"
+#include "libff/algebra/scalar_multiplication/multiexp.hpp"
+#include "libff/common/parallel.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+namespace libff
+{
+
+namespace internal
+{
+
+template<typename GroupT>
+using group_coordinate_field =
+    typename std::decay<decltype(std::declval<GroupT>().X)>::type;
+
+// sgn0 (RFC 9380, section 4.1).
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sgn0(const Fp_model<n, modulus> &x)
+{
+    return x.as_bigint().data[0] & 1;
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sgn0(const Fp2_model<n, modulus> &x)
+{
+    const bigint<n> x0 = x.coeffs[0].as_bigint();
+    const bool sign_0 = x0.data[0] & 1;
+    const bool zero_0 = x0.is_zero();
+    const bool sign_1 = x.coeffs[1].as_bigint().data[0] & 1;
+    return sign_0 || (zero_0 && sign_1);
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+void field_from_components(
+    Fp_model<n, modulus> &out, const Fp_model<n, modulus> *components)
+{
+    out = components[0];
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+void field_from_components(
+    Fp2_model<n, modulus> &out, const Fp_model<n, modulus> *components)
+{
+    out = Fp2_model<n, modulus>(components[0], components[1]);
+}
+
+/// The number of bytes L used to derive each element of the prime field
+/// (RFC 9380, section 5), for security level k = 128.
+template<typename PrimeFieldT> size_t hash_to_field_element_size()
+{
+    return (PrimeFieldT::num_bits + 128 + 7) / 8;
+}
+
+/// Interpret a big-endian byte string of length at most sizeof(bigint<n>) as
+/// an integer.
+template<mp_size_t n>
+bigint<n> bigint_from_bytes(const uint8_t *bytes, const size_t num_bytes)
+{
+    const size_t limb_bytes = sizeof(mp_limb_t);
+    assert(num_bytes <= n * limb_bytes);
+    bigint<n> result;
+    for (size_t i = 0; i < num_bytes; ++i) {
+        const size_t byte_idx = num_bytes - 1 - i;
+        result.data[i / limb_bytes] |= ((mp_limb_t)bytes[byte_idx])
+                                       << (8 * (i % limb_bytes));
+    }
+    return result;
+}
+
+/// hash_to_field (RFC 9380, section 5.2), given the output of
+/// expand_message. Writes count elements to out.
+template<typename FieldT>
+void hash_to_field(
+    const uint8_t *uniform_bytes, const size_t count, FieldT *out)
+{
+    using prime_field = typename FieldT::my_Fp;
+    const size_t m = FieldT::extension_degree();
+    const size_t L = hash_to_field_element_size<prime_field>();
+
+    // Each L-byte integer is split as hi * 2^{8 * lo_size} + lo, where both
+    // hi and lo are smaller than the modulus.
+    const size_t lo_size = L / 2;
+    const size_t lo_bits = 8 * lo_size;
+    assert(8 * (L - lo_size) < prime_field::num_bits);
+    bigint<prime_field::num_limbs> shift;
+    shift.data[lo_bits / GMP_NUMB_BITS] = ((mp_limb_t)1)
+                                          << (lo_bits % GMP_NUMB_BITS);
+    const prime_field shift_el(shift);
+
+    std::vector<prime_field> components(m);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            const uint8_t *tv = uniform_bytes + L * (j + i * m);
+            const prime_field hi(bigint_from_bytes<prime_field::num_limbs>(
+                tv, L - lo_size));
+            const prime_field lo(bigint_from_bytes<prime_field::num_limbs>(
+                tv + L - lo_size, lo_size));
+            components[j] = hi * shift_el + lo;
+        }
+        field_from_components(out[i], components.data());
+    }
+}
+
+/// Parameters of the simplified SWU map for a curve E (RFC 9380, sections
+/// 6.6.2 and 6.6.3): the coefficients A and B of a curve E': y^2 = x^3 + A x +
+/// B isogenous to E, the constant Z, and the coefficients (lowest degree
+/// first) of the rational functions of the isogeny map E' -> E.
+template<typename FieldT> class sswu_curve_params
+{
+public:
+    FieldT A;
+    FieldT B;
+    FieldT Z;
+    std::vector<FieldT> x_num;
+    std::vector<FieldT> x_den;
+    std::vector<FieldT> y_num;
+    std::vector<FieldT> y_den;
+
+    /// Z^t and Z^((t + 1) / 2), where the order of the multiplicative group
+    /// is 2^s * t with t odd (the constants c6 and c7 of sqrt_ratio).
+    FieldT Z_to_t;
+    FieldT Z_to_t_plus_1_over_2;
+
+    sswu_curve_params(
+        const FieldT &A,
+        const FieldT &B,
+        const FieldT &Z,
+        const std::vector<FieldT> &x_num,
+        const std::vector<FieldT> &x_den,
+        const std::vector<FieldT> &y_num,
+        const std::vector<FieldT> &y_den);
+};
+
+/// The parameters of the simplified SWU map for the curve of GroupT.
+/// Specialized (in hash_to_curve.cpp) for each supported group, and computed
+/// on first use.
+template<typename GroupT>
+const sswu_curve_params<group_coordinate_field<GroupT>> &sswu_params();
+
+template<> const sswu_curve_params<bls12_381_Fq> &sswu_params<bls12_381_G1>();
+
+template<>
+const sswu_curve_params<bls12_381_Fq2> &sswu_params<bls12_381_G2>();
+
+template<typename FieldT>
+sswu_curve_params<FieldT>::sswu_curve_params(
+    const FieldT &A,
+    const FieldT &B,
+    const FieldT &Z,
+    const std::vector<FieldT> &x_num,
+    const std::vector<FieldT> &x_den,
+    const std::vector<FieldT> &y_num,
+    const std::vector<FieldT> &y_den)
+    : A(A)
+    , B(B)
+    , Z(Z)
+    , x_num(x_num)
+    , x_den(x_den)
+    , y_num(y_num)
+    , y_den(y_den)
+    , Z_to_t(Z ^ FieldT::t)
+    , Z_to_t_plus_1_over_2((Z ^ FieldT::t_minus_1_over_2) * Z)
+{
+    // iso_map relies on the degrees of the isogeny map of RFC 9380, appendix
+    // E: deg(x_den) = deg(x_num) - 1 and deg(y_den) = deg(y_num).
+    assert(x_den.size() + 1 == x_num.size());
+    assert(y_den.size() == y_num.size());
+}
+
+/// sqrt_ratio (RFC 9380, appendix F.2.1.1). If u / v is square, set y to a
+/// square root of u / v and return true. Otherwise, set y to a square root of
+/// Z * u / v and return false. This requires a single exponentiation (and
+/// FieldT::s squarings), and no inversion.
+template<typename FieldT>
+bool sqrt_ratio(
+    const sswu_curve_params<FieldT> &params,
+    const FieldT &u,
+    const FieldT &v,
+    FieldT &y)
+{
+    const size_t c1 = FieldT::s;
+
+    // tv2 = v^(2^c1 - 1)
+    FieldT tv2 = v;
+    for (size_t i = 1; i < c1; ++i) {
+        tv2 = tv2.squared() * v;
+    }
+    FieldT tv3 = tv2.squared() * v;
+    FieldT tv5 = ((u * tv3) ^ FieldT::t_minus_1_over_2) * tv2;
+    tv2 = tv5 * v;
+    tv3 = tv5 * u;
+    FieldT tv4 = tv3 * tv2;
+
+    // tv5 = tv4^(2^(c1 - 1))
+    tv5 = tv4;
+    for (size_t i = 1; i < c1; ++i) {
+        tv5 = tv5.squared();
+    }
+    const bool is_qr = (tv5 == FieldT::one());
+
+    FieldT tv1 = params.Z_to_t;
+    if (!is_qr) {
+        tv3 = tv3 * params.Z_to_t_plus_1_over_2;
+        tv4 = tv4 * tv1;
+    }
+
+    for (size_t i = c1; i >= 2; --i) {
+        // tv5 = tv4^(2^(i - 2))
+        tv5 = tv4;
+        for (size_t j = 2; j < i; ++j) {
+            tv5 = tv5.squared();
+        }
+        tv2 = tv3 * tv1;
+        tv1 = tv1.squared();
+        if (tv5 != FieldT::one()) {
+            tv3 = tv2;
+            tv4 = tv4 * tv1;
+        }
+    }
+
+    y = tv3;
+    return is_qr;
+}
+
+/// The simplified SWU map (RFC 9380, section 6.6.2) to the curve E' of
+/// params, following the straight-line description of appendix F.2. The
+/// x-coordinate of the result is given as the fraction x_num / x_den, so that
+/// no inversion is required.
+template<typename FieldT>
+void map_to_isogenous_curve_simple_swu(
+    const sswu_curve_params<FieldT> &params,
+    const FieldT &u,
+    FieldT &x_num,
+    FieldT &x_den,
+    FieldT &y)
+{
+    const FieldT tv1 = params.Z * u.squared();
+    FieldT tv2 = tv1.squared() + tv1;
+    const FieldT tv3 = params.B * (tv2 + FieldT::one());
+    const FieldT tv4 = params.A * (tv2.is_zero() ? params.Z : -tv2);
+    FieldT tv6 = tv4.squared();
+    tv2 = (tv3.squared() + params.A * tv6) * tv3;
+    tv6 = tv6 * tv4;
+    tv2 = tv2 + params.B * tv6;
+
+    // g(x1) = tv2 / tv6, where x1 = tv3 / tv4. If it is not square, then
+    // g(x2) is, where x2 = tv1 * x1.
+    FieldT y1;
+    if (sqrt_ratio(params, tv2, tv6, y1)) {
+        x_num = tv3;
+        y = y1;
+    } else {
+        x_num = tv1 * tv3;
+        y = tv1 * u * y1;
+    }
+    x_den = tv4;
+
+    if (field_sgn0(u) != field_sgn0(y)) {
+        y = -y;
+    }
+}
+
+/// Evaluate the polynomial with the given coefficients (lowest degree first),
+/// homogenized to degree d, at (x_num : x_den). That is, compute x_den^d *
+/// f(x_num / x_den), given x_den_powers[i] = x_den^i for i <= d.
+template<typename FieldT>
+FieldT evaluate_homogeneous(
+    const std::vector<FieldT> &coeffs,
+    const FieldT &x_num,
+    const std::vector<FieldT> &x_den_powers,
+    const size_t d)
+{
+    assert(coeffs.size() <= d + 1);
+    FieldT result = FieldT::zero();
+    for (size_t i = d + 1; i-- > 0;) {
+        result = result * x_num;
+        if (i < coeffs.size()) {
+            result = result + coeffs[i] * x_den_powers[d - i];
+        }
+    }
+    return result;
+}
+
+/// The isogeny map E' -> E (RFC 9380, section 6.6.3), evaluated at the point
+/// (x_num / x_den, y) of E' without inversion. The result is in Jacobian
+/// coordinates, and is zero at the exceptional points of the map.
+template<typename GroupT>
+GroupT iso_map(
+    const sswu_curve_params<group_coordinate_field<GroupT>> &params,
+    const group_coordinate_field<GroupT> &x_num,
+    const group_coordinate_field<GroupT> &x_den,
+    const group_coordinate_field<GroupT> &y)
+{
+    using field = group_coordinate_field<GroupT>;
+
+    const size_t deg_x = params.x_num.size() - 1;
+    const size_t deg_y = params.y_num.size() - 1;
+    std::vector<field> x_den_powers(std::max(deg_x, deg_y) + 1);
+    x_den_powers[0] = field::one();
+    for (size_t i = 1; i < x_den_powers.size(); ++i) {
+        x_den_powers[i] = x_den_powers[i - 1] * x_den;
+    }
+
+    // The image is (x_n / x_d, y * y_n / y_d). With Z = x_d * y_d, the
+    // Jacobian coordinates are X = x_n * x_d * y_d^2 and Y = y * y_n * x_d^3 *
+    // y_d^2.
+    const field x_n =
+        evaluate_homogeneous(params.x_num, x_num, x_den_powers, deg_x);
+    const field x_d =
+        evaluate_homogeneous(params.x_den, x_num, x_den_powers, deg_x);
+    const field y_n =
+        evaluate_homogeneous(params.y_num, x_num, x_den_powers, deg_y);
+    const field y_d =
+        evaluate_homogeneous(params.y_den, x_num, x_den_powers, deg_y);
+    const field x_d_y_d2 = x_d * y_d.squared();
+    return GroupT(
+        x_n * x_d_y_d2, y * y_n * x_d.squared() * x_d_y_d2, x_d * y_d);
+}
+
+/// Cofactor clearing, specialized for each supported group.
+template<typename GroupT> class hash_to_curve_cofactor;
+
+// Multiplication by h_eff = 1 - z (RFC 9380, section 8.8.1).
+template<> class hash_to_curve_cofactor<bls12_381_G1>
+{
+public:
+    static bls12_381_G1 clear(const bls12_381_G1 &P)
+    {
+        const bigint<1> h_eff = bigint<1>::from_hex("d201000000010001");
+        return h_eff * P;
+    }
+};
+
+/// Cofactor clearing for the G2 group of BLS12 curves, using the method of
+/// Budroni and Pintore (RFC 9380, appendix G.3). This computes
+///
+///   [z^2 - z - 1] P + [z - 1] psi(P) + psi^2(2 P)
+///
+/// where psi is the endomorphism mul_by_q.
+template<typename G2T, mp_size_t n>
+G2T bls12_g2_clear_cofactor(
+    const G2T &P, const bigint<n> &z_abs, const bool z_is_neg)
+{
+    const auto mul_by_z = [&](const G2T &Q) {
+        const G2T zQ = z_abs * Q;
+        return z_is_neg ? -zQ : zQ;
+    };
+
+    const G2T t1 = mul_by_z(P);
+    G2T t2 = P.mul_by_q();
+    G2T t3 = P.dbl().mul_by_q().mul_by_q();
+    t3 = t3 - t2;
+    t2 = mul_by_z(t1 + t2);
+    t3 = t3 + t2;
+    t3 = t3 - t1;
+    return t3 - P;
+}
+
+template<> class hash_to_curve_cofactor<bls12_381_G2>
+{
+public:
+    static bls12_381_G2 clear(const bls12_381_G2 &P)
+    {
+        return bls12_g2_clear_cofactor(
+            P,
+            bls12_381_final_exponent_z,
+            bls12_381_final_exponent_is_z_neg);
+    }
+};
+
+/// Number of uniform bytes required by hash_to_curve for GroupT.
+template<typename GroupT> size_t hash_to_curve_num_bytes()
+{
+    using field = group_coordinate_field<GroupT>;
+    return 2 * field::extension_degree() *
+           hash_to_field_element_size<typename field::my_Fp>();
+}
+
+} // namespace internal
+
+template<typename GroupT, typename FieldT>
+GroupT map_to_curve_simple_swu(const FieldT &u)
+{
+    static_assert(
+        std::is_same<FieldT, internal::group_coordinate_field<GroupT>>::value,
+        "unexpected field type");
+    const internal::sswu_curve_params<FieldT> &params =
+        internal::sswu_params<GroupT>();
+    FieldT x_num;
+    FieldT x_den;
+    FieldT y;
+    internal::map_to_isogenous_curve_simple_swu(params, u, x_num, x_den, y);
+    return internal::iso_map<GroupT>(params, x_num, x_den, y);
+}
+
+template<typename GroupT>
+hash_to_curve_hasher<GroupT>::hash_to_curve_hasher(const std::string &dst)
+    : _expander(dst)
+{
+}
+
+template<typename GroupT>
+void hash_to_curve_hasher<GroupT>::update(const void *data, const size_t size)
+{
+    _expander.update(data, size);
+}
+
+template<typename GroupT> GroupT hash_to_curve_hasher<GroupT>::finalize()
+{
+    using field = internal::group_coordinate_field<GroupT>;
+
+    std::vector<uint8_t> uniform_bytes(
+        internal::hash_to_curve_num_bytes<GroupT>());
+    _expander.finalize(uniform_bytes.data(), uniform_bytes.size());
+    field u[2];
+    internal::hash_to_field(uniform_bytes.data(), 2, u);
+
+    const GroupT Q0 = map_to_curve_simple_swu<GroupT>(u[0]);
+    const GroupT Q1 = map_to_curve_simple_swu<GroupT>(u[1]);
+    return internal::hash_to_curve_cofactor<GroupT>::clear(Q0 + Q1);
+}
+
+template<typename GroupT>
+GroupT hash_to_curve(const std::string &msg, const std::string &dst)
+{
+    hash_to_curve_hasher<GroupT> hasher(dst);
+    hasher.update(msg.data(), msg.size());
+    return hasher.finalize();
+}
+
+template<typename GroupT>
+std::vector<GroupT> batch_hash_to_curve(
+    const std::vector<std::string> &msgs, const std::string &dst)
+{
+    std::vector<GroupT> result(msgs.size());
+    parallel_for(0, msgs.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hash_to_curve_hasher<GroupT> hasher(dst);
+            hasher.update(msgs[i].data(), msgs[i].size());
+            result[i] = hasher.finalize();
+        }
+    });
+
+    batch_to_special(result);
+    return result;
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_CURVES_HASH_TO_CURVE_TCC__
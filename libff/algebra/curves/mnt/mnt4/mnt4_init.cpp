@@ -48,128 +48,154 @@ void init_mnt4_params()
         sizeof(mp_limb_t) == 4); // Montgomery assumes this
 
     /* parameters for scalar field Fr */
-    mnt4_modulus_r = bigint_r("475922286169261325753349249653048451545124878552"
-                              "823515553267735739164647307408490559963137");
     assert(mnt4_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        mnt4_Fr::Rsquared =
-            bigint_r("163983144722506446826715124368972380525894397127205577781"
-                     "234305496325861831001705438796139");
-        mnt4_Fr::Rcubed =
-            bigint_r("207236281459091063710247635236340312578688659363066707916"
-                     "716212805695955118593239854980171");
+        mnt4_Fr::Rsquared = bigint_r::from_hex(
+            "149bb44a34202ff00dced8e4b6d4bbd6dcf1e3a8386034f9102adb68371465a743"
+            "c68e0596b");
+        mnt4_Fr::Rcubed = bigint_r::from_hex(
+            "1a0b411c083b440f6a9ed2947ceac13907bab5d43c2f687b031b7f0b2b9b6de2f1"
+            "b99bd9c4b");
         mnt4_Fr::inv = 0xbb4334a3ffffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        mnt4_Fr::Rsquared =
-            bigint_r("163983144722506446826715124368972380525894397127205577781"
-                     "234305496325861831001705438796139");
-        mnt4_Fr::Rcubed =
-            bigint_r("207236281459091063710247635236340312578688659363066707916"
-                     "716212805695955118593239854980171");
+        mnt4_Fr::Rsquared = bigint_r::from_hex(
+            "149bb44a34202ff00dced8e4b6d4bbd6dcf1e3a8386034f9102adb68371465a743"
+            "c68e0596b");
+        mnt4_Fr::Rcubed = bigint_r::from_hex(
+            "1a0b411c083b440f6a9ed2947ceac13907bab5d43c2f687b031b7f0b2b9b6de2f1"
+            "b99bd9c4b");
         mnt4_Fr::inv = 0xffffffff;
     }
     mnt4_Fr::num_bits = 298;
-    mnt4_Fr::euler = bigint_r("237961143084630662876674624826524225772562439276"
-                              "411757776633867869582323653704245279981568");
+    mnt4_Fr::euler = bigint_r::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae7a20ca7da4a603c92eb569dda19a52000"
+        "00000");
     mnt4_Fr::s = 34;
-    mnt4_Fr::t = bigint_r("2770232305450256248897344628657729199302411164115319"
-                          "9339359284829066871159442729");
-    mnt4_Fr::t_minus_1_over_2 =
-        bigint_r("1385116152725128124448672314328864599651205582057659966967964"
-                 "2414533435579721364");
-    mnt4_Fr::multiplicative_generator = mnt4_Fr("10");
-    mnt4_Fr::root_of_unity =
-        mnt4_Fr("12063881782691317345876882948569009984537700803089161801010977"
-                "2937363554409782252579816313");
-    mnt4_Fr::nqr = mnt4_Fr("5");
-    mnt4_Fr::nqr_to_t = mnt4_Fr("4062206042430904010564294587302981459372625525"
-                                "08985450684842547562990900634752279902740880");
+    mnt4_Fr::t = bigint_r::from_hex(
+        "ef3def351ce899892769ec1523b2bbb258d73d10653ed25301e4975ab4eed0cd29");
+    mnt4_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "779ef79a8e744cc493b4f60a91d95dd92c6b9e88329f692980f24bad5a77686694");
+    mnt4_Fr::multiplicative_generator = mnt4_Fr::from_montgomery_hex(
+        "2977770b3d11159f37d4e0fddb28f00647b48958d3625e295ff76674008b1ddfacffd5"
+        "32b94");
+    mnt4_Fr::root_of_unity = mnt4_Fr::from_montgomery_hex(
+        "6a24a0f8a8f9bd39c0cdcf1bb65784a8fe792c5f8a2ae2750d46a53957818b361df1af"
+        "7be4");
+    mnt4_Fr::nqr = mnt4_Fr::from_montgomery_hex(
+        "14bbbb859e888acf9bea707eed94780323da44ac69b12f14affbb33a00458eefd67fea"
+        "995ca");
+    mnt4_Fr::nqr_to_t = mnt4_Fr::from_montgomery_hex(
+        "116674aec664b46c5bfd53e80d730bf7490d1156bcf91413f08d15b54da89521bfda12"
+        "f07f0");
     mnt4_Fr::static_init();
 
     /* parameters for base field Fq */
-    mnt4_modulus_q = bigint_q("475922286169261325753349249653048451545124879242"
-                              "694725395555128576210262817955800483758081");
     assert(mnt4_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        mnt4_Fq::Rsquared =
-            bigint_q("273000478523237720910981655601160860640083126627235719712"
-                     "980612296263966512828033847775776");
-        mnt4_Fq::Rcubed =
-            bigint_q("427298980065529822574935274648041073124704261331681436071"
-                     "990730954930769758106792920349077");
+        mnt4_Fq::Rsquared = bigint_q::from_hex(
+            "224f0918a341f32e014ad38d47b66bd7673318850e1a266a1adbf2bc8930065ace"
+            "c5613d220");
+        mnt4_Fq::Rcubed = bigint_q::from_hex(
+            "35b329c5c21db492b899fb731b0626c4c908a5073171de648c893ba7447a3fe093"
+            "a2c77f995");
         mnt4_Fq::inv = 0xb071a1b67165ffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        mnt4_Fq::Rsquared =
-            bigint_q("273000478523237720910981655601160860640083126627235719712"
-                     "980612296263966512828033847775776");
-        mnt4_Fq::Rcubed =
-            bigint_q("427298980065529822574935274648041073124704261331681436071"
-                     "990730954930769758106792920349077");
+        mnt4_Fq::Rsquared = bigint_q::from_hex(
+            "224f0918a341f32e014ad38d47b66bd7673318850e1a266a1adbf2bc8930065ace"
+            "c5613d220");
+        mnt4_Fq::Rcubed = bigint_q::from_hex(
+            "35b329c5c21db492b899fb731b0626c4c908a5073171de648c893ba7447a3fe093"
+            "a2c77f995");
         mnt4_Fq::inv = 0x7165ffff;
     }
     mnt4_Fq::num_bits = 298;
-    mnt4_Fq::euler = bigint_q("237961143084630662876674624826524225772562439621"
-                              "347362697777564288105131408977900241879040");
+    mnt4_Fq::euler = bigint_q::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae89987520d4f1af2890070964866b2d38b"
+        "30000");
     mnt4_Fq::s = 17;
-    mnt4_Fq::t = bigint_q("3630998887399759870554727551674258816109656366292531"
-                          "779446068791017229177993437198515");
-    mnt4_Fq::t_minus_1_over_2 =
-        bigint_q("1815499443699879935277363775837129408054828183146265889723034"
-                 "395508614588996718599257");
-    mnt4_Fq::multiplicative_generator = mnt4_Fq("17");
-    mnt4_Fq::root_of_unity =
-        mnt4_Fq("26470625057180008075806930236965430553012567552126397603405487"
-                "8017580902343339784464690243");
-    mnt4_Fq::nqr = mnt4_Fq("17");
-    mnt4_Fq::nqr_to_t = mnt4_Fq("2647062505718000807580693023696543055301256755"
-                                "21263976034054878017580902343339784464690243");
+    mnt4_Fq::t = bigint_q::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae89987520d4f1af2890070964866b2d38b"
+        "3");
+    mnt4_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "ef3def351ce899892769ec1523b2bbb258d744cc3a906a78d794480384b24335969c"
+        "59");
+    mnt4_Fq::multiplicative_generator = mnt4_Fq::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt4_Fq::root_of_unity = mnt4_Fq::from_montgomery_hex(
+        "39fc98494e1ce4c49d76adbcbc58a465859c7d431ff8366528dcef9a167884ce85c8d8"
+        "9f2b9");
+    mnt4_Fq::nqr = mnt4_Fq::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt4_Fq::nqr_to_t = mnt4_Fq::from_montgomery_hex(
+        "39fc98494e1ce4c49d76adbcbc58a465859c7d431ff8366528dcef9a167884ce85c8d8"
+        "9f2b9");
     mnt4_Fq::static_init();
 
     /* parameters for twist field Fq2 */
-    mnt4_Fq2::euler = bigint<2 * mnt4_q_limbs>(
-        "1132510112362881350982493452491542308959143818587889181068472142434191"
-        "4242292413349746081746824985483306726003898571037009192086083701428188"
-        "6963086681184370139950267830740466401280");
+    mnt4_Fq2::euler = bigint<2 * mnt4_q_limbs>::from_hex(
+        "6fca59d085672643469af74c5c58e6a2a78d1a6bef46259b6308a20619652fe76ee42c"
+        "f5090e067aaee541ded7d53794c0321ffc39b6c85f1141fe5dfef4d47501fa0040670a"
+        "c71660000");
     mnt4_Fq2::s = 18;
-    mnt4_Fq2::t = bigint<2 * mnt4_q_limbs>(
-        "8640366457846689994678447360927904578850889729216683815524842395280391"
-        "1150302225873917249655341991297200973540485924049447571457547770905980"
-        "6542104196047745818712370534824115");
-    mnt4_Fq2::t_minus_1_over_2 = bigint<2 * mnt4_q_limbs>(
-        "4320183228923344997339223680463952289425444864608341907762421197640195"
-        "5575151112936958624827670995648600486770242962024723785728773885452990"
-        "3271052098023872909356185267412057");
-    mnt4_Fq2::non_residue = mnt4_Fq("17");
-    mnt4_Fq2::nqr = mnt4_Fq2(mnt4_Fq("8"), mnt4_Fq("1"));
+    mnt4_Fq2::t = bigint<2 * mnt4_q_limbs>::from_hex(
+        "37e52ce842b39321a34d7ba62e2c735153c68d35f7a312cdb18451030cb297f3b77216"
+        "7a8487033d5772a0ef6bea9bca60190ffe1cdb642f88a0ff2eff7a6a3a80fd00203385"
+        "638b3");
+    mnt4_Fq2::t_minus_1_over_2 = bigint<2 * mnt4_q_limbs>::from_hex(
+        "1bf296742159c990d1a6bdd3171639a8a9e3469afbd18966d8c2288186594bf9dbb90b"
+        "3d4243819eabb95077b5f54de5300c87ff0e6db217c4507f977fbd351d407e801019c2"
+        "b1c59");
+    mnt4_Fq2::non_residue = mnt4_Fq::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt4_Fq2::nqr = mnt4_Fq2(
+        mnt4_Fq::from_montgomery_hex(
+            "2d22ab320be618f96ea2cc98f11ce2fd00f309bc74889f626942a5445706af250c"
+            "b6eea22dd"),
+        mnt4_Fq::one());
     mnt4_Fq2::nqr_to_t = mnt4_Fq2(
-        mnt4_Fq("0"),
-        mnt4_Fq("29402818985595053196743631544512156561638230562612542604956687"
-                "802791427330205135130967658"));
-    mnt4_Fq2::Frobenius_coeffs_c1[0] = mnt4_Fq("1");
-    mnt4_Fq2::Frobenius_coeffs_c1[1] =
-        mnt4_Fq("47592228616926132575334924965304845154512487924269472539555512"
-                "8576210262817955800483758080");
+        mnt4_Fq::zero(),
+        mnt4_Fq::from_montgomery_hex(
+            "247a07a2efdab16d80905930107b7bd4417afb179c398beeaccb926cd470bc7669"
+            "a08faa647"));
+    mnt4_Fq2::Frobenius_coeffs_c1[0] = mnt4_Fq::one();
+    mnt4_Fq2::Frobenius_coeffs_c1[1] = mnt4_Fq::from_montgomery_hex(
+        "1fbd57fa0b0794de405433502f7050f43dc341885a957cb69486d69801db049bbdf190"
+        "27ba5");
+    mnt4_Fq2::half = mnt4_Fq::from_montgomery_hex(
+        "e0911e99e1948c204c323da8cbe2efc2c3947d55a074ef3d0af1db46fa8c618d3dac31"
+        "c22e");
+    mnt4_Fq2::non_residue_inverse = mnt4_Fq::from_montgomery_hex(
+        "24d5781bc4071014683d1f681d564e4e7badecebd6f7fad41a22e0e891977b8acd30ba"
+        "b4406");
     mnt4_Fq2::static_init();
 
     /* parameters for Fq4 */
-    mnt4_Fq4::non_residue = mnt4_Fq("17");
-    mnt4_Fq4::Frobenius_coeffs_c1[0] = mnt4_Fq("1");
-    mnt4_Fq4::Frobenius_coeffs_c1[1] =
-        mnt4_Fq("76841632454535016156213515524733370693010820609768050046250116"
-                "94147890954040864167002308");
-    mnt4_Fq4::Frobenius_coeffs_c1[2] =
-        mnt4_Fq("47592228616926132575334924965304845154512487924269472539555512"
-                "8576210262817955800483758080");
-    mnt4_Fq4::Frobenius_coeffs_c1[3] =
-        mnt4_Fq("46823812292380782413772789810057511447582379718171792039093011"
-                "6882062371863914936316755773");
+    mnt4_Fq4::non_residue = mnt4_Fq::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt4_Fq4::Frobenius_coeffs_c1[0] = mnt4_Fq::one();
+    mnt4_Fq4::Frobenius_coeffs_c1[1] = mnt4_Fq::from_montgomery_hex(
+        "3772430e00d3fb62479f705d41ee07b85760f50a074cd02cc9816da8a8de426145080b"
+        "f2ee7");
+    mnt4_Fq4::Frobenius_coeffs_c1[2] = mnt4_Fq::from_montgomery_hex(
+        "1fbd57fa0b0794de405433502f7050f43dc341885a957cb69486d69801db049bbdf190"
+        "27ba5");
+    mnt4_Fq4::Frobenius_coeffs_c1[3] = mnt4_Fq::from_montgomery_hex(
+        "45d38bf46662b00023b0aa806fea7343ed4dc2907574a716c63a458384e4e6c209f0a6"
+        "d11a");
 
     /* choice of short Weierstrass curve and its twist */
-    mnt4_G1::coeff_a = mnt4_Fq("2");
-    mnt4_G1::coeff_b = mnt4_Fq("42389453652668417828941601153388824002931810367"
-                               "3896002803341544124054745019340795360841685");
+    mnt4_G1::coeff_a = mnt4_Fq::from_montgomery_hex(
+        "382447a678652308130c8f6a32f8bbf0b0e51f55681d3bcf42bc76d1bea318634f6b0c"
+        "708b8");
+    mnt4_G1::coeff_b = mnt4_Fq::from_montgomery_hex(
+        "169b131a14d4c2b62b6cfc1895f39c29c6219621ca503ffe4a5e33d74776cd74067bbd"
+        "dcb31");
     mnt4_twist = mnt4_Fq2(mnt4_Fq::zero(), mnt4_Fq::one());
     mnt4_twist_coeff_a =
         mnt4_Fq2(mnt4_G1::coeff_a * mnt4_Fq2::non_residue, mnt4_Fq::zero());
@@ -182,26 +208,28 @@ void init_mnt4_params()
     mnt4_twist_mul_by_a_c1 = mnt4_G1::coeff_a * mnt4_Fq2::non_residue;
     mnt4_twist_mul_by_b_c0 = mnt4_G1::coeff_b * mnt4_Fq2::non_residue.squared();
     mnt4_twist_mul_by_b_c1 = mnt4_G1::coeff_b * mnt4_Fq2::non_residue;
-    mnt4_twist_mul_by_q_X =
-        mnt4_Fq("47592228616926132575334924965304845154512487924269472539555512"
-                "8576210262817955800483758080");
-    mnt4_twist_mul_by_q_Y =
-        mnt4_Fq("76841632454535016156213515524733370693010820609768050046250116"
-                "94147890954040864167002308");
+    mnt4_twist_mul_by_q_X = mnt4_Fq::from_montgomery_hex(
+        "1fbd57fa0b0794de405433502f7050f43dc341885a957cb69486d69801db049bbdf190"
+        "27ba5");
+    mnt4_twist_mul_by_q_Y = mnt4_Fq::from_montgomery_hex(
+        "3772430e00d3fb62479f705d41ee07b85760f50a074cd02cc9816da8a8de426145080b"
+        "f2ee7");
 
     /* choice of group G1 */
     // Identities
     mnt4_G1::G1_zero =
         mnt4_G1(mnt4_Fq::zero(), mnt4_Fq::one(), mnt4_Fq::zero());
     mnt4_G1::G1_one = mnt4_G1(
-        mnt4_Fq("60760244141852568949126569781626075788424196370144486719385562"
-                "369396875346601926534016838"),
-        mnt4_Fq("36373285070258297826390277081514578445974772235707184397110767"
-                "4179038674942891694705904306"),
+        mnt4_Fq::from_montgomery_hex(
+            "2c92de7836154d91c797e47fb02daaf7bad5bfe5f43d1a0ccc72d57566753e8c71"
+            "197d9f8b4"),
+        mnt4_Fq::from_montgomery_hex(
+            "37f5ae096e4d3ac75497936f0f8f599a22085a378e887975c3ee01d86d37a1a14f"
+            "4dec3207d"),
         mnt4_Fq::one());
 
     // Cofactor
-    mnt4_G1::h = bigint<mnt4_G1::h_limbs>("1");
+    mnt4_G1::h = bigint<mnt4_G1::h_limbs>::from_hex("1");
 
     // WNAF
     mnt4_G1::wnaf_window_table.resize(0);
@@ -262,21 +290,25 @@ void init_mnt4_params()
         mnt4_G2(mnt4_Fq2::zero(), mnt4_Fq2::one(), mnt4_Fq2::zero());
     mnt4_G2::G2_one = mnt4_G2(
         mnt4_Fq2(
-            mnt4_Fq("4383749262193500998549191000778096818427835091637909918478"
-                    "67546339851681564223481322252708"),
-            mnt4_Fq("3762095361550048011093551436092327860546447645971239327767"
-                    "9280819942849043649216370485641")),
+            mnt4_Fq::from_montgomery_hex(
+                "178e1c4e680909fe4b201a779ae40fdc053176b14fe2540055a02dbe4844a5"
+                "6b87bf6e3bbf2"),
+            mnt4_Fq::from_montgomery_hex(
+                "2186470a1697e38904fbe0dfae2fd90c8649f6452a5d5a6dac8c5ab51c201d"
+                "9e9b91f772f70")),
         mnt4_Fq2(
-            mnt4_Fq("3743740900852896826835252103493693184297354644137066311854"
-                    "3015118291998305624025037512482"),
-            mnt4_Fq("4246214795988938826723931903374206805975846958923171976461"
-                    "13820787463109735345923009077489")),
+            mnt4_Fq::from_montgomery_hex(
+                "26768c829207206e4a3c7ca14553728254a46d08bd6d837d925c1014f34ead"
+                "181e1ccdfa094"),
+            mnt4_Fq::from_montgomery_hex(
+                "1f8a707e350f927cfd064735d73a0a5df3e419c22c6783caeb87ed305ec010"
+                "63f70c6460c54")),
         mnt4_Fq2::one());
 
     // Cofactor
-    mnt4_G2::h = bigint<mnt4_G2::h_limbs>(
-        "4759222861692613257533492496530484515451248799325659352378425214132558"
-        "78328503110407553025");
+    mnt4_G2::h = bigint<mnt4_G2::h_limbs>::from_hex(
+        "3bcf7bcd473a266249da7b0548ecaeec9635d32203f880a7ab50fe2b151d6d67810e2c"
+        "c0001");
 
     // WNAF
     mnt4_G2::wnaf_window_table.resize(0);
@@ -332,18 +364,18 @@ void init_mnt4_params()
     mnt4_G2::fixed_base_exp_window_table.push_back(38760027);
 
     /* pairing parameters */
-    mnt4_ate_loop_count =
-        bigint_q("689871209842287392837045615510547309923794944");
+    mnt4_ate_loop_count = bigint_q::from_hex(
+        "1eef5546609756bec2a33f0dc9a1b671660000");
     mnt4_ate_is_loop_count_neg = false;
-    mnt4_final_exponent = bigint<4 * mnt4_q_limbs>(
-        "1077973603571099034307944903095920722789277838030318543579109081219034"
-        "3983877286149717711641082558674308976086994539461051191727497797155906"
-        "2689561855016270594656570874331111995170645233717143416875749097203441"
-        "437192367065467706065411650403684877366879441766585988546560");
-    mnt4_final_exponent_last_chunk_abs_of_w0 =
-        bigint_q("689871209842287392837045615510547309923794945");
+    mnt4_final_exponent = bigint<4 * mnt4_q_limbs>::from_hex(
+        "343c7ac3174c87a1efe216b37afb6d3035acca5a07b2394f42e0029264c0324a95e87d"
+        "cb6c97234cba7385b8d20fea4e85074066818687634e61f58b68ea590b11cee431be83"
+        "48deb351384d8485e987a57004bb9a1e7a6036c7a5801f55ac8e065e41b012422619e7"
+        "e69541c5980000");
+    mnt4_final_exponent_last_chunk_abs_of_w0 = bigint_q::from_hex(
+        "1eef5546609756bec2a33f0dc9a1b671660001");
     mnt4_final_exponent_last_chunk_is_w0_neg = false;
-    mnt4_final_exponent_last_chunk_w1 = bigint_q("1");
+    mnt4_final_exponent_last_chunk_w1 = bigint_q::from_hex("1");
 }
 
 } // namespace libff
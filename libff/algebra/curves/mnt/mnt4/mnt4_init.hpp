@@ -30,8 +30,8 @@ const mp_size_t mnt4_q_bitcount = mnt46_B_bitcount;
 const mp_size_t mnt4_r_limbs = mnt46_A_limbs;
 const mp_size_t mnt4_q_limbs = mnt46_B_limbs;
 
-extern bigint<mnt4_r_limbs> mnt4_modulus_r;
-extern bigint<mnt4_q_limbs> mnt4_modulus_q;
+extern const bigint<mnt4_r_limbs> mnt4_modulus_r;
+extern const bigint<mnt4_q_limbs> mnt4_modulus_q;
 
 typedef Fp_model<mnt4_r_limbs, mnt4_modulus_r> mnt4_Fr;
 typedef Fp_model<mnt4_q_limbs, mnt4_modulus_q> mnt4_Fq;
@@ -16,7 +16,13 @@
 namespace libff
 {
 
-bigint<mnt46_A_limbs> mnt46_modulus_A;
-bigint<mnt46_B_limbs> mnt46_modulus_B;
+constexpr bigint<mnt46_A_limbs> mnt46_modulus_A =
+    bigint<mnt46_A_limbs>::from_hex(
+        "3bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000"
+        "00001");
+constexpr bigint<mnt46_B_limbs> mnt46_modulus_B =
+    bigint<mnt46_B_limbs>::from_hex(
+        "3bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a716"
+        "60001");
 
 } // namespace libff
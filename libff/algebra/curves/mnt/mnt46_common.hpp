@@ -25,8 +25,8 @@ const mp_size_t mnt46_A_limbs =
 const mp_size_t mnt46_B_limbs =
     (mnt46_B_bitcount + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
 
-extern bigint<mnt46_A_limbs> mnt46_modulus_A;
-extern bigint<mnt46_B_limbs> mnt46_modulus_B;
+extern const bigint<mnt46_A_limbs> mnt46_modulus_A;
+extern const bigint<mnt46_B_limbs> mnt46_modulus_B;
 
 } // namespace libff
 
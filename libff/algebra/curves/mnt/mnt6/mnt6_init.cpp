@@ -50,148 +50,169 @@ void init_mnt6_params()
         sizeof(mp_limb_t) == 4); // Montgomery assumes this
 
     /* parameters for scalar field Fr */
-    mnt6_modulus_r = bigint_r("475922286169261325753349249653048451545124879242"
-                              "694725395555128576210262817955800483758081");
     assert(mnt6_Fr::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        mnt6_Fr::Rsquared =
-            bigint_r("273000478523237720910981655601160860640083126627235719712"
-                     "980612296263966512828033847775776");
-        mnt6_Fr::Rcubed =
-            bigint_r("427298980065529822574935274648041073124704261331681436071"
-                     "990730954930769758106792920349077");
+        mnt6_Fr::Rsquared = bigint_r::from_hex(
+            "224f0918a341f32e014ad38d47b66bd7673318850e1a266a1adbf2bc8930065ace"
+            "c5613d220");
+        mnt6_Fr::Rcubed = bigint_r::from_hex(
+            "35b329c5c21db492b899fb731b0626c4c908a5073171de648c893ba7447a3fe093"
+            "a2c77f995");
         mnt6_Fr::inv = 0xb071a1b67165ffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        mnt6_Fr::Rsquared =
-            bigint_r("273000478523237720910981655601160860640083126627235719712"
-                     "980612296263966512828033847775776");
-        mnt6_Fr::Rcubed =
-            bigint_r("427298980065529822574935274648041073124704261331681436071"
-                     "990730954930769758106792920349077");
+        mnt6_Fr::Rsquared = bigint_r::from_hex(
+            "224f0918a341f32e014ad38d47b66bd7673318850e1a266a1adbf2bc8930065ace"
+            "c5613d220");
+        mnt6_Fr::Rcubed = bigint_r::from_hex(
+            "35b329c5c21db492b899fb731b0626c4c908a5073171de648c893ba7447a3fe093"
+            "a2c77f995");
         mnt6_Fr::inv = 0x7165ffff;
     }
     mnt6_Fr::num_bits = 298;
-    mnt6_Fr::euler = bigint_r("237961143084630662876674624826524225772562439621"
-                              "347362697777564288105131408977900241879040");
+    mnt6_Fr::euler = bigint_r::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae89987520d4f1af2890070964866b2d38b"
+        "30000");
     mnt6_Fr::s = 17;
-    mnt6_Fr::t = bigint_r("3630998887399759870554727551674258816109656366292531"
-                          "779446068791017229177993437198515");
-    mnt6_Fr::t_minus_1_over_2 =
-        bigint_r("1815499443699879935277363775837129408054828183146265889723034"
-                 "395508614588996718599257");
-    mnt6_Fr::multiplicative_generator = mnt6_Fr("17");
-    mnt6_Fr::root_of_unity =
-        mnt6_Fr("26470625057180008075806930236965430553012567552126397603405487"
-                "8017580902343339784464690243");
-    mnt6_Fr::nqr = mnt6_Fr("17");
-    mnt6_Fr::nqr_to_t = mnt6_Fr("2647062505718000807580693023696543055301256755"
-                                "21263976034054878017580902343339784464690243");
+    mnt6_Fr::t = bigint_r::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae89987520d4f1af2890070964866b2d38b"
+        "3");
+    mnt6_Fr::t_minus_1_over_2 = bigint_r::from_hex(
+        "ef3def351ce899892769ec1523b2bbb258d744cc3a906a78d794480384b24335969c"
+        "59");
+    mnt6_Fr::multiplicative_generator = mnt6_Fr::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt6_Fr::root_of_unity = mnt6_Fr::from_montgomery_hex(
+        "39fc98494e1ce4c49d76adbcbc58a465859c7d431ff8366528dcef9a167884ce85c8d8"
+        "9f2b9");
+    mnt6_Fr::nqr = mnt6_Fr::from_montgomery_hex(
+        "3a87fe6a0cc49d149cf165e1b2c97505c422d1f08e7bc20e3dfe73f0ac3259ae5b7c4d"
+        "1ca15");
+    mnt6_Fr::nqr_to_t = mnt6_Fr::from_montgomery_hex(
+        "39fc98494e1ce4c49d76adbcbc58a465859c7d431ff8366528dcef9a167884ce85c8d8"
+        "9f2b9");
     mnt6_Fr::static_init();
 
     /* parameters for base field Fq */
-    mnt6_modulus_q = bigint_q("475922286169261325753349249653048451545124878552"
-                              "823515553267735739164647307408490559963137");
     assert(mnt6_Fq::modulus_is_valid());
     if (sizeof(mp_limb_t) == 8) {
-        mnt6_Fq::Rsquared =
-            bigint_q("163983144722506446826715124368972380525894397127205577781"
-                     "234305496325861831001705438796139");
-        mnt6_Fq::Rcubed =
-            bigint_q("207236281459091063710247635236340312578688659363066707916"
-                     "716212805695955118593239854980171");
+        mnt6_Fq::Rsquared = bigint_q::from_hex(
+            "149bb44a34202ff00dced8e4b6d4bbd6dcf1e3a8386034f9102adb68371465a743"
+            "c68e0596b");
+        mnt6_Fq::Rcubed = bigint_q::from_hex(
+            "1a0b411c083b440f6a9ed2947ceac13907bab5d43c2f687b031b7f0b2b9b6de2f1"
+            "b99bd9c4b");
         mnt6_Fq::inv = 0xbb4334a3ffffffff;
     }
     if (sizeof(mp_limb_t) == 4) {
-        mnt6_Fq::Rsquared =
-            bigint_q("163983144722506446826715124368972380525894397127205577781"
-                     "234305496325861831001705438796139");
-        mnt6_Fq::Rcubed =
-            bigint_q("207236281459091063710247635236340312578688659363066707916"
-                     "716212805695955118593239854980171");
+        mnt6_Fq::Rsquared = bigint_q::from_hex(
+            "149bb44a34202ff00dced8e4b6d4bbd6dcf1e3a8386034f9102adb68371465a743"
+            "c68e0596b");
+        mnt6_Fq::Rcubed = bigint_q::from_hex(
+            "1a0b411c083b440f6a9ed2947ceac13907bab5d43c2f687b031b7f0b2b9b6de2f1"
+            "b99bd9c4b");
         mnt6_Fq::inv = 0xffffffff;
     }
     mnt6_Fq::num_bits = 298;
-    mnt6_Fq::euler = bigint_q("237961143084630662876674624826524225772562439276"
-                              "411757776633867869582323653704245279981568");
+    mnt6_Fq::euler = bigint_q::from_hex(
+        "1de7bde6a39d133124ed3d82a47657764b1ae7a20ca7da4a603c92eb569dda19a52000"
+        "00000");
     mnt6_Fq::s = 34;
-    mnt6_Fq::t = bigint_q("2770232305450256248897344628657729199302411164115319"
-                          "9339359284829066871159442729");
-    mnt6_Fq::t_minus_1_over_2 =
-        bigint_q("1385116152725128124448672314328864599651205582057659966967964"
-                 "2414533435579721364");
-    mnt6_Fq::multiplicative_generator = mnt6_Fq("10");
-    mnt6_Fq::root_of_unity =
-        mnt6_Fq("12063881782691317345876882948569009984537700803089161801010977"
-                "2937363554409782252579816313");
-    mnt6_Fq::nqr = mnt6_Fq("5");
-    mnt6_Fq::nqr_to_t = mnt6_Fq("4062206042430904010564294587302981459372625525"
-                                "08985450684842547562990900634752279902740880");
+    mnt6_Fq::t = bigint_q::from_hex(
+        "ef3def351ce899892769ec1523b2bbb258d73d10653ed25301e4975ab4eed0cd29");
+    mnt6_Fq::t_minus_1_over_2 = bigint_q::from_hex(
+        "779ef79a8e744cc493b4f60a91d95dd92c6b9e88329f692980f24bad5a77686694");
+    mnt6_Fq::multiplicative_generator = mnt6_Fq::from_montgomery_hex(
+        "2977770b3d11159f37d4e0fddb28f00647b48958d3625e295ff76674008b1ddfacffd5"
+        "32b94");
+    mnt6_Fq::root_of_unity = mnt6_Fq::from_montgomery_hex(
+        "6a24a0f8a8f9bd39c0cdcf1bb65784a8fe792c5f8a2ae2750d46a53957818b361df1af"
+        "7be4");
+    mnt6_Fq::nqr = mnt6_Fq::from_montgomery_hex(
+        "14bbbb859e888acf9bea707eed94780323da44ac69b12f14affbb33a00458eefd67fea"
+        "995ca");
+    mnt6_Fq::nqr_to_t = mnt6_Fq::from_montgomery_hex(
+        "116674aec664b46c5bfd53e80d730bf7490d1156bcf91413f08d15b54da89521bfda12"
+        "f07f0");
     mnt6_Fq::static_init();
 
     /* parameters for twist field Fq3 */
-    mnt6_Fq3::euler = bigint<3 * mnt6_q_limbs>(
-        "5389868017855495171539724515479603613946389158900147862919313636912491"
-        "5637741423690184935056189295242736833704290747216410090671804540908400"
-        "2107789344621296256462630953983234857955575512841902241668515716158341"
-        "94321908328559167529729507439069424158411618728014749106176");
+    mnt6_Fq3::euler = bigint<3 * mnt6_q_limbs>::from_hex(
+        "1a1e3d618ba643d0f7f10b59bd7db6981ad661cc756dcf7ec82f4f320cf354c814fab1"
+        "f72198e11aae5a65bfac8866cda5f25e91fe3405fb619822ae7756e3f1cbc0b60fbd44"
+        "114fc23e7cc3932d198cbe6f3df9df28e58ff8dbdc80329943bf3f003b81a48cadd598"
+        "e4cef600000000");
     mnt6_Fq3::s = 34;
-    mnt6_Fq3::t = bigint<3 * mnt6_q_limbs>(
-        "6274632199033507112809136178669989590936327770934612330653836993631547"
-        "7403976749268110067416202853483540045218880692515999649967770721889566"
-        "8755040206738394052328810740708414066996862544726932237004530285669423"
-        "1080113482726640944570478452261237446033817102203");
-    mnt6_Fq3::t_minus_1_over_2 = bigint<3 * mnt6_q_limbs>(
-        "3137316099516753556404568089334994795468163885467306165326918496815773"
-        "8701988374634055033708101426741770022609440346257999824983885360944783"
-        "4377520103369197026164405370354207033498431272363466118502265142834711"
-        "5540056741363320472285239226130618723016908551101");
-    mnt6_Fq3::non_residue = mnt6_Fq("5");
-    mnt6_Fq3::nqr = mnt6_Fq3(mnt6_Fq("5"), mnt6_Fq("0"), mnt6_Fq("0"));
+    mnt6_Fq3::t = bigint<3 * mnt6_q_limbs>::from_hex(
+        "d0f1eb0c5d321e87bf885acdebedb4c0d6b30e63ab6e7bf6417a7990679aa640a7d58f"
+        "b90cc708d572d32dfd6443366d2f92f48ff1a02fdb0cc11573bab71f8e5e05b07dea20"
+        "8a7e11f3e61c9968cc65f379efcef9472c7fc6dee40194ca1df9f801dc0d24656eacc7"
+        "2677b");
+    mnt6_Fq3::t_minus_1_over_2 = bigint<3 * mnt6_q_limbs>::from_hex(
+        "6878f5862e990f43dfc42d66f5f6da606b598731d5b73dfb20bd3cc833cd532053eac7"
+        "dc8663846ab96996feb2219b3697c97a47f8d017ed86608ab9dd5b8fc72f02d83ef510"
+        "453f08f9f30e4cb46632f9bcf7e77ca3963fe36f7200ca650efcfc00ee069232b75663"
+        "933bd");
+    mnt6_Fq3::non_residue = mnt6_Fq::from_montgomery_hex(
+        "14bbbb859e888acf9bea707eed94780323da44ac69b12f14affbb33a00458eefd67fea"
+        "995ca");
+    mnt6_Fq3::nqr = mnt6_Fq3(
+        mnt6_Fq::from_montgomery_hex(
+            "14bbbb859e888acf9bea707eed94780323da44ac69b12f14affbb33a00458eefd6"
+            "7fea995ca"),
+        mnt6_Fq::zero(),
+        mnt6_Fq::zero());
     mnt6_Fq3::nqr_to_t = mnt6_Fq3(
-        mnt6_Fq("15436144967878350507698415627597793765433110336117446963234623"
-                "0549735979552469642799720052"),
-        mnt6_Fq("0"),
-        mnt6_Fq("0"));
-    mnt6_Fq3::Frobenius_coeffs_c1[0] = mnt6_Fq("1");
-    mnt6_Fq3::Frobenius_coeffs_c1[1] =
-        mnt6_Fq("47173889896752102913304085131844916599730410872955897377007731"
-                "9830005517129946578866686956");
-    mnt6_Fq3::Frobenius_coeffs_c1[2] =
-        mnt6_Fq("41833872017402966203083983345992855478207698232645417831904159"
-                "09159130177461911693276180");
-    mnt6_Fq3::Frobenius_coeffs_c2[0] = mnt6_Fq("1");
-    mnt6_Fq3::Frobenius_coeffs_c2[1] =
-        mnt6_Fq("41833872017402966203083983345992855478207698232645417831904159"
-                "09159130177461911693276180");
-    mnt6_Fq3::Frobenius_coeffs_c2[2] =
-        mnt6_Fq("47173889896752102913304085131844916599730410872955897377007731"
-                "9830005517129946578866686956");
+        mnt6_Fq::from_montgomery_hex(
+            "3730de2a45dd0127c4589095738bbc01b9c400c07a149321e4d00f3507344a4178"
+            "610a3a4e6"),
+        mnt6_Fq::zero(),
+        mnt6_Fq::zero());
+    mnt6_Fq3::Frobenius_coeffs_c1[0] = mnt6_Fq::one();
+    mnt6_Fq3::Frobenius_coeffs_c1[1] = mnt6_Fq::from_montgomery_hex(
+        "84ad70320709d5b981062164ba21c062106d949dd82621629c22e83dbb1c17bb747708"
+        "5b6a");
+    mnt6_Fq3::Frobenius_coeffs_c1[2] = mnt6_Fq::from_montgomery_hex(
+        "177280f6ea96f782a843d139e3ce34ed98542eefb6239a7226875df158fdc13fe3f893"
+        "c203b");
+    mnt6_Fq3::Frobenius_coeffs_c2[0] = mnt6_Fq::one();
+    mnt6_Fq3::Frobenius_coeffs_c2[1] = mnt6_Fq::from_montgomery_hex(
+        "177280f6ea96f782a843d139e3ce34ed98542eefb6239a7226875df158fdc13fe3f893"
+        "c203b");
+    mnt6_Fq3::Frobenius_coeffs_c2[2] = mnt6_Fq::from_montgomery_hex(
+        "84ad70320709d5b981062164ba21c062106d949dd82621629c22e83dbb1c17bb747708"
+        "5b6a");
 
     /* parameters for Fq6 */
-    mnt6_Fq6::non_residue = mnt6_Fq("5");
-    mnt6_Fq6::Frobenius_coeffs_c1[0] = mnt6_Fq("1");
-    mnt6_Fq6::Frobenius_coeffs_c1[1] =
-        mnt6_Fq("47173889896752102913304085131844916599730410872955897377007731"
-                "9830005517129946578866686957");
-    mnt6_Fq6::Frobenius_coeffs_c1[2] =
-        mnt6_Fq("47173889896752102913304085131844916599730410872955897377007731"
-                "9830005517129946578866686956");
-    mnt6_Fq6::Frobenius_coeffs_c1[3] =
-        mnt6_Fq("47592228616926132575334924965304845154512487855282351555326773"
-                "5739164647307408490559963136");
-    mnt6_Fq6::Frobenius_coeffs_c1[4] =
-        mnt6_Fq("41833872017402966203083983345992855478207698232645417831904159"
-                "09159130177461911693276180");
-    mnt6_Fq6::Frobenius_coeffs_c1[5] =
-        mnt6_Fq("41833872017402966203083983345992855478207698232645417831904159"
-                "09159130177461911693276181");
+    mnt6_Fq6::non_residue = mnt6_Fq::from_montgomery_hex(
+        "14bbbb859e888acf9bea707eed94780323da44ac69b12f14affbb33a00458eefd67fea"
+        "995ca");
+    mnt6_Fq6::Frobenius_coeffs_c1[0] = mnt6_Fq::one();
+    mnt6_Fq6::Frobenius_coeffs_c1[1] = mnt6_Fq::from_montgomery_hex(
+        "245cfad65ca32edfa196a9cb651e79fefde1a054632c1a2299f1c7e5543df2f366476c"
+        "3dfc6");
+    mnt6_Fq6::Frobenius_coeffs_c1[2] = mnt6_Fq::from_montgomery_hex(
+        "84ad70320709d5b981062164ba21c062106d949dd82621629c22e83dbb1c17bb747708"
+        "5b6a");
+    mnt6_Fq6::Frobenius_coeffs_c1[3] = mnt6_Fq::from_montgomery_hex(
+        "1fbd57fa0b0794de405433502f7050f3b95b083993a5fc8850498c7534af82bb9b4004"
+        "47ba5");
+    mnt6_Fq6::Frobenius_coeffs_c1[4] = mnt6_Fq::from_montgomery_hex(
+        "177280f6ea96f782a843d139e3ce34ed98542eefb6239a7226875df158fdc13fe3f893"
+        "c203b");
+    mnt6_Fq6::Frobenius_coeffs_c1[5] = mnt6_Fq::from_montgomery_hex(
+        "3384a4ca26c98906b1ca18eefd4a92e6752ef5fa3bcd527e96b6f752d189f2b792f88f"
+        "7a497");
     mnt6_Fq6::my_Fp2::non_residue = mnt6_Fq3::non_residue;
 
     /* choice of short Weierstrass curve and its twist */
-    mnt6_G1::coeff_a = mnt6_Fq("11");
-    mnt6_G1::coeff_b = mnt6_Fq("10670008051085173567796731963258535225645425120"
-                               "1367587890185989362936000262606668469523074");
+    mnt6_G1::coeff_a = mnt6_Fq::from_montgomery_hex(
+        "9ba1f11320980c0f780adadabb89f128e59811f3fbc61a10fadd9fecbdb9b2411bfd0e"
+        "afef");
+    mnt6_G1::coeff_b = mnt6_Fq::from_montgomery_hex(
+        "ecff0892ef990dbcbc6661cf95ae927592157c81210e1ed15e8119bae60a94cb16ed8e"
+        "733b");
     mnt6_twist = mnt6_Fq3(mnt6_Fq::zero(), mnt6_Fq::one(), mnt6_Fq::zero());
     mnt6_twist_coeff_a =
         mnt6_Fq3(mnt6_Fq::zero(), mnt6_Fq::zero(), mnt6_G1::coeff_a);
@@ -208,26 +229,28 @@ void init_mnt6_params()
     mnt6_twist_mul_by_b_c0 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
     mnt6_twist_mul_by_b_c1 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
     mnt6_twist_mul_by_b_c2 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_q_X =
-        mnt6_Fq("41833872017402966203083983345992855478207698232645417831904159"
-                "09159130177461911693276180");
-    mnt6_twist_mul_by_q_Y =
-        mnt6_Fq("47592228616926132575334924965304845154512487855282351555326773"
-                "5739164647307408490559963136");
+    mnt6_twist_mul_by_q_X = mnt6_Fq::from_montgomery_hex(
+        "177280f6ea96f782a843d139e3ce34ed98542eefb6239a7226875df158fdc13fe3f893"
+        "c203b");
+    mnt6_twist_mul_by_q_Y = mnt6_Fq::from_montgomery_hex(
+        "1fbd57fa0b0794de405433502f7050f3b95b083993a5fc8850498c7534af82bb9b4004"
+        "47ba5");
 
     /* choice of group G1 */
     // Identities
     mnt6_G1::G1_zero =
         mnt6_G1(mnt6_Fq::zero(), mnt6_Fq::one(), mnt6_Fq::zero());
     mnt6_G1::G1_one = mnt6_G1(
-        mnt6_Fq("33668575288308222810928984635393710418569820937140417834296883"
-                "8739115829740084426881123453"),
-        mnt6_Fq("40259629013978098970933270771656892077762203207376274986234237"
-                "4583908837063963736098549800"),
+        mnt6_Fq::from_montgomery_hex(
+            "86537578a870c4a4ea36aa01d9da077538a9763df2c1d1d583fccd1b791a663562"
+            "f74e1d24"),
+        mnt6_Fq::from_montgomery_hex(
+            "3140fbc35939a7fac709a8c463c43f137a8b517b33988dd7392522150707ad5bfd"
+            "16dcfffb2"),
         mnt6_Fq::one());
 
     // Cofactor
-    mnt6_G1::h = bigint<mnt6_G1::h_limbs>("1");
+    mnt6_G1::h = bigint<mnt6_G1::h_limbs>::from_hex("1");
 
     // WNAF
     mnt6_G1::wnaf_window_table.resize(0);
@@ -288,26 +311,32 @@ void init_mnt6_params()
         mnt6_G2(mnt6_Fq3::zero(), mnt6_Fq3::one(), mnt6_Fq3::zero());
     mnt6_G2::G2_one = mnt6_G2(
         mnt6_Fq3(
-            mnt6_Fq("4214564357728118462568265615939083222885091154891199075603"
-                    "82401870203318738334702321297427"),
-            mnt6_Fq("1030729274385485024635270099613449150211675847064399454049"
-                    "59058962657261178393635706405114"),
-            mnt6_Fq("1430291721437318526270029263247351838097683633011490092048"
-                    "49580478324784395590388826052558")),
+            mnt6_Fq::from_montgomery_hex(
+                "243853463ed46ba0aedcc383c07e6e66283ad5a786a9e0b2b2b2bb8b97915c"
+                "a12fc5d551ea7"),
+            mnt6_Fq::from_montgomery_hex(
+                "2c28bb7186209782ee3c70834da6f1f0d2dd1502a8227a15d879495904b2c0"
+                "e3dd7be176130"),
+            mnt6_Fq::from_montgomery_hex(
+                "100b8026b9d72e58e4c3aa3598c2d2abb128fee90f30657801e80c50778f3e"
+                "5f4eb9631e1f1")),
         mnt6_Fq3(
-            mnt6_Fq("4646735966686894631300992275756395125412181334453888693838"
-                    "93594087634649237515554342751377"),
-            mnt6_Fq("1006429075019773751845750759671180718078211179601527433356"
-                    "03284583254620685343989304941678"),
-            mnt6_Fq("1230198555029698960269405457158411813002751801572880446630"
-                    "51565390506010149881373807142903")),
+            mnt6_Fq::from_montgomery_hex(
+                "12cc928ef109438f46f63d3264f039e9a733be49ed1a01e90d89aa5d2bab1c"
+                "ddd6c64a67c5f"),
+            mnt6_Fq::from_montgomery_hex(
+                "d3c77c9ff942835bf373e4b2139b3d647bd8c70b2221c5e827cf309306a152"
+                "9b7265ad4be7"),
+            mnt6_Fq::from_montgomery_hex(
+                "2d3c3d195a16d65c95f69adb7009dcfd915a09da60851a23865b52045f1610"
+                "557ec4b58b8df")),
         mnt6_Fq3::one());
 
     // Cofactor
-    mnt6_G2::h = bigint<mnt6_G2::h_limbs>(
-        "2265020224725762701964986904983084617918287627326025861622075353519602"
-        "7008271269497733337236154908221451925226173504813188901850140437785678"
-        "6623430385820659037970876666767495659520");
+    mnt6_G2::h = bigint<mnt6_G2::h_limbs>::from_hex(
+        "df94b3a10ace4c868d35ee98b8b1cd454f1a1f292d2362035024095209870c0f7ffbbf"
+        "096e99fb6a637b933124e28403e0b413f4d65a5b22e7f6194104081d31771efd4719de"
+        "c00000000");
 
     // WNAF
     mnt6_G2::wnaf_window_table.resize(0);
@@ -363,21 +392,20 @@ void init_mnt6_params()
     mnt6_G2::fixed_base_exp_window_table.push_back(38554492);
 
     /* pairing parameters */
-    mnt6_ate_loop_count =
-        bigint_q("689871209842287392837045615510547309923794944");
+    mnt6_ate_loop_count = bigint_q::from_hex(
+        "1eef5546609756bec2a33f0dc9a1b671660000");
     mnt6_ate_is_loop_count_neg = true;
-    mnt6_final_exponent = bigint<6 * mnt6_q_limbs>(
-        "2441632013809050969789059541431343876835397748986254393590401071543906"
-        "6975957855922532159264213056712140358746422742237328406558352706591021"
-        "6422306180605028554512640453974447931868761990152567816487468886255270"
-        "7546606307501130780086217376423631134210521168112142693161684363521585"
-        "2236649271569251468773714424208521977615548771268520882870120900360322"
-        "0442188067120277293518453076904749855025875277538472001305920580983636"
-        "41559341826790559426614919168");
-    mnt6_final_exponent_last_chunk_abs_of_w0 =
-        bigint_q("689871209842287392837045615510547309923794944");
+    mnt6_final_exponent = bigint<6 * mnt6_q_limbs>::from_hex(
+        "2d9f068e10293574745c62cb0ee7cf1d27f98ba7e8f16bb1cb498038b1b0b4d7ea28c4"
+        "2575093726d5e360818f2dd5b39038cff6405359561dd2f2f0627f9264724e069a7198"
+        "c17873f7f54d8c7ce3d5daed1ac5e87c26c03b1f481813bb668b6fedc7c2aaa83936d8"
+        "bc842f74c66e7a13921f7d91474b3981d3a3b3b40537720c84fe27e3e90bb29db12dff"
+        "e17a286c150ef5071b3087765f9454046ecbdd3b014ff91a1c18d55db868e841dbf82b"
+        "ccefb4233833bd800000000");
+    mnt6_final_exponent_last_chunk_abs_of_w0 = bigint_q::from_hex(
+        "1eef5546609756bec2a33f0dc9a1b671660000");
     mnt6_final_exponent_last_chunk_is_w0_neg = true;
-    mnt6_final_exponent_last_chunk_w1 = bigint_q("1");
+    mnt6_final_exponent_last_chunk_w1 = bigint_q::from_hex("1");
 }
 
 } // namespace libff
@@ -30,8 +30,8 @@ const mp_size_t mnt6_q_bitcount = mnt46_A_bitcount;
 const mp_size_t mnt6_r_limbs = mnt46_B_limbs;
 const mp_size_t mnt6_q_limbs = mnt46_A_limbs;
 
-extern bigint<mnt6_r_limbs> mnt6_modulus_r;
-extern bigint<mnt6_q_limbs> mnt6_modulus_q;
+extern const bigint<mnt6_r_limbs> mnt6_modulus_r;
+extern const bigint<mnt6_q_limbs> mnt6_modulus_q;
 
 typedef Fp_model<mnt6_r_limbs, mnt6_modulus_r> mnt6_Fr;
 typedef Fp_model<mnt6_q_limbs, mnt6_modulus_q> mnt6_Fq;
@@ -0,0 +1,41 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_HPP__
+#define __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_HPP__
+
+#include "libff/algebra/serialization.hpp"
+
+#include <iostream>
+
+namespace libff
+{
+
+/// Write a precomputed G2 element (as returned by the `*_ate_precompute_G2`
+/// functions) in a compact binary form: the affine coordinates of the
+/// original point, a 4-byte big-endian line count, followed by the line
+/// coefficients. All field elements are written with encoding_binary, in the
+/// given form. form_montgomery avoids any reduction when reading and writing,
+/// and is the natural choice for caching precomputed values on disk.
+///
+/// Supported for the ate precomputation of alt_bn128, bls12_377, bls12_381
+/// and bw6_761. Other precomputation types (bn128, edwards, mnt4, mnt6) are
+/// rejected at compile time.
+template<form_t Form = form_montgomery, typename G2PrecompT>
+void g2_precomp_write(const G2PrecompT &precomp, std::ostream &out_s);
+
+/// Read a precomputed G2 element written by g2_precomp_write. Throws
+/// std::runtime_error if the data is truncated.
+template<form_t Form = form_montgomery, typename G2PrecompT>
+void g2_precomp_read(G2PrecompT &precomp, std::istream &in_s);
+
+} // namespace libff
+
+#include "libff/algebra/curves/pairing_serialization.tcc"
+
+#endif // __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_HPP__
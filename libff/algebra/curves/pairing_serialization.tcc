@@ -0,0 +1,117 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_TCC__
+#define __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_TCC__
+
+#include "libff/algebra/curves/pairing_serialization.hpp"
+#include "libff/algebra/fields/field_serialization.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace libff
+{
+
+namespace internal
+{
+
+template<typename... T> struct g2_precomp_void {
+    typedef void type;
+};
+
+/// True if G2PrecompT has the layout supported by the generic
+/// g2_precomp_codec below.
+template<typename G2PrecompT, typename = void>
+struct g2_precomp_has_ell_coeffs : std::false_type {
+};
+
+template<typename G2PrecompT>
+struct g2_precomp_has_ell_coeffs<
+    G2PrecompT,
+    typename g2_precomp_void<
+        decltype(std::declval<G2PrecompT &>().QX),
+        decltype(std::declval<G2PrecompT &>().QY),
+        decltype(std::declval<G2PrecompT &>().coeffs[0].ell_0),
+        decltype(std::declval<G2PrecompT &>().coeffs[0].ell_VW),
+        decltype(std::declval<G2PrecompT &>().coeffs[0].ell_VV)>::type>
+    : std::true_type {
+};
+
+// Generic codec for precomputed G2 values of the form:
+//
+//   { QX, QY, coeffs = [ { ell_0, ell_VW, ell_VV }, ... ] }
+//
+// which covers the ate precomputation of alt_bn128, bls12_377 and bls12_381.
+// Curves with a different layout of precomputed values specialize this class
+// (see bw6_761_pairing.hpp). The precomputation of bn128 (whose coefficients
+// are bn::Fp6 values of the ate-pairing library), edwards and the MNT curves
+// is not supported.
+template<form_t Form, typename G2PrecompT> class g2_precomp_codec
+{
+public:
+    static_assert(
+        g2_precomp_has_ell_coeffs<G2PrecompT>::value,
+        "g2_precomp_write / g2_precomp_read: unsupported G2 precomputation "
+        "type (supported curves: alt_bn128, bls12_377, bls12_381, bw6_761)");
+
+    static void write(const G2PrecompT &precomp, std::ostream &out_s)
+    {
+        field_write<encoding_binary, Form>(precomp.QX, out_s);
+        field_write<encoding_binary, Form>(precomp.QY, out_s);
+        size_write_binary(precomp.coeffs.size(), out_s);
+        for (const auto &c : precomp.coeffs) {
+            field_write<encoding_binary, Form>(c.ell_0, out_s);
+            field_write<encoding_binary, Form>(c.ell_VW, out_s);
+            field_write<encoding_binary, Form>(c.ell_VV, out_s);
+        }
+    }
+
+    static void read(G2PrecompT &precomp, std::istream &in_s)
+    {
+        using coeffs_t = typename std::decay<decltype(precomp.coeffs[0])>::type;
+
+        field_read<encoding_binary, Form>(precomp.QX, in_s);
+        field_read<encoding_binary, Form>(precomp.QY, in_s);
+        const size_t num_coeffs = size_read_binary(in_s);
+
+        // Entries are appended one at a time (rather than resizing up-front)
+        // so that a corrupt count cannot trigger an arbitrarily large
+        // allocation.
+        precomp.coeffs.clear();
+        for (size_t i = 0; i < num_coeffs; ++i) {
+            coeffs_t c;
+            field_read<encoding_binary, Form>(c.ell_0, in_s);
+            field_read<encoding_binary, Form>(c.ell_VW, in_s);
+            field_read<encoding_binary, Form>(c.ell_VV, in_s);
+            if (!in_s) {
+                throw std::runtime_error("truncated G2 precomputation");
+            }
+            precomp.coeffs.push_back(c);
+        }
+    }
+};
+
+} // namespace internal
+
+template<form_t Form, typename G2PrecompT>
+void g2_precomp_write(const G2PrecompT &precomp, std::ostream &out_s)
+{
+    internal::g2_precomp_codec<Form, G2PrecompT>::write(precomp, out_s);
+}
+
+template<form_t Form, typename G2PrecompT>
+void g2_precomp_read(G2PrecompT &precomp, std::istream &in_s)
+{
+    internal::g2_precomp_codec<Form, G2PrecompT>::read(precomp, in_s);
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_CURVES_PAIRING_SERIALIZATION_TCC__
@@ -0,0 +1,64 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP__
+#define __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP__
+
+#include <cstddef>
+#include <vector>
+
+namespace libff
+{
+
+enum subgroup_check_method_t {
+    /// Check random linear combinations of the elements, choosing the scalar
+    /// size and the number of combinations based on the cofactor of the
+    /// group. Falls back to subgroup_check_per_element where that is cheaper
+    /// (e.g. for small numbers of elements), or where the cofactor of the
+    /// group is not known.
+    subgroup_check_random_combination = 0,
+    /// Call is_in_safe_subgroup() on each element, in parallel if MULTICORE is
+    /// enabled.
+    subgroup_check_per_element = 1,
+};
+
+/// Returns true if all elements are in the prime-order subgroup. All elements
+/// must be well-formed (see is_well_formed()).
+///
+/// With subgroup_check_random_combination, several combinations
+/// sum_i r_i * elements[i] are computed with random k-bit scalars r_i, and each
+/// is checked with is_in_safe_subgroup(). k is chosen such that 2^k is at most
+/// the smallest prime factor of the cofactor, so that each combination is
+/// outside the subgroup with probability at least 1 - 2^{-k} if any element
+/// is outside it. The number of combinations is chosen such that the
+/// probability of returning true for an invalid input is at most 2^{-128}.
+/// Combinations are computed in parallel if MULTICORE is enabled.
+template<typename GroupT>
+bool batch_is_in_safe_subgroup(
+    const GroupT *elements,
+    const size_t num_elements,
+    const subgroup_check_method_t method = subgroup_check_random_combination);
+
+template<typename GroupT>
+bool batch_is_in_safe_subgroup(
+    const std::vector<GroupT> &elements,
+    const subgroup_check_method_t method = subgroup_check_random_combination);
+
+/// Returns the indices of all elements which are not in the prime-order
+/// subgroup (or an empty vector if all elements are in the subgroup). All
+/// elements are first checked by batch_is_in_safe_subgroup, and only if this
+/// fails is each element checked individually.
+template<typename GroupT>
+std::vector<size_t> find_not_in_safe_subgroup(
+    const std::vector<GroupT> &elements);
+
+} // namespace libff
+
+#include "libff/algebra/curves/subgroup_check.tcc"
+
+#endif // __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP__
@@ -0,0 +1,241 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_TCC__
+#define __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_TCC__
+
+#include "libff/algebra/curves/subgroup_check.hpp"
+#include "libff/common/parallel.hpp"
+#include "libff/common/rng.hpp"
+
+#include <gmp.h>
+#include <stdint.h>
+
+namespace libff
+{
+
+namespace internal
+{
+
+/// Probability (as -log_2) that batch_is_in_safe_subgroup returns true for
+/// an invalid input.
+static const size_t SUBGROUP_CHECK_SECURITY_BITS = 128;
+
+/// Maximum size (in bits) of the scalars used in random combinations. Each
+/// combination uses 2^k buckets.
+static const size_t SUBGROUP_CHECK_MAX_SCALAR_BITS = 16;
+
+/// Smallest prime factor of the cofactor of GroupT, if it is less than
+/// 2^SUBGROUP_CHECK_MAX_SCALAR_BITS. Returns 1 if the cofactor is 1, and
+/// 2^SUBGROUP_CHECK_MAX_SCALAR_BITS if the cofactor has no smaller factor.
+template<typename GroupT>
+auto group_cofactor_smallest_factor(int) -> decltype(GroupT::h, mp_limb_t())
+{
+    const mp_limb_t max_factor = (mp_limb_t)1 << SUBGROUP_CHECK_MAX_SCALAR_BITS;
+    if (GroupT::h.num_bits() <= 1) {
+        return 1;
+    }
+
+    for (mp_limb_t d = 2; d < max_factor; ++d) {
+        if (0 == mpn_mod_1(GroupT::h.data, GroupT::h_limbs, d)) {
+            return d;
+        }
+    }
+
+    return max_factor;
+}
+
+/// Groups which do not expose their cofactor. Returns 0, in which case
+/// elements must be checked individually.
+template<typename GroupT> mp_limb_t group_cofactor_smallest_factor(long)
+{
+    return 0;
+}
+
+/// The (cached) result of group_cofactor_smallest_factor.
+template<typename GroupT> mp_limb_t subgroup_check_cofactor_factor()
+{
+    static const mp_limb_t factor = group_cofactor_smallest_factor<GroupT>(0);
+    return factor;
+}
+
+/// Returns the size of the scalars to use in random combinations of
+/// num_elements elements, or 0 if it is cheaper to check each element
+/// individually. Costs are estimated as numbers of group operations.
+template<typename GroupT>
+size_t subgroup_check_scalar_bits(const size_t num_elements)
+{
+    const mp_limb_t factor = subgroup_check_cofactor_factor<GroupT>();
+    if (factor < 2) {
+        return 0;
+    }
+
+    size_t max_scalar_bits = 0;
+    while (((mp_limb_t)2 << max_scalar_bits) <= factor) {
+        ++max_scalar_bits;
+    }
+
+    // Each call to is_in_safe_subgroup() is assumed to cost a scalar
+    // multiplication by the group order.
+    const size_t check_cost = 3 * GroupT::order().num_bits() / 2;
+    size_t best_scalar_bits = 0;
+    size_t best_cost = num_elements * check_cost;
+    for (size_t k = 1; k <= max_scalar_bits; ++k) {
+        const size_t num_rounds = (SUBGROUP_CHECK_SECURITY_BITS + k - 1) / k;
+        const size_t cost =
+            num_rounds * (num_elements + ((size_t)2 << k) + check_cost);
+        if (cost < best_cost) {
+            best_scalar_bits = k;
+            best_cost = cost;
+        }
+    }
+
+    return best_scalar_bits;
+}
+
+/// Compute sum_i r_i * elements[i] for random scalars r_i of scalar_bits bits,
+/// using a single window of the bucket method.
+template<typename GroupT>
+GroupT subgroup_check_random_combination(
+    const GroupT *elements, const size_t num_elements, const size_t scalar_bits)
+{
+    std::vector<uint16_t> scalars(num_elements);
+    random_bytes(scalars.data(), scalars.size() * sizeof(uint16_t));
+
+    // Element i is added to bucket r_i - 1.
+    const uint16_t mask = (uint16_t)((1u << scalar_bits) - 1);
+    std::vector<GroupT> buckets(mask, GroupT::zero());
+    for (size_t i = 0; i < num_elements; ++i) {
+        const uint16_t scalar = scalars[i] & mask;
+        if (scalar == 0) {
+            continue;
+        }
+
+        GroupT &bucket = buckets[scalar - 1];
+        if (elements[i].is_special()) {
+            bucket = bucket.mixed_add(elements[i]);
+        } else {
+            bucket = bucket + elements[i];
+        }
+    }
+
+    // sum_j (j + 1) * buckets[j]
+    GroupT running_sum = GroupT::zero();
+    GroupT result = GroupT::zero();
+    for (size_t j = buckets.size(); j > 0; --j) {
+        running_sum = running_sum + buckets[j - 1];
+        result = result + running_sum;
+    }
+
+    return result;
+}
+
+template<typename GroupT>
+bool batch_is_in_safe_subgroup_per_element(
+    const GroupT *elements, const size_t num_elements)
+{
+    return parallel_reduce(
+        0,
+        num_elements,
+        0,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t i = begin; i < end; ++i) {
+                success = elements[i].is_in_safe_subgroup() && success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
+}
+
+} // namespace internal
+
+template<typename GroupT>
+bool batch_is_in_safe_subgroup(
+    const GroupT *elements,
+    const size_t num_elements,
+    const subgroup_check_method_t method)
+{
+    if (num_elements == 0) {
+        return true;
+    }
+
+    if (method == subgroup_check_per_element) {
+        return internal::batch_is_in_safe_subgroup_per_element(
+            elements, num_elements);
+    }
+
+    // If the cofactor is 1, all well-formed elements are in the subgroup.
+    if (internal::subgroup_check_cofactor_factor<GroupT>() == 1) {
+        return true;
+    }
+
+    const size_t scalar_bits =
+        internal::subgroup_check_scalar_bits<GroupT>(num_elements);
+    if (scalar_bits == 0) {
+        return internal::batch_is_in_safe_subgroup_per_element(
+            elements, num_elements);
+    }
+
+    const size_t num_rounds =
+        (internal::SUBGROUP_CHECK_SECURITY_BITS + scalar_bits - 1) /
+        scalar_bits;
+    return parallel_reduce(
+        0,
+        num_rounds,
+        1,
+        true,
+        [&](size_t begin, size_t end) {
+            bool success = true;
+            for (size_t round = begin; round < end; ++round) {
+                const GroupT combination =
+                    internal::subgroup_check_random_combination(
+                        elements, num_elements, scalar_bits);
+                success = combination.is_in_safe_subgroup() && success;
+            }
+            return success;
+        },
+        [](bool a, bool b) { return a && b; });
+}
+
+template<typename GroupT>
+bool batch_is_in_safe_subgroup(
+    const std::vector<GroupT> &elements, const subgroup_check_method_t method)
+{
+    return batch_is_in_safe_subgroup(elements.data(), elements.size(), method);
+}
+
+template<typename GroupT>
+std::vector<size_t> find_not_in_safe_subgroup(
+    const std::vector<GroupT> &elements)
+{
+    if (batch_is_in_safe_subgroup(elements)) {
+        return std::vector<size_t>();
+    }
+
+    std::vector<char> invalid(elements.size());
+    parallel_for(0, elements.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            invalid[i] = !elements[i].is_in_safe_subgroup();
+        }
+    });
+
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (invalid[i]) {
+            indices.push_back(i);
+        }
+    }
+
+    return indices;
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_CURVES_SUBGROUP_CHECK_TCC__
@@ -15,8 +15,11 @@
 #include <libff/algebra/curves/bls12_377/bls12_377_pp.hpp>
 #include <libff/algebra/curves/bls12_381/bls12_381_pp.hpp>
 #include <libff/algebra/curves/bw6_761/bw6_761_pp.hpp>
+#include <libff/algebra/curves/g2_precomp_cache.hpp>
 #include <libff/algebra/curves/mnt/mnt4/mnt4_pp.hpp>
 #include <libff/algebra/curves/mnt/mnt6/mnt6_pp.hpp>
+#include <libff/algebra/curves/pairing_serialization.hpp>
+#include <sstream>
 
 using namespace libff;
 
@@ -95,6 +98,115 @@ template<typename ppT> void double_miller_loop_test()
     ASSERT_EQ(ans_1 * ans_2, ans_12);
 }
 
+template<typename ppT> void g2_precomp_cache_test()
+{
+    const G2<ppT> Q1 = (Fr<ppT>::random_element()) * G2<ppT>::one();
+    const G2<ppT> Q2 = (Fr<ppT>::random_element()) * G2<ppT>::one();
+    const G2<ppT> Q3 = (Fr<ppT>::random_element()) * G2<ppT>::one();
+
+    g2_precomp_cache<ppT> cache(2);
+    const auto prec_Q1 = cache.get(Q1);
+    ASSERT_EQ(ppT::precompute_G2(Q1), *prec_Q1);
+    ASSERT_EQ(0u, cache.num_hits());
+    ASSERT_EQ(1u, cache.num_misses());
+
+    // The same point, with different (non-affine) coordinates, must hit.
+    const auto prec_Q1_again = cache.get(Q1.dbl() - Q1);
+    ASSERT_EQ(prec_Q1.get(), prec_Q1_again.get());
+    ASSERT_EQ(1u, cache.num_hits());
+
+    // Q1 is least recently used, and is evicted by Q3.
+    cache.get(Q2);
+    cache.get(Q3);
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ(3u, cache.num_misses());
+    ASSERT_EQ(*prec_Q1, *cache.get(Q1));
+    ASSERT_EQ(4u, cache.num_misses());
+
+    cache.set_capacity(0);
+    ASSERT_EQ(0u, cache.size());
+    ASSERT_EQ(ppT::precompute_G2(Q2), *cache.get(Q2));
+    ASSERT_EQ(0u, cache.size());
+
+    const G1<ppT> P = (Fr<ppT>::random_element()) * G1<ppT>::one();
+    ASSERT_EQ(ppT::reduced_pairing(P, Q1), cached_reduced_pairing<ppT>(P, Q1));
+    ASSERT_EQ(ppT::reduced_pairing(P, Q1), cached_reduced_pairing<ppT>(P, Q1));
+
+    // Products of pairings (with odd and even numbers of terms).
+    std::vector<G1<ppT>> Ps;
+    std::vector<G2<ppT>> Qs;
+    GT<ppT> expect = GT<ppT>::one();
+    ASSERT_EQ(expect, cached_reduced_pairing_product<ppT>(Ps, Qs));
+    for (size_t i = 0; i < 5; ++i) {
+        Ps.push_back((Fr<ppT>::random_element()) * G1<ppT>::one());
+        Qs.push_back((i % 2) ? Q1 : Q2);
+        expect = expect * ppT::reduced_pairing(Ps.back(), Qs.back());
+        ASSERT_EQ(expect, cached_reduced_pairing_product<ppT>(Ps, Qs));
+    }
+    Ps.push_back(P);
+    ASSERT_THROW(
+        cached_reduced_pairing_product<ppT>(Ps, Qs), std::invalid_argument);
+
+    // e(P, Q1) * e(-P, Q1) = 1
+    ASSERT_EQ(
+        GT<ppT>::one(),
+        cached_reduced_pairing_product<ppT>({P, -P}, {Q1, Q1}));
+}
+
+template<typename ppT, form_t Form> void g2_precomp_serialization_test()
+{
+    const G2<ppT> Q = (Fr<ppT>::random_element()) * G2<ppT>::one();
+    const G2_precomp<ppT> prec_Q = ppT::precompute_G2(Q);
+
+    std::string buffer;
+    {
+        std::ostringstream ss;
+        g2_precomp_write<Form>(prec_Q, ss);
+        buffer = ss.str();
+    }
+
+    G2_precomp<ppT> prec_Q_dec;
+    {
+        std::istringstream ss(buffer);
+        g2_precomp_read<Form>(prec_Q_dec, ss);
+    }
+    ASSERT_EQ(prec_Q, prec_Q_dec);
+
+    // Truncated data must be rejected.
+    std::istringstream truncated(buffer.substr(0, buffer.size() - 1));
+    ASSERT_THROW(g2_precomp_read<Form>(prec_Q_dec, truncated), std::exception);
+}
+
+// Precomputation types without the generic layout are rejected (at compile
+// time) by g2_precomp_write / g2_precomp_read.
+static_assert(
+    internal::g2_precomp_has_ell_coeffs<alt_bn128_ate_G2_precomp>::value,
+    "alt_bn128 G2 precomputation should be supported");
+static_assert(
+    internal::g2_precomp_has_ell_coeffs<bls12_381_ate_G2_precomp>::value,
+    "bls12_381 G2 precomputation should be supported");
+static_assert(
+    !internal::g2_precomp_has_ell_coeffs<mnt4_ate_G2_precomp>::value,
+    "mnt4 G2 precomputation should not be supported");
+static_assert(
+    !internal::g2_precomp_has_ell_coeffs<mnt6_ate_G2_precomp>::value,
+    "mnt6 G2 precomputation should not be supported");
+static_assert(
+    !internal::g2_precomp_has_ell_coeffs<edwards_tate_G2_precomp>::value,
+    "edwards G2 precomputation should not be supported");
+#ifdef CURVE_BN128
+static_assert(
+    !internal::g2_precomp_has_ell_coeffs<bn128_ate_G2_precomp>::value,
+    "bn128 G2 precomputation should not be supported");
+#endif
+
+template<typename ppT> void g2_precomp_test()
+{
+    g2_precomp_cache_test<ppT>();
+    g2_precomp_serialization_test<ppT, form_plain>();
+    g2_precomp_serialization_test<ppT, form_montgomery>();
+}
+
 template<typename ppT> void affine_pairing_test()
 {
     GT<ppT> GT_one = GT<ppT>::one();
@@ -154,6 +266,7 @@ TEST(TestBiliearity, Alt_BN128)
     alt_bn128_pp::init_public_params();
     pairing_test<alt_bn128_pp>();
     double_miller_loop_test<alt_bn128_pp>();
+    g2_precomp_test<alt_bn128_pp>();
 }
 
 TEST(TestBiliearity, BLS12_377)
@@ -161,6 +274,7 @@ TEST(TestBiliearity, BLS12_377)
     bls12_377_pp::init_public_params();
     pairing_test<bls12_377_pp>();
     double_miller_loop_test<bls12_377_pp>();
+    g2_precomp_test<bls12_377_pp>();
 }
 
 TEST(TestBiliearity, BW6_761)
@@ -168,6 +282,7 @@ TEST(TestBiliearity, BW6_761)
     bw6_761_pp::init_public_params();
     pairing_test<bw6_761_pp>();
     double_miller_loop_test<bw6_761_pp>();
+    g2_precomp_test<bw6_761_pp>();
 }
 
 // BN128 has fancy dependencies so it may be disabled
@@ -185,4 +300,5 @@ TEST(TestBiliearity, BLS12_381)
     bls12_381_pp::init_public_params();
     pairing_test<bls12_381_pp>();
     double_miller_loop_test<bls12_381_pp>();
+    g2_precomp_test<bls12_381_pp>();
 }
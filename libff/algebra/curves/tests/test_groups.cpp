@@ -18,6 +18,11 @@
 #include <libff/algebra/curves/bw6_761/bw6_761_pp.hpp>
 #include <libff/algebra/curves/curve_serialization.hpp>
 #include <libff/algebra/curves/curve_utils.hpp>
+#include <libff/algebra/curves/group_container.hpp>
+#include <libff/algebra/curves/hash_to_curve.hpp>
+#include <libff/algebra/curves/subgroup_check.hpp>
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 using namespace libff;
@@ -177,6 +182,30 @@ void test_serialize_group_config(const GroupT &v)
     }
 
     ASSERT_EQ(v, v_dec);
+
+    // Raw buffer encoding must match the stream encoding.
+    std::vector<char> raw(buffer.size());
+    ASSERT_EQ(
+        buffer.size(),
+        (group_encode<Enc, Form, Comp>(v, raw.data(), raw.size())));
+    ASSERT_EQ(buffer, std::string(raw.begin(), raw.end()));
+    ASSERT_THROW(
+        (group_encode<Enc, Form, Comp>(v, raw.data(), raw.size() - 1)),
+        std::runtime_error);
+
+    GroupT v_raw_dec;
+    ASSERT_EQ(
+        raw.size(),
+        (group_decode<Enc, Form, Comp>(v_raw_dec, raw.data(), raw.size())));
+    ASSERT_EQ(v, v_raw_dec);
+    ASSERT_THROW(
+        (group_decode<Enc, Form, Comp>(
+            v_raw_dec, raw.data(), raw.size() - 1)),
+        std::runtime_error);
+
+    if (Enc == encoding_binary) {
+        ASSERT_EQ((group_binary_size<Comp, GroupT>()), raw.size());
+    }
 }
 
 template<typename GroupT> void test_serialize_group_element(const GroupT &v)
@@ -214,10 +243,345 @@ template<typename GroupT> void test_serialize_group()
     test_serialize_group_element(GroupT::random_element());
 }
 
+template<encoding_t Enc, form_t Form, compression_t Comp, typename GroupT>
+void test_serialize_group_vector_config(const std::vector<GroupT> &v)
+{
+    // Expected output, written element-by-element.
+    std::string expect;
+    {
+        std::ostringstream ss;
+        if (Enc == encoding_binary) {
+            size_write_binary(v.size(), ss);
+        } else {
+            ss << "[";
+        }
+        for (size_t i = 0; i < v.size(); ++i) {
+            if (Enc == encoding_json && i != 0) {
+                ss << ",";
+            }
+            group_write<Enc, Form, Comp>(v[i], ss);
+        }
+        if (Enc == encoding_json) {
+            ss << "]";
+        }
+        expect = ss.str();
+    }
+
+    std::ostringstream ss;
+    group_write_vector<Enc, Form, Comp>(v, ss);
+    ASSERT_EQ(expect, ss.str());
+
+    std::vector<GroupT> v_dec;
+    {
+        std::istringstream in_s(expect);
+        group_read_vector<Enc, Form, Comp>(
+            v_dec, in_s, group_check_well_formed);
+    }
+    ASSERT_EQ(v, v_dec);
+
+    // Truncated data must be rejected.
+    if (!v.empty()) {
+        std::istringstream in_s(expect.substr(0, expect.size() - 1));
+        ASSERT_THROW(
+            (group_read_vector<Enc, Form, Comp>(v_dec, in_s)), std::exception);
+    }
+}
+
+template<typename GroupT>
+void test_serialize_group_vector_all_configs(const std::vector<GroupT> &v)
+{
+    test_serialize_group_vector_config<
+        encoding_binary,
+        form_plain,
+        compression_on>(v);
+    test_serialize_group_vector_config<
+        encoding_binary,
+        form_plain,
+        compression_off>(v);
+    test_serialize_group_vector_config<
+        encoding_binary,
+        form_montgomery,
+        compression_on>(v);
+    test_serialize_group_vector_config<
+        encoding_binary,
+        form_montgomery,
+        compression_off>(v);
+    test_serialize_group_vector_config<
+        encoding_json,
+        form_plain,
+        compression_off>(v);
+    test_serialize_group_vector_config<
+        encoding_json,
+        form_montgomery,
+        compression_off>(v);
+}
+
+template<typename GroupT>
+void test_serialize_group_vector_invalid(const GroupT &invalid)
+{
+    std::vector<GroupT> v{{GroupT::one(), invalid, GroupT::one()}};
+    std::ostringstream out_s;
+    group_write_vector<encoding_binary, form_montgomery, compression_off>(
+        v, out_s);
+
+    std::vector<GroupT> v_dec;
+    {
+        std::istringstream in_s(out_s.str());
+        group_read_vector<encoding_binary, form_montgomery, compression_off>(
+            v_dec, in_s, group_check_none);
+    }
+    {
+        std::istringstream in_s(out_s.str());
+        ASSERT_THROW(
+            (group_read_vector<
+                encoding_binary,
+                form_montgomery,
+                compression_off>(v_dec, in_s, group_check_subgroup)),
+            std::runtime_error);
+    }
+}
+
+template<typename GroupT> void test_serialize_group_not_on_curve()
+{
+    using FieldT = typename std::decay<decltype(GroupT().X)>::type;
+
+    // An element whose x coordinate has no corresponding point on the curve.
+    FieldT x = FieldT::one();
+    while (field_is_square(curve_y_squared_at_x<GroupT>(x))) {
+        x = x + FieldT::one();
+    }
+    const GroupT invalid(x, FieldT::one(), FieldT::one());
+    ASSERT_FALSE(invalid.is_well_formed());
+
+    {
+        std::ostringstream out_s;
+        group_write<encoding_binary, form_plain, compression_on>(
+            invalid, out_s);
+        std::istringstream in_s(out_s.str());
+        GroupT dec;
+        ASSERT_THROW(
+            (group_read<encoding_binary, form_plain, compression_on>(
+                dec, in_s)),
+            std::runtime_error);
+    }
+    {
+        // Uncompressed elements are checked by default.
+        std::ostringstream out_s;
+        group_write<encoding_binary, form_plain, compression_off>(
+            invalid, out_s);
+        GroupT dec;
+        std::istringstream in_s(out_s.str());
+        ASSERT_THROW(
+            (group_read<encoding_binary, form_plain, compression_off>(
+                dec, in_s)),
+            std::runtime_error);
+        std::istringstream in_s_unchecked(out_s.str());
+        group_read<encoding_binary, form_plain, compression_off>(
+            dec, in_s_unchecked, group_check_none);
+        ASSERT_EQ(invalid.X, dec.X);
+    }
+
+    std::vector<GroupT> v(300, GroupT::one());
+    v[100] = invalid;
+    ASSERT_FALSE(batch_is_well_formed(v.data(), v.size()));
+    ASSERT_TRUE(batch_is_well_formed(v.data(), 100));
+
+    std::vector<GroupT> v_dec;
+    {
+        // Compressed elements are always checked.
+        std::ostringstream out_s;
+        group_write_vector<encoding_binary, form_plain, compression_on>(
+            v, out_s);
+        std::istringstream in_s(out_s.str());
+        ASSERT_THROW(
+            (group_read_vector<encoding_binary, form_plain, compression_on>(
+                v_dec, in_s, group_check_none)),
+            std::runtime_error);
+    }
+    {
+        std::ostringstream out_s;
+        group_write_vector<encoding_binary, form_plain, compression_off>(
+            v, out_s);
+        std::istringstream in_s(out_s.str());
+        ASSERT_THROW(
+            (group_read_vector<encoding_binary, form_plain, compression_off>(
+                v_dec, in_s)),
+            std::runtime_error);
+    }
+}
+
+template<typename GroupT> void test_serialize_group_vector()
+{
+    test_serialize_group_vector_all_configs(std::vector<GroupT>());
+
+    // Enough elements to be split into several chunks, including some zeros.
+    std::vector<GroupT> v;
+    GroupT el = GroupT::random_element();
+    for (size_t i = 0; i < 2100; ++i) {
+        v.push_back((i % 500 == 7) ? GroupT::zero() : el);
+        el = el + GroupT::one();
+    }
+    test_serialize_group_vector_all_configs(v);
+
+    // An element which is not on the curve.
+    GroupT off_curve = GroupT::one();
+    off_curve.Y = off_curve.Y + off_curve.Y;
+    test_serialize_group_vector_invalid(off_curve);
+}
+
+/// Vectors are written in blocks of 1 << 16 elements. Check vectors spanning
+/// several blocks, for a single curve (since the test is relatively slow).
+template<typename GroupT> void test_serialize_group_vector_blocks()
+{
+    std::vector<GroupT> v;
+    GroupT el = GroupT::random_element();
+    for (size_t i = 0; i < (1 << 16) + 100; ++i) {
+        v.push_back((i % 50000 == 7) ? GroupT::zero() : el);
+        el = el + GroupT::one();
+    }
+    test_serialize_group_vector_config<
+        encoding_binary,
+        form_montgomery,
+        compression_off>(v);
+    test_serialize_group_vector_config<
+        encoding_json,
+        form_plain,
+        compression_off>(v);
+}
+
 template<typename ppT> void test_serialize()
 {
     test_serialize_group<G1<ppT>>();
     test_serialize_group<G2<ppT>>();
+    test_serialize_group_vector<G1<ppT>>();
+    test_serialize_group_vector<G2<ppT>>();
+    test_serialize_group_not_on_curve<G1<ppT>>();
+    test_serialize_group_not_on_curve<G2<ppT>>();
+}
+
+template<typename ppT> void test_group_container()
+{
+    const std::string filename = "test_group_container.bin";
+    const size_t alignment = 4096;
+
+    std::vector<G1<ppT>> g1s;
+    for (size_t i = 0; i < 1000; ++i) {
+        g1s.push_back(G1<ppT>::random_element());
+    }
+    g1s[7] = G1<ppT>::zero();
+    std::vector<G2<ppT>> g2s;
+    for (size_t i = 0; i < 100; ++i) {
+        g2s.push_back(G2<ppT>::random_element());
+    }
+
+    {
+        group_container_writer writer(filename, alignment);
+        writer.write_section<form_plain, compression_on>(g1s);
+        writer.write_section<form_montgomery, compression_off>(g2s);
+        writer.write_section<form_montgomery, compression_on>(
+            std::vector<G1<ppT>>());
+        writer.close();
+    }
+
+    {
+        group_container_reader reader(filename);
+        ASSERT_EQ(3, reader.num_sections());
+        ASSERT_TRUE(reader.verify_checksums());
+        for (size_t i = 0; i < reader.num_sections(); ++i) {
+            ASSERT_EQ(0, reader.section_info(i).payload_offset % alignment);
+        }
+
+        const group_container_section_view<G1<ppT>> g1_view =
+            reader.template section<G1<ppT>>(0);
+        std::vector<G1<ppT>> g1s_dec;
+        g1_view.read(g1s_dec, group_check_well_formed);
+        ASSERT_EQ(g1s, g1s_dec);
+        ASSERT_EQ(g1s[7], g1_view.element(7));
+        ASSERT_EQ(g1s[999], g1_view.element(999));
+        g1_view.read(g1s_dec, group_check_subgroup, 100, 200);
+        ASSERT_EQ(
+            std::vector<G1<ppT>>(g1s.begin() + 100, g1s.begin() + 200),
+            g1s_dec);
+
+        std::vector<G2<ppT>> g2s_dec;
+        reader.template section<G2<ppT>>(1).read(g2s_dec);
+        ASSERT_EQ(g2s, g2s_dec);
+
+        ASSERT_EQ(0, reader.template section<G1<ppT>>(2).size());
+        ASSERT_THROW(reader.template section<G2<ppT>>(0), std::runtime_error);
+        ASSERT_THROW(reader.template section<G1<ppT>>(3), std::runtime_error);
+    }
+
+    // Corrupt the payload of the second section.
+    {
+        const size_t offset =
+            group_container_reader(filename).section_info(1).payload_offset;
+        std::fstream f(
+            filename.c_str(),
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        f.seekg(offset);
+        const char c = (char)f.get();
+        f.seekp(offset);
+        f.put(~c);
+    }
+    ASSERT_FALSE(group_container_reader(filename).verify_checksums());
+
+    std::remove(filename.c_str());
+}
+
+template<typename GroupT> void test_hash_to_curve_group()
+{
+    const std::string dst = "LIBFF-TEST-HASH-TO-CURVE";
+    std::vector<std::string> msgs;
+    for (size_t i = 0; i < 16; ++i) {
+        msgs.push_back(std::string(i * 7, (char)('a' + i)));
+    }
+
+    std::vector<GroupT> points;
+    for (const std::string &msg : msgs) {
+        const GroupT P = hash_to_curve<GroupT>(msg, dst);
+        ASSERT_TRUE(P.is_well_formed());
+        ASSERT_TRUE(P.is_in_safe_subgroup());
+        ASSERT_NE(GroupT::zero(), P);
+        ASSERT_EQ(P, hash_to_curve<GroupT>(msg, dst));
+        points.push_back(P);
+    }
+
+    // Distinct messages and domain separation tags give distinct points.
+    for (size_t i = 1; i < points.size(); ++i) {
+        ASSERT_NE(points[i - 1], points[i]);
+    }
+    ASSERT_NE(points[3], hash_to_curve<GroupT>(msgs[3], dst + "-2"));
+
+    // Streaming the message in parts.
+    hash_to_curve_hasher<GroupT> hasher(dst);
+    hasher.update(msgs[5].data(), 10);
+    hasher.update(msgs[5].data() + 10, 0);
+    hasher.update(msgs[5].data() + 10, msgs[5].size() - 10);
+    ASSERT_EQ(points[5], hasher.finalize());
+
+    // Batch
+    const std::vector<GroupT> batch = batch_hash_to_curve<GroupT>(msgs, dst);
+    ASSERT_EQ(points, batch);
+    for (const GroupT &P : batch) {
+        ASSERT_TRUE(P.is_special());
+    }
+    ASSERT_TRUE(
+        batch_hash_to_curve<GroupT>(std::vector<std::string>(), dst).empty());
+
+    // The map alone gives points on the curve.
+    using FieldT = typename std::remove_reference<decltype(GroupT().X)>::type;
+    for (size_t i = 0; i < 16; ++i) {
+        const FieldT u = (i == 0) ? FieldT::zero() : FieldT::random_element();
+        const GroupT P = map_to_curve_simple_swu<GroupT>(u);
+        ASSERT_TRUE(P.is_well_formed());
+    }
+}
+
+template<typename ppT> void test_hash_to_curve()
+{
+    test_hash_to_curve_group<G1<ppT>>();
+    test_hash_to_curve_group<G2<ppT>>();
 }
 
 template<typename GroupT> void test_group_membership_valid()
@@ -262,6 +626,52 @@ void test_group_membership_invalid_g2(const typename GroupT::twist_field &x)
     ASSERT_FALSE(g2_invalid.is_in_safe_subgroup());
 }
 
+template<typename GroupT>
+void test_batch_subgroup_check_invalid(const GroupT &invalid)
+{
+    ASSERT_TRUE(invalid.is_well_formed());
+    ASSERT_FALSE(invalid.is_in_safe_subgroup());
+
+    std::vector<GroupT> elements;
+    for (size_t i = 0; i < 300; ++i) {
+        elements.push_back(GroupT::random_element());
+        if (i % 2 == 0) {
+            elements.back().to_special();
+        }
+    }
+    ASSERT_TRUE(batch_is_in_safe_subgroup(elements));
+    ASSERT_TRUE(
+        batch_is_in_safe_subgroup(elements, subgroup_check_per_element));
+    ASSERT_TRUE(find_not_in_safe_subgroup(elements).empty());
+    ASSERT_TRUE(batch_is_in_safe_subgroup(std::vector<GroupT>()));
+
+    elements[17] = invalid;
+    elements[200] = elements[200] + invalid;
+    ASSERT_FALSE(batch_is_in_safe_subgroup(elements));
+    ASSERT_FALSE(
+        batch_is_in_safe_subgroup(elements, subgroup_check_per_element));
+    ASSERT_EQ(
+        std::vector<size_t>({17, 200}), find_not_in_safe_subgroup(elements));
+    ASSERT_FALSE(batch_is_in_safe_subgroup(&invalid, 1));
+}
+
+void test_batch_subgroup_check_bls12_381()
+{
+    // A point of order 3 (the smallest prime factor of the cofactor), added
+    // to an element of the subgroup. Points on the curve, but not in the
+    // subgroup, are generated with map_to_curve_simple_swu.
+    const bls12_381_G1 torsion =
+        bigint<2>("25443201128072175343902036600697491001") *
+        (bls12_381_Fr::mod *
+         map_to_curve_simple_swu<bls12_381_G1>(bls12_381_Fq(3)));
+    ASSERT_NE(bls12_381_G1::zero(), torsion);
+    ASSERT_EQ(bls12_381_G1::zero(), bigint<1>(3) * torsion);
+    test_batch_subgroup_check_invalid(bls12_381_G1::random_element() + torsion);
+
+    test_batch_subgroup_check_invalid(
+        map_to_curve_simple_swu<bls12_381_G2>(bls12_381_Fq2::one()));
+}
+
 template<typename ppT> void test_check_membership()
 {
     test_group_membership_valid<G1<ppT>>();
@@ -275,6 +685,10 @@ template<> void test_check_membership<alt_bn128_pp>()
     // Skip the G1 check (there are no points on the curve over Fq which are
     // not in the subgroup).
     test_group_membership_invalid_g2<alt_bn128_G2>(alt_bn128_Fq2::one());
+    test_serialize_group_vector_invalid(
+        g2_curve_point_at_x<alt_bn128_G2>(alt_bn128_Fq2::one()));
+    test_batch_subgroup_check_invalid(
+        g2_curve_point_at_x<alt_bn128_G2>(alt_bn128_Fq2::one()));
 }
 
 template<> void test_check_membership<bls12_377_pp>()
@@ -287,6 +701,12 @@ template<> void test_check_membership<bls12_377_pp>()
 
     test_group_membership_proof_valid<bls12_377_G1>();
     test_group_membership_proof_invalid_g1<bls12_377_G1>(bls12_377_Fq(3));
+    test_serialize_group_vector_invalid(
+        g1_curve_point_at_x<bls12_377_G1>(bls12_377_Fq(3)));
+    test_batch_subgroup_check_invalid(
+        g1_curve_point_at_x<bls12_377_G1>(bls12_377_Fq(3)));
+    test_batch_subgroup_check_invalid(g2_curve_point_at_x<bls12_377_G2>(
+        bls12_377_Fq(3) * bls12_377_Fq2::one()));
 }
 
 template<> void test_check_membership<bw6_761_pp>()
@@ -295,6 +715,8 @@ template<> void test_check_membership<bw6_761_pp>()
     test_group_membership_valid<bw6_761_G2>();
     test_group_membership_invalid_g1<bw6_761_G1>(bw6_761_Fq(6));
     test_group_membership_invalid_g2<bw6_761_G2>(bw6_761_Fq(0));
+    test_batch_subgroup_check_invalid(
+        g1_curve_point_at_x<bw6_761_G1>(bw6_761_Fq(6)));
 }
 
 void test_bls12_377()
@@ -389,6 +811,8 @@ TEST(TestGroups, Alt_BN128)
     test_group<G2<alt_bn128_pp>>();
     test_output<G2<alt_bn128_pp>>();
     test_serialize<alt_bn128_pp>();
+    test_serialize_group_vector_blocks<G1<alt_bn128_pp>>();
+    test_group_container<alt_bn128_pp>();
     test_mul_by_q<G2<alt_bn128_pp>>();
     test_check_membership<alt_bn128_pp>();
     test_mul_by_cofactor<G1<alt_bn128_pp>>();
@@ -453,8 +877,150 @@ TEST(TestGroups, BLS12_381)
     test_group<G2<bls12_381_pp>>();
     test_output<G2<bls12_381_pp>>();
     test_serialize<bls12_381_pp>();
+    test_group_container<bls12_381_pp>();
     test_mul_by_q<G2<bls12_381_pp>>();
     test_check_membership<bls12_381_pp>();
+    test_batch_subgroup_check_bls12_381();
     test_mul_by_cofactor<G1<bls12_381_pp>>();
     test_mul_by_cofactor<G2<bls12_381_pp>>();
 }
+
+TEST(TestGroups, ExpandMessageXmd)
+{
+    // Test vectors from RFC 9380, appendix K.1.
+    const std::string dst = "QUUX-V01-CS02-with-expander-SHA256-128";
+    const std::vector<std::pair<std::string, std::string>> vectors{
+        {"",
+         "68a985b87eb6b46952128911f2a4412bbc302a9d759667f87f7a21d803f07235"},
+        {"abc",
+         "d8ccab23b5985ccea865c6c97b6e5b8350e794e603b4b97902f53a8a0d605615"},
+    };
+
+    for (const auto &v : vectors) {
+        uint8_t out[32];
+        expand_message_xmd_sha256 expander(dst);
+        expander.update(v.first.data(), v.first.size());
+        expander.finalize(out, sizeof(out));
+        uint8_t expect[32];
+        hex_to_bytes_reversed(v.second, expect, sizeof(expect));
+        std::reverse(expect, expect + sizeof(expect));
+        ASSERT_EQ(0, memcmp(expect, out, sizeof(out)));
+    }
+
+    uint8_t out[32];
+    expand_message_xmd_sha256 expander(dst);
+    ASSERT_THROW(expander.finalize(out, 256 * 32), std::runtime_error);
+}
+
+TEST(TestGroups, HashToCurveBLS12_381)
+{
+    bls12_381_pp::init_public_params();
+
+    // Test vectors from RFC 9380, appendix J.9.1.
+    const std::string dst_g1 =
+        "QUUX-V01-CS02-with-BLS12381G1_XMD:SHA-256_SSWU_RO_";
+    const std::vector<std::vector<std::string>> vectors_g1{
+        {"",
+         "052926add2207b76ca4fa57a8734416c8dc95e24501772c814278700eed6d1e4"
+         "e8cf62d9c09db0fac349612b759e79a1",
+         "08ba738453bfed09cb546dbb0783dbb3a5f1f566ed67bb6be0e8c67e2e81a4cc"
+         "68ee29813bb7994998f3eae0c9c6a265"},
+        {"abc",
+         "03567bc5ef9c690c2ab2ecdf6a96ef1c139cc0b2f284dca0a9a7943388a49a3a"
+         "ee664ba5379a7655d3c68900be2f6903",
+         "0b9c15f3fe6e5cf4211f346271d7b01c8f3b28be689c8429c85b67af21553331"
+         "1f0b8dfaaa154fa6b88176c229f2885d"},
+        {"abcdef0123456789",
+         "11e0b079dea29a68f0383ee94fed1b940995272407e3bb916bbf268c263ddd57"
+         "a6a27200a784cbc248e84f357ce82d98",
+         "03a87ae2caf14e8ee52e51fa2ed8eefe80f02457004ba4d486d6aa1f517c0889"
+         "501dc7413753f9599b099ebcbbd2d709"},
+        {"q128_" + std::string(128, 'q'),
+         "15f68eaa693b95ccb85215dc65fa81038d69629f70aeee0d0f677cf22285e7bf"
+         "58d7cb86eefe8f2e9bc3f8cb84fac488",
+         "1807a1d50c29f430b8cafc4f8638dfeeadf51211e1602a5f184443076715f91b"
+         "b90a48ba1e370edce6ae1062f5e6dd38"},
+        {"a512_" + std::string(512, 'a'),
+         "082aabae8b7dedb0e78aeb619ad3bfd9277a2f77ba7fad20ef6aabdc6c31d19b"
+         "a5a6d12283553294c1825c4b3ca2dcfe",
+         "05b84ae5a942248eea39e1d91030458c40153f3b654ab7872d779ad1e942856a"
+         "20c438e8d99bc8abfbf74729ce1f7ac8"},
+    };
+
+    for (const std::vector<std::string> &v : vectors_g1) {
+        bigint<bls12_381_q_limbs> x;
+        bigint<bls12_381_q_limbs> y;
+        bigint_from_hex(x, v[1]);
+        bigint_from_hex(y, v[2]);
+        const bls12_381_G1 expect(
+            bls12_381_Fq(x), bls12_381_Fq(y), bls12_381_Fq::one());
+        ASSERT_EQ(expect, hash_to_curve<bls12_381_G1>(v[0], dst_g1));
+    }
+
+    // Test vectors from RFC 9380, appendix J.10.1.
+    const std::string dst_g2 =
+        "QUUX-V01-CS02-with-BLS12381G2_XMD:SHA-256_SSWU_RO_";
+    const std::vector<std::vector<std::string>> vectors_g2{
+        {"",
+         "0141ebfbdca40eb85b87142e130ab689c673cf60f1a3e98d69335266f30d9b8d"
+         "4ac44c1038e9dcdd5393faf5c41fb78a",
+         "05cb8437535e20ecffaef7752baddf98034139c38452458baeefab379ba13dff"
+         "5bf5dd71b72418717047f5b0f37da03d",
+         "0503921d7f6a12805e72940b963c0cf3471c7b2a524950ca195d11062ee75ec0"
+         "76daf2d4bc358c4b190c0c98064fdd92",
+         "12424ac32561493f3fe3c260708a12b7c620e7be00099a974e259ddc7d1f6395"
+         "c3c811cdd19f1e8dbf3e9ecfdcbab8d6"},
+        {"abc",
+         "02c2d18e033b960562aae3cab37a27ce00d80ccd5ba4b7fe0e7a210245129dbe"
+         "c7780ccc7954725f4168aff2787776e6",
+         "139cddbccdc5e91b9623efd38c49f81a6f83f175e80b06fc374de9eb4b41dfe4"
+         "ca3a230ed250fbe3a2acf73a41177fd8",
+         "1787327b68159716a37440985269cf584bcb1e621d3a7202be6ea05c4cfe244a"
+         "eb197642555a0645fb87bf7466b2ba48",
+         "00aa65dae3c8d732d10ecd2c50f8a1baf3001578f71c694e03866e9f3d49ac1e"
+         "1ce70dd94a733534f106d4cec0eddd16"},
+        {"abcdef0123456789",
+         "121982811d2491fde9ba7ed31ef9ca474f0e1501297f68c298e9f4c0028add35"
+         "aea8bb83d53c08cfc007c1e005723cd0",
+         "190d119345b94fbd15497bcba94ecf7db2cbfd1e1fe7da034d26cbba169fb396"
+         "8288b3fafb265f9ebd380512a71c3f2c",
+         "05571a0f8d3c08d094576981f4a3b8eda0a8e771fcdcc8ecceaf1356a6acf175"
+         "74518acb506e435b639353c2e14827c8",
+         "0bb5e7572275c567462d91807de765611490205a941a5a6af3b1691bfe596c31"
+         "225d3aabdf15faff860cb4ef17c7c3be"},
+        {"q128_" + std::string(128, 'q'),
+         "19a84dd7248a1066f737cc34502ee5555bd3c19f2ecdb3c7d9e24dc65d4e25e5"
+         "0d83f0f77105e955d78f4762d33c17da",
+         "0934aba516a52d8ae479939a91998299c76d39cc0c035cd18813bec433f587e2"
+         "d7a4fef038260eef0cef4d02aae3eb91",
+         "14f81cd421617428bc3b9fe25afbb751d934a00493524bc4e065635b0555084d"
+         "d54679df1536101b2c979c0152d09192",
+         "09bcccfa036b4847c9950780733633f13619994394c23ff0b32fa6b795844f4a"
+         "0673e20282d07bc69641cee04f5e5662"},
+        {"a512_" + std::string(512, 'a'),
+         "01a6ba2f9a11fa5598b2d8ace0fbe0a0eacb65deceb476fbbcb64fd24557c2f4"
+         "b18ecfc5663e54ae16a84f5ab7f62534",
+         "11fca2ff525572795a801eed17eb12785887c7b63fb77a42be46ce4a34131d71"
+         "f7a73e95fee3f812aea3de78b4d01569",
+         "0b6798718c8aed24bc19cb27f866f1c9effcdbf92397ad6448b5c9db90d2b9da"
+         "6cbabf48adc1adf59a1a28344e79d57e",
+         "03a47f8e6d1763ba0cad63d6114c0accbef65707825a511b251a660a9b399424"
+         "9ae4e63fac38b23da0c398689ee2ab52"},
+    };
+
+    for (const std::vector<std::string> &v : vectors_g2) {
+        std::vector<bls12_381_Fq> coords;
+        for (size_t i = 1; i < 5; ++i) {
+            bigint<bls12_381_q_limbs> c;
+            bigint_from_hex(c, v[i]);
+            coords.push_back(bls12_381_Fq(c));
+        }
+        const bls12_381_G2 expect(
+            bls12_381_Fq2(coords[0], coords[1]),
+            bls12_381_Fq2(coords[2], coords[3]),
+            bls12_381_Fq2::one());
+        ASSERT_EQ(expect, hash_to_curve<bls12_381_G2>(v[0], dst_g2));
+    }
+
+    test_hash_to_curve<bls12_381_pp>();
+}
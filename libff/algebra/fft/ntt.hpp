@@ -0,0 +1,159 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_FFT_NTT_HPP__
+#define __LIBFF_ALGEBRA_FFT_NTT_HPP__
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libff
+{
+
+/// Number theoretic transforms (FFTs over prime fields) of a fixed
+/// power-of-2 size, over the multiplicative subgroup generated by omega =
+/// get_root_of_unity<FieldT>(size). That is, for a vector of coefficients
+/// a_0, ..., a_{n-1}, fft() computes the evaluations a(omega^i) for i = 0,
+/// ..., n-1, and ifft() performs the inverse.
+///
+/// Twiddle factors are precomputed at construction. Transforms of at most
+/// six_step_threshold elements use iterative radix-2 transforms (with
+/// butterflies in each layer processed in parallel if MULTICORE is
+/// enabled). Larger transforms use the six-step algorithm: the data is viewed
+/// as a matrix with roughly sqrt(size) rows, and the transform is performed
+/// as two sets of smaller transforms over contiguous rows (processed in
+/// parallel), separated by blocked transpositions, so that each smaller
+/// transform fits in cache.
+///
+/// fft_bit_reversed() and ifft_bit_reversed() produce (resp. consume)
+/// evaluations in bit-reversed order. These avoid the bit-reversal
+/// permutation (and, for the six-step algorithm, the final transposition),
+/// and can be paired when evaluations are only used pointwise.
+///
+/// The six-step algorithm requires a scratch buffer of size elements. Each
+/// transform has an overload taking a scratch vector, which is resized as
+/// required and can be retained by the caller between calls to avoid
+/// allocating per call. Other overloads allocate the buffer when it is
+/// required.
+template<typename FieldT> class ntt_domain
+{
+public:
+    static const size_t default_six_step_threshold = 1 << 16;
+
+    /// Throws std::invalid_argument if size is not a power of 2, or if FieldT
+    /// has no root of unity of order size.
+    explicit ntt_domain(
+        const size_t size,
+        const size_t six_step_threshold = default_six_step_threshold);
+
+    size_t size() const;
+
+    /// The generator of the domain.
+    const FieldT &omega() const;
+
+    /// Coefficients (natural order) to evaluations (natural order).
+    void fft(std::vector<FieldT> &a) const;
+    void fft(std::vector<FieldT> &a, std::vector<FieldT> &scratch) const;
+
+    /// Evaluations (natural order) to coefficients (natural order).
+    void ifft(std::vector<FieldT> &a) const;
+    void ifft(std::vector<FieldT> &a, std::vector<FieldT> &scratch) const;
+
+    /// Coefficients (natural order) to evaluations at g * omega^i (natural
+    /// order).
+    void coset_fft(
+        std::vector<FieldT> &a,
+        const FieldT &g = FieldT::multiplicative_generator) const;
+    void coset_fft(
+        std::vector<FieldT> &a,
+        const FieldT &g,
+        std::vector<FieldT> &scratch) const;
+
+    /// Evaluations at g * omega^i (natural order) to coefficients (natural
+    /// order).
+    void icoset_fft(
+        std::vector<FieldT> &a,
+        const FieldT &g = FieldT::multiplicative_generator) const;
+    void icoset_fft(
+        std::vector<FieldT> &a,
+        const FieldT &g,
+        std::vector<FieldT> &scratch) const;
+
+    /// Coefficients (natural order) to evaluations (bit-reversed order).
+    void fft_bit_reversed(std::vector<FieldT> &a) const;
+    void fft_bit_reversed(
+        std::vector<FieldT> &a, std::vector<FieldT> &scratch) const;
+
+    /// Evaluations (bit-reversed order) to coefficients (natural order).
+    void ifft_bit_reversed(std::vector<FieldT> &a) const;
+    void ifft_bit_reversed(
+        std::vector<FieldT> &a, std::vector<FieldT> &scratch) const;
+
+protected:
+    ntt_domain(
+        const size_t size,
+        const FieldT &omega,
+        const size_t six_step_threshold);
+
+    void init(const size_t six_step_threshold);
+    void check_size(const std::vector<FieldT> &a) const;
+    /// Resize scratch (if required by the six-step algorithm) and return its
+    /// data, or nullptr if no scratch space is required.
+    FieldT *scratch_data(std::vector<FieldT> &scratch) const;
+
+    // Transforms of the size elements at a. No scaling is applied. scratch
+    // must point to size elements (or may be nullptr for sizes up to the
+    // six-step threshold), whose contents are overwritten.
+
+    /// Natural order to bit-reversed order.
+    void dif(FieldT *a, const bool inverse) const;
+    /// Bit-reversed order to natural order.
+    void dit(FieldT *a, const bool inverse) const;
+    /// Natural order to natural order.
+    void transform(FieldT *a, FieldT *scratch, const bool inverse) const;
+    /// Natural order to bit-reversed order.
+    void transform_to_bit_reversed(
+        FieldT *a, FieldT *scratch, const bool inverse) const;
+    /// Bit-reversed order to natural order.
+    void transform_from_bit_reversed(
+        FieldT *a, FieldT *scratch, const bool inverse) const;
+
+    void six_step(FieldT *a, FieldT *scratch, const bool inverse) const;
+    void six_step_to_bit_reversed(
+        FieldT *a, FieldT *scratch, const bool inverse) const;
+    void six_step_from_bit_reversed(
+        FieldT *a, FieldT *scratch, const bool inverse) const;
+
+    size_t _size;
+    size_t _log_size;
+    FieldT _omega;
+    FieldT _omega_inv;
+    FieldT _size_inv;
+
+    // omega^i (resp. omega^-i) for i < size / 2. Only used for sizes up to
+    // the six-step threshold.
+    std::vector<FieldT> _twiddles;
+    std::vector<FieldT> _inv_twiddles;
+
+    // For the six-step algorithm, the domains for the rows and columns, and
+    // the bit-reversal of each index into the rows.
+    std::unique_ptr<ntt_domain<FieldT>> _rows_domain;
+    std::unique_ptr<ntt_domain<FieldT>> _cols_domain;
+    std::vector<size_t> _rows_bit_reverse;
+};
+
+/// Permute the elements of a (whose size must be a power of 2) into
+/// bit-reversed order (this permutation is its own inverse).
+template<typename FieldT> void bit_reverse_permute(std::vector<FieldT> &a);
+
+} // namespace libff
+
+#include "libff/algebra/fft/ntt.tcc"
+
+#endif // __LIBFF_ALGEBRA_FFT_NTT_HPP__
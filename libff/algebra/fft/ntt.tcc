@@ -0,0 +1,523 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_FFT_NTT_TCC__
+#define __LIBFF_ALGEBRA_FFT_NTT_TCC__
+
+#include "libff/algebra/fft/ntt.hpp"
+#include "libff/algebra/fields/field_utils.hpp"
+#include "libff/common/parallel.hpp"
+#include "libff/common/utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace libff
+{
+
+namespace internal
+{
+
+/// Minimum size of a transform for which the butterflies in each layer are
+/// processed in parallel.
+static const size_t NTT_PARALLEL_THRESHOLD = 1 << 12;
+
+/// Grain size (see parallel_for) for the butterflies of a transform of the
+/// given size, such that small transforms are processed sequentially.
+inline size_t ntt_butterfly_grain_size(const size_t size)
+{
+    return (size >= NTT_PARALLEL_THRESHOLD) ? 0 : size / 2;
+}
+
+/// Number of elements per chunk, when processing vectors in parallel.
+static const size_t NTT_CHUNK_SIZE = 1 << 12;
+
+/// Size of the (square) blocks used in transpositions.
+static const size_t NTT_TRANSPOSE_BLOCK_SIZE = 16;
+
+template<typename FieldT>
+void ntt_bit_reverse_permute(FieldT *a, const size_t size)
+{
+    const size_t log_size = log2(size);
+    for (size_t i = 0; i < size; ++i) {
+        const size_t j = bitreverse(i, log_size);
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+}
+
+/// Transpose the (rows x cols) matrix in into the (cols x rows) matrix out
+/// (both row-major).
+template<typename FieldT>
+void ntt_transpose(
+    const FieldT *in, FieldT *out, const size_t rows, const size_t cols)
+{
+    const size_t block = NTT_TRANSPOSE_BLOCK_SIZE;
+    const size_t num_row_blocks = (rows + block - 1) / block;
+    parallel_for(0, num_row_blocks, 1, [&](size_t begin, size_t end) {
+        for (size_t row_block = begin; row_block < end; ++row_block) {
+            const size_t row_begin = row_block * block;
+            const size_t row_end = std::min(row_begin + block, rows);
+            for (size_t col_begin = 0; col_begin < cols; col_begin += block) {
+                const size_t col_end = std::min(col_begin + block, cols);
+                for (size_t r = row_begin; r < row_end; ++r) {
+                    for (size_t c = col_begin; c < col_end; ++c) {
+                        out[c * rows + r] = in[r * cols + c];
+                    }
+                }
+            }
+        }
+    });
+}
+
+/// a[i] <- a[i] * g^i
+template<typename FieldT>
+void ntt_multiply_by_powers(FieldT *a, const size_t size, const FieldT &g)
+{
+    const size_t num_chunks = (size + NTT_CHUNK_SIZE - 1) / NTT_CHUNK_SIZE;
+    parallel_for(
+        0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+            for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+                const size_t begin = chunk * NTT_CHUNK_SIZE;
+                const size_t end = std::min(begin + NTT_CHUNK_SIZE, size);
+                FieldT g_i = g ^ (unsigned long)begin;
+                for (size_t i = begin; i < end; ++i) {
+                    a[i] *= g_i;
+                    g_i *= g;
+                }
+            }
+        });
+}
+
+/// a[i] <- a[i] * c
+template<typename FieldT>
+void ntt_scale(FieldT *a, const size_t size, const FieldT &c)
+{
+    parallel_for(0, size, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            a[i] *= c;
+        }
+    });
+}
+
+} // namespace internal
+
+template<typename FieldT>
+const size_t ntt_domain<FieldT>::default_six_step_threshold;
+
+template<typename FieldT>
+ntt_domain<FieldT>::ntt_domain(
+    const size_t size, const size_t six_step_threshold)
+    : ntt_domain(size, get_root_of_unity<FieldT>(size), six_step_threshold)
+{
+}
+
+template<typename FieldT>
+ntt_domain<FieldT>::ntt_domain(
+    const size_t size, const FieldT &omega, const size_t six_step_threshold)
+    : _size(size)
+    , _log_size(log2(size))
+    , _omega(omega)
+    , _omega_inv(omega.inverse())
+    , _size_inv(FieldT((long)size).inverse())
+{
+    init(six_step_threshold);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::init(const size_t six_step_threshold)
+{
+    if (_size > six_step_threshold && _size >= 4) {
+        // Rows of the six-step matrix have size 2^(log_size / 2) and there
+        // are 2^(log_size - log_size / 2) of them. The row domain is
+        // generated by omega^num_rows, and the column domain by
+        // omega^row_size.
+        const size_t row_size = (size_t)1 << (_log_size / 2);
+        const size_t num_rows = _size / row_size;
+        _rows_domain.reset(new ntt_domain<FieldT>(
+            row_size, _omega ^ (unsigned long)num_rows, six_step_threshold));
+        _cols_domain.reset(new ntt_domain<FieldT>(
+            num_rows, _omega ^ (unsigned long)row_size, six_step_threshold));
+        _rows_bit_reverse.resize(row_size);
+        for (size_t i = 0; i < row_size; ++i) {
+            _rows_bit_reverse[i] = bitreverse(i, _log_size / 2);
+        }
+        return;
+    }
+
+    const size_t num_twiddles = std::max<size_t>(_size / 2, 1);
+    _twiddles.resize(num_twiddles);
+    _inv_twiddles.resize(num_twiddles);
+    _twiddles[0] = FieldT::one();
+    _inv_twiddles[0] = FieldT::one();
+    for (size_t i = 1; i < num_twiddles; ++i) {
+        _twiddles[i] = _twiddles[i - 1] * _omega;
+        _inv_twiddles[i] = _inv_twiddles[i - 1] * _omega_inv;
+    }
+}
+
+template<typename FieldT> size_t ntt_domain<FieldT>::size() const
+{
+    return _size;
+}
+
+template<typename FieldT> const FieldT &ntt_domain<FieldT>::omega() const
+{
+    return _omega;
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::fft(std::vector<FieldT> &a) const
+{
+    std::vector<FieldT> scratch;
+    fft(a, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::fft(
+    std::vector<FieldT> &a, std::vector<FieldT> &scratch) const
+{
+    check_size(a);
+    transform(a.data(), scratch_data(scratch), false);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::ifft(std::vector<FieldT> &a) const
+{
+    std::vector<FieldT> scratch;
+    ifft(a, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::ifft(
+    std::vector<FieldT> &a, std::vector<FieldT> &scratch) const
+{
+    check_size(a);
+    transform(a.data(), scratch_data(scratch), true);
+    internal::ntt_scale(a.data(), _size, _size_inv);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::coset_fft(
+    std::vector<FieldT> &a, const FieldT &g) const
+{
+    std::vector<FieldT> scratch;
+    coset_fft(a, g, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::coset_fft(
+    std::vector<FieldT> &a,
+    const FieldT &g,
+    std::vector<FieldT> &scratch) const
+{
+    check_size(a);
+    internal::ntt_multiply_by_powers(a.data(), _size, g);
+    transform(a.data(), scratch_data(scratch), false);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::icoset_fft(
+    std::vector<FieldT> &a, const FieldT &g) const
+{
+    std::vector<FieldT> scratch;
+    icoset_fft(a, g, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::icoset_fft(
+    std::vector<FieldT> &a,
+    const FieldT &g,
+    std::vector<FieldT> &scratch) const
+{
+    ifft(a, scratch);
+    internal::ntt_multiply_by_powers(a.data(), _size, g.inverse());
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::fft_bit_reversed(std::vector<FieldT> &a) const
+{
+    std::vector<FieldT> scratch;
+    fft_bit_reversed(a, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::fft_bit_reversed(
+    std::vector<FieldT> &a, std::vector<FieldT> &scratch) const
+{
+    check_size(a);
+    transform_to_bit_reversed(a.data(), scratch_data(scratch), false);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::ifft_bit_reversed(std::vector<FieldT> &a) const
+{
+    std::vector<FieldT> scratch;
+    ifft_bit_reversed(a, scratch);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::ifft_bit_reversed(
+    std::vector<FieldT> &a, std::vector<FieldT> &scratch) const
+{
+    check_size(a);
+    transform_from_bit_reversed(a.data(), scratch_data(scratch), true);
+    internal::ntt_scale(a.data(), _size, _size_inv);
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::check_size(const std::vector<FieldT> &a) const
+{
+    if (a.size() != _size) {
+        throw std::invalid_argument("unexpected size for ntt_domain");
+    }
+}
+
+template<typename FieldT>
+FieldT *ntt_domain<FieldT>::scratch_data(std::vector<FieldT> &scratch) const
+{
+    if (!_rows_domain) {
+        return nullptr;
+    }
+    if (scratch.size() < _size) {
+        scratch.resize(_size);
+    }
+    return scratch.data();
+}
+
+// Gentleman-Sande (decimation in frequency) butterflies. Layers operate on
+// blocks of size 2m, for m = size/2, ..., 1.
+template<typename FieldT>
+void ntt_domain<FieldT>::dif(FieldT *a, const bool inverse) const
+{
+    const std::vector<FieldT> &twiddles = inverse ? _inv_twiddles : _twiddles;
+    const size_t num_butterflies = _size / 2;
+    const size_t grain = internal::ntt_butterfly_grain_size(_size);
+
+    for (size_t log_m = _log_size; log_m-- > 0;) {
+        const size_t m = (size_t)1 << log_m;
+        const size_t log_stride = _log_size - 1 - log_m;
+        parallel_for(0, num_butterflies, grain, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                const size_t j = b & (m - 1);
+                const size_t i = ((b >> log_m) << (log_m + 1)) + j;
+                const FieldT u = a[i];
+                const FieldT v = a[i + m];
+                a[i] = u + v;
+                a[i + m] = (u - v) * twiddles[j << log_stride];
+            }
+        });
+    }
+}
+
+// Cooley-Tukey (decimation in time) butterflies. Layers operate on blocks of
+// size 2m, for m = 1, ..., size/2.
+template<typename FieldT>
+void ntt_domain<FieldT>::dit(FieldT *a, const bool inverse) const
+{
+    const std::vector<FieldT> &twiddles = inverse ? _inv_twiddles : _twiddles;
+    const size_t num_butterflies = _size / 2;
+    const size_t grain = internal::ntt_butterfly_grain_size(_size);
+
+    for (size_t log_m = 0; log_m < _log_size; ++log_m) {
+        const size_t m = (size_t)1 << log_m;
+        const size_t log_stride = _log_size - 1 - log_m;
+        parallel_for(0, num_butterflies, grain, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                const size_t j = b & (m - 1);
+                const size_t i = ((b >> log_m) << (log_m + 1)) + j;
+                const FieldT u = a[i];
+                const FieldT v = a[i + m] * twiddles[j << log_stride];
+                a[i] = u + v;
+                a[i + m] = u - v;
+            }
+        });
+    }
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::transform(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    if (_rows_domain) {
+        six_step(a, scratch, inverse);
+    } else {
+        dif(a, inverse);
+        internal::ntt_bit_reverse_permute(a, _size);
+    }
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::transform_to_bit_reversed(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    if (_rows_domain) {
+        six_step_to_bit_reversed(a, scratch, inverse);
+    } else {
+        dif(a, inverse);
+    }
+}
+
+template<typename FieldT>
+void ntt_domain<FieldT>::transform_from_bit_reversed(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    if (_rows_domain) {
+        six_step_from_bit_reversed(a, scratch, inverse);
+    } else {
+        dit(a, inverse);
+    }
+}
+
+// With n = R * C, input index k = C * k1 + k2 and output index j = j1 + R * j2
+// (for 0 <= k1, j1 < R and 0 <= k2, j2 < C):
+//
+//   X[j1 + R * j2] = sum_{k2} (w^R)^{j2 * k2} * w^{j1 * k2}
+//                      * sum_{k1} (w^C)^{j1 * k1} * a[C * k1 + k2]
+//
+// so the inner sums are R-point transforms (one for each k2), and the outer
+// sums are C-point transforms (one for each j1). Transpositions ensure that
+// each transform operates on a contiguous row. While the rows of one buffer
+// are transformed, the other buffer is unused, and provides the scratch space
+// for each (six-step) row transform.
+template<typename FieldT>
+void ntt_domain<FieldT>::six_step(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    const size_t R = _rows_domain->_size;
+    const size_t C = _cols_domain->_size;
+    const FieldT &w = inverse ? _omega_inv : _omega;
+
+    // 1. a (R x C) -> scratch (C x R), so that row k2 holds a[C * k1 + k2]
+    internal::ntt_transpose(a, scratch, R, C);
+
+    // 2. R-point transforms of each row, and 3. multiply entry (k2, j1) by
+    // w^{j1 * k2}.
+    parallel_for(0, C, 1, [&](size_t begin, size_t end) {
+        for (size_t k2 = begin; k2 < end; ++k2) {
+            FieldT *row = scratch + k2 * R;
+            _rows_domain->transform(row, a + k2 * R, inverse);
+
+            const FieldT w_k2 = w ^ (unsigned long)k2;
+            FieldT factor = w_k2;
+            for (size_t j1 = 1; j1 < R; ++j1) {
+                row[j1] *= factor;
+                factor *= w_k2;
+            }
+        }
+    });
+
+    // 4. scratch (C x R) -> a (R x C), and 5. C-point transforms of each row.
+    internal::ntt_transpose(scratch, a, C, R);
+    parallel_for(0, R, 1, [&](size_t begin, size_t end) {
+        for (size_t j1 = begin; j1 < end; ++j1) {
+            _cols_domain->transform(a + j1 * C, scratch + j1 * C, inverse);
+        }
+    });
+
+    // 6. a (R x C) -> scratch (C x R), so that entry (j2, j1) is at
+    // j1 + R * j2.
+    internal::ntt_transpose(a, scratch, R, C);
+    std::copy(scratch, scratch + _size, a);
+}
+
+// As for six_step, where the row transforms produce bit-reversed output, so
+// that after step 4, entry (r1, j2) of a (R x C) holds the inner sums for
+// j1 = bitreverse(r1). The output index of X[j1 + R * j2] in bit-reversed
+// order is
+//
+//   bitreverse(j1 + R * j2) = C * bitreverse(j1) + bitreverse(j2)
+//
+// which is the position of entry (r1, j2) after the column transforms (again
+// producing bit-reversed output). Hence the final transposition is not
+// required, and no bit-reversal permutation is performed.
+template<typename FieldT>
+void ntt_domain<FieldT>::six_step_to_bit_reversed(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    const size_t R = _rows_domain->_size;
+    const size_t C = _cols_domain->_size;
+    const FieldT &w = inverse ? _omega_inv : _omega;
+
+    internal::ntt_transpose(a, scratch, R, C);
+    parallel_for(0, C, 1, [&](size_t begin, size_t end) {
+        for (size_t k2 = begin; k2 < end; ++k2) {
+            FieldT *row = scratch + k2 * R;
+            _rows_domain->transform_to_bit_reversed(row, a + k2 * R, inverse);
+
+            const FieldT w_k2 = w ^ (unsigned long)k2;
+            FieldT factor = w_k2;
+            for (size_t j1 = 1; j1 < R; ++j1) {
+                row[_rows_bit_reverse[j1]] *= factor;
+                factor *= w_k2;
+            }
+        }
+    });
+
+    internal::ntt_transpose(scratch, a, C, R);
+    parallel_for(0, R, 1, [&](size_t begin, size_t end) {
+        for (size_t r1 = begin; r1 < end; ++r1) {
+            _cols_domain->transform_to_bit_reversed(
+                a + r1 * C, scratch + r1 * C, inverse);
+        }
+    });
+}
+
+// The steps of six_step_to_bit_reversed in reverse: entry (r1, j2) of a (R x
+// C) initially holds X[j1 + R * j2] for j1 = bitreverse(r1), with each row in
+// bit-reversed order.
+template<typename FieldT>
+void ntt_domain<FieldT>::six_step_from_bit_reversed(
+    FieldT *a, FieldT *scratch, const bool inverse) const
+{
+    const size_t R = _rows_domain->_size;
+    const size_t C = _cols_domain->_size;
+    const FieldT &w = inverse ? _omega_inv : _omega;
+
+    // C-point transforms of each row, giving entry (r1, k2), which is
+    // multiplied by w^{j1 * k2}.
+    parallel_for(0, R, 1, [&](size_t begin, size_t end) {
+        for (size_t r1 = begin; r1 < end; ++r1) {
+            FieldT *row = a + r1 * C;
+            _cols_domain->transform_from_bit_reversed(
+                row, scratch + r1 * C, inverse);
+
+            const FieldT w_j1 = w ^ (unsigned long)_rows_bit_reverse[r1];
+            FieldT factor = w_j1;
+            for (size_t k2 = 1; k2 < C; ++k2) {
+                row[k2] *= factor;
+                factor *= w_j1;
+            }
+        }
+    });
+
+    // a (R x C) -> scratch (C x R), R-point transforms of each row (whose
+    // entries are in bit-reversed order of j1), giving entry (k2, k1), and
+    // scratch (C x R) -> a (R x C).
+    internal::ntt_transpose(a, scratch, R, C);
+    parallel_for(0, C, 1, [&](size_t begin, size_t end) {
+        for (size_t k2 = begin; k2 < end; ++k2) {
+            _rows_domain->transform_from_bit_reversed(
+                scratch + k2 * R, a + k2 * R, inverse);
+        }
+    });
+    internal::ntt_transpose(scratch, a, C, R);
+}
+
+template<typename FieldT> void bit_reverse_permute(std::vector<FieldT> &a)
+{
+    if (a.size() != ((size_t)1 << log2(a.size()))) {
+        throw std::invalid_argument("size must be a power of 2");
+    }
+    internal::ntt_bit_reverse_permute(a.data(), a.size());
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_FFT_NTT_TCC__
@@ -0,0 +1,243 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "libff/algebra/curves/bls12_377/bls12_377_pp.hpp"
+#include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#include "libff/algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "libff/algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#include "libff/algebra/fft/ntt.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace libff;
+
+namespace
+{
+
+template<typename FieldT>
+std::vector<FieldT> random_vector(const size_t size)
+{
+    std::vector<FieldT> v(size);
+    for (FieldT &e : v) {
+        e = FieldT::random_element();
+    }
+    return v;
+}
+
+// Evaluate the polynomial with coefficients a at x.
+template<typename FieldT>
+FieldT evaluate(const std::vector<FieldT> &a, const FieldT &x)
+{
+    FieldT result = FieldT::zero();
+    for (size_t i = a.size(); i > 0; --i) {
+        result = result * x + a[i - 1];
+    }
+    return result;
+}
+
+template<typename FieldT> void test_ntt_naive(const size_t size)
+{
+    const ntt_domain<FieldT> domain(size);
+    const std::vector<FieldT> coeffs = random_vector<FieldT>(size);
+
+    // fft against direct evaluation
+    std::vector<FieldT> evals = coeffs;
+    domain.fft(evals);
+    FieldT x = FieldT::one();
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(evaluate(coeffs, x), evals[i]);
+        x *= domain.omega();
+    }
+    ASSERT_EQ(FieldT::one(), x);
+
+    // coset_fft against direct evaluation
+    const FieldT g = FieldT::multiplicative_generator;
+    std::vector<FieldT> coset_evals = coeffs;
+    domain.coset_fft(coset_evals);
+    x = g;
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(evaluate(coeffs, x), coset_evals[i]);
+        x *= domain.omega();
+    }
+
+    // Inverses
+    domain.ifft(evals);
+    ASSERT_EQ(coeffs, evals);
+    domain.icoset_fft(coset_evals);
+    ASSERT_EQ(coeffs, coset_evals);
+}
+
+template<typename FieldT>
+void test_ntt_round_trip(const size_t size, const size_t six_step_threshold)
+{
+    const ntt_domain<FieldT> domain(size, six_step_threshold);
+    const std::vector<FieldT> coeffs = random_vector<FieldT>(size);
+
+    std::vector<FieldT> v = coeffs;
+    domain.fft(v);
+    domain.ifft(v);
+    ASSERT_EQ(coeffs, v);
+
+    const FieldT g = FieldT::random_element();
+    domain.coset_fft(v, g);
+    domain.icoset_fft(v, g);
+    ASSERT_EQ(coeffs, v);
+
+    domain.fft_bit_reversed(v);
+    domain.ifft_bit_reversed(v);
+    ASSERT_EQ(coeffs, v);
+}
+
+// The six-step and iterative transforms must agree, and bit-reversed variants
+// must be consistent with the natural order ones.
+template<typename FieldT>
+void test_ntt_six_step(const size_t size, const size_t six_step_threshold)
+{
+    const ntt_domain<FieldT> iterative(size, size);
+    const ntt_domain<FieldT> six_step(size, six_step_threshold);
+    ASSERT_EQ(iterative.omega(), six_step.omega());
+
+    const std::vector<FieldT> coeffs = random_vector<FieldT>(size);
+    std::vector<FieldT> expect = coeffs;
+    iterative.fft(expect);
+
+    std::vector<FieldT> v = coeffs;
+    six_step.fft(v);
+    ASSERT_EQ(expect, v);
+
+    std::vector<FieldT> expect_bit_reversed = expect;
+    bit_reverse_permute(expect_bit_reversed);
+    for (const ntt_domain<FieldT> *domain : {&iterative, &six_step}) {
+        v = coeffs;
+        domain->fft_bit_reversed(v);
+        ASSERT_EQ(expect_bit_reversed, v);
+        domain->ifft_bit_reversed(v);
+        ASSERT_EQ(coeffs, v);
+    }
+
+    // Pointwise product of bit-reversed evaluations gives the cyclic
+    // convolution.
+    std::vector<FieldT> a = random_vector<FieldT>(size);
+    std::vector<FieldT> b = random_vector<FieldT>(size);
+    std::vector<FieldT> expect_product(size, FieldT::zero());
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            expect_product[(i + j) % size] += a[i] * b[j];
+        }
+    }
+    std::vector<FieldT> scratch;
+    six_step.fft_bit_reversed(a, scratch);
+    six_step.fft_bit_reversed(b, scratch);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] *= b[i];
+    }
+    six_step.ifft_bit_reversed(a, scratch);
+    ASSERT_EQ(expect_product, a);
+
+    // Transforms using a caller-provided scratch buffer.
+    v = coeffs;
+    six_step.coset_fft(v, FieldT::multiplicative_generator, scratch);
+    six_step.icoset_fft(v, FieldT::multiplicative_generator, scratch);
+    ASSERT_EQ(coeffs, v);
+}
+
+template<typename FieldT> void test_ntt()
+{
+    for (size_t size = 1; size <= 32; size *= 2) {
+        test_ntt_naive<FieldT>(size);
+    }
+
+    test_ntt_round_trip<FieldT>(1, 1);
+    test_ntt_round_trip<FieldT>(2, 1);
+    test_ntt_round_trip<FieldT>(
+        1 << 10, ntt_domain<FieldT>::default_six_step_threshold);
+    test_ntt_round_trip<FieldT>(1 << 10, 1 << 4);
+    test_ntt_round_trip<FieldT>(1 << 9, 1 << 3);
+
+    test_ntt_six_step<FieldT>(1 << 4, 1 << 1);
+    test_ntt_six_step<FieldT>(1 << 7, 1 << 2);
+    test_ntt_six_step<FieldT>(1 << 8, 1 << 4);
+
+    // Larger sizes, compared against the iterative transform only.
+    const size_t size = 1 << 13;
+    const ntt_domain<FieldT> iterative(size, size);
+    const ntt_domain<FieldT> six_step(size, 1 << 6);
+    std::vector<FieldT> expect = random_vector<FieldT>(size);
+    std::vector<FieldT> v = expect;
+    iterative.fft(expect);
+    six_step.fft(v);
+    ASSERT_EQ(expect, v);
+
+    // Six-step row and column transforms which themselves use the six-step
+    // algorithm.
+    const ntt_domain<FieldT> nested(size, 1 << 3);
+    v = random_vector<FieldT>(size);
+    expect = v;
+    iterative.fft_bit_reversed(expect);
+    nested.fft_bit_reversed(v);
+    ASSERT_EQ(expect, v);
+    iterative.ifft_bit_reversed(expect);
+    nested.ifft_bit_reversed(v);
+    ASSERT_EQ(expect, v);
+}
+
+template<typename FieldT> void test_ntt_invalid_size()
+{
+    ASSERT_THROW(ntt_domain<FieldT>(3), std::invalid_argument);
+    ASSERT_THROW(ntt_domain<FieldT>(12), std::invalid_argument);
+    ASSERT_THROW(
+        ntt_domain<FieldT>((size_t)1 << (FieldT::s + 1)),
+        std::invalid_argument);
+
+    const ntt_domain<FieldT> domain(8);
+    std::vector<FieldT> v(4, FieldT::one());
+    ASSERT_THROW(domain.fft(v), std::invalid_argument);
+    ASSERT_THROW(domain.ifft(v), std::invalid_argument);
+
+    std::vector<FieldT> w(6, FieldT::one());
+    ASSERT_THROW(bit_reverse_permute(w), std::invalid_argument);
+}
+
+TEST(NTTTest, ALT_BN128)
+{
+    alt_bn128_pp::init_public_params();
+    test_ntt<alt_bn128_Fr>();
+    test_ntt_invalid_size<alt_bn128_Fr>();
+}
+
+TEST(NTTTest, BLS12_381)
+{
+    bls12_381_pp::init_public_params();
+    test_ntt<bls12_381_Fr>();
+    test_ntt_invalid_size<bls12_381_Fr>();
+}
+
+TEST(NTTTest, BLS12_377)
+{
+    bls12_377_pp::init_public_params();
+    test_ntt<bls12_377_Fr>();
+    test_ntt<bls12_377_Fq>();
+    test_ntt_invalid_size<bls12_377_Fr>();
+}
+
+TEST(NTTTest, MNT4)
+{
+    mnt4_pp::init_public_params();
+    test_ntt<mnt4_Fr>();
+    test_ntt_invalid_size<mnt4_Fr>();
+}
+
+TEST(NTTTest, MNT6)
+{
+    mnt6_pp::init_public_params();
+    test_ntt<mnt6_Fr>();
+}
+
+} // namespace
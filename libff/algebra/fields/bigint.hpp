@@ -13,6 +13,8 @@
 #include <gmp.h>
 #include <iostream>
 #include <libff/common/serialization.hpp>
+#include <libff/common/template_utils.hpp>
+#include <stdexcept>
 
 namespace libff
 {
@@ -22,6 +24,51 @@ template<mp_size_t n>
 std::ostream &operator<<(std::ostream &, const bigint<n> &);
 template<mp_size_t n> std::istream &operator>>(std::istream &, bigint<n> &);
 
+namespace internal
+{
+
+constexpr size_t bigint_hex_digits_per_limb = GMP_NUMB_BITS / 4;
+
+constexpr mp_limb_t bigint_hex_digit(const char c)
+{
+    return ('0' <= c && c <= '9')   ? (mp_limb_t)(c - '0')
+           : ('a' <= c && c <= 'f') ? (mp_limb_t)(c - 'a' + 10)
+           : ('A' <= c && c <= 'F')
+               ? (mp_limb_t)(c - 'A' + 10)
+               : throw std::invalid_argument("invalid hexadecimal digit");
+}
+
+/// Value of the hexadecimal digits hex[begin], ..., hex[end-1] (most
+/// significant first), accumulated onto acc.
+constexpr mp_limb_t bigint_hex_digits_value(
+    const char *hex, const size_t begin, const size_t end, const mp_limb_t acc)
+{
+    return (begin == end) ? acc
+                          : bigint_hex_digits_value(
+                                hex,
+                                begin + 1,
+                                end,
+                                (acc << 4) | bigint_hex_digit(hex[begin]));
+}
+
+/// Limb i of the integer with len hexadecimal digits hex[0], ...,
+/// hex[len-1].
+constexpr mp_limb_t bigint_hex_limb(
+    const char *hex, const size_t len, const size_t i)
+{
+    return (len <= i * bigint_hex_digits_per_limb)
+               ? 0
+               : bigint_hex_digits_value(
+                     hex,
+                     (len > (i + 1) * bigint_hex_digits_per_limb)
+                         ? len - (i + 1) * bigint_hex_digits_per_limb
+                         : 0,
+                     len - i * bigint_hex_digits_per_limb,
+                     0);
+}
+
+} // namespace internal
+
 /// Wrapper class around GMP's MPZ long integers. It supports arithmetic
 /// operations, serialization and randomization. Serialization is fragile, see
 /// common/serialization.hpp.
@@ -40,6 +87,19 @@ public:
     /// Initialize from MPZ element
     bigint(const mpz_t r);
 
+    /// Initialize from a string literal containing an integer in hexadecimal
+    /// notation (most significant digit first, without prefix). This is
+    /// evaluated at compile time when used to initialize a constexpr (or
+    /// constant-initialized) variable, so that parameters can be emitted as
+    /// constants rather than parsed at runtime.
+    template<size_t L>
+    static constexpr bigint<n> from_hex(const char (&hex)[L])
+    {
+        return (L - 1 <= n * internal::bigint_hex_digits_per_limb)
+                   ? bigint<n>(hex, L - 1, make_index_sequence<n>())
+                   : throw std::invalid_argument("hex value too large");
+    }
+
     void print() const;
     void print_hex() const;
     bool operator==(const bigint<n> &other) const;
@@ -62,6 +122,14 @@ public:
 
     friend std::ostream &operator<<<n>(std::ostream &out, const bigint<n> &b);
     friend std::istream &operator>><n>(std::istream &in, bigint<n> &b);
+
+protected:
+    template<size_t... I>
+    constexpr bigint(
+        const char *hex, const size_t len, const index_sequence<I...> &)
+        : data{internal::bigint_hex_limb(hex, len, I)...}
+    {
+    }
 };
 
 } // namespace libff
@@ -21,6 +21,28 @@ void bigint_from_hex(BigIntT &v, const std::string &hex);
 template<typename BigIntT>
 std::string bigint_to_hex(const BigIntT &v, bool prefix = false);
 
+/// Size in bytes of the encoding_binary encoding of elements of FieldT (for
+/// either form).
+template<typename FieldT> constexpr size_t field_binary_size();
+
+/// Encode v to the start of a caller-owned buffer of buffer_size bytes,
+/// returning the number of bytes written. Throws std::runtime_error if the
+/// buffer is too small.
+template<
+    encoding_t Enc = encoding_binary,
+    form_t Form = form_plain,
+    typename FieldT>
+size_t field_encode(const FieldT &v, void *buffer, const size_t buffer_size);
+
+/// Decode v from the start of a buffer of buffer_size bytes, returning the
+/// number of bytes consumed. Throws std::runtime_error if the buffer is too
+/// small or the encoding is invalid.
+template<
+    encoding_t Enc = encoding_binary,
+    form_t Form = form_plain,
+    typename FieldT>
+size_t field_decode(FieldT &v, const void *buffer, const size_t buffer_size);
+
 template<
     encoding_t Enc = encoding_binary,
     form_t Form = form_plain,
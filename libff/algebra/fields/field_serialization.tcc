@@ -28,7 +28,8 @@ class field_element_codec<encoding_json, Form, FieldT>
 {
 public:
     // Convert a field element to JSON
-    static void write(const FieldT &field_el, std::ostream &out_s)
+    template<typename OStreamT>
+    static void write(const FieldT &field_el, OStreamT &out_s)
     {
         using base_field_t =
             typename std::decay<decltype(field_el.coeffs[0])>::type;
@@ -49,7 +50,8 @@ public:
     }
 
     // Read a field element from JSON
-    static void read(FieldT &field_el, std::istream &in_s)
+    template<typename IStreamT>
+    static void read(FieldT &field_el, IStreamT &in_s)
     {
         using base_field_t =
             typename std::decay<decltype(field_el.coeffs[0])>::type;
@@ -90,7 +92,8 @@ class field_element_codec<encoding_json, Form, libff::Fp_model<n, modulus>>
 {
 public:
     using Field = libff::Fp_model<n, modulus>;
-    static void write(const Field &field_el, std::ostream &out_s)
+    template<typename OStreamT>
+    static void write(const Field &field_el, OStreamT &out_s)
     {
         if (Form == form_plain) {
             out_s << '"' << bigint_to_hex(field_el.as_bigint(), true) << '"';
@@ -98,7 +101,8 @@ public:
             out_s << '"' << bigint_to_hex(field_el.mont_repr, true) << '"';
         }
     };
-    static void read(Field &field_el, std::istream &in_s)
+    template<typename IStreamT>
+    static void read(Field &field_el, IStreamT &in_s)
     {
         char quote;
         in_s >> quote;
@@ -107,7 +111,8 @@ public:
         }
         std::string bigint_hex;
         try {
-            std::getline(in_s, bigint_hex, '"');
+            using std::getline;
+            getline(in_s, bigint_hex, '"');
         } catch (...) {
             throw std::runtime_error("json string not terminated");
         }
@@ -127,29 +132,35 @@ template<typename FieldT, form_t Form>
 class field_element_codec<encoding_binary, Form, FieldT>
 {
 public:
-    static void write(const FieldT &field_el, std::ostream &out_s)
+    using base_field_t = typename std::decay<decltype(
+        std::declval<FieldT>().coeffs[0])>::type;
+
+    static constexpr size_t binary_size()
+    {
+        return FieldT::tower_extension_degree *
+               field_element_codec<encoding_binary, Form, base_field_t>::
+                   binary_size();
+    }
+    template<typename OStreamT>
+    static void write(const FieldT &field_el, OStreamT &out_s)
     {
-        using base_field_t =
-            typename std::decay<decltype(field_el.coeffs[0])>::type;
         for (size_t i = 0; i < FieldT::tower_extension_degree; ++i) {
             field_element_codec<encoding_binary, Form, base_field_t>::write(
                 field_el.coeffs[i], out_s);
         }
     }
-    static void read(FieldT &field_el, std::istream &in_s)
+    template<typename IStreamT>
+    static void read(FieldT &field_el, IStreamT &in_s)
     {
-        using base_field_t =
-            typename std::decay<decltype(field_el.coeffs[0])>::type;
         for (size_t i = 0; i < FieldT::tower_extension_degree; ++i) {
             field_element_codec<encoding_binary, Form, base_field_t>::read(
                 field_el.coeffs[i], in_s);
         }
     }
+    template<typename OStreamT>
     static void write_with_flags(
-        const FieldT &field_el, const mp_limb_t flags, std::ostream &out_s)
+        const FieldT &field_el, const mp_limb_t flags, OStreamT &out_s)
     {
-        using base_field_t =
-            typename std::decay<decltype(field_el.coeffs[0])>::type;
         // Write first component with flags, then all remaining components as
         // normal.
         field_element_codec<encoding_binary, Form, base_field_t>::
@@ -159,11 +170,10 @@ public:
                 field_el.coeffs[i], out_s);
         }
     }
+    template<typename IStreamT>
     static void read_with_flags(
-        FieldT &field_el, mp_limb_t &flags, std::istream &in_s)
+        FieldT &field_el, mp_limb_t &flags, IStreamT &in_s)
     {
-        using base_field_t =
-            typename std::decay<decltype(field_el.coeffs[0])>::type;
         // Read first component with flags, then all remaining components as
         // normal.
         field_element_codec<encoding_binary, Form, base_field_t>::
@@ -194,7 +204,9 @@ public:
         const size_t field_size_on_disk = 8 * sizeof(Field);
         return (field_size_on_disk - field_bits) >= NUM_FLAG_BITS;
     }
-    static void write(const Field &field_el, std::ostream &out_s)
+    static constexpr size_t binary_size() { return sizeof(libff::bigint<n>); }
+    template<typename OStreamT>
+    static void write(const Field &field_el, OStreamT &out_s)
     {
         // Convert to bigint, reverse bytes in-place, and write to stream.
         libff::bigint<n> bi;
@@ -206,7 +218,8 @@ public:
         std::reverse((char *)(&bi), (char *)(&bi + 1));
         out_s.write((const char *)(&bi.data[0]), sizeof(bi));
     }
-    static void read(Field &field_el, std::istream &in_s)
+    template<typename IStreamT>
+    static void read(Field &field_el, IStreamT &in_s)
     {
         // Read bigint from stream, reverse bytes in-place and convert to field
         // element.
@@ -221,8 +234,9 @@ public:
             std::reverse((char *)(&res), (char *)(&res + 1));
         }
     }
+    template<typename OStreamT>
     static void write_with_flags(
-        const Field &field_el, const mp_limb_t flags, std::ostream &out_s)
+        const Field &field_el, const mp_limb_t flags, OStreamT &out_s)
     {
         assert(verify_flag_capacity());
         assert(flags == (flags & ((1 << NUM_FLAG_BITS) - 1)));
@@ -239,8 +253,9 @@ public:
         std::reverse((char *)(&bi), (char *)(&bi + 1));
         out_s.write((const char *)(&bi.data[0]), sizeof(bi));
     }
+    template<typename IStreamT>
     static void read_with_flags(
-        Field &field_el, mp_limb_t &flags, std::istream &in_s)
+        Field &field_el, mp_limb_t &flags, IStreamT &in_s)
     {
         assert(verify_flag_capacity());
 
@@ -266,6 +281,47 @@ public:
     }
 };
 
+// Reading and writing of field elements via std::istream and std::ostream.
+// Json is parsed from (written to) the stream directly.
+template<encoding_t Enc, form_t Form, typename FieldT>
+class field_stream_codec
+{
+public:
+    static void write(const FieldT &field_el, std::ostream &out_s)
+    {
+        field_element_codec<Enc, Form, FieldT>::write(field_el, out_s);
+    }
+    static void read(FieldT &field_el, std::istream &in_s)
+    {
+        field_element_codec<Enc, Form, FieldT>::read(field_el, in_s);
+    }
+};
+
+// Binary encodings have a fixed size, so elements are encoded to (decoded
+// from) a local buffer by field_encode (field_decode), and the stream is
+// accessed with a single call.
+template<form_t Form, typename FieldT>
+class field_stream_codec<encoding_binary, Form, FieldT>
+{
+public:
+    using codec = field_element_codec<encoding_binary, Form, FieldT>;
+
+    static void write(const FieldT &field_el, std::ostream &out_s)
+    {
+        char buffer[codec::binary_size()];
+        field_encode<encoding_binary, Form>(field_el, buffer, sizeof(buffer));
+        out_s.write(buffer, sizeof(buffer));
+    }
+    static void read(FieldT &field_el, std::istream &in_s)
+    {
+        char buffer[codec::binary_size()];
+        if (in_s.read(buffer, sizeof(buffer))) {
+            field_decode<encoding_binary, Form>(
+                field_el, buffer, sizeof(buffer));
+        }
+    }
+};
+
 } // namespace internal
 
 template<typename BigIntT>
@@ -297,28 +353,49 @@ template<typename BigIntT> std::string bigint_to_dec(const BigIntT &v)
     return result;
 }
 
+template<typename FieldT> constexpr size_t field_binary_size()
+{
+    return internal::field_element_codec<encoding_binary, form_plain, FieldT>::
+        binary_size();
+}
+
 template<encoding_t Enc, form_t Form, typename FieldT>
-void field_read(FieldT &v, std::istream &in_s)
+size_t field_encode(const FieldT &v, void *buffer, const size_t buffer_size)
 {
+    buffer_writer out_s(buffer, buffer_size);
+    internal::field_element_codec<Enc, Form, FieldT>::write(v, out_s);
+    return out_s.num_written();
+}
+
+template<encoding_t Enc, form_t Form, typename FieldT>
+size_t field_decode(FieldT &v, const void *buffer, const size_t buffer_size)
+{
+    buffer_reader in_s(buffer, buffer_size);
     internal::field_element_codec<Enc, Form, FieldT>::read(v, in_s);
+    return in_s.num_read();
 }
 
 template<encoding_t Enc, form_t Form, typename FieldT>
-void field_write(const FieldT &v, std::ostream &out_s)
+void field_read(FieldT &v, std::istream &in_s)
 {
-    internal::field_element_codec<Enc, Form, FieldT>::write(v, out_s);
+    internal::field_stream_codec<Enc, Form, FieldT>::read(v, in_s);
 }
 
 template<encoding_t Enc, form_t Form, typename FieldT>
-void field_read_with_flags(FieldT &v, mp_limb_t &flags, std::istream &in_s)
+void field_write(const FieldT &v, std::ostream &out_s)
+{
+    internal::field_stream_codec<Enc, Form, FieldT>::write(v, out_s);
+}
+
+template<encoding_t Enc, form_t Form, typename FieldT, typename IStreamT>
+void field_read_with_flags(FieldT &v, mp_limb_t &flags, IStreamT &in_s)
 {
     internal::field_element_codec<Enc, Form, FieldT>::read_with_flags(
         v, flags, in_s);
 }
 
-template<encoding_t Enc, form_t Form, typename FieldT>
-void field_write_with_flags(
-    const FieldT &v, mp_limb_t flags, std::ostream &out_s)
+template<encoding_t Enc, form_t Form, typename FieldT, typename OStreamT>
+void field_write_with_flags(const FieldT &v, mp_limb_t flags, OStreamT &out_s)
 {
     internal::field_element_codec<Enc, Form, FieldT>::write_with_flags(
         v, flags, out_s);
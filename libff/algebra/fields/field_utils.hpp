@@ -18,6 +18,9 @@
 namespace libff
 {
 
+template<mp_size_t n, const bigint<n> &modulus> class Fp2_model;
+template<mp_size_t n, const bigint<n> &modulus> class Fp3_model;
+
 // returns true if get_root_of_unity will succeed.
 template<typename FieldT>
 typename std::enable_if<std::is_same<FieldT, Double>::value, bool>::type
@@ -55,6 +58,14 @@ void field_get_signed_digits(
     const size_t digit_size,
     const size_t num_digits);
 
+/// As above, for a value already in bigint (non-Montgomery) form.
+template<mp_size_t n>
+void field_get_signed_digits(
+    std::vector<ssize_t> &digits,
+    const bigint<n> &v,
+    const size_t digit_size,
+    const size_t num_digits);
+
 template<typename FieldT>
 std::vector<FieldT> pack_int_vector_into_field_element_vector(
     const std::vector<size_t> &v, const size_t w);
@@ -87,6 +98,38 @@ FieldT convert_bit_vector_to_field_element(const bit_vector &v);
 
 template<typename FieldT> void batch_invert(std::vector<FieldT> &vec);
 
+/// Returns true if v is a square (including zero). For extension fields, this
+/// is determined by the norm of v, requiring a single exponentiation in the
+/// base field.
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp_model<n, modulus> &v);
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp2_model<n, modulus> &v);
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp3_model<n, modulus> &v);
+
+/// If v is a square (including zero), write a square root of v to root and
+/// return true. Otherwise return false (root is then unspecified). Checking
+/// is (almost) free: Fp and Fp3 use Tonelli-Shanks, where the check costs at
+/// most s-1 squarings. Fp2 uses the "complex method", reducing the
+/// computation to square roots in the base field. If p = 3 mod 4, this
+/// requires exactly two base field exponentiations, compared to a single
+/// exponentiation over Fp2 with an exponent of twice the size for
+/// Tonelli-Shanks.
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp_model<n, modulus> &v, Fp_model<n, modulus> &root);
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp2_model<n, modulus> &v, Fp2_model<n, modulus> &root);
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp3_model<n, modulus> &v, Fp3_model<n, modulus> &root);
+
 /// Rerturns a reference to the 0-th component of the element (or the element
 /// itself if FieldT is not an extension field).
 template<typename FieldT>
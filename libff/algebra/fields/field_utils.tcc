@@ -45,6 +45,92 @@ public:
     }
 };
 
+/// Norm of an element over the base field, which is a square iff the element
+/// is a square.
+template<mp_size_t n, const bigint<n> &modulus>
+const Fp_model<n, modulus> &field_norm(const Fp_model<n, modulus> &v)
+{
+    return v;
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> field_norm(const Fp2_model<n, modulus> &v)
+{
+    // a0^2 - non_residue * a1^2
+    return v.coeffs[0].squared() -
+           Fp2_model<n, modulus>::non_residue * v.coeffs[1].squared();
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> field_norm(const Fp3_model<n, modulus> &v)
+{
+    // a0^3 + non_residue * a1^3 + non_residue^2 * a2^3
+    //   - 3 * non_residue * a0 * a1 * a2
+    const Fp_model<n, modulus> &non_residue =
+        Fp3_model<n, modulus>::non_residue;
+    const Fp_model<n, modulus> &a0 = v.coeffs[0];
+    const Fp_model<n, modulus> &a1 = v.coeffs[1];
+    const Fp_model<n, modulus> &a2 = v.coeffs[2];
+    const Fp_model<n, modulus> a0a1a2 = a0 * a1 * a2;
+    return a0.squared() * a0 +
+           non_residue * (a1.squared() * a1 +
+                          non_residue * a2.squared() * a2 - a0a1a2 -
+                          a0a1a2 - a0a1a2);
+}
+
+/// Tonelli-Shanks, for fields with 2-adicity s, where (for odd t) the field
+/// order minus 1 is 2^s * t.
+template<typename FieldT>
+bool field_sqrt_tonelli_shanks(const FieldT &v, FieldT &root)
+{
+    const FieldT one = FieldT::one();
+    if (v.is_zero()) {
+        root = v;
+        return true;
+    }
+
+    size_t k = FieldT::s;
+    FieldT z = FieldT::nqr_to_t;
+    FieldT w = v ^ FieldT::t_minus_1_over_2;
+    FieldT x = v * w;
+    // b = v^t
+    FieldT b = x * w;
+
+    // Euler's criterion: v is a square iff b^(2^(s-1)) = 1. This also
+    // guarantees that the loop below terminates.
+    FieldT check = b;
+    for (size_t i = 1; i < k; ++i) {
+        check = check.squared();
+    }
+    if (check != one) {
+        return false;
+    }
+
+    // Invariants: x^2 = v * b, and b has order 2^m for some m < k.
+    while (b != one) {
+        size_t m = 0;
+        FieldT b2m = b;
+        while (b2m != one) {
+            b2m = b2m.squared();
+            ++m;
+        }
+
+        // w = z^(2^(k-m-1))
+        w = z;
+        for (size_t j = m + 1; j < k; ++j) {
+            w = w.squared();
+        }
+
+        z = w.squared();
+        b = b * z;
+        x = x * w;
+        k = m;
+    }
+
+    root = x;
+    return true;
+}
+
 } // namespace internal
 
 template<mp_size_t n>
@@ -208,6 +294,16 @@ void field_get_signed_digits(
     const FieldT &v,
     const size_t digit_size,
     const size_t num_digits)
+{
+    field_get_signed_digits(digits, v.as_bigint(), digit_size, num_digits);
+}
+
+template<mp_size_t n>
+void field_get_signed_digits(
+    std::vector<ssize_t> &digits,
+    const bigint<n> &v_bi,
+    const size_t digit_size,
+    const size_t num_digits)
 {
     assert(digits.size() >= num_digits);
 
@@ -215,7 +311,6 @@ void field_get_signed_digits(
 
     const size_t carry_mask = 1ull << (digit_size - 1);
     const size_t overflow_mask = 1ll << digit_size;
-    const auto v_bi = v.as_bigint();
 
     size_t carry = 0;
     size_t overflow = 0;
@@ -438,6 +533,100 @@ template<typename FieldT> void batch_invert(std::vector<FieldT> &vec)
     }
 }
 
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp_model<n, modulus> &v)
+{
+    return v.is_zero() ||
+           (v ^ Fp_model<n, modulus>::euler) == Fp_model<n, modulus>::one();
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp2_model<n, modulus> &v)
+{
+    return field_is_square(internal::field_norm(v));
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_is_square(const Fp3_model<n, modulus> &v)
+{
+    return field_is_square(internal::field_norm(v));
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp_model<n, modulus> &v, Fp_model<n, modulus> &root)
+{
+    return internal::field_sqrt_tonelli_shanks(v, root);
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp2_model<n, modulus> &v, Fp2_model<n, modulus> &root)
+{
+    using FieldT = Fp2_model<n, modulus>;
+    using BaseFieldT = Fp_model<n, modulus>;
+
+    // For v = a0 + a1 * u, where u^2 = non_residue, x0 + x1 * u is a square
+    // root of v iff x0^2 + non_residue * x1^2 = a0 and 2 * x0 * x1 = a1. (Copy
+    // a0 and a1, in case root and v are the same object).
+    const BaseFieldT a0 = v.coeffs[0];
+    const BaseFieldT a1 = v.coeffs[1];
+    if (a1.is_zero()) {
+        // One of a0 and a0 / non_residue is a square.
+        if (field_sqrt_if_square(a0, root.coeffs[0])) {
+            root.coeffs[1] = BaseFieldT::zero();
+            return true;
+        }
+        root.coeffs[0] = BaseFieldT::zero();
+        return field_sqrt_if_square(
+            a0 * FieldT::non_residue_inverse, root.coeffs[1]);
+    }
+
+    // v is a square iff its norm a0^2 - non_residue * a1^2 is a square, with
+    // root alpha. Then x0^2 is (a0 + alpha) / 2 or (a0 - alpha) / 2, exactly
+    // one of which is a square (their product is non_residue * a1^2 / 4).
+    const BaseFieldT &half = FieldT::half;
+    BaseFieldT alpha;
+    if (!field_sqrt_if_square(internal::field_norm(v), alpha)) {
+        return false;
+    }
+    const BaseFieldT delta = (a0 + alpha) * half;
+
+    if (BaseFieldT::s == 1) {
+        // p = 3 mod 4. With w = delta^((p-3)/4), x0 = delta * w satisfies
+        // x0 * w = delta^((p-1)/2) = +/-1, so that x0^2 = +/-delta and
+        // 1/x0 = +/-w (and no inversion is required).
+        const BaseFieldT w = delta ^ BaseFieldT::t_minus_1_over_2;
+        const BaseFieldT x0 = delta * w;
+        if (x0 * w == BaseFieldT::one()) {
+            root.coeffs[0] = x0;
+            root.coeffs[1] = a1 * w * half;
+        } else {
+            // x0^2 = -delta. Since -1 is not a square, -non_residue = r^2
+            // (with r = sqrt_minus_non_residue), and (a0 - alpha) / 2 =
+            // non_residue * a1^2 / (4 * delta) has square root
+            // r * a1 / (2 * x0) = -r * a1 * w / 2.
+            root.coeffs[0] =
+                -(FieldT::sqrt_minus_non_residue * a1 * w * half);
+            root.coeffs[1] = x0 * FieldT::sqrt_minus_non_residue_inverse;
+        }
+        return true;
+    }
+
+    if (!field_sqrt_if_square(delta, root.coeffs[0])) {
+        field_sqrt_if_square(delta - alpha, root.coeffs[0]);
+    }
+    root.coeffs[1] = a1 * (root.coeffs[0] + root.coeffs[0]).inverse();
+    return true;
+}
+
+template<mp_size_t n, const bigint<n> &modulus>
+bool field_sqrt_if_square(
+    const Fp3_model<n, modulus> &v, Fp3_model<n, modulus> &root)
+{
+    return internal::field_sqrt_tonelli_shanks(v, root);
+}
+
 template<typename FieldT>
 const typename FieldT::my_Fp &field_get_component_0(const FieldT &v)
 {
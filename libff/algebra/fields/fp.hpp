@@ -90,6 +90,13 @@ public:
     Fp_model(const bigint<n> &b);
     Fp_model(const long x, const bool is_unsigned = false);
 
+    /// Construct the element whose Montgomery representation is the given
+    /// hexadecimal value (see bigint::from_hex), without any conversion. Used
+    /// for precomputed constants, which can then be set at init time without
+    /// parsing or Montgomery multiplication.
+    template<size_t L>
+    static Fp_model from_montgomery_hex(const char (&hex)[L]);
+
     void set_ulong(const unsigned long x);
 
     void mul_reduce(const bigint<n> &other);
@@ -125,7 +132,8 @@ public:
     Fp_model squared() const;
     Fp_model &invert();
     Fp_model inverse() const;
-    /// HAS TO BE A SQUARE (else does not terminate)
+    /// HAS TO BE A SQUARE (else the result is unspecified). See also
+    /// field_sqrt_if_square.
     Fp_model sqrt() const;
 
     Fp_model operator^(const unsigned long pow) const;
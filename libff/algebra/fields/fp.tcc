@@ -253,6 +253,16 @@ Fp_model<n, modulus>::Fp_model(const long x, const bool is_unsigned)
     mul_reduce(Rsquared);
 }
 
+template<mp_size_t n, const bigint<n> &modulus>
+template<size_t L>
+Fp_model<n, modulus> Fp_model<n, modulus>::from_montgomery_hex(
+    const char (&hex)[L])
+{
+    Fp_model<n, modulus> res;
+    res.mont_repr = bigint<n>::from_hex(hex);
+    return res;
+}
+
 template<mp_size_t n, const bigint<n> &modulus>
 void Fp_model<n, modulus>::set_ulong(const unsigned long x)
 {
@@ -763,52 +773,11 @@ Fp_model<n, modulus> Fp_model<n, modulus>::random_element()
 template<mp_size_t n, const bigint<n> &modulus>
 Fp_model<n, modulus> Fp_model<n, modulus>::sqrt() const
 {
-    Fp_model<n, modulus> one = Fp_model<n, modulus>::one();
-
-    size_t v = Fp_model<n, modulus>::s;
-    Fp_model<n, modulus> z = Fp_model<n, modulus>::nqr_to_t;
-    Fp_model<n, modulus> w = (*this) ^ Fp_model<n, modulus>::t_minus_1_over_2;
-    Fp_model<n, modulus> x = (*this) * w;
-    Fp_model<n, modulus> b = x * w; // b = (*this)^t
-
-#if DEBUG
-    // check if square with euler's criterion
-    Fp_model<n, modulus> check = b;
-    for (size_t i = 0; i < v - 1; ++i) {
-        check = check.squared();
-    }
-    if (check != one) {
-        assert(0);
-    }
-#endif
-
-    // compute square root with Tonelli--Shanks
-    // (does not terminate if not a square!)
-
-    while (b != one) {
-        size_t m = 0;
-        Fp_model<n, modulus> b2m = b;
-        while (b2m != one) {
-            // invariant: b2m = b^(2^m) after entering this loop
-            b2m = b2m.squared();
-            m += 1;
-        }
-
-        // w = z^2^(v-m-1)
-        int j = v - m - 1;
-        w = z;
-        while (j > 0) {
-            w = w.squared();
-            --j;
-        }
-
-        z = w.squared();
-        b = b * z;
-        x = x * w;
-        v = m;
-    }
-
-    return x;
+    Fp_model<n, modulus> root;
+    const bool is_square = field_sqrt_if_square(*this, root);
+    assert(is_square);
+    UNUSED(is_square);
+    return root;
 }
 
 template<mp_size_t n, const bigint<n> &modulus>
@@ -57,6 +57,15 @@ public:
     static Fp2_model<n, modulus> nqr;
     /// nqr^t
     static Fp2_model<n, modulus> nqr_to_t;
+    /// 1/2 in Fp, used when computing square roots
+    static my_Fp half;
+    /// 1/non_residue, used when computing square roots
+    static my_Fp non_residue_inverse;
+    /// sqrt(-non_residue) and its inverse, used when computing square roots
+    /// (only set where modulus = 3 mod 4, in which case -non_residue is a
+    /// square in Fp)
+    static my_Fp sqrt_minus_non_residue;
+    static my_Fp sqrt_minus_non_residue_inverse;
     /// non_residue^((modulus^i-1)/2) for i=0,1
     static my_Fp Frobenius_coeffs_c1[2];
 
@@ -98,7 +107,8 @@ public:
     Fp2_model squared() const;
     Fp2_model inverse() const;
     Fp2_model Frobenius_map(unsigned long power) const;
-    /// HAS TO BE A SQUARE (else does not terminate)
+    /// HAS TO BE A SQUARE (else the result is unspecified). See also
+    /// field_sqrt_if_square.
     Fp2_model sqrt() const;
     Fp2_model squared_karatsuba() const;
     Fp2_model squared_complex() const;
@@ -152,6 +162,18 @@ Fp2_model<n, modulus> Fp2_model<n, modulus>::nqr;
 template<mp_size_t n, const bigint<n> &modulus>
 Fp2_model<n, modulus> Fp2_model<n, modulus>::nqr_to_t;
 
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> Fp2_model<n, modulus>::half;
+
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> Fp2_model<n, modulus>::non_residue_inverse;
+
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> Fp2_model<n, modulus>::sqrt_minus_non_residue;
+
+template<mp_size_t n, const bigint<n> &modulus>
+Fp_model<n, modulus> Fp2_model<n, modulus>::sqrt_minus_non_residue_inverse;
+
 template<mp_size_t n, const bigint<n> &modulus>
 Fp_model<n, modulus> Fp2_model<n, modulus>::Frobenius_coeffs_c1[2];
 
@@ -101,7 +101,8 @@ public:
     Fp3_model squared() const;
     Fp3_model inverse() const;
     Fp3_model Frobenius_map(unsigned long power) const;
-    /// HAS TO BE A SQUARE (else does not terminate)
+    /// HAS TO BE A SQUARE (else the result is unspecified). See also
+    /// field_sqrt_if_square.
     Fp3_model sqrt() const;
 
     template<mp_size_t m> Fp3_model operator^(const bigint<m> &other) const;
@@ -68,6 +68,50 @@ template<typename FieldT> void test_sqrt()
         FieldT asq = a.squared();
         ASSERT_TRUE(asq.sqrt() == a || asq.sqrt() == -a);
     }
+
+    // Squares, non-squares, zero, and elements of the base field (which are
+    // all squares in even degree extensions).
+    using BaseFieldT = typename FieldT::my_Fp;
+    FieldT root;
+    ASSERT_TRUE(field_sqrt_if_square(FieldT::zero(), root));
+    ASSERT_EQ(FieldT::zero(), root);
+    for (size_t i = 0; i < 100; ++i) {
+        const FieldT a = FieldT::random_element();
+        const FieldT values[] = {
+            a.squared(),
+            FieldT::nqr * a.squared(),
+            BaseFieldT::random_element() * FieldT::one()};
+        for (const FieldT &v : values) {
+            if (field_sqrt_if_square(v, root)) {
+                ASSERT_TRUE(field_is_square(v));
+                ASSERT_EQ(v, root.squared());
+            } else {
+                ASSERT_FALSE(field_is_square(v));
+            }
+        }
+        ASSERT_TRUE(field_sqrt_if_square(values[0], root));
+        ASSERT_TRUE(root == a || root == -a);
+        ASSERT_FALSE(field_sqrt_if_square(values[1], root));
+
+        // The root may be written to the input.
+        root = values[0];
+        ASSERT_TRUE(field_sqrt_if_square(root, root));
+        ASSERT_EQ(values[0], root.squared());
+    }
+}
+
+template<typename FieldT> void test_is_square()
+{
+    const FieldT nqr = FieldT::nqr;
+    ASSERT_TRUE(field_is_square(FieldT::zero()));
+    ASSERT_TRUE(field_is_square(FieldT::one()));
+    ASSERT_FALSE(field_is_square(nqr));
+
+    for (size_t i = 0; i < 500; ++i) {
+        const FieldT a = FieldT::random_element().squared();
+        ASSERT_TRUE(field_is_square(a));
+        ASSERT_FALSE(field_is_square(nqr * a));
+    }
 }
 
 template<typename FieldT> void test_two_squarings()
@@ -424,6 +468,39 @@ void test_field_serialization_config()
     ASSERT_EQ(a, a_dec);
     ASSERT_EQ(b, b_dec);
     ASSERT_EQ(c, c_dec);
+
+    // Raw buffer encoding must match the stream encoding.
+    std::vector<char> raw(buffer.size());
+    size_t offset = 0;
+    offset += field_encode<Enc, Form>(a, &raw[offset], raw.size() - offset);
+    offset += field_encode<Enc, Form>(b, &raw[offset], raw.size() - offset);
+    offset += field_encode<Enc, Form>(c, &raw[offset], raw.size() - offset);
+    ASSERT_EQ(buffer.size(), offset);
+    ASSERT_EQ(buffer, std::string(raw.begin(), raw.end()));
+    ASSERT_THROW(
+        (field_encode<Enc, Form>(a, raw.data(), raw.size() - offset)),
+        std::runtime_error);
+
+    FieldT a_raw_dec;
+    FieldT b_raw_dec;
+    FieldT c_raw_dec;
+    offset = 0;
+    offset += field_decode<Enc, Form>(a_raw_dec, &raw[offset], raw.size());
+    offset +=
+        field_decode<Enc, Form>(b_raw_dec, &raw[offset], raw.size() - offset);
+    offset +=
+        field_decode<Enc, Form>(c_raw_dec, &raw[offset], raw.size() - offset);
+    ASSERT_EQ(raw.size(), offset);
+    ASSERT_EQ(a, a_raw_dec);
+    ASSERT_EQ(b, b_raw_dec);
+    ASSERT_EQ(c, c_raw_dec);
+    ASSERT_THROW(
+        (field_decode<Enc, Form>(a_raw_dec, raw.data(), 1)),
+        std::runtime_error);
+
+    if (Enc == encoding_binary) {
+        ASSERT_EQ(3 * field_binary_size<FieldT>(), raw.size());
+    }
 }
 
 template<typename FieldT> void test_field_serialization_all_configs()
@@ -520,6 +597,22 @@ TEST(FieldsTest, BigInt)
     ASSERT_EQ(c, c_2);
     bigint_from_hex(d_2, d_hex_p);
     ASSERT_EQ(d, d_2);
+
+    // Compile-time construction from hex literals
+    constexpr bigint<4> a_3 = bigint<4>::from_hex("0");
+    constexpr bigint<4> b_3 =
+        bigint<4>::from_hex("3a0c92075c0dbf3b8acbc5f96ce3f0ad2");
+    constexpr bigint<4> d_3 = bigint<4>::from_hex(
+        "00000000000000000000000000000002F050FE938943ACC45F65568000000000");
+    static_assert((b_3.data[0] & 0xffffffff) == 0xce3f0ad2, "from_hex");
+    ASSERT_EQ(a, a_3);
+    ASSERT_EQ(b, b_3);
+    ASSERT_EQ(c, bigint<4>::from_hex("1"));
+    ASSERT_EQ(d, d_3);
+    ASSERT_THROW(bigint<4>::from_hex("12g"), std::invalid_argument);
+    ASSERT_THROW(
+        bigint<1>::from_hex("1000000000000000000000000000000000"),
+        std::invalid_argument);
 }
 
 TEST(FieldsTest, Edwards)
@@ -536,6 +629,8 @@ TEST(FieldsTest, MNT4)
     test_serialization<mnt4_pp>();
     test_all_fields<mnt4_pp>();
     test_Fp4_tom_cook<mnt4_Fq4>();
+    test_is_square<mnt4_Fq>();
+    test_is_square<mnt4_Fq2>();
     test_two_squarings<Fqe<mnt4_pp>>();
     test_cyclotomic_squaring<Fqk<mnt4_pp>>();
 }
@@ -545,6 +640,7 @@ TEST(FieldsTest, MNT6)
     mnt6_pp::init_public_params();
     test_serialization<mnt6_pp>();
     test_all_fields<mnt6_pp>();
+    test_is_square<mnt6_Fq3>();
     test_cyclotomic_squaring<Fqk<mnt6_pp>>();
 }
 
@@ -592,4 +688,6 @@ TEST(FieldsTest, BLS12_381)
     test_all_fields<bls12_381_pp>();
     test_Fp12_2over3over2_mul_by_024<bls12_381_Fq12>();
     test_signed_digits<bls12_381_Fr>();
+    test_is_square<bls12_381_Fq>();
+    test_is_square<bls12_381_Fq2>();
 }
@@ -0,0 +1,130 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_HPP__
+#define __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_HPP__
+
+#include "libff/algebra/fft/ntt.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace libff
+{
+
+/// Polynomials over FieldT in dense coefficient form, where p[i] is the
+/// coefficient of X^i. Trailing zero coefficients are permitted, and the zero
+/// polynomial may be represented by an empty vector. Unless stated otherwise,
+/// functions returning polynomials remove trailing zero coefficients. Work is
+/// distributed across threads if MULTICORE is enabled.
+///
+/// The evaluation form of a polynomial of degree less than n is the vector of
+/// its evaluations at g * omega^i, i = 0, ..., n-1, where omega is the
+/// generator of ntt_domain<FieldT>(n) and g is either 1 or the generator of a
+/// coset.
+template<typename FieldT> using polynomial = std::vector<FieldT>;
+
+/// Remove trailing zero coefficients.
+template<typename FieldT> void polynomial_trim(polynomial<FieldT> &p);
+
+template<typename FieldT> bool polynomial_is_zero(const polynomial<FieldT> &p);
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_add(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b);
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_subtract(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b);
+
+/// Product of two polynomials. Small products use schoolbook
+/// multiplication, otherwise the operands are transformed using
+/// ntt_domain. Throws std::invalid_argument if FieldT has no root of unity
+/// of sufficient order for the product.
+template<typename FieldT>
+polynomial<FieldT> polynomial_multiply(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b);
+
+/// As above, using the given domain, whose size must be at least the number
+/// of coefficients of the product.
+template<typename FieldT>
+polynomial<FieldT> polynomial_multiply(
+    const polynomial<FieldT> &a,
+    const polynomial<FieldT> &b,
+    const ntt_domain<FieldT> &domain);
+
+/// Evaluation form of p over the given domain (or over the coset g * domain).
+/// Throws std::invalid_argument if p has too many coefficients for the
+/// domain.
+template<typename FieldT>
+std::vector<FieldT> polynomial_to_evaluations(
+    const polynomial<FieldT> &p, const ntt_domain<FieldT> &domain);
+
+template<typename FieldT>
+std::vector<FieldT> polynomial_to_coset_evaluations(
+    const polynomial<FieldT> &p,
+    const ntt_domain<FieldT> &domain,
+    const FieldT &g = FieldT::multiplicative_generator);
+
+/// Interpolate the polynomial from its evaluation form over the given domain
+/// (or over the coset g * domain).
+template<typename FieldT>
+polynomial<FieldT> polynomial_from_evaluations(
+    std::vector<FieldT> evaluations, const ntt_domain<FieldT> &domain);
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_from_coset_evaluations(
+    std::vector<FieldT> evaluations,
+    const ntt_domain<FieldT> &domain,
+    const FieldT &g = FieldT::multiplicative_generator);
+
+/// Compute quotient and remainder such that p = quotient * (X^n - 1) +
+/// remainder, where remainder has degree less than n. Requires O(p.size())
+/// operations.
+template<typename FieldT>
+void polynomial_divide_by_vanishing(
+    const polynomial<FieldT> &p,
+    const size_t n,
+    polynomial<FieldT> &quotient,
+    polynomial<FieldT> &remainder);
+
+/// Divide (in place) the evaluations of a polynomial at g * omega^i (for the
+/// generator omega of ntt_domain<FieldT>(m), where m =
+/// coset_evaluations.size()) by the evaluations of X^n - 1. n must divide m,
+/// in which case only m/n distinct inversions are required. Throws
+/// std::invalid_argument if X^n - 1 vanishes at any point of the coset.
+template<typename FieldT>
+void polynomial_evaluations_divide_by_vanishing(
+    std::vector<FieldT> &coset_evaluations,
+    const size_t n,
+    const FieldT &g = FieldT::multiplicative_generator);
+
+/// Compute quotient such that p = quotient * (X - z) + p(z), returning p(z).
+template<typename FieldT>
+FieldT polynomial_divide_by_linear(
+    const polynomial<FieldT> &p, const FieldT &z, polynomial<FieldT> &quotient);
+
+/// Evaluate p at x using Horner's rule.
+template<typename FieldT>
+FieldT polynomial_evaluate(const polynomial<FieldT> &p, const FieldT &x);
+
+/// Evaluate p at each of the given points.
+template<typename FieldT>
+std::vector<FieldT> polynomial_evaluate(
+    const polynomial<FieldT> &p, const std::vector<FieldT> &points);
+
+/// Evaluate each of the given polynomials at x.
+template<typename FieldT>
+std::vector<FieldT> polynomial_batch_evaluate(
+    const std::vector<polynomial<FieldT>> &polynomials, const FieldT &x);
+
+} // namespace libff
+
+#include "libff/algebra/polynomials/polynomial.tcc"
+
+#endif // __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_HPP__
@@ -0,0 +1,457 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_TCC__
+#define __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_TCC__
+
+#include "libff/algebra/fields/field_utils.hpp"
+#include "libff/algebra/polynomials/polynomial.hpp"
+#include "libff/common/parallel.hpp"
+#include "libff/common/utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace libff
+{
+
+namespace internal
+{
+
+/// Products where either operand has at most this many coefficients use
+/// schoolbook multiplication.
+static const size_t POLYNOMIAL_SCHOOLBOOK_THRESHOLD = 32;
+
+/// Minimum number of coefficients per chunk, for operations which are split
+/// into chunks processed in parallel.
+static const size_t POLYNOMIAL_MIN_CHUNK_SIZE = 1 << 12;
+
+/// Number of chunks to use when processing num_elements in parallel. Used
+/// for operations that add work per chunk, so there is at most one chunk per
+/// thread.
+inline size_t polynomial_num_chunks(const size_t num_elements)
+{
+    return std::max<size_t>(
+        1,
+        std::min(
+            parallel_num_threads(), num_elements / POLYNOMIAL_MIN_CHUNK_SIZE));
+}
+
+/// Number of coefficients, excluding trailing zeros.
+template<typename FieldT>
+size_t polynomial_trimmed_size(const polynomial<FieldT> &p)
+{
+    size_t size = p.size();
+    while (size > 0 && p[size - 1].is_zero()) {
+        --size;
+    }
+    return size;
+}
+
+/// a - b if subtract is set, otherwise a + b.
+template<typename FieldT>
+polynomial<FieldT> polynomial_add_or_subtract(
+    const polynomial<FieldT> &a,
+    const polynomial<FieldT> &b,
+    const bool subtract)
+{
+    const size_t a_size = a.size();
+    const size_t b_size = b.size();
+    polynomial<FieldT> result(std::max(a_size, b_size));
+    parallel_for(0, result.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (i >= b_size) {
+                result[i] = a[i];
+            } else if (i >= a_size) {
+                result[i] = subtract ? -b[i] : b[i];
+            } else {
+                result[i] = subtract ? a[i] - b[i] : a[i] + b[i];
+            }
+        }
+    });
+
+    polynomial_trim(result);
+    return result;
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_multiply_schoolbook(
+    const polynomial<FieldT> &a,
+    const size_t a_size,
+    const polynomial<FieldT> &b,
+    const size_t b_size)
+{
+    polynomial<FieldT> result(a_size + b_size - 1);
+    // Each iteration computes a single output coefficient.
+    parallel_for(0, result.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k) {
+            const size_t i_begin = (k < b_size) ? 0 : k - b_size + 1;
+            const size_t i_end = std::min(k + 1, a_size);
+            FieldT sum = FieldT::zero();
+            for (size_t i = i_begin; i < i_end; ++i) {
+                sum += a[i] * b[k - i];
+            }
+            result[k] = sum;
+        }
+    });
+
+    return result;
+}
+
+/// Evaluate the polynomial with coefficients coeffs[begin], ...,
+/// coeffs[end-1] at x, using Horner's rule.
+template<typename FieldT>
+FieldT polynomial_horner(
+    const polynomial<FieldT> &coeffs,
+    const size_t begin,
+    const size_t end,
+    const FieldT &x)
+{
+    FieldT result = FieldT::zero();
+    for (size_t i = end; i > begin; --i) {
+        result = result * x + coeffs[i - 1];
+    }
+    return result;
+}
+
+/// Copy p into a vector of size domain.size(), padding with zeros.
+template<typename FieldT>
+std::vector<FieldT> polynomial_pad_to_domain(
+    const polynomial<FieldT> &p,
+    const size_t size,
+    const ntt_domain<FieldT> &domain)
+{
+    if (size > domain.size()) {
+        throw std::invalid_argument("polynomial too large for domain");
+    }
+
+    std::vector<FieldT> result(domain.size(), FieldT::zero());
+    std::copy(p.begin(), p.begin() + size, result.begin());
+    return result;
+}
+
+} // namespace internal
+
+template<typename FieldT> void polynomial_trim(polynomial<FieldT> &p)
+{
+    p.resize(internal::polynomial_trimmed_size(p));
+}
+
+template<typename FieldT> bool polynomial_is_zero(const polynomial<FieldT> &p)
+{
+    return internal::polynomial_trimmed_size(p) == 0;
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_add(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b)
+{
+    return internal::polynomial_add_or_subtract(a, b, false);
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_subtract(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b)
+{
+    return internal::polynomial_add_or_subtract(a, b, true);
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_multiply(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b)
+{
+    const size_t a_size = internal::polynomial_trimmed_size(a);
+    const size_t b_size = internal::polynomial_trimmed_size(b);
+    if (a_size == 0 || b_size == 0) {
+        return polynomial<FieldT>();
+    }
+
+    if (std::min(a_size, b_size) <= internal::POLYNOMIAL_SCHOOLBOOK_THRESHOLD) {
+        return internal::polynomial_multiply_schoolbook(a, a_size, b, b_size);
+    }
+
+    const size_t result_size = a_size + b_size - 1;
+    const ntt_domain<FieldT> domain((size_t)1 << log2(result_size));
+    return polynomial_multiply(a, b, domain);
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_multiply(
+    const polynomial<FieldT> &a,
+    const polynomial<FieldT> &b,
+    const ntt_domain<FieldT> &domain)
+{
+    const size_t a_size = internal::polynomial_trimmed_size(a);
+    const size_t b_size = internal::polynomial_trimmed_size(b);
+    if (a_size == 0 || b_size == 0) {
+        return polynomial<FieldT>();
+    }
+
+    const size_t result_size = a_size + b_size - 1;
+    if (result_size > domain.size()) {
+        throw std::invalid_argument("domain too small for product");
+    }
+
+    // Evaluations are only used pointwise, so bit-reversed order is
+    // sufficient.
+    std::vector<FieldT> a_evals =
+        internal::polynomial_pad_to_domain(a, a_size, domain);
+    std::vector<FieldT> b_evals =
+        internal::polynomial_pad_to_domain(b, b_size, domain);
+    std::vector<FieldT> scratch;
+    domain.fft_bit_reversed(a_evals, scratch);
+    domain.fft_bit_reversed(b_evals, scratch);
+    parallel_for(0, a_evals.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            a_evals[i] *= b_evals[i];
+        }
+    });
+    domain.ifft_bit_reversed(a_evals, scratch);
+
+    a_evals.resize(result_size);
+    polynomial_trim(a_evals);
+    return a_evals;
+}
+
+template<typename FieldT>
+std::vector<FieldT> polynomial_to_evaluations(
+    const polynomial<FieldT> &p, const ntt_domain<FieldT> &domain)
+{
+    std::vector<FieldT> evaluations = internal::polynomial_pad_to_domain(
+        p, internal::polynomial_trimmed_size(p), domain);
+    domain.fft(evaluations);
+    return evaluations;
+}
+
+template<typename FieldT>
+std::vector<FieldT> polynomial_to_coset_evaluations(
+    const polynomial<FieldT> &p,
+    const ntt_domain<FieldT> &domain,
+    const FieldT &g)
+{
+    std::vector<FieldT> evaluations = internal::polynomial_pad_to_domain(
+        p, internal::polynomial_trimmed_size(p), domain);
+    domain.coset_fft(evaluations, g);
+    return evaluations;
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_from_evaluations(
+    std::vector<FieldT> evaluations, const ntt_domain<FieldT> &domain)
+{
+    domain.ifft(evaluations);
+    polynomial_trim(evaluations);
+    return evaluations;
+}
+
+template<typename FieldT>
+polynomial<FieldT> polynomial_from_coset_evaluations(
+    std::vector<FieldT> evaluations,
+    const ntt_domain<FieldT> &domain,
+    const FieldT &g)
+{
+    domain.icoset_fft(evaluations, g);
+    polynomial_trim(evaluations);
+    return evaluations;
+}
+
+// With p = q * (X^n - 1) + r, coefficients satisfy p_i = q_{i-n} - q_i + r_i
+// (where out-of-range terms are zero), so q_{i-n} = p_i + q_i for i >= n and
+// r_i = p_i + q_i for i < n. Each residue class of indices modulo n is an
+// independent recurrence, processed from the highest index down.
+template<typename FieldT>
+void polynomial_divide_by_vanishing(
+    const polynomial<FieldT> &p,
+    const size_t n,
+    polynomial<FieldT> &quotient,
+    polynomial<FieldT> &remainder)
+{
+    if (n == 0) {
+        throw std::invalid_argument(
+            "vanishing polynomial must have positive degree");
+    }
+
+    const size_t p_size = internal::polynomial_trimmed_size(p);
+    quotient.assign(p_size > n ? p_size - n : 0, FieldT::zero());
+    remainder.assign(std::min(p_size, n), FieldT::zero());
+
+    parallel_for(0, remainder.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            FieldT q_i = FieldT::zero();
+            // Highest index i < p_size with i = j mod n
+            size_t i = j + ((p_size - 1 - j) / n) * n;
+            for (; i >= n; i -= n) {
+                q_i += p[i];
+                quotient[i - n] = q_i;
+            }
+            remainder[j] = p[j] + q_i;
+        }
+    });
+
+    polynomial_trim(quotient);
+    polynomial_trim(remainder);
+}
+
+template<typename FieldT>
+void polynomial_evaluations_divide_by_vanishing(
+    std::vector<FieldT> &coset_evaluations, const size_t n, const FieldT &g)
+{
+    const size_t m = coset_evaluations.size();
+    if (n == 0 || m % n != 0) {
+        throw std::invalid_argument("n must divide the number of evaluations");
+    }
+
+    // (g * omega_m^i)^n - 1 = g^n * omega_k^i - 1, for omega_k = omega_m^n of
+    // order k = m / n.
+    const size_t k = m / n;
+    const FieldT omega_k = get_root_of_unity<FieldT>(k);
+    std::vector<FieldT> inverses(k);
+    FieldT g_n_omega_k_i = g ^ (unsigned long)n;
+    for (size_t i = 0; i < k; ++i) {
+        inverses[i] = g_n_omega_k_i - FieldT::one();
+        if (inverses[i].is_zero()) {
+            throw std::invalid_argument(
+                "vanishing polynomial is zero on the coset");
+        }
+        g_n_omega_k_i *= omega_k;
+    }
+    batch_invert(inverses);
+
+    parallel_for(0, m, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            coset_evaluations[i] *= inverses[i % k];
+        }
+    });
+}
+
+// Synthetic division: with s_{size-1} = p_{size-1} and s_i = p_i + z * s_{i+1},
+// quotient_{i-1} = s_i and p(z) = s_0. To process chunks [begin, end) in
+// parallel, each chunk first computes s'_i assuming s_end = 0. The true values
+// are then s_i = s'_i + z^{end-i} * s_end, where the values s_end at chunk
+// boundaries are computed sequentially.
+template<typename FieldT>
+FieldT polynomial_divide_by_linear(
+    const polynomial<FieldT> &p, const FieldT &z, polynomial<FieldT> &quotient)
+{
+    const size_t p_size = internal::polynomial_trimmed_size(p);
+    if (p_size == 0) {
+        quotient.clear();
+        return FieldT::zero();
+    }
+
+    // s_i is stored in s[i], for 0 <= i < p_size.
+    std::vector<FieldT> s(p_size);
+    const size_t num_chunks = internal::polynomial_num_chunks(p_size);
+    const size_t chunk_size = (p_size + num_chunks - 1) / num_chunks;
+
+    parallel_for(0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+        for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(begin + chunk_size, p_size);
+            FieldT s_i = FieldT::zero();
+            for (size_t i = end; i > begin; --i) {
+                s_i = p[i - 1] + z * s_i;
+                s[i - 1] = s_i;
+            }
+        }
+    });
+
+    if (num_chunks > 1) {
+        // s_end for each chunk (zero for the highest chunk).
+        std::vector<FieldT> s_end(num_chunks, FieldT::zero());
+        for (size_t chunk = num_chunks - 1; chunk > 0; --chunk) {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(begin + chunk_size, p_size);
+            s_end[chunk - 1] =
+                s[begin] + (z ^ (unsigned long)(end - begin)) * s_end[chunk];
+        }
+
+        parallel_for(
+            0,
+            num_chunks - 1,
+            1,
+            [&](size_t chunks_begin, size_t chunks_end) {
+                for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+                    const size_t begin = chunk * chunk_size;
+                    const size_t end = std::min(begin + chunk_size, p_size);
+                    FieldT correction = s_end[chunk];
+                    for (size_t i = end; i > begin; --i) {
+                        correction *= z;
+                        s[i - 1] += correction;
+                    }
+                }
+            });
+    }
+
+    const FieldT result = s[0];
+    quotient.assign(s.begin() + 1, s.end());
+    polynomial_trim(quotient);
+    return result;
+}
+
+// Each chunk [begin, end) is evaluated using Horner's rule, and the results
+// are combined as sum_chunk x^begin * result_chunk.
+template<typename FieldT>
+FieldT polynomial_evaluate(const polynomial<FieldT> &p, const FieldT &x)
+{
+    const size_t p_size = p.size();
+    const size_t num_chunks = internal::polynomial_num_chunks(p_size);
+    const size_t chunk_size = (p_size + num_chunks - 1) / num_chunks;
+    std::vector<FieldT> chunk_results(num_chunks);
+
+    parallel_for(0, num_chunks, 1, [&](size_t chunks_begin, size_t chunks_end) {
+        for (size_t chunk = chunks_begin; chunk < chunks_end; ++chunk) {
+            const size_t begin = std::min(chunk * chunk_size, p_size);
+            const size_t end = std::min(begin + chunk_size, p_size);
+            chunk_results[chunk] =
+                internal::polynomial_horner(p, begin, end, x);
+        }
+    });
+
+    const FieldT x_chunk_size = x ^ (unsigned long)chunk_size;
+    FieldT result = FieldT::zero();
+    for (size_t chunk = num_chunks; chunk > 0; --chunk) {
+        result = result * x_chunk_size + chunk_results[chunk - 1];
+    }
+
+    return result;
+}
+
+template<typename FieldT>
+std::vector<FieldT> polynomial_evaluate(
+    const polynomial<FieldT> &p, const std::vector<FieldT> &points)
+{
+    std::vector<FieldT> evaluations(points.size());
+    parallel_for(0, points.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            evaluations[j] =
+                internal::polynomial_horner(p, 0, p.size(), points[j]);
+        }
+    });
+
+    return evaluations;
+}
+
+template<typename FieldT>
+std::vector<FieldT> polynomial_batch_evaluate(
+    const std::vector<polynomial<FieldT>> &polynomials, const FieldT &x)
+{
+    std::vector<FieldT> evaluations(polynomials.size());
+    parallel_for(0, polynomials.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            const polynomial<FieldT> &p = polynomials[j];
+            evaluations[j] = internal::polynomial_horner(p, 0, p.size(), x);
+        }
+    });
+
+    return evaluations;
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_POLYNOMIALS_POLYNOMIAL_TCC__
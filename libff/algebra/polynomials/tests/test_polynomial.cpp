@@ -0,0 +1,265 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#include "libff/algebra/polynomials/polynomial.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace libff;
+
+namespace
+{
+
+template<typename FieldT>
+polynomial<FieldT> random_polynomial(const size_t num_coefficients)
+{
+    polynomial<FieldT> p(num_coefficients);
+    for (FieldT &c : p) {
+        c = FieldT::random_element();
+    }
+    return p;
+}
+
+template<typename FieldT>
+FieldT evaluate_naive(const polynomial<FieldT> &p, const FieldT &x)
+{
+    FieldT result = FieldT::zero();
+    FieldT x_i = FieldT::one();
+    for (const FieldT &c : p) {
+        result += c * x_i;
+        x_i *= x;
+    }
+    return result;
+}
+
+template<typename FieldT>
+polynomial<FieldT> multiply_naive(
+    const polynomial<FieldT> &a, const polynomial<FieldT> &b)
+{
+    polynomial<FieldT> result(a.size() + b.size() - 1, FieldT::zero());
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t j = 0; j < b.size(); ++j) {
+            result[i + j] += a[i] * b[j];
+        }
+    }
+    return result;
+}
+
+// X^n - 1
+template<typename FieldT> polynomial<FieldT> vanishing_polynomial(size_t n)
+{
+    polynomial<FieldT> z(n + 1, FieldT::zero());
+    z[0] = -FieldT::one();
+    z[n] = FieldT::one();
+    return z;
+}
+
+template<typename FieldT> void test_polynomial_add_subtract()
+{
+    const polynomial<FieldT> a = random_polynomial<FieldT>(7);
+    const polynomial<FieldT> b = random_polynomial<FieldT>(12);
+    const FieldT x = FieldT::random_element();
+
+    ASSERT_EQ(
+        evaluate_naive(a, x) + evaluate_naive(b, x),
+        evaluate_naive(polynomial_add(a, b), x));
+    ASSERT_EQ(
+        evaluate_naive(a, x) - evaluate_naive(b, x),
+        evaluate_naive(polynomial_subtract(a, b), x));
+    ASSERT_EQ(
+        evaluate_naive(b, x) - evaluate_naive(a, x),
+        evaluate_naive(polynomial_subtract(b, a), x));
+
+    // Cancellation removes trailing zeros
+    ASSERT_TRUE(polynomial_subtract(a, a).empty());
+    polynomial<FieldT> a_padded = a;
+    a_padded.resize(20, FieldT::zero());
+    ASSERT_FALSE(polynomial_is_zero(a_padded));
+    polynomial_trim(a_padded);
+    ASSERT_EQ(a, a_padded);
+    ASSERT_TRUE(polynomial_is_zero(polynomial<FieldT>(5, FieldT::zero())));
+}
+
+template<typename FieldT> void test_polynomial_multiply()
+{
+    const size_t sizes[][2] = {
+        {1, 1}, {1, 40}, {3, 5}, {32, 100}, {33, 33}, {64, 64}, {100, 257}};
+    for (const auto &size : sizes) {
+        const polynomial<FieldT> a = random_polynomial<FieldT>(size[0]);
+        const polynomial<FieldT> b = random_polynomial<FieldT>(size[1]);
+        const polynomial<FieldT> expect = multiply_naive(a, b);
+        ASSERT_EQ(expect, polynomial_multiply(a, b));
+        ASSERT_EQ(expect, polynomial_multiply(b, a));
+    }
+
+    // Trailing zeros in the operands, and an explicit (larger) domain.
+    polynomial<FieldT> a = random_polynomial<FieldT>(50);
+    polynomial<FieldT> b = random_polynomial<FieldT>(70);
+    const polynomial<FieldT> expect = multiply_naive(a, b);
+    a.resize(80, FieldT::zero());
+    b.resize(90, FieldT::zero());
+    ASSERT_EQ(expect, polynomial_multiply(a, b));
+    ASSERT_EQ(expect, polynomial_multiply(a, b, ntt_domain<FieldT>(256)));
+    ASSERT_THROW(
+        polynomial_multiply(a, b, ntt_domain<FieldT>(64)),
+        std::invalid_argument);
+
+    ASSERT_TRUE(polynomial_multiply(a, polynomial<FieldT>()).empty());
+    ASSERT_TRUE(
+        polynomial_multiply(a, polynomial<FieldT>(3, FieldT::zero())).empty());
+}
+
+template<typename FieldT> void test_polynomial_evaluations()
+{
+    const ntt_domain<FieldT> domain(64);
+    const polynomial<FieldT> p = random_polynomial<FieldT>(50);
+    const FieldT g = FieldT::random_element();
+
+    const std::vector<FieldT> evals = polynomial_to_evaluations(p, domain);
+    const std::vector<FieldT> coset_evals =
+        polynomial_to_coset_evaluations(p, domain, g);
+    FieldT x = FieldT::one();
+    for (size_t i = 0; i < domain.size(); ++i) {
+        ASSERT_EQ(evaluate_naive(p, x), evals[i]);
+        ASSERT_EQ(evaluate_naive(p, g * x), coset_evals[i]);
+        x *= domain.omega();
+    }
+
+    ASSERT_EQ(p, polynomial_from_evaluations(evals, domain));
+    ASSERT_EQ(p, polynomial_from_coset_evaluations(coset_evals, domain, g));
+
+    ASSERT_THROW(
+        polynomial_to_evaluations(random_polynomial<FieldT>(65), domain),
+        std::invalid_argument);
+}
+
+template<typename FieldT> void test_polynomial_divide_by_vanishing()
+{
+    const size_t cases[][2] = {{100, 16}, {16, 16}, {10, 16}, {17, 1}};
+    for (const auto &c : cases) {
+        const polynomial<FieldT> p = random_polynomial<FieldT>(c[0]);
+        const size_t n = c[1];
+
+        polynomial<FieldT> quotient;
+        polynomial<FieldT> remainder;
+        polynomial_divide_by_vanishing(p, n, quotient, remainder);
+        ASSERT_LE(remainder.size(), n);
+        ASSERT_EQ(
+            p,
+            polynomial_add(
+                multiply_naive(quotient, vanishing_polynomial<FieldT>(n)),
+                remainder));
+    }
+
+    // Exact division, in coefficient and evaluation form.
+    const size_t n = 32;
+    const polynomial<FieldT> q = random_polynomial<FieldT>(3 * n - 1);
+    const polynomial<FieldT> p =
+        multiply_naive(q, vanishing_polynomial<FieldT>(n));
+
+    polynomial<FieldT> quotient;
+    polynomial<FieldT> remainder;
+    polynomial_divide_by_vanishing(p, n, quotient, remainder);
+    ASSERT_EQ(q, quotient);
+    ASSERT_TRUE(remainder.empty());
+
+    const ntt_domain<FieldT> domain(4 * n);
+    std::vector<FieldT> evals = polynomial_to_coset_evaluations(p, domain);
+    polynomial_evaluations_divide_by_vanishing(evals, n);
+    ASSERT_EQ(q, polynomial_from_coset_evaluations(evals, domain));
+
+    // X^n - 1 vanishes on the domain itself.
+    evals = polynomial_to_evaluations(p, domain);
+    ASSERT_THROW(
+        polynomial_evaluations_divide_by_vanishing(evals, n, FieldT::one()),
+        std::invalid_argument);
+}
+
+template<typename FieldT> void test_polynomial_divide_by_linear()
+{
+    // Include sizes that are split into several chunks when multiple threads
+    // are available.
+    for (const size_t size : {1, 2, 50, 20000}) {
+        const polynomial<FieldT> p = random_polynomial<FieldT>(size);
+        const FieldT z = FieldT::random_element();
+
+        polynomial<FieldT> quotient;
+        const FieldT p_z = polynomial_divide_by_linear(p, z, quotient);
+        ASSERT_EQ(evaluate_naive(p, z), p_z);
+        ASSERT_EQ(size - 1, quotient.size());
+
+        // Check p(x) = quotient(x) * (x - z) + p(z) at a random point.
+        const FieldT x = FieldT::random_element();
+        ASSERT_EQ(
+            evaluate_naive(p, x),
+            polynomial_evaluate(quotient, x) * (x - z) + p_z);
+    }
+
+    polynomial<FieldT> quotient;
+    ASSERT_EQ(
+        FieldT::zero(),
+        polynomial_divide_by_linear(
+            polynomial<FieldT>(), FieldT::random_element(), quotient));
+    ASSERT_TRUE(quotient.empty());
+}
+
+template<typename FieldT> void test_polynomial_evaluate()
+{
+    for (const size_t size : {0, 1, 33, 20000}) {
+        const polynomial<FieldT> p = random_polynomial<FieldT>(size);
+        const FieldT x = FieldT::random_element();
+        ASSERT_EQ(evaluate_naive(p, x), polynomial_evaluate(p, x));
+    }
+
+    const polynomial<FieldT> p = random_polynomial<FieldT>(100);
+    const std::vector<FieldT> points = random_polynomial<FieldT>(20);
+    const std::vector<FieldT> evals = polynomial_evaluate(p, points);
+    ASSERT_EQ(points.size(), evals.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        ASSERT_EQ(evaluate_naive(p, points[i]), evals[i]);
+    }
+
+    std::vector<polynomial<FieldT>> polynomials;
+    for (size_t i = 0; i < 10; ++i) {
+        polynomials.push_back(random_polynomial<FieldT>(10 * i));
+    }
+    const FieldT x = FieldT::random_element();
+    const std::vector<FieldT> batch_evals =
+        polynomial_batch_evaluate(polynomials, x);
+    ASSERT_EQ(polynomials.size(), batch_evals.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        ASSERT_EQ(evaluate_naive(polynomials[i], x), batch_evals[i]);
+    }
+}
+
+template<typename FieldT> void test_polynomial()
+{
+    test_polynomial_add_subtract<FieldT>();
+    test_polynomial_multiply<FieldT>();
+    test_polynomial_evaluations<FieldT>();
+    test_polynomial_divide_by_vanishing<FieldT>();
+    test_polynomial_divide_by_linear<FieldT>();
+    test_polynomial_evaluate<FieldT>();
+}
+
+TEST(PolynomialTest, ALT_BN128)
+{
+    alt_bn128_pp::init_public_params();
+    test_polynomial<alt_bn128_Fr>();
+}
+
+TEST(PolynomialTest, BLS12_381)
+{
+    bls12_381_pp::init_public_params();
+    test_polynomial<bls12_381_Fr>();
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_HPP__
+#define __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_HPP__
+
+#include <cstddef>
+#include <vector>
+
+namespace libff
+{
+
+/// Precomputed table for scalar multiplication of a fixed base point B.
+///
+/// Scalars are decomposed into signed digits d_i of `window` bits (see
+/// field_get_signed_digits), so that:
+///
+///   s * B = \sum_i d_i * (2^{window * i} * B)
+///
+/// For each digit index i, the table holds the multiples
+///
+///   j * 2^{window * i} * B, for j = 1, ..., 2^{window - 1}
+///
+/// in special form. A scalar multiplication then requires no doublings, and
+/// at most one mixed addition per digit (negative digits use the negation of
+/// the table entry).
+template<typename GroupT> class fixed_base_table
+{
+public:
+    using scalar_field = typename GroupT::scalar_field;
+
+    /// The window size used for the tables of the group generators.
+#ifdef LOWMEM
+    static const size_t default_window = 6;
+#else
+    static const size_t default_window = 8;
+#endif
+
+    fixed_base_table(const GroupT &base, const size_t window = default_window);
+
+    GroupT mul(const scalar_field &scalar) const;
+
+    /// Multiply the base by each of the given scalars (in parallel if
+    /// MULTICORE is enabled).
+    std::vector<GroupT> batch_mul(
+        const std::vector<scalar_field> &scalars) const;
+
+    size_t window() const;
+    size_t num_digits() const;
+
+    /// A process-wide table for GroupT::one(), built on first use. Must not
+    /// be called before the curve parameters have been initialized.
+    static const fixed_base_table<GroupT> &generator();
+
+protected:
+    const GroupT &entry(const size_t digit_idx, const size_t multiple) const;
+
+    size_t _window;
+    size_t _num_digits;
+    size_t _row_size;
+    std::vector<GroupT> _table;
+};
+
+/// Compute scalar * GroupT::one() using the precomputed generator table.
+template<typename GroupT>
+GroupT mul_generator(const typename GroupT::scalar_field &scalar);
+
+/// Compute scalars[i] * GroupT::one(), for each i, using the precomputed
+/// generator table.
+template<typename GroupT>
+std::vector<GroupT> batch_mul_generator(
+    const std::vector<typename GroupT::scalar_field> &scalars);
+
+} // namespace libff
+
+#include "libff/algebra/scalar_multiplication/fixed_base.tcc"
+
+#endif // __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_HPP__
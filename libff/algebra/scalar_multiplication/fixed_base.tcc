@@ -0,0 +1,132 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_TCC__
+#define __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_TCC__
+
+#include "libff/algebra/fields/field_utils.hpp"
+#include "libff/algebra/scalar_multiplication/fixed_base.hpp"
+#include "libff/common/parallel.hpp"
+
+#include <cassert>
+
+namespace libff
+{
+
+template<typename GroupT> const size_t fixed_base_table<GroupT>::default_window;
+
+template<typename GroupT>
+fixed_base_table<GroupT>::fixed_base_table(
+    const GroupT &base, const size_t window)
+    : _window(window)
+    , _num_digits(field_get_num_signed_digits<scalar_field>(window))
+    , _row_size(1ull << (window - 1))
+{
+    assert(window > 1);
+    assert(!base.is_zero());
+
+    // The first entry of each row is 2^{window * i} * B. These are computed
+    // sequentially, after which the rows can be filled independently.
+    _table.resize(_num_digits * _row_size);
+    GroupT row_base = base;
+    for (size_t i = 0; i < _num_digits; ++i) {
+        _table[i * _row_size] = row_base;
+        for (size_t j = 0; j < _window; ++j) {
+            row_base = row_base.dbl();
+        }
+    }
+
+    parallel_for(0, _num_digits, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            GroupT *row = &_table[i * _row_size];
+            for (size_t j = 1; j < _row_size; ++j) {
+                row[j] = row[j - 1] + row[0];
+            }
+        }
+    });
+
+    // Since B has prime order, no entry of the table is zero.
+    GroupT::batch_to_special_all_non_zeros(_table);
+}
+
+template<typename GroupT>
+GroupT fixed_base_table<GroupT>::mul(const scalar_field &scalar) const
+{
+    std::vector<ssize_t> digits(_num_digits);
+    field_get_signed_digits(digits, scalar, _window, _num_digits);
+
+    GroupT result = GroupT::zero();
+    for (size_t i = 0; i < _num_digits; ++i) {
+        const ssize_t digit = digits[i];
+        if (digit > 0) {
+            result = result.mixed_add(entry(i, digit));
+        } else if (digit < 0) {
+            result = result.mixed_add(-entry(i, -digit));
+        }
+    }
+
+    return result;
+}
+
+template<typename GroupT>
+std::vector<GroupT> fixed_base_table<GroupT>::batch_mul(
+    const std::vector<scalar_field> &scalars) const
+{
+    std::vector<GroupT> result(scalars.size());
+
+    parallel_for(0, scalars.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            result[i] = mul(scalars[i]);
+        }
+    });
+
+    return result;
+}
+
+template<typename GroupT> size_t fixed_base_table<GroupT>::window() const
+{
+    return _window;
+}
+
+template<typename GroupT> size_t fixed_base_table<GroupT>::num_digits() const
+{
+    return _num_digits;
+}
+
+template<typename GroupT>
+const fixed_base_table<GroupT> &fixed_base_table<GroupT>::generator()
+{
+    // Initialization of function-local statics is thread-safe in C++11.
+    static const fixed_base_table<GroupT> table(GroupT::one());
+    return table;
+}
+
+template<typename GroupT>
+const GroupT &fixed_base_table<GroupT>::entry(
+    const size_t digit_idx, const size_t multiple) const
+{
+    assert(multiple > 0 && multiple <= _row_size);
+    return _table[digit_idx * _row_size + multiple - 1];
+}
+
+template<typename GroupT>
+GroupT mul_generator(const typename GroupT::scalar_field &scalar)
+{
+    return fixed_base_table<GroupT>::generator().mul(scalar);
+}
+
+template<typename GroupT>
+std::vector<GroupT> batch_mul_generator(
+    const std::vector<typename GroupT::scalar_field> &scalars)
+{
+    return fixed_base_table<GroupT>::generator().batch_mul(scalars);
+}
+
+} // namespace libff
+
+#endif // __LIBFF_ALGEBRA_SCALAR_MULTIPLICATION_FIXED_BASE_TCC__
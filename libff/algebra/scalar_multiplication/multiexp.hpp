@@ -13,6 +13,10 @@
 #define MULTIEXP_HPP_
 
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <libff/common/numa.hpp>
+#include <type_traits>
 #include <vector>
 
 namespace libff
@@ -39,6 +43,14 @@ enum multi_exp_method {
     multi_exp_method_BDLO12,
     /// Similar to multi_exp_method_BDLO12, but using signed digits.
     multi_exp_method_BDLO12_signed,
+    /// Straus' method, with interleaved wNAF representations of the scalars.
+    /// A table of odd multiples is computed for each base, and all doublings
+    /// are shared between the terms. Efficient for small numbers of terms
+    /// (up to a few hundred).
+    multi_exp_method_straus,
+    /// Select one of the methods above, based on the number of terms and the
+    /// group (see multi_exp_select_method).
+    multi_exp_method_auto,
 };
 
 /// Form of base elements passed to multi_exp routines.
@@ -50,16 +62,166 @@ enum multi_exp_base_form {
     multi_exp_base_form_special,
 };
 
+namespace internal
+{
+
+/// Temporary storage for a single multi_exp_inner call (see
+/// multi_exp_workspace). Each accessor resizes a buffer to the given size and
+/// returns it. The contents of the buffer are unspecified (they may hold
+/// values from a previous call), and its capacity is retained, so that the
+/// buffer is only reallocated if it must grow. New storage is advised to use
+/// huge pages (see advise_huge_pages). The returned reference remains valid
+/// until release() is called.
+template<typename GroupT, typename FieldT> class multi_exp_arena
+{
+public:
+    using BigInt =
+        typename std::decay<decltype(((FieldT *)nullptr)->mont_repr)>::type;
+
+    /// Scalars in bigint form.
+    std::vector<BigInt> &bigints(const size_t size);
+
+    /// Indices of terms.
+    std::vector<size_t> &indices(const size_t size);
+
+    /// Digits of scalars (e.g. wNAF digits).
+    std::vector<long> &digits(const size_t size);
+
+    /// Group elements (e.g. buckets), and their associated flags. set_idx
+    /// selects one of several independent sets, so that a method may hold
+    /// several sets of buckets at once.
+    std::vector<GroupT> &buckets(const size_t set_idx, const size_t size);
+    std::vector<bool> &bucket_hit(const size_t set_idx, const size_t size);
+
+    /// Total size of the buffers held by the arena.
+    size_t num_bytes() const;
+
+    /// Free all buffers.
+    void release();
+
+protected:
+    std::vector<BigInt> _bigints;
+    std::vector<size_t> _indices;
+    std::vector<long> _digits;
+    // Sets are held in deques, so that adding a set does not invalidate
+    // references to existing sets.
+    std::deque<std::vector<GroupT>> _buckets;
+    std::deque<std::vector<bool>> _bucket_hit;
+};
+
+} // namespace internal
+
+/// Temporary storage for multi_exp, which callers can keep between calls to
+/// avoid reallocating (and re-faulting) the scalar, bucket and digit buffers
+/// of each call. The workspace holds one arena per chunk, so that chunks
+/// processed concurrently never share buffers. Each buffer is sized by the
+/// method on first use, and grows as required. A workspace must not be used
+/// by more than one multi_exp call at a time.
+template<typename GroupT, typename FieldT> class multi_exp_workspace
+{
+public:
+    /// Ensure that the workspace holds (at least) num_chunks arenas.
+    void reserve(const size_t num_chunks);
+
+    /// The arena for the given chunk (chunk_idx < the reserved number of
+    /// chunks).
+    internal::multi_exp_arena<GroupT, FieldT> &arena(const size_t chunk_idx);
+
+    /// Total size of the buffers held by all arenas.
+    size_t num_bytes() const;
+
+    /// Free all buffers.
+    void release();
+
+protected:
+    std::vector<internal::multi_exp_arena<GroupT, FieldT>> _arenas;
+};
+
+/// Scalars converted once to the forms used by multi_exp, so that several
+/// multi-exponentiations over the same scalars (for example, in G1 and G2)
+/// do not each repeat the conversion. Holds the bigint form of each scalar
+/// (computing which requires a Montgomery reduction) and, if digit_size is
+/// not 0, the signed digits of each scalar used by
+/// multi_exp_method_BDLO12_signed (which otherwise recomputes digits in every
+/// round). When digits are present, BDLO12_signed uses digit_size in place of
+/// its own choice of c. To match that choice, use
+///   bdlo12_signed_optimal_c(num_entries / chunks).
+template<typename FieldT> class prepared_scalars
+{
+public:
+    using BigInt =
+        typename std::decay<decltype(((FieldT *)nullptr)->mont_repr)>::type;
+
+    prepared_scalars();
+
+    /// Convert the scalars [scalar_start, scalar_end) (in parallel).
+    prepared_scalars(
+        typename std::vector<FieldT>::const_iterator scalar_start,
+        typename std::vector<FieldT>::const_iterator scalar_end,
+        const size_t digit_size = 0);
+
+    /// The given entries of this object (in the order given), without
+    /// repeating any conversion.
+    prepared_scalars<FieldT> subset(const std::vector<size_t> &indices) const;
+
+    size_t size() const;
+
+    /// Maximum number of bits of the scalars.
+    size_t num_bits() const;
+
+    const std::vector<BigInt> &bigints() const;
+
+    /// Size (in bits) of the signed digits, or 0 if there are no digits.
+    size_t digit_size() const;
+
+    /// Number of signed digits of each scalar, sufficient for num_bits() + 2
+    /// bits (to accomodate overflow and a negative final digit).
+    size_t num_digits() const;
+
+    /// The digit_idx-th signed digits of all scalars (size() entries).
+    const int32_t *signed_digits(const size_t digit_idx) const;
+
+protected:
+    std::vector<BigInt> _bigints;
+    size_t _num_bits;
+    size_t _digit_size;
+    size_t _num_digits;
+    // Ordered by digit index, then by scalar, so that each round of
+    // BDLO12_signed reads its digits sequentially.
+    std::vector<int32_t> _digits;
+};
+
 /// Optimal value of digit size (commonly refered to as c here) for
 /// BDLO12-style algorithms which use signed digits. In general, this is used
 /// internally by the routines here, but is useful externally in some cases
 /// (for example where precomputing must be performed).
 static inline size_t bdlo12_signed_optimal_c(size_t num_entries);
 
+/// The method used by multi_exp_method_auto for a given number of terms (per
+/// chunk) in GroupT. One of multi_exp_method_straus,
+/// multi_exp_method_bos_coster or multi_exp_method_BDLO12_signed. The
+/// thresholds between methods depend on the cost of operations in GroupT
+/// (see the implementation).
+template<typename GroupT>
+multi_exp_method multi_exp_select_method(const size_t num_entries);
+
 /// Computes the sum:
 ///   \sum_i scalar_start[i] * vec_start[i]
 /// using the selected method. Input is split into the given number of chunks,
-/// and processed in parallel.
+/// and processed in parallel (see parallel_reduce).
+template<
+    typename T,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks);
+
+/// As above, using (and retaining) temporary storage in the given workspace.
 template<
     typename T,
     typename FieldT,
@@ -70,11 +232,60 @@ T multi_exp(
     typename std::vector<T>::const_iterator vec_end,
     typename std::vector<FieldT>::const_iterator scalar_start,
     typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks,
+    multi_exp_workspace<T, FieldT> &workspace);
+
+/// As multi_exp, using scalars converted in advance (see prepared_scalars).
+/// scalars.size() must equal the number of base elements.
+template<
+    typename T,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
     const size_t chunks);
 
+/// As above, using (and retaining) temporary storage in the given workspace.
+template<
+    typename T,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t chunks,
+    multi_exp_workspace<T, FieldT> &workspace);
+
+/// Number of scalars in each class, as partitioned by
+/// multi_exp_filter_one_zero.
+struct multi_exp_filter_stats {
+    /// Zero scalars (skipped).
+    size_t num_zero = 0;
+    /// Scalars equal to 1 (base elements added directly).
+    size_t num_one = 0;
+    /// Scalars +/-s, for 1 < s <= multi_exp_filter_max_small (or s = 1 with
+    /// negative sign), accumulated in buckets.
+    size_t num_small = 0;
+    /// Remaining scalars, processed by multi_exp.
+    size_t num_other = 0;
+};
+
+/// Largest absolute value of scalars handled by the small-scalar path of
+/// multi_exp_filter_one_zero.
+const size_t multi_exp_filter_max_small = 256;
+
 /// A variant of multi_exp which includes special pre-processing step to skip
-/// zeros, and directly sum base elements with factor 1. Remaining values are
-/// processed as usual via multi_exp.
+/// zeros, and directly sum base elements with factor 1. Base elements whose
+/// scalars are small integers (or their negations, see
+/// multi_exp_filter_max_small) are accumulated in buckets, using one addition
+/// per element. Remaining values are processed as usual via multi_exp,
+/// reading base elements in-place via a list of their indices. If stats is
+/// not null, it is populated with the number of scalars in each class.
 template<
     typename T,
     typename FieldT,
@@ -85,8 +296,73 @@ T multi_exp_filter_one_zero(
     typename std::vector<T>::const_iterator vec_end,
     typename std::vector<FieldT>::const_iterator scalar_start,
     typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks,
+    multi_exp_filter_stats *stats = nullptr);
+
+/// As above, using scalars converted in advance (see prepared_scalars).
+template<
+    typename T,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp_filter_one_zero(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t chunks,
+    multi_exp_filter_stats *stats = nullptr);
+
+/// A variant of multi_exp for scalars known to be small, given as unsigned
+/// integers of at most num_bits bits (1 <= num_bits <= 64), such as values
+/// subject to range checks or lookup tables. The scalars are used directly
+/// (without conversion to field elements or bigints), and the number of
+/// rounds and the window size of the bucket method are chosen based on
+/// num_bits rather than the size of the scalar field. FieldT only determines
+/// the type of the (internal or given) workspace, and defaults to the scalar
+/// field of T.
+template<
+    typename T,
+    typename FieldT = typename T::scalar_field,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp_small(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    std::vector<uint64_t>::const_iterator scalar_start,
+    std::vector<uint64_t>::const_iterator scalar_end,
+    const size_t num_bits,
     const size_t chunks);
 
+/// As above, using (and retaining) temporary storage in the given workspace.
+template<
+    typename T,
+    typename FieldT = typename T::scalar_field,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp_small(
+    typename std::vector<T>::const_iterator vec_start,
+    typename std::vector<T>::const_iterator vec_end,
+    std::vector<uint64_t>::const_iterator scalar_start,
+    std::vector<uint64_t>::const_iterator scalar_end,
+    const size_t num_bits,
+    const size_t chunks,
+    multi_exp_workspace<T, FieldT> &workspace);
+
+/// A variant of multi_exp for base elements partitioned over NUMA nodes. The
+/// terms of each partition are split between threads_per_node tasks (or
+/// numa_node_num_threads(node) if threads_per_node is 0), executed by the
+/// workers pinned to the node which owns the partition (see
+/// numa_run_on_all_nodes), so that base elements are always read from local
+/// memory. Scalars are not partitioned.
+template<
+    typename T,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm = multi_exp_base_form_normal>
+T multi_exp_numa(
+    const numa_partitioned_vector<T> &bases,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t threads_per_node = 0);
+
 /// A convenience function for calculating a pure inner product, where the more
 /// complicated methods are not required.
 template<typename T>
@@ -138,6 +414,8 @@ std::vector<T> batch_exp_with_coeff(
     const FieldT &coeff,
     const std::vector<FieldT> &v);
 
+/// Convert all elements of vec to special form, using one field inversion per
+/// range of (up to) 1024 elements. Ranges are converted in parallel.
 template<typename T> void batch_to_special(std::vector<T> &vec);
 
 } // namespace libff
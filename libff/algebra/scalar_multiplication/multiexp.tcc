@@ -22,6 +22,7 @@
 #include <libff/algebra/scalar_multiplication/multiexp.hpp>
 #include <libff/algebra/scalar_multiplication/wnaf.hpp>
 #include <libff/common/concurrent_fifo.hpp>
+#include <libff/common/parallel.hpp>
 #include <libff/common/profiling.hpp>
 #include <libff/common/utils.hpp>
 #include <type_traits>
@@ -124,6 +125,108 @@ GroupT multiexp_accumulate_buckets(
     return sum;
 }
 
+/// Resize a buffer of a multi_exp_arena. See multi_exp_arena.
+template<typename T>
+std::vector<T> &multi_exp_arena_resize(
+    std::vector<T> &buffer, const size_t size)
+{
+    if (size > buffer.capacity()) {
+        // The contents need not be preserved, so free the old storage first.
+        // Advise the use of huge pages before the new storage is written.
+        std::vector<T>().swap(buffer);
+        buffer.reserve(size);
+        advise_huge_pages(buffer.data(), size * sizeof(T));
+    }
+    buffer.resize(size);
+    return buffer;
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<typename multi_exp_arena<GroupT, FieldT>::BigInt> &multi_exp_arena<
+    GroupT,
+    FieldT>::bigints(const size_t size)
+{
+    return multi_exp_arena_resize(_bigints, size);
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<size_t> &multi_exp_arena<GroupT, FieldT>::indices(
+    const size_t size)
+{
+    return multi_exp_arena_resize(_indices, size);
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<long> &multi_exp_arena<GroupT, FieldT>::digits(const size_t size)
+{
+    return multi_exp_arena_resize(_digits, size);
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<GroupT> &multi_exp_arena<GroupT, FieldT>::buckets(
+    const size_t set_idx, const size_t size)
+{
+    if (set_idx >= _buckets.size()) {
+        _buckets.resize(set_idx + 1);
+    }
+    return multi_exp_arena_resize(_buckets[set_idx], size);
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<bool> &multi_exp_arena<GroupT, FieldT>::bucket_hit(
+    const size_t set_idx, const size_t size)
+{
+    if (set_idx >= _bucket_hit.size()) {
+        _bucket_hit.resize(set_idx + 1);
+    }
+    // Flags are small (one bit per bucket), and are not advised.
+    _bucket_hit[set_idx].resize(size);
+    return _bucket_hit[set_idx];
+}
+
+template<typename GroupT, typename FieldT>
+size_t multi_exp_arena<GroupT, FieldT>::num_bytes() const
+{
+    size_t num_bytes = _bigints.capacity() * sizeof(BigInt) +
+                       _indices.capacity() * sizeof(size_t) +
+                       _digits.capacity() * sizeof(long);
+    for (const std::vector<GroupT> &buckets : _buckets) {
+        num_bytes += buckets.capacity() * sizeof(GroupT);
+    }
+    for (const std::vector<bool> &bucket_hit : _bucket_hit) {
+        num_bytes += (bucket_hit.capacity() + 7) / 8;
+    }
+    return num_bytes;
+}
+
+template<typename GroupT, typename FieldT>
+void multi_exp_arena<GroupT, FieldT>::release()
+{
+    std::vector<BigInt>().swap(_bigints);
+    std::vector<size_t>().swap(_indices);
+    std::vector<long>().swap(_digits);
+    std::deque<std::vector<GroupT>>().swap(_buckets);
+    std::deque<std::vector<bool>>().swap(_bucket_hit);
+}
+
+/// Convert exponents to bigint form, in the bigints buffer of the arena.
+template<typename GroupT, typename FieldT>
+typename std::vector<
+    typename multi_exp_arena<GroupT, FieldT>::BigInt>::const_iterator
+multi_exp_exponents_to_bigints(
+    typename std::vector<FieldT>::const_iterator exponents,
+    typename std::vector<FieldT>::const_iterator exponents_end,
+    multi_exp_arena<GroupT, FieldT> &arena)
+{
+    const size_t num_entries = exponents_end - exponents;
+    std::vector<typename multi_exp_arena<GroupT, FieldT>::BigInt>
+        &bi_exponents = arena.bigints(num_entries);
+    for (size_t i = 0; i < num_entries; ++i) {
+        bi_exponents[i] = exponents[i].as_bigint();
+    }
+    return bi_exponents.begin();
+}
+
 template<mp_size_t n> class ordered_exponent
 {
     // to use std::push_heap and friends later
@@ -138,7 +241,7 @@ public:
 #if defined(__x86_64__) && defined(USE_ASM)
         if (n == 3) {
             long res;
-            __asm__(                                   // Preserve alignment
+            __asm__ volatile(                          // Preserve alignment
                 "// check for overflow           \n\t" //
                 "mov $0, %[res]                  \n\t" //
                 ADD_CMP(16)                            //
@@ -150,11 +253,11 @@ public:
                 "done%=:                         \n\t" //
                 : [res] "=&r"(res)
                 : [A] "r"(other.r.data), [mod] "r"(this->r.data)
-                : "cc", "%rax");
+                : "cc", "memory", "%rax");
             return res;
         } else if (n == 4) {
             long res;
-            __asm__(                                   // Preserve alignment
+            __asm__ volatile(                          // Preserve alignment
                 "// check for overflow           \n\t" //
                 "mov $0, %[res]                  \n\t" //
                 ADD_CMP(24)                            //
@@ -167,11 +270,11 @@ public:
                 "done%=:                         \n\t" //
                 : [res] "=&r"(res)
                 : [A] "r"(other.r.data), [mod] "r"(this->r.data)
-                : "cc", "%rax");
+                : "cc", "memory", "%rax");
             return res;
         } else if (n == 5) {
             long res;
-            __asm__(                                   // Preserve alignment
+            __asm__ volatile(                          // Preserve alignment
                 "// check for overflow           \n\t" //
                 "mov $0, %[res]                  \n\t" //
                 ADD_CMP(32)                            //
@@ -185,7 +288,7 @@ public:
                 "done%=:                         \n\t" //
                 : [res] "=&r"(res)
                 : [A] "r"(other.r.data), [mod] "r"(this->r.data)
-                : "cc", "%rax");
+                : "cc", "memory", "%rax");
             return res;
         } else
 #endif
@@ -201,7 +304,16 @@ public:
 //       typename std::vector<GroupT>::const_iterator bases,
 //       typename std::vector<GroupT>::const_iterator bases_end,
 //       typename std::vector<FieldT>::const_iterator exponents,
-//       typename std::vector<FieldT>::const_iterator exponents_end);
+//       typename std::vector<FieldT>::const_iterator exponents_end,
+//       multi_exp_arena<GroupT, FieldT> &arena);
+// where any temporary storage is taken from arena, and a variant taking
+// exponents already in bigint form:
+//   static GroupT multi_exp_inner_bigint(
+//       typename std::vector<GroupT>::const_iterator bases,
+//       typename std::vector<GroupT>::const_iterator bases_end,
+//       typename std::vector<BigInt>::const_iterator exponents,
+//       multi_exp_arena<GroupT, FieldT> &arena);
+// where BigInt is multi_exp_arena<GroupT, FieldT>::BigInt.
 template<
     typename GroupT,
     typename FieldT,
@@ -216,26 +328,43 @@ template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
 class multi_exp_implementation<GroupT, FieldT, multi_exp_method_naive, BaseForm>
 {
 public:
+    using BigInt = typename multi_exp_arena<GroupT, FieldT>::BigInt;
+
     static GroupT multi_exp_inner(
         typename std::vector<GroupT>::const_iterator vec_start,
         typename std::vector<GroupT>::const_iterator vec_end,
         typename std::vector<FieldT>::const_iterator scalar_start,
-        typename std::vector<FieldT>::const_iterator scalar_end)
+        typename std::vector<FieldT>::const_iterator scalar_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        assert(scalar_end - scalar_start == vec_end - vec_start);
+        return multi_exp_inner_bigint(
+            vec_start,
+            vec_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                scalar_start, scalar_end, arena),
+            arena);
+    }
+
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT vec_start,
+        BasesIterT vec_end,
+        typename std::vector<BigInt>::const_iterator scalar_start,
+        multi_exp_arena<GroupT, FieldT> &arena)
     {
+        UNUSED(arena);
         GroupT result(GroupT::zero());
 
-        typename std::vector<GroupT>::const_iterator vec_it;
-        typename std::vector<FieldT>::const_iterator scalar_it;
+        BasesIterT vec_it;
+        typename std::vector<BigInt>::const_iterator scalar_it;
 
         for (vec_it = vec_start, scalar_it = scalar_start; vec_it != vec_end;
              ++vec_it, ++scalar_it) {
-            bigint<FieldT::num_limbs> scalar_bigint = scalar_it->as_bigint();
             result =
                 result + opt_window_wnaf_exp(
-                             *vec_it, scalar_bigint, scalar_bigint.num_bits());
+                             *vec_it, *scalar_it, scalar_it->num_bits());
         }
-        assert(scalar_it == scalar_end);
-        UNUSED(scalar_end);
 
         return result;
     }
@@ -250,12 +379,16 @@ class multi_exp_implementation<
     BaseForm>
 {
 public:
+    using BigInt = typename multi_exp_arena<GroupT, FieldT>::BigInt;
+
     static GroupT multi_exp_inner(
         typename std::vector<GroupT>::const_iterator vec_start,
         typename std::vector<GroupT>::const_iterator vec_end,
         typename std::vector<FieldT>::const_iterator scalar_start,
-        typename std::vector<FieldT>::const_iterator scalar_end)
+        typename std::vector<FieldT>::const_iterator scalar_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
     {
+        UNUSED(arena);
         GroupT result(GroupT::zero());
 
         typename std::vector<GroupT>::const_iterator vec_it;
@@ -270,6 +403,27 @@ public:
 
         return result;
     }
+
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT vec_start,
+        BasesIterT vec_end,
+        typename std::vector<BigInt>::const_iterator scalar_start,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        UNUSED(arena);
+        GroupT result(GroupT::zero());
+
+        BasesIterT vec_it;
+        typename std::vector<BigInt>::const_iterator scalar_it;
+
+        for (vec_it = vec_start, scalar_it = scalar_start; vec_it != vec_end;
+             ++vec_it, ++scalar_it) {
+            result = result + (*scalar_it) * (*vec_it);
+        }
+
+        return result;
+    }
 };
 
 // multi_exp_implementation for BDLO12
@@ -281,23 +435,36 @@ class multi_exp_implementation<
     BaseForm>
 {
 public:
+    using BigInt = typename multi_exp_arena<GroupT, FieldT>::BigInt;
+
     static GroupT multi_exp_inner(
         typename std::vector<GroupT>::const_iterator bases,
         typename std::vector<GroupT>::const_iterator bases_end,
         typename std::vector<FieldT>::const_iterator exponents,
-        typename std::vector<FieldT>::const_iterator exponents_end)
+        typename std::vector<FieldT>::const_iterator exponents_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        assert(exponents_end - exponents == bases_end - bases);
+        return multi_exp_inner_bigint(
+            bases,
+            bases_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                exponents, exponents_end, arena),
+            arena);
+    }
+
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT bases,
+        BasesIterT bases_end,
+        typename std::vector<BigInt>::const_iterator bi_exponents,
+        multi_exp_arena<GroupT, FieldT> &arena)
     {
-        UNUSED(exponents_end);
         const size_t length = bases_end - bases;
         const size_t c = internal::pippenger_optimal_c(length);
 
-        const mp_size_t exp_num_limbs =
-            std::remove_reference<decltype(*exponents)>::type::num_limbs;
-        std::vector<bigint<exp_num_limbs>> bi_exponents(length);
         size_t num_bits = 0;
-
         for (size_t i = 0; i < length; i++) {
-            bi_exponents[i] = exponents[i].as_bigint();
             num_bits = std::max(num_bits, bi_exponents[i].num_bits());
         }
 
@@ -306,6 +473,10 @@ public:
         GroupT result;
         bool result_nonzero = false;
 
+        // Allocate the round state once, and reuse it.
+        std::vector<GroupT> &buckets = arena.buckets(0, 1 << c);
+        std::vector<bool> &bucket_nonzero = arena.bucket_hit(0, 1 << c);
+
         for (size_t k = num_groups - 1; k <= num_groups; k--) {
             if (result_nonzero) {
                 for (size_t i = 0; i < c; i++) {
@@ -313,8 +484,7 @@ public:
                 }
             }
 
-            std::vector<GroupT> buckets(1 << c);
-            std::vector<bool> bucket_nonzero(1 << c);
+            bucket_nonzero.assign(1 << c, false);
 
             for (size_t i = 0; i < length; i++) {
                 // id = k-th "digit" of bi_exponents[i], radix 2^c
@@ -388,14 +558,33 @@ class multi_exp_implementation<
     BaseForm>
 {
 public:
+    using BigInt = typename multi_exp_arena<GroupT, FieldT>::BigInt;
+
     static GroupT multi_exp_inner(
         typename std::vector<GroupT>::const_iterator vec_start,
         typename std::vector<GroupT>::const_iterator vec_end,
         typename std::vector<FieldT>::const_iterator scalar_start,
-        typename std::vector<FieldT>::const_iterator scalar_end)
+        typename std::vector<FieldT>::const_iterator scalar_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        assert(scalar_end - scalar_start == vec_end - vec_start);
+        return multi_exp_inner_bigint(
+            vec_start,
+            vec_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                scalar_start, scalar_end, arena),
+            arena);
+    }
+
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT vec_start,
+        BasesIterT vec_end,
+        typename std::vector<BigInt>::const_iterator scalar_start,
+        multi_exp_arena<GroupT, FieldT> &arena)
     {
-        const mp_size_t n =
-            std::remove_reference<decltype(*scalar_start)>::type::num_limbs;
+        UNUSED(arena);
+        const mp_size_t n = FieldT::num_limbs;
 
         if (vec_start == vec_end) {
             return GroupT::zero();
@@ -406,24 +595,23 @@ public:
         }
 
         std::vector<ordered_exponent<n>> opt_q;
-        const size_t vec_len = scalar_end - scalar_start;
+        const size_t vec_len = vec_end - vec_start;
         const size_t odd_vec_len = (vec_len % 2 == 1 ? vec_len : vec_len + 1);
         opt_q.reserve(odd_vec_len);
         std::vector<GroupT> g;
         g.reserve(odd_vec_len);
 
-        typename std::vector<GroupT>::const_iterator vec_it;
-        typename std::vector<FieldT>::const_iterator scalar_it;
+        BasesIterT vec_it;
+        typename std::vector<BigInt>::const_iterator scalar_it;
         size_t i;
         for (i = 0, vec_it = vec_start, scalar_it = scalar_start;
              vec_it != vec_end;
              ++vec_it, ++scalar_it, ++i) {
             g.emplace_back(*vec_it);
 
-            opt_q.emplace_back(ordered_exponent<n>(i, scalar_it->as_bigint()));
+            opt_q.emplace_back(ordered_exponent<n>(i, *scalar_it));
         }
         std::make_heap(opt_q.begin(), opt_q.end());
-        assert(scalar_it == scalar_end);
 
         if (vec_len != odd_vec_len) {
             g.emplace_back(GroupT::zero());
@@ -516,9 +704,10 @@ public:
         typename std::decay<decltype(((FieldT *)nullptr)->mont_repr)>::type;
 
     /// buckets and bucket_hit should have at least 2^{c-1} entries.
+    template<typename BasesIterT>
     static GroupT signed_digits_round(
-        typename std::vector<GroupT>::const_iterator bases,
-        typename std::vector<GroupT>::const_iterator bases_end,
+        BasesIterT bases,
+        BasesIterT bases_end,
         typename std::vector<BigInt>::const_iterator exponents,
         std::vector<GroupT> &buckets,
         std::vector<bool> &bucket_hit,
@@ -528,56 +717,46 @@ public:
         const size_t digit_idx)
     {
         UNUSED(bases_end);
-
-        assert(buckets.size() >= num_buckets);
-        assert(bucket_hit.size() >= num_buckets);
-
-        // Zero bucket_hit array.
-        bucket_hit.assign(num_buckets, false);
-
-        // For each scalar, element pair ...
-        size_t non_zero = 0;
-        for (size_t i = 0; i < num_entries; ++i) {
-            const ssize_t digit =
-                field_get_signed_digit(exponents[i], c, digit_idx);
-            if (digit == 0) {
-                continue;
-            }
-
-            multi_exp_add_element_to_bucket_with_signed_digit<GroupT, BaseForm>(
-                buckets, bucket_hit, bases[i], digit);
-            ++non_zero;
-        }
-
-        // Check up-front for the edge-case where no buckets have been touched.
-        if (non_zero == 0) {
-            return GroupT::zero();
-        }
-
-        // TODO: consider converting buckets to special form
-
-        return multiexp_accumulate_buckets<GroupT, multi_exp_base_form_normal>(
-            buckets, bucket_hit, num_buckets);
+        return buckets_round(
+            bases,
+            buckets,
+            bucket_hit,
+            num_entries,
+            num_buckets,
+            [exponents, c, digit_idx](size_t i) {
+                return field_get_signed_digit(exponents[i], c, digit_idx);
+            });
     }
 
     static GroupT multi_exp_inner(
         typename std::vector<GroupT>::const_iterator bases,
         typename std::vector<GroupT>::const_iterator bases_end,
         typename std::vector<FieldT>::const_iterator exponents,
-        typename std::vector<FieldT>::const_iterator exponents_end)
+        typename std::vector<FieldT>::const_iterator exponents_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
     {
-        UNUSED(exponents_end);
+        assert(exponents_end - exponents == bases_end - bases);
+        return multi_exp_inner_bigint(
+            bases,
+            bases_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                exponents, exponents_end, arena),
+            arena);
+    }
 
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT bases,
+        BasesIterT bases_end,
+        typename std::vector<BigInt>::const_iterator bi_exponents,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
         const size_t num_entries = bases_end - bases;
-        assert(exponents_end - exponents == (ssize_t)num_entries);
         const size_t c = bdlo12_signed_optimal_c(num_entries);
         assert(c > 0);
 
-        // Pre-compute the bigint values
         size_t num_bits = 0;
-        std::vector<BigInt> bi_exponents(num_entries);
         for (size_t i = 0; i < num_entries; ++i) {
-            bi_exponents[i] = exponents[i].as_bigint();
             num_bits = std::max(num_bits, bi_exponents[i].num_bits());
         }
 
@@ -592,182 +771,1188 @@ public:
         const size_t num_buckets = 1 << (c - 1);
 
         // Allocate the round state once, and reuse it.
-        std::vector<GroupT> buckets(num_buckets);
-        std::vector<bool> bucket_hit(num_buckets);
+        std::vector<GroupT> &buckets = arena.buckets(0, num_buckets);
+        std::vector<bool> &bucket_hit = arena.bucket_hit(0, num_buckets);
         assert(buckets.size() == num_buckets);
         assert(bucket_hit.size() == num_buckets);
 
-        // Compute from highest-order to lowest-order digits, accumulating at
-        // the same time.
-        GroupT result = signed_digits_round(
-            bases,
-            bases_end,
-            bi_exponents.begin(),
-            buckets,
-            bucket_hit,
-            num_entries,
-            num_buckets,
-            c,
-            num_rounds - 1);
-        for (size_t round_idx = 1; round_idx < num_rounds; ++round_idx) {
-            const size_t digit_idx = num_rounds - 1 - round_idx;
-            for (size_t i = 0; i < c; ++i) {
-                result = result.dbl();
-            }
-
-            const GroupT round_result = signed_digits_round(
+        return accumulate_rounds(num_rounds, c, [&](size_t digit_idx) {
+            return signed_digits_round(
                 bases,
                 bases_end,
-                bi_exponents.begin(),
+                bi_exponents,
                 buckets,
                 bucket_hit,
                 num_entries,
                 num_buckets,
                 c,
                 digit_idx);
-            result = result + round_result;
-        }
+        });
+    }
 
-        return result;
+    /// As multi_exp_inner, using the signed digits precomputed in scalars
+    /// (starting at the entry with index offset), with digit size
+    /// scalars.digit_size().
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_digits(
+        BasesIterT bases,
+        BasesIterT bases_end,
+        const prepared_scalars<FieldT> &scalars,
+        const size_t offset,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        const size_t num_entries = bases_end - bases;
+        assert(offset + num_entries <= scalars.size());
+        const size_t c = scalars.digit_size();
+        assert(c > 0);
+
+        const size_t num_buckets = 1 << (c - 1);
+        std::vector<GroupT> &buckets = arena.buckets(0, num_buckets);
+        std::vector<bool> &bucket_hit = arena.bucket_hit(0, num_buckets);
+
+        return accumulate_rounds(
+            scalars.num_digits(), c, [&](size_t digit_idx) {
+                const int32_t *const digits =
+                    scalars.signed_digits(digit_idx) + offset;
+                return buckets_round(
+                    bases,
+                    buckets,
+                    bucket_hit,
+                    num_entries,
+                    num_buckets,
+                    [digits](size_t i) { return digits[i]; });
+            });
     }
-};
 
-} // namespace internal
+protected:
+    /// Add (or subtract) each base element to (or from) the bucket for its
+    /// signed digit digit_fn(i), and return the weighted sum of the buckets.
+    template<typename BasesIterT, typename DigitFnT>
+    static GroupT buckets_round(
+        BasesIterT bases,
+        std::vector<GroupT> &buckets,
+        std::vector<bool> &bucket_hit,
+        const size_t num_entries,
+        const size_t num_buckets,
+        const DigitFnT &digit_fn)
+    {
+        assert(buckets.size() >= num_buckets);
+        assert(bucket_hit.size() >= num_buckets);
 
-static inline size_t bdlo12_signed_optimal_c(size_t num_entries)
-{
-    // For now, this seems like a good estimate in most cases.
-    return internal::pippenger_optimal_c(num_entries) + 1;
-}
+        // Zero bucket_hit array.
+        bucket_hit.assign(num_buckets, false);
 
-template<
-    typename GroupT,
-    typename FieldT,
-    multi_exp_method Method,
-    multi_exp_base_form BaseForm>
-GroupT multi_exp(
-    typename std::vector<GroupT>::const_iterator vec_start,
-    typename std::vector<GroupT>::const_iterator vec_end,
-    typename std::vector<FieldT>::const_iterator scalar_start,
-    typename std::vector<FieldT>::const_iterator scalar_end,
-    const size_t chunks)
-{
-    const size_t total = vec_end - vec_start;
-    if ((total < chunks) || (chunks == 1)) {
-        // no need to split into "chunks", can call implementation directly
-        return internal::
-            multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
-                multi_exp_inner(vec_start, vec_end, scalar_start, scalar_end);
-    }
+        // For each scalar, element pair ...
+        size_t non_zero = 0;
+        for (size_t i = 0; i < num_entries; ++i) {
+            const ssize_t digit = digit_fn(i);
+            if (digit == 0) {
+                continue;
+            }
 
-    const size_t one = total / chunks;
+            multi_exp_add_element_to_bucket_with_signed_digit<GroupT, BaseForm>(
+                buckets, bucket_hit, bases[i], digit);
+            ++non_zero;
+        }
+
+        // Check up-front for the edge-case where no buckets have been touched.
+        if (non_zero == 0) {
+            return GroupT::zero();
+        }
 
-    std::vector<GroupT> partial(chunks, GroupT::zero());
+        // TODO: consider converting buckets to special form
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < chunks; ++i) {
-        partial[i] = internal::
-            multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
-                multi_exp_inner(
-                    vec_start + i * one,
-                    (i == chunks - 1) ? vec_end : (vec_start + (i + 1) * one),
-                    scalar_start + i * one,
-                    (i == chunks - 1) ? scalar_end
-                                      : (scalar_start + (i + 1) * one));
+        return multiexp_accumulate_buckets<GroupT, multi_exp_base_form_normal>(
+            buckets, bucket_hit, num_buckets);
     }
 
-    GroupT final = GroupT::zero();
+    /// Combine the results round_fn(digit_idx) of num_rounds rounds of c-bit
+    /// digits, computing from highest-order to lowest-order digits.
+    template<typename RoundFnT>
+    static GroupT accumulate_rounds(
+        const size_t num_rounds, const size_t c, const RoundFnT &round_fn)
+    {
+        GroupT result = round_fn(num_rounds - 1);
+        for (size_t round_idx = 1; round_idx < num_rounds; ++round_idx) {
+            const size_t digit_idx = num_rounds - 1 - round_idx;
+            for (size_t i = 0; i < c; ++i) {
+                result = result.dbl();
+            }
+
+            const GroupT round_result = round_fn(digit_idx);
+            result = result + round_result;
+        }
+
+        return result;
+    }
+};
 
-    for (size_t i = 0; i < chunks; ++i) {
-        final = final + partial[i];
+/// Window size for the interleaved wNAF (Straus) method, chosen to minimize
+/// the number of additions per term: approximately num_bits / (w + 1) for
+/// the wNAF digits, plus 2^{w-1} to compute the table of odd multiples.
+inline size_t straus_optimal_window(const size_t num_bits)
+{
+    size_t best_window = 1;
+    size_t best_cost = num_bits / 2 + 1;
+    for (size_t w = 2; w < 8; ++w) {
+        const size_t cost = num_bits / (w + 1) + (1ul << (w - 1));
+        if (cost < best_cost) {
+            best_window = w;
+            best_cost = cost;
+        }
     }
 
-    return final;
+    return best_window;
 }
 
-template<
-    typename GroupT,
-    typename FieldT,
-    multi_exp_method Method,
-    multi_exp_base_form BaseForm>
-GroupT multi_exp_filter_one_zero(
-    typename std::vector<GroupT>::const_iterator vec_start,
-    typename std::vector<GroupT>::const_iterator vec_end,
-    typename std::vector<FieldT>::const_iterator scalar_start,
-    typename std::vector<FieldT>::const_iterator scalar_end,
-    const size_t chunks)
+// multi_exp_implementation for interleaved wNAF (Straus)
+template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
+class multi_exp_implementation<
+    GroupT,
+    FieldT,
+    multi_exp_method_straus,
+    BaseForm>
 {
-    assert(
-        std::distance(vec_start, vec_end) ==
-        std::distance(scalar_start, scalar_end));
-    UNUSED(vec_end);
-    enter_block("Process scalar vector");
-    auto value_it = vec_start;
-    auto scalar_it = scalar_start;
-
-    std::vector<FieldT> p;
-    std::vector<GroupT> g;
+public:
+    using BigInt =
+        typename std::decay<decltype(((FieldT *)nullptr)->mont_repr)>::type;
 
-    GroupT acc = GroupT::zero();
+    static GroupT multi_exp_inner(
+        typename std::vector<GroupT>::const_iterator bases,
+        typename std::vector<GroupT>::const_iterator bases_end,
+        typename std::vector<FieldT>::const_iterator exponents,
+        typename std::vector<FieldT>::const_iterator exponents_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        assert(exponents_end - exponents == bases_end - bases);
+        return multi_exp_inner_bigint(
+            bases,
+            bases_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                exponents, exponents_end, arena),
+            arena);
+    }
 
-    size_t num_skip = 0;
-    size_t num_add = 0;
-    size_t num_other = 0;
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT bases,
+        BasesIterT bases_end,
+        typename std::vector<BigInt>::const_iterator bi_exponents,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        const size_t length = bases_end - bases;
 
-    for (; scalar_it != scalar_end; ++scalar_it, ++value_it) {
-        if (scalar_it->is_zero()) {
-            // do nothing
-            ++num_skip;
-        } else if (*scalar_it == FieldT::one()) {
-            if (BaseForm == multi_exp_base_form_special) {
-                acc = acc.mixed_add(*value_it);
-            } else {
-                acc = acc + (*value_it);
+        // Zero terms are skipped entirely. The indices of the remaining terms
+        // are collected.
+        std::vector<size_t> &indices = arena.indices(length);
+        size_t num_terms = 0;
+        size_t num_bits = 0;
+        for (size_t i = 0; i < length; ++i) {
+            if (bases[i].is_zero() || bi_exponents[i].is_zero()) {
+                continue;
             }
-            ++num_add;
-        } else {
-            p.emplace_back(*scalar_it);
-            g.emplace_back(*value_it);
-            ++num_other;
-        }
-    }
-
-    print_indent();
-    printf(
-        "* Elements of w skipped: %zu (%0.2f%%)\n",
-        num_skip,
-        100. * num_skip / (num_skip + num_add + num_other));
-    print_indent();
-    printf(
-        "* Elements of w processed with special addition: %zu (%0.2f%%)\n",
-        num_add,
-        100. * num_add / (num_skip + num_add + num_other));
-    print_indent();
-    printf(
-        "* Elements of w remaining: %zu (%0.2f%%)\n",
-        num_other,
-        100. * num_other / (num_skip + num_add + num_other));
 
-    leave_block("Process scalar vector");
+            indices[num_terms] = i;
+            num_bits = std::max(num_bits, bi_exponents[i].num_bits());
+            ++num_terms;
+        }
 
-    return acc + multi_exp<GroupT, FieldT, Method, BaseForm>(
-                     g.begin(), g.end(), p.begin(), p.end(), chunks);
-}
+        if (num_terms == 0) {
+            return GroupT::zero();
+        }
 
-template<typename T>
-T inner_product(
-    typename std::vector<T>::const_iterator a_start,
-    typename std::vector<T>::const_iterator a_end,
-    typename std::vector<T>::const_iterator b_start,
-    typename std::vector<T>::const_iterator b_end)
-{
-    return multi_exp<T, T, multi_exp_method_naive_plain>(
-        a_start, a_end, b_start, b_end, 1);
-}
+        // Compute the odd multiples B, 3B, ..., (2^w - 1)B of each base.
+        const size_t window = straus_optimal_window(num_bits);
+        const size_t table_size = 1ul << (window - 1);
+        std::vector<GroupT> &tables =
+            arena.buckets(0, num_terms * table_size);
+        bool all_non_zero = true;
+        for (size_t i = 0; i < num_terms; ++i) {
+            const GroupT &base = bases[indices[i]];
+            const GroupT dbl = base.dbl();
+            GroupT *const table = &tables[i * table_size];
+            table[0] = base;
+            for (size_t j = 1; j < table_size; ++j) {
+                table[j] = table[j - 1] + dbl;
+                all_non_zero = all_non_zero && !table[j].is_zero();
+            }
+        }
 
-template<typename T> size_t get_exp_window_size(const size_t num_scalars)
+        // Convert to special form (unless some base has small order), so that
+        // the main loop can use mixed addition.
+        if (all_non_zero) {
+            GroupT::batch_to_special_all_non_zeros(tables);
+        }
+
+        // wNAF digits for each scalar. find_wnaf_digits requires space for
+        // max_bits + 1 digits. Digits above the length of the wNAF of each
+        // scalar must be zero.
+        const size_t stride = bi_exponents[0].max_bits() + 1;
+        std::vector<long> &digits = arena.digits(num_terms * stride);
+        std::fill(digits.begin(), digits.end(), 0);
+        size_t num_digits = 0;
+        for (size_t i = 0; i < num_terms; ++i) {
+            num_digits = std::max(
+                num_digits,
+                find_wnaf_digits(
+                    &digits[i * stride], window, bi_exponents[indices[i]]));
+        }
+
+        // Process all digit positions from the highest order, sharing the
+        // doublings across all terms.
+        GroupT result = GroupT::zero();
+        bool result_nonzero = false;
+        for (size_t digit_idx = num_digits - 1; digit_idx < num_digits;
+             --digit_idx) {
+            if (result_nonzero) {
+                result = result.dbl();
+            }
+
+            for (size_t i = 0; i < num_terms; ++i) {
+                const long digit = digits[i * stride + digit_idx];
+                if (digit == 0) {
+                    continue;
+                }
+
+                const GroupT &entry =
+                    tables[i * table_size + std::abs(digit) / 2];
+                const GroupT addend = (digit > 0) ? entry : -entry;
+                if (all_non_zero) {
+                    result = result.mixed_add(addend);
+                } else {
+                    result = result + addend;
+                }
+                result_nonzero = true;
+            }
+        }
+
+        return result;
+    }
+};
+
+// multi_exp_implementation which selects a method at runtime
+template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
+class multi_exp_implementation<
+    GroupT,
+    FieldT,
+    multi_exp_method_auto,
+    BaseForm>
+{
+public:
+    using BigInt = typename multi_exp_arena<GroupT, FieldT>::BigInt;
+
+    static GroupT multi_exp_inner(
+        typename std::vector<GroupT>::const_iterator bases,
+        typename std::vector<GroupT>::const_iterator bases_end,
+        typename std::vector<FieldT>::const_iterator exponents,
+        typename std::vector<FieldT>::const_iterator exponents_end,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        assert(exponents_end - exponents == bases_end - bases);
+        return multi_exp_inner_bigint(
+            bases,
+            bases_end,
+            multi_exp_exponents_to_bigints<GroupT, FieldT>(
+                exponents, exponents_end, arena),
+            arena);
+    }
+
+    template<typename BasesIterT>
+    static GroupT multi_exp_inner_bigint(
+        BasesIterT bases,
+        BasesIterT bases_end,
+        typename std::vector<BigInt>::const_iterator exponents,
+        multi_exp_arena<GroupT, FieldT> &arena)
+    {
+        switch (multi_exp_select_method<GroupT>(bases_end - bases)) {
+        case multi_exp_method_straus:
+            return multi_exp_implementation<
+                GroupT,
+                FieldT,
+                multi_exp_method_straus,
+                BaseForm>::
+                multi_exp_inner_bigint(bases, bases_end, exponents, arena);
+        case multi_exp_method_bos_coster:
+            return multi_exp_implementation<
+                GroupT,
+                FieldT,
+                multi_exp_method_bos_coster,
+                BaseForm>::
+                multi_exp_inner_bigint(bases, bases_end, exponents, arena);
+        default:
+            return multi_exp_implementation<
+                GroupT,
+                FieldT,
+                multi_exp_method_BDLO12_signed,
+                BaseForm>::
+                multi_exp_inner_bigint(bases, bases_end, exponents, arena);
+        }
+    }
+};
+
+/// Compute the multi-exponentiation of [bases, bases_end) with the prepared
+/// scalars starting at index offset. Precomputed signed digits (if any) are
+/// used whenever the BDLO12_signed method is selected.
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm,
+    typename BasesIterT>
+GroupT multi_exp_inner_prepared(
+    BasesIterT bases,
+    BasesIterT bases_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t offset,
+    multi_exp_arena<GroupT, FieldT> &arena)
+{
+    const multi_exp_method method =
+        (Method == multi_exp_method_auto)
+            ? multi_exp_select_method<GroupT>(bases_end - bases)
+            : Method;
+    if (method == multi_exp_method_BDLO12_signed &&
+        scalars.digit_size() != 0) {
+        return multi_exp_implementation<
+            GroupT,
+            FieldT,
+            multi_exp_method_BDLO12_signed,
+            BaseForm>::
+            multi_exp_inner_digits(bases, bases_end, scalars, offset, arena);
+    }
+
+    return multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
+        multi_exp_inner_bigint(
+            bases, bases_end, scalars.bigints().begin() + offset, arena);
+}
+
+/// Split the terms [0, total) into the given number of chunks, and sum the
+/// results of inner_fn(begin, end, arena) for each chunk, using the arena of
+/// the chunk. Chunks are processed as separate tasks, so that threads which
+/// complete cheaper chunks can steal remaining ones.
+template<typename GroupT, typename FieldT, typename InnerFnT>
+GroupT multi_exp_chunks(
+    const size_t total,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, FieldT> &workspace,
+    const InnerFnT &inner_fn)
+{
+    if ((total < chunks) || (chunks == 1)) {
+        // no need to split into "chunks", can call implementation directly
+        workspace.reserve(1);
+        return inner_fn(0, total, workspace.arena(0));
+    }
+
+    const size_t one = total / chunks;
+
+    // With a grain size of 1, each call to the map function processes a
+    // single chunk.
+    workspace.reserve(chunks);
+    return parallel_reduce(
+        0,
+        chunks,
+        1,
+        GroupT::zero(),
+        [&](size_t i, size_t) {
+            const size_t end = (i == chunks - 1) ? total : (i + 1) * one;
+            return inner_fn(i * one, end, workspace.arena(i));
+        },
+        [](const GroupT &a, const GroupT &b) { return a + b; });
+}
+
+/// Window size for multi_exp_small, minimizing the approximate cost of
+/// ceil(num_bits / c) rounds, each requiring one addition per entry and
+/// about 2 * 2^c additions to accumulate the buckets.
+inline size_t multi_exp_small_optimal_c(
+    const size_t num_entries, const size_t num_bits)
+{
+    // Limit the window (and hence the number of buckets) for very large
+    // numbers of entries.
+    const size_t max_c = std::min<size_t>(num_bits, 20);
+    size_t best_c = 1;
+    size_t best_cost = num_bits * (num_entries + 2);
+    for (size_t c = 2; c <= max_c; ++c) {
+        const size_t num_rounds = (num_bits + c - 1) / c;
+        const size_t cost = num_rounds * (num_entries + 2 * (1ul << c));
+        if (cost < best_cost) {
+            best_c = c;
+            best_cost = cost;
+        }
+    }
+
+    return best_c;
+}
+
+/// Bucket method for multi_exp_small, using unsigned c-bit digits of the
+/// num_bits-bit scalars.
+template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
+GroupT multi_exp_small_inner(
+    typename std::vector<GroupT>::const_iterator bases,
+    std::vector<uint64_t>::const_iterator scalars,
+    const size_t num_entries,
+    const size_t num_bits,
+    multi_exp_arena<GroupT, FieldT> &arena)
+{
+    if (num_entries == 0) {
+        return GroupT::zero();
+    }
+
+    const size_t c = multi_exp_small_optimal_c(num_entries, num_bits);
+    const size_t num_rounds = (num_bits + c - 1) / c;
+    const size_t num_buckets = (1ul << c) - 1;
+    const uint64_t digit_mask = num_buckets;
+    std::vector<GroupT> &buckets = arena.buckets(0, num_buckets);
+    std::vector<bool> &bucket_hit = arena.bucket_hit(0, num_buckets);
+
+    GroupT result = GroupT::zero();
+    bool result_nonzero = false;
+    for (size_t round_idx = num_rounds - 1; round_idx < num_rounds;
+         --round_idx) {
+        if (result_nonzero) {
+            for (size_t i = 0; i < c; ++i) {
+                result = result.dbl();
+            }
+        }
+
+        bucket_hit.assign(num_buckets, false);
+        bool round_nonzero = false;
+        const size_t shift = round_idx * c;
+        for (size_t i = 0; i < num_entries; ++i) {
+            assert(num_bits == 64 || (scalars[i] >> num_bits) == 0);
+            const ssize_t digit = (scalars[i] >> shift) & digit_mask;
+            if (digit == 0) {
+                continue;
+            }
+
+            multi_exp_add_element_to_bucket_with_signed_digit<GroupT, BaseForm>(
+                buckets, bucket_hit, bases[i], digit);
+            round_nonzero = true;
+        }
+
+        if (round_nonzero) {
+            result = result +
+                     multiexp_accumulate_buckets<
+                         GroupT,
+                         multi_exp_base_form_normal>(
+                         buckets, bucket_hit, num_buckets);
+            result_nonzero = true;
+        }
+    }
+
+    return result;
+}
+
+/// Random-access iterator over the base elements bases[indices[i]], so that a
+/// subset of a vector of base elements can be processed without copying.
+template<typename GroupT> class multi_exp_indexed_bases_iterator
+{
+public:
+    multi_exp_indexed_bases_iterator() : _bases(nullptr), _indices(nullptr) {}
+
+    multi_exp_indexed_bases_iterator(
+        const GroupT *bases, const size_t *indices)
+        : _bases(bases), _indices(indices)
+    {
+    }
+
+    const GroupT &operator*() const { return _bases[*_indices]; }
+
+    const GroupT &operator[](const size_t i) const
+    {
+        return _bases[_indices[i]];
+    }
+
+    multi_exp_indexed_bases_iterator &operator++()
+    {
+        ++_indices;
+        return *this;
+    }
+
+    multi_exp_indexed_bases_iterator operator+(const size_t i) const
+    {
+        return multi_exp_indexed_bases_iterator(_bases, _indices + i);
+    }
+
+    ptrdiff_t operator-(const multi_exp_indexed_bases_iterator &other) const
+    {
+        return _indices - other._indices;
+    }
+
+    bool operator==(const multi_exp_indexed_bases_iterator &other) const
+    {
+        return _indices == other._indices;
+    }
+
+    bool operator!=(const multi_exp_indexed_bases_iterator &other) const
+    {
+        return _indices != other._indices;
+    }
+
+protected:
+    const GroupT *_bases;
+    const size_t *_indices;
+};
+
+/// If the scalar bi (a canonical representative of an element of FieldT) is
+/// equal to s or -s, for 0 <= s <= multi_exp_filter_max_small, set value to s
+/// or -s (respectively) and return true. Otherwise return false.
+template<typename FieldT, mp_size_t n>
+bool multi_exp_filter_small_value(const bigint<n> &bi, ssize_t &value)
+{
+    if (bi.num_bits() <= GMP_NUMB_BITS &&
+        bi.as_ulong() <= multi_exp_filter_max_small) {
+        value = bi.as_ulong();
+        return true;
+    }
+
+    bigint<n> negated;
+    mpn_sub_n(negated.data, FieldT::mod.data, bi.data, n);
+    if (negated.num_bits() <= GMP_NUMB_BITS &&
+        negated.as_ulong() <= multi_exp_filter_max_small) {
+        value = -(ssize_t)negated.as_ulong();
+        return true;
+    }
+
+    return false;
+}
+
+/// Partial result of multi_exp_filter_partition for a range of terms.
+template<typename GroupT> struct multi_exp_filter_partial {
+    multi_exp_filter_partial() : sum(GroupT::zero()) {}
+
+    GroupT sum;
+    multi_exp_filter_stats stats;
+};
+
+/// Partition the terms [0, num_entries), based on classify_fn(i, value),
+/// which returns true (and sets value) if the scalar of term i is a small
+/// integer (see multi_exp_filter_small_value). Ranges of terms are processed
+/// in parallel, each accumulating the base elements of its small terms in
+/// buckets (one per absolute value), and marking the remaining terms. Returns
+/// the sum of the small terms, and writes the indices of the remaining terms
+/// (in order) to other_indices.
+template<typename GroupT, multi_exp_base_form BaseForm, typename ClassifyFnT>
+GroupT multi_exp_filter_partition(
+    typename std::vector<GroupT>::const_iterator bases,
+    const size_t num_entries,
+    const ClassifyFnT &classify_fn,
+    std::vector<size_t> &other_indices,
+    multi_exp_filter_stats &stats)
+{
+    // Bytes rather than std::vector<bool>, so that ranges can be written
+    // concurrently.
+    std::vector<uint8_t> is_other(num_entries, 0);
+
+    // Each range allocates and accumulates its own buckets, so ranges should
+    // be large enough to amortize this.
+    const size_t grain_size = std::max<size_t>(
+        4 * multi_exp_filter_max_small,
+        num_entries / (8 * parallel_num_threads()));
+
+    const multi_exp_filter_partial<GroupT> result = parallel_reduce(
+        0,
+        num_entries,
+        grain_size,
+        multi_exp_filter_partial<GroupT>(),
+        [&](size_t begin, size_t end) {
+            multi_exp_filter_partial<GroupT> partial;
+            std::vector<GroupT> buckets(multi_exp_filter_max_small);
+            std::vector<bool> bucket_hit(multi_exp_filter_max_small, false);
+            bool any_hit = false;
+            for (size_t i = begin; i < end; ++i) {
+                ssize_t value;
+                if (!classify_fn(i, value)) {
+                    is_other[i] = 1;
+                    ++partial.stats.num_other;
+                    continue;
+                }
+
+                if (value == 0) {
+                    ++partial.stats.num_zero;
+                    continue;
+                }
+
+                if (value == 1) {
+                    ++partial.stats.num_one;
+                } else {
+                    ++partial.stats.num_small;
+                }
+
+                multi_exp_add_element_to_bucket_with_signed_digit<
+                    GroupT,
+                    BaseForm>(buckets, bucket_hit, bases[i], value);
+                any_hit = true;
+            }
+
+            if (any_hit) {
+                partial.sum = multiexp_accumulate_buckets<
+                    GroupT,
+                    multi_exp_base_form_normal>(
+                    buckets, bucket_hit, multi_exp_filter_max_small);
+            }
+
+            return partial;
+        },
+        [](const multi_exp_filter_partial<GroupT> &a,
+           const multi_exp_filter_partial<GroupT> &b) {
+            multi_exp_filter_partial<GroupT> sum;
+            sum.sum = a.sum + b.sum;
+            sum.stats.num_zero = a.stats.num_zero + b.stats.num_zero;
+            sum.stats.num_one = a.stats.num_one + b.stats.num_one;
+            sum.stats.num_small = a.stats.num_small + b.stats.num_small;
+            sum.stats.num_other = a.stats.num_other + b.stats.num_other;
+            return sum;
+        });
+
+    other_indices.clear();
+    other_indices.reserve(result.stats.num_other);
+    for (size_t i = 0; i < num_entries; ++i) {
+        if (is_other[i]) {
+            other_indices.push_back(i);
+        }
+    }
+
+    stats = result.stats;
+    return result.sum;
+}
+
+} // namespace internal
+
+template<typename FieldT> prepared_scalars<FieldT>::prepared_scalars()
+    : _num_bits(0), _digit_size(0), _num_digits(0)
+{
+}
+
+template<typename FieldT>
+prepared_scalars<FieldT>::prepared_scalars(
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t digit_size)
+    : _bigints(scalar_end - scalar_start), _digit_size(digit_size)
+{
+    const size_t num_entries = _bigints.size();
+    _num_bits = parallel_reduce(
+        0,
+        num_entries,
+        0,
+        (size_t)0,
+        [&](size_t begin, size_t end) {
+            size_t num_bits = 0;
+            for (size_t i = begin; i < end; ++i) {
+                _bigints[i] = scalar_start[i].as_bigint();
+                num_bits = std::max(num_bits, _bigints[i].num_bits());
+            }
+            return num_bits;
+        },
+        [](size_t a, size_t b) { return std::max(a, b); });
+
+    if (digit_size == 0) {
+        _num_digits = 0;
+        return;
+    }
+
+    // Allow for num_bits + 2 bits, as in BDLO12_signed.
+    assert(digit_size < 32);
+    _num_digits = (_num_bits + 2 + digit_size - 1) / digit_size;
+    _digits.resize(_num_digits * num_entries);
+    parallel_for(0, num_entries, 0, [&](size_t begin, size_t end) {
+        std::vector<ssize_t> digits(_num_digits);
+        for (size_t i = begin; i < end; ++i) {
+            field_get_signed_digits(
+                digits, _bigints[i], _digit_size, _num_digits);
+            for (size_t digit_idx = 0; digit_idx < _num_digits; ++digit_idx) {
+                _digits[digit_idx * num_entries + i] =
+                    (int32_t)digits[digit_idx];
+            }
+        }
+    });
+}
+
+template<typename FieldT>
+prepared_scalars<FieldT> prepared_scalars<FieldT>::subset(
+    const std::vector<size_t> &indices) const
+{
+    prepared_scalars<FieldT> result;
+    result._num_bits = _num_bits;
+    result._digit_size = _digit_size;
+    result._num_digits = _num_digits;
+
+    const size_t num_entries = indices.size();
+    result._bigints.resize(num_entries);
+    result._digits.resize(_num_digits * num_entries);
+    for (size_t i = 0; i < num_entries; ++i) {
+        assert(indices[i] < size());
+        result._bigints[i] = _bigints[indices[i]];
+    }
+    for (size_t digit_idx = 0; digit_idx < _num_digits; ++digit_idx) {
+        const int32_t *const digits = signed_digits(digit_idx);
+        int32_t *const result_digits = &result._digits[digit_idx * num_entries];
+        for (size_t i = 0; i < num_entries; ++i) {
+            result_digits[i] = digits[indices[i]];
+        }
+    }
+
+    return result;
+}
+
+template<typename FieldT> size_t prepared_scalars<FieldT>::size() const
+{
+    return _bigints.size();
+}
+
+template<typename FieldT> size_t prepared_scalars<FieldT>::num_bits() const
+{
+    return _num_bits;
+}
+
+template<typename FieldT>
+const std::vector<typename prepared_scalars<FieldT>::BigInt> &prepared_scalars<
+    FieldT>::bigints() const
+{
+    return _bigints;
+}
+
+template<typename FieldT> size_t prepared_scalars<FieldT>::digit_size() const
+{
+    return _digit_size;
+}
+
+template<typename FieldT> size_t prepared_scalars<FieldT>::num_digits() const
+{
+    return _num_digits;
+}
+
+template<typename FieldT>
+const int32_t *prepared_scalars<FieldT>::signed_digits(
+    const size_t digit_idx) const
+{
+    assert(digit_idx < _num_digits);
+    return _digits.data() + digit_idx * _bigints.size();
+}
+
+template<typename GroupT, typename FieldT>
+void multi_exp_workspace<GroupT, FieldT>::reserve(const size_t num_chunks)
+{
+    if (num_chunks > _arenas.size()) {
+        _arenas.resize(num_chunks);
+    }
+}
+
+template<typename GroupT, typename FieldT>
+internal::multi_exp_arena<GroupT, FieldT> &multi_exp_workspace<
+    GroupT,
+    FieldT>::arena(const size_t chunk_idx)
+{
+    assert(chunk_idx < _arenas.size());
+    return _arenas[chunk_idx];
+}
+
+template<typename GroupT, typename FieldT>
+size_t multi_exp_workspace<GroupT, FieldT>::num_bytes() const
+{
+    size_t num_bytes = 0;
+    for (const internal::multi_exp_arena<GroupT, FieldT> &arena : _arenas) {
+        num_bytes += arena.num_bytes();
+    }
+    return num_bytes;
+}
+
+template<typename GroupT, typename FieldT>
+void multi_exp_workspace<GroupT, FieldT>::release()
+{
+    std::vector<internal::multi_exp_arena<GroupT, FieldT>>().swap(_arenas);
+}
+
+static inline size_t bdlo12_signed_optimal_c(size_t num_entries)
+{
+    // For now, this seems like a good estimate in most cases.
+    return internal::pippenger_optimal_c(num_entries) + 1;
+}
+
+template<typename GroupT>
+multi_exp_method multi_exp_select_method(const size_t num_entries)
+{
+    // Thresholds measured with profile_multiexp_bench (on a single thread)
+    // on the G1 and G2 groups of alt_bn128, bls12_381, bw6_761 and mnt4.
+    // Straus' method requires a table (and a normalization) per term, which
+    // dominates for larger inputs. Bos-Coster minimizes the number of group
+    // operations at the cost of bigint arithmetic on the scalars, and so
+    // outperforms BDLO12_signed up to larger sizes when group operations are
+    // more expensive. The relative cost of group operations is approximated
+    // by the size of group elements in units of scalars: 3 for alt_bn128 and
+    // mnt4 G1, 4 for bls12 G1, and at least 6 for G2 groups and bw6_761.
+    const size_t relative_size =
+        sizeof(GroupT) / sizeof(typename GroupT::scalar_field);
+
+    const size_t straus_max_entries = (relative_size <= 3) ? 128 : 64;
+    if (num_entries < straus_max_entries) {
+        return multi_exp_method_straus;
+    }
+
+    const size_t bos_coster_max_entries =
+        (relative_size <= 4) ? 4096 : 32768;
+    if (num_entries < bos_coster_max_entries) {
+        return multi_exp_method_bos_coster;
+    }
+
+    return multi_exp_method_BDLO12_signed;
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks)
+{
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return multi_exp<GroupT, FieldT, Method, BaseForm>(
+        vec_start, vec_end, scalar_start, scalar_end, chunks, workspace);
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
+{
+    assert(scalar_end - scalar_start == vec_end - vec_start);
+    UNUSED(scalar_end);
+    return internal::multi_exp_chunks(
+        vec_end - vec_start,
+        chunks,
+        workspace,
+        [&](size_t begin,
+            size_t end,
+            internal::multi_exp_arena<GroupT, FieldT> &arena) {
+            return internal::
+                multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
+                    multi_exp_inner(
+                        vec_start + begin,
+                        vec_start + end,
+                        scalar_start + begin,
+                        scalar_start + end,
+                        arena);
+        });
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t chunks)
+{
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return multi_exp<GroupT, FieldT, Method, BaseForm>(
+        vec_start, vec_end, scalars, chunks, workspace);
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
+{
+    assert((size_t)(vec_end - vec_start) == scalars.size());
+    return internal::multi_exp_chunks(
+        vec_end - vec_start,
+        chunks,
+        workspace,
+        [&](size_t begin,
+            size_t end,
+            internal::multi_exp_arena<GroupT, FieldT> &arena) {
+            return internal::
+                multi_exp_inner_prepared<GroupT, FieldT, Method, BaseForm>(
+                    vec_start + begin, vec_start + end, scalars, begin, arena);
+        });
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp_filter_one_zero(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t chunks,
+    multi_exp_filter_stats *stats)
+{
+    using BigInt = typename internal::multi_exp_arena<GroupT, FieldT>::BigInt;
+
+    const size_t num_entries = vec_end - vec_start;
+    assert((size_t)(scalar_end - scalar_start) == num_entries);
+    UNUSED(scalar_end);
+    enter_block("Process scalar vector");
+
+    // Scalars are converted to bigints only if they are not 0 or 1. The
+    // bigints of the remaining terms are then compacted in place.
+    const FieldT one = FieldT::one();
+    std::vector<BigInt> bigints(num_entries);
+    std::vector<size_t> indices;
+    multi_exp_filter_stats filter_stats;
+    const GroupT small_sum =
+        internal::multi_exp_filter_partition<GroupT, BaseForm>(
+            vec_start,
+            num_entries,
+            [&](size_t i, ssize_t &value) -> bool {
+                const FieldT &scalar = scalar_start[i];
+                if (scalar.is_zero()) {
+                    value = 0;
+                    return true;
+                }
+                if (scalar == one) {
+                    value = 1;
+                    return true;
+                }
+                bigints[i] = scalar.as_bigint();
+                return internal::multi_exp_filter_small_value<FieldT>(
+                    bigints[i], value);
+            },
+            indices,
+            filter_stats);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        bigints[i] = bigints[indices[i]];
+    }
+
+    leave_block("Process scalar vector");
+    if (stats != nullptr) {
+        *stats = filter_stats;
+    }
+    if (indices.empty()) {
+        return small_sum;
+    }
+
+    const internal::multi_exp_indexed_bases_iterator<GroupT> bases(
+        &vec_start[0], indices.data());
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return small_sum +
+           internal::multi_exp_chunks(
+               indices.size(),
+               chunks,
+               workspace,
+               [&](size_t begin,
+                   size_t end,
+                   internal::multi_exp_arena<GroupT, FieldT> &arena) {
+                   return internal::multi_exp_implementation<
+                       GroupT,
+                       FieldT,
+                       Method,
+                       BaseForm>::
+                       multi_exp_inner_bigint(
+                           bases + begin,
+                           bases + end,
+                           bigints.cbegin() + begin,
+                           arena);
+               });
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp_filter_one_zero(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    const prepared_scalars<FieldT> &scalars,
+    const size_t chunks,
+    multi_exp_filter_stats *stats)
+{
+    const size_t num_entries = vec_end - vec_start;
+    assert(num_entries == scalars.size());
+    enter_block("Process scalar vector");
+
+    // Scalars are in bigint (non-Montgomery) form, so small values are
+    // represented directly.
+    const std::vector<typename prepared_scalars<FieldT>::BigInt> &bigints =
+        scalars.bigints();
+    std::vector<size_t> indices;
+    multi_exp_filter_stats filter_stats;
+    const GroupT small_sum =
+        internal::multi_exp_filter_partition<GroupT, BaseForm>(
+            vec_start,
+            num_entries,
+            [&bigints](size_t i, ssize_t &value) {
+                return internal::multi_exp_filter_small_value<FieldT>(
+                    bigints[i], value);
+            },
+            indices,
+            filter_stats);
+
+    leave_block("Process scalar vector");
+    if (stats != nullptr) {
+        *stats = filter_stats;
+    }
+    if (indices.empty()) {
+        return small_sum;
+    }
+
+    // The remaining scalars (and any digits) are copied rather than
+    // recomputed.
+    const prepared_scalars<FieldT> other_scalars = scalars.subset(indices);
+    const internal::multi_exp_indexed_bases_iterator<GroupT> bases(
+        &vec_start[0], indices.data());
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return small_sum +
+           internal::multi_exp_chunks(
+               indices.size(),
+               chunks,
+               workspace,
+               [&](size_t begin,
+                   size_t end,
+                   internal::multi_exp_arena<GroupT, FieldT> &arena) {
+                   return internal::multi_exp_inner_prepared<
+                       GroupT,
+                       FieldT,
+                       Method,
+                       BaseForm>(
+                       bases + begin, bases + end, other_scalars, begin, arena);
+               });
+}
+
+template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
+GroupT multi_exp_small(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    std::vector<uint64_t>::const_iterator scalar_start,
+    std::vector<uint64_t>::const_iterator scalar_end,
+    const size_t num_bits,
+    const size_t chunks)
+{
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return multi_exp_small<GroupT, FieldT, BaseForm>(
+        vec_start,
+        vec_end,
+        scalar_start,
+        scalar_end,
+        num_bits,
+        chunks,
+        workspace);
+}
+
+template<typename GroupT, typename FieldT, multi_exp_base_form BaseForm>
+GroupT multi_exp_small(
+    typename std::vector<GroupT>::const_iterator vec_start,
+    typename std::vector<GroupT>::const_iterator vec_end,
+    std::vector<uint64_t>::const_iterator scalar_start,
+    std::vector<uint64_t>::const_iterator scalar_end,
+    const size_t num_bits,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
+{
+    assert(scalar_end - scalar_start == vec_end - vec_start);
+    assert(num_bits >= 1 && num_bits <= 64);
+    UNUSED(scalar_end);
+    return internal::multi_exp_chunks(
+        vec_end - vec_start,
+        chunks,
+        workspace,
+        [&](size_t begin,
+            size_t end,
+            internal::multi_exp_arena<GroupT, FieldT> &arena) {
+            return internal::multi_exp_small_inner<GroupT, FieldT, BaseForm>(
+                vec_start + begin,
+                scalar_start + begin,
+                end - begin,
+                num_bits,
+                arena);
+        });
+}
+
+template<
+    typename GroupT,
+    typename FieldT,
+    multi_exp_method Method,
+    multi_exp_base_form BaseForm>
+GroupT multi_exp_numa(
+    const numa_partitioned_vector<GroupT> &bases,
+    typename std::vector<FieldT>::const_iterator scalar_start,
+    typename std::vector<FieldT>::const_iterator scalar_end,
+    const size_t threads_per_node)
+{
+    assert((size_t)std::distance(scalar_start, scalar_end) == bases.size());
+    assert(bases.num_partitions() == numa_num_nodes());
+    UNUSED(scalar_end);
+
+    // One partial result per thread.
+    const size_t num_nodes = bases.num_partitions();
+    std::vector<std::vector<GroupT>> partial(num_nodes);
+    for (size_t node = 0; node < num_nodes; ++node) {
+        const size_t num_threads =
+            threads_per_node ? threads_per_node : numa_node_num_threads(node);
+        partial[node].resize(num_threads, GroupT::zero());
+    }
+
+    numa_run_on_all_nodes(
+        threads_per_node, [&](size_t node, size_t thread_idx) {
+            const std::vector<GroupT> &partition = bases.partition(node);
+            const size_t num_threads = partial[node].size();
+            const size_t begin = partition.size() * thread_idx / num_threads;
+            const size_t end =
+                partition.size() * (thread_idx + 1) / num_threads;
+            if (begin == end) {
+                return;
+            }
+
+            // Temporary storage is allocated by (and is local to) the thread.
+            const auto scalars = scalar_start + bases.partition_offset(node);
+            internal::multi_exp_arena<GroupT, FieldT> arena;
+            partial[node][thread_idx] = internal::
+                multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
+                    multi_exp_inner(
+                        partition.begin() + begin,
+                        partition.begin() + end,
+                        scalars + begin,
+                        scalars + end,
+                        arena);
+        });
+
+    GroupT result = GroupT::zero();
+    for (const std::vector<GroupT> &node_partial : partial) {
+        for (const GroupT &p : node_partial) {
+            result = result + p;
+        }
+    }
+    return result;
+}
+
+template<typename T>
+T inner_product(
+    typename std::vector<T>::const_iterator a_start,
+    typename std::vector<T>::const_iterator a_end,
+    typename std::vector<T>::const_iterator b_start,
+    typename std::vector<T>::const_iterator b_end)
+{
+    return multi_exp<T, T, multi_exp_method_naive_plain>(
+        a_start, a_end, b_start, b_end, 1);
+}
+
+template<typename T> size_t get_exp_window_size(const size_t num_scalars)
 {
     if (T::fixed_base_exp_window_table.empty()) {
 #ifdef LOWMEM
@@ -895,17 +2080,16 @@ std::vector<T> batch_exp(
     }
     std::vector<T> res(num_entries, table[0][0]);
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_entries; ++i) {
-        res[i] = windowed_exp(scalar_size, window, table, v[i]);
+    parallel_for(0, num_entries, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            res[i] = windowed_exp(scalar_size, window, table, v[i]);
 
-        if (!inhibit_profiling_info && (i % 10000 == 0)) {
-            printf(".");
-            fflush(stdout);
+            if (!inhibit_profiling_info && (i % 10000 == 0)) {
+                printf(".");
+                fflush(stdout);
+            }
         }
-    }
+    });
 
     if (!inhibit_profiling_info) {
         printf(" DONE!\n");
@@ -927,17 +2111,16 @@ std::vector<T> batch_exp_with_coeff(
     }
     std::vector<T> res(v.size(), table[0][0]);
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < v.size(); ++i) {
-        res[i] = windowed_exp(scalar_size, window, table, coeff * v[i]);
+    parallel_for(0, v.size(), 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            res[i] = windowed_exp(scalar_size, window, table, coeff * v[i]);
 
-        if (!inhibit_profiling_info && (i % 10000 == 0)) {
-            printf(".");
-            fflush(stdout);
+            if (!inhibit_profiling_info && (i % 10000 == 0)) {
+                printf(".");
+                fflush(stdout);
+            }
         }
-    }
+    });
 
     if (!inhibit_profiling_info) {
         printf(" DONE!\n");
@@ -950,26 +2133,33 @@ template<typename T> void batch_to_special(std::vector<T> &vec)
 {
     enter_block("Batch-convert elements to special form");
 
-    std::vector<T> non_zero_vec;
-    for (size_t i = 0; i < vec.size(); ++i) {
-        if (!vec[i].is_zero()) {
-            non_zero_vec.emplace_back(vec[i]);
-        }
-    }
-
-    T::batch_to_special_all_non_zeros(non_zero_vec);
-    auto it = non_zero_vec.begin();
     T zero_special = T::zero();
     zero_special.to_special();
 
-    for (size_t i = 0; i < vec.size(); ++i) {
-        if (!vec[i].is_zero()) {
-            vec[i] = *it;
-            ++it;
-        } else {
-            vec[i] = zero_special;
+    // Ranges of elements are converted in parallel, using one inversion per
+    // range. Ranges are large enough for the cost of the inversion to be
+    // amortized.
+    const size_t grain_size = 1024;
+    parallel_for(0, vec.size(), grain_size, [&](size_t begin, size_t end) {
+        std::vector<T> non_zero_vec;
+        non_zero_vec.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            if (!vec[i].is_zero()) {
+                non_zero_vec.emplace_back(vec[i]);
+            }
         }
-    }
+
+        T::batch_to_special_all_non_zeros(non_zero_vec);
+        auto it = non_zero_vec.begin();
+        for (size_t i = begin; i < end; ++i) {
+            if (!vec[i].is_zero()) {
+                vec[i] = *it;
+                ++it;
+            } else {
+                vec[i] = zero_special;
+            }
+        }
+    });
     leave_block("Batch-convert elements to special form");
 }
 
@@ -9,7 +9,9 @@
 #ifndef MULTIEXP_STREAM_HPP_
 #define MULTIEXP_STREAM_HPP_
 
+#include "libff/algebra/scalar_multiplication/multiexp.hpp"
 #include "libff/algebra/serialization.hpp"
+#include "libff/common/numa.hpp"
 
 #include <cstddef>
 #include <vector>
@@ -26,6 +28,14 @@ template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
 GroupT multi_exp_stream(
     std::istream &base_elements_in, const std::vector<FieldT> &exponents);
 
+/// As above, using (and retaining) the buckets of all rounds in the given
+/// workspace.
+template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
+GroupT multi_exp_stream(
+    std::istream &base_elements_in,
+    const std::vector<FieldT> &exponents,
+    multi_exp_workspace<GroupT, FieldT> &workspace);
+
 /// Perform optimal multiexp using precomputed elements from a stream. The
 /// stream is expected to be formatted as follows:
 ///   For each original base element e_i:
@@ -41,6 +51,23 @@ GroupT multi_exp_stream_with_precompute(
     const std::vector<FieldT> &exponents,
     const size_t precompute_c);
 
+/// As above, using (and retaining) temporary storage in the given workspace.
+template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
+GroupT multi_exp_stream_with_precompute(
+    std::istream &precomputed_elements_in,
+    const std::vector<FieldT> &exponents,
+    const size_t precompute_c,
+    multi_exp_workspace<GroupT, FieldT> &workspace);
+
+/// Read num_elements base elements from a stream into a
+/// numa_partitioned_vector, for use with multi_exp_numa. The stream is read
+/// sequentially, in blocks, and the elements of each block are decoded (and
+/// checked to be well-formed) in parallel by the workers of the NUMA node
+/// which owns them. Throws std::runtime_error if the data is invalid.
+template<form_t Form, compression_t Comp, typename GroupT>
+numa_partitioned_vector<GroupT> numa_partitioned_elements_from_stream(
+    std::istream &base_elements_in, const size_t num_elements);
+
 } // namespace libff
 
 #include "libff/algebra/scalar_multiplication/multiexp_stream.tcc"
@@ -11,6 +11,8 @@
 
 #include "libff/algebra/scalar_multiplication/multiexp.hpp"
 
+#include <stdexcept>
+
 namespace libff
 {
 
@@ -52,7 +54,8 @@ template<typename GroupT, typename FieldT>
 GroupT multi_exp_base_elements_from_fifo_all_rounds(
     concurrent_fifo_spsc<GroupT> &fifo,
     const std::vector<FieldT> &exponents,
-    const size_t c)
+    const size_t c,
+    internal::multi_exp_arena<GroupT, FieldT> &arena)
 {
     const size_t num_entries = exponents.size();
     // Allow sufficient rounds for num_bits + 2, to accomodate overflow +
@@ -60,14 +63,13 @@ GroupT multi_exp_base_elements_from_fifo_all_rounds(
     const size_t num_digits = (FieldT::num_bits + 2 + c - 1) / c;
     const size_t num_buckets = 1 << (c - 1);
 
-    // Allocate state for all rounds.
-    std::vector<std::vector<GroupT>> round_buckets(num_digits);
-    std::vector<std::vector<bool>> round_bucket_hit(num_digits);
-    for (std::vector<GroupT> &buckets : round_buckets) {
-        buckets.resize(num_buckets);
-    }
-    for (std::vector<bool> &bucket_hit : round_bucket_hit) {
-        bucket_hit.resize(num_buckets);
+    // Allocate state for all rounds (one set of buckets per digit).
+    std::vector<std::vector<GroupT> *> round_buckets(num_digits);
+    std::vector<std::vector<bool> *> round_bucket_hit(num_digits);
+    for (size_t digit_idx = 0; digit_idx < num_digits; ++digit_idx) {
+        round_buckets[digit_idx] = &arena.buckets(digit_idx, num_buckets);
+        round_bucket_hit[digit_idx] = &arena.bucket_hit(digit_idx, num_buckets);
+        round_bucket_hit[digit_idx]->assign(num_buckets, false);
     }
     std::vector<ssize_t> digits(num_digits);
 
@@ -79,8 +81,8 @@ GroupT multi_exp_base_elements_from_fifo_all_rounds(
 
         // Process all digits
         for (size_t digit_idx = 0; digit_idx < num_digits; ++digit_idx) {
-            std::vector<GroupT> &buckets = round_buckets[digit_idx];
-            std::vector<bool> &bucket_hit = round_bucket_hit[digit_idx];
+            std::vector<GroupT> &buckets = *round_buckets[digit_idx];
+            std::vector<bool> &bucket_hit = *round_bucket_hit[digit_idx];
             const ssize_t digit = digits[digit_idx];
 
             internal::multi_exp_add_element_to_bucket_with_signed_digit<
@@ -95,11 +97,9 @@ GroupT multi_exp_base_elements_from_fifo_all_rounds(
     // For each digit, sum the buckets and accumulate the total
     GroupT result = internal::
         multiexp_accumulate_buckets<GroupT, multi_exp_base_form_normal>(
-            round_buckets[num_digits - 1],
-            round_bucket_hit[num_digits - 1],
+            *round_buckets[num_digits - 1],
+            *round_bucket_hit[num_digits - 1],
             num_buckets);
-    round_buckets[num_digits - 1].clear();
-    round_bucket_hit[num_digits - 1].clear();
 
     for (size_t digit_idx = num_digits - 2; digit_idx < num_digits;
          --digit_idx) {
@@ -109,11 +109,9 @@ GroupT multi_exp_base_elements_from_fifo_all_rounds(
 
         const GroupT digit_sum = internal::
             multiexp_accumulate_buckets<GroupT, multi_exp_base_form_normal>(
-                round_buckets[digit_idx],
-                round_bucket_hit[digit_idx],
+                *round_buckets[digit_idx],
+                *round_bucket_hit[digit_idx],
                 num_buckets);
-        round_buckets[digit_idx].clear();
-        round_bucket_hit[digit_idx].clear();
 
         result = result + digit_sum;
     }
@@ -126,14 +124,16 @@ GroupT multi_exp_precompute_from_fifo(
     concurrent_buffer_fifo_spsc<GroupT> &fifo,
     const std::vector<FieldT> &exponents,
     const size_t c,
-    const size_t num_digits)
+    const size_t num_digits,
+    internal::multi_exp_arena<GroupT, FieldT> &arena)
 {
     const size_t num_entries = exponents.size();
     const size_t num_buckets = 1 << (c - 1);
 
     // Allocate state (single collection of buckets).
-    std::vector<GroupT> buckets(num_buckets);
-    std::vector<bool> bucket_hit(num_buckets, false);
+    std::vector<GroupT> &buckets = arena.buckets(0, num_buckets);
+    std::vector<bool> &bucket_hit = arena.bucket_hit(0, num_buckets);
+    bucket_hit.assign(num_buckets, false);
     std::vector<ssize_t> digits(num_digits);
 
     // Process each element
@@ -164,6 +164,17 @@ GroupT multi_exp_precompute_from_fifo(
 template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
 GroupT multi_exp_stream(
     std::istream &base_elements_in, const std::vector<FieldT> &exponents)
+{
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return multi_exp_stream<Form, Comp, GroupT, FieldT>(
+        base_elements_in, exponents, workspace);
+}
+
+template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
+GroupT multi_exp_stream(
+    std::istream &base_elements_in,
+    const std::vector<FieldT> &exponents,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
 {
     static const size_t FIFO_SIZE = 1024;
     const size_t num_entries = exponents.size();
@@ -180,9 +191,10 @@ GroupT multi_exp_stream(
     });
 
     // Consume all elements from the fifo.
+    workspace.reserve(1);
     const GroupT result =
         multi_exp_base_elements_from_fifo_all_rounds<GroupT, FieldT>(
-            fifo, exponents, c);
+            fifo, exponents, c, workspace.arena(0));
 
     // Wait for reading thread
     producer.join();
@@ -195,6 +207,18 @@ GroupT multi_exp_stream_with_precompute(
     std::istream &base_elements_in,
     const std::vector<FieldT> &exponents,
     const size_t c)
+{
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    return multi_exp_stream_with_precompute<Form, Comp, GroupT, FieldT>(
+        base_elements_in, exponents, c, workspace);
+}
+
+template<form_t Form, compression_t Comp, typename GroupT, typename FieldT>
+GroupT multi_exp_stream_with_precompute(
+    std::istream &base_elements_in,
+    const std::vector<FieldT> &exponents,
+    const size_t c,
+    multi_exp_workspace<GroupT, FieldT> &workspace)
 {
     // Each entry is a buffer. We may want to tweak this (possibly depending on
     // exponents.size() and precompute_c), but for now we expect 8 to be a
@@ -214,14 +238,59 @@ GroupT multi_exp_stream_with_precompute(
     });
 
     // Consume all elements from the fifo to compute the final result.
+    workspace.reserve(1);
     const GroupT result = multi_exp_precompute_from_fifo<GroupT, FieldT>(
-        fifo, exponents, c, num_digits);
+        fifo, exponents, c, num_digits, workspace.arena(0));
 
     producer.join();
 
     return result;
 }
 
+template<form_t Form, compression_t Comp, typename GroupT>
+numa_partitioned_vector<GroupT> numa_partitioned_elements_from_stream(
+    std::istream &base_elements_in, const size_t num_elements)
+{
+    const size_t block_size = 1 << 16;
+    const size_t element_size = group_binary_size<Comp, GroupT>();
+
+    numa_partitioned_vector<GroupT> result(num_elements);
+    std::vector<char> buffer;
+    for (size_t node = 0; node < result.num_partitions(); ++node) {
+        std::vector<GroupT> &partition = result.partition(node);
+        const size_t num_tasks = numa_node_num_threads(node);
+        for (size_t block_begin = 0; block_begin < partition.size();
+             block_begin += block_size) {
+            const size_t block_num_elements =
+                std::min(block_size, partition.size() - block_begin);
+            buffer.resize(block_num_elements * element_size);
+            base_elements_in.read(buffer.data(), buffer.size());
+            if (!base_elements_in) {
+                throw std::runtime_error("truncated group element vector");
+            }
+
+            numa_run_on_node(node, num_tasks, [&](size_t task_idx) {
+                const size_t begin = block_num_elements * task_idx / num_tasks;
+                const size_t end =
+                    block_num_elements * (task_idx + 1) / num_tasks;
+                for (size_t i = begin; i < end; ++i) {
+                    GroupT &element = partition[block_begin + i];
+                    group_decode<encoding_binary, Form, Comp>(
+                        element,
+                        buffer.data() + i * element_size,
+                        element_size);
+                    internal::group_element_check(
+                        element,
+                        group_check_well_formed,
+                        Comp == compression_on);
+                }
+            });
+        }
+    }
+
+    return result;
+}
+
 } // namespace libff
 
 #endif // MULTIEXP_STREAM_TCC_
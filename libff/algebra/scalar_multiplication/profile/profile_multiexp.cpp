@@ -2,6 +2,7 @@
 #include "libff/algebra/curves/curve_serialization.hpp"
 #include "libff/algebra/scalar_multiplication/multiexp.hpp"
 #include "libff/algebra/scalar_multiplication/multiexp_stream.hpp"
+#include "libff/common/numa.hpp"
 #include "libff/common/profiling.hpp"
 #include "libff/common/rng.hpp"
 
@@ -398,6 +399,129 @@ void print_performance_csv(
     }
 }
 
+/// Time NUM_ITERATIONS evaluations of the multiexp over the partition of
+/// the given node, using the NUMA workers of the node.
+template<typename GroupT, typename FieldT>
+long long profile_multiexp_numa_node(
+    const numa_partitioned_vector<GroupT> &group_elements,
+    const test_instances_t<FieldT> &scalars,
+    const size_t node)
+{
+    const std::vector<GroupT> &partition = group_elements.partition(node);
+    const auto node_scalars =
+        scalars.cbegin() + group_elements.partition_offset(node);
+    const size_t num_threads = numa_node_num_threads(node);
+
+    long long start_time = get_nsec_time();
+
+    for (size_t iter = 0; iter < NUM_ITERATIONS; ++iter) {
+        numa_run_on_node(node, num_threads, [&](size_t t) {
+            const size_t begin = partition.size() * t / num_threads;
+            const size_t end = partition.size() * (t + 1) / num_threads;
+            internal::multi_exp_arena<GroupT, FieldT> arena;
+            internal::multi_exp_implementation<
+                GroupT,
+                FieldT,
+                multi_exp_method_BDLO12_signed,
+                multi_exp_base_form_special>::
+                multi_exp_inner(
+                    partition.cbegin() + begin,
+                    partition.cbegin() + end,
+                    node_scalars + begin,
+                    node_scalars + end,
+                    arena);
+        });
+    }
+
+    return get_nsec_time() - start_time;
+}
+
+/// Compare multi_exp (with one chunk per CPU) over elements allocated by the
+/// main thread, with multi_exp_numa over elements partitioned across NUMA
+/// nodes. Also report the throughput (in elements per second) of each node
+/// processing only its own partition.
+template<typename GroupT, typename FieldT>
+void print_numa_performance_csv(
+    const std::string &tag, size_t expn_start, size_t expn_end)
+{
+    const size_t num_nodes = numa_num_nodes();
+    size_t num_cpus = 0;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        num_cpus += numa_node_cpus(node).size();
+    }
+
+    std::cout << "Profiling " << tag << " (NUMA nodes: " << num_nodes
+              << ", CPUs: " << num_cpus << ")\n";
+    printf("\t%16s\t%16s", "multi_exp", "multi_exp_numa");
+    for (size_t node = 0; node < num_nodes; ++node) {
+        printf("\t%10s%6zu", "el/s node", node);
+    }
+    printf("\n");
+
+    for (size_t expn = expn_start; expn <= expn_end; expn++) {
+        test_instances_t<GroupT> group_elements;
+        try {
+            group_elements = read_group_elements<GroupT>(tag, 1 << expn);
+        } catch (const std::ifstream::failure &e) {
+            std::cout << "(Generating files for 1<<" << expn << ")\n";
+            create_base_element_files<GroupT>(tag, 1 << expn);
+            group_elements = read_group_elements<GroupT>(tag, 1 << expn);
+        }
+        const test_instances_t<FieldT> scalars =
+            generate_scalars<FieldT>(1 << expn);
+
+        printf("%ld", expn);
+        fflush(stdout);
+
+        GroupT answer;
+        long long start_time = get_nsec_time();
+        for (size_t iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            answer = multi_exp<
+                GroupT,
+                FieldT,
+                multi_exp_method_BDLO12_signed,
+                multi_exp_base_form_special>(
+                group_elements.cbegin(),
+                group_elements.cend(),
+                scalars.cbegin(),
+                scalars.cend(),
+                num_cpus);
+        }
+        printf("\t%16lld", get_nsec_time() - start_time);
+        fflush(stdout);
+
+        const numa_partitioned_vector<GroupT> partitioned(
+            group_elements.cbegin(), group_elements.cend());
+        GroupT answer_numa;
+        start_time = get_nsec_time();
+        for (size_t iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            answer_numa = multi_exp_numa<
+                GroupT,
+                FieldT,
+                multi_exp_method_BDLO12_signed,
+                multi_exp_base_form_special>(
+                partitioned, scalars.cbegin(), scalars.cend());
+        }
+        printf("\t%16lld", get_nsec_time() - start_time);
+        fflush(stdout);
+
+        if (answer != answer_numa) {
+            fprintf(stderr, "Answers NOT MATCHING (multi_exp != numa)\n");
+        }
+
+        for (size_t node = 0; node < num_nodes; ++node) {
+            const long long node_time =
+                profile_multiexp_numa_node(partitioned, scalars, node);
+            const double num_processed =
+                (double)(partitioned.partition(node).size() * NUM_ITERATIONS);
+            printf("\t%16.0f", num_processed * 1e9 / (double)node_time);
+            fflush(stdout);
+        }
+
+        printf("\n");
+    }
+}
+
 int main(void)
 {
     print_compilation_info();
@@ -410,5 +534,8 @@ int main(void)
     print_performance_csv<G2<alt_bn128_pp>, Fr<alt_bn128_pp>>(
         "alt_bn128_g2", 8, 20, 14, true);
 
+    print_numa_performance_csv<G1<alt_bn128_pp>, Fr<alt_bn128_pp>>(
+        "alt_bn128_g1", 16, 20);
+
     return 0;
 }
@@ -0,0 +1,491 @@
+/** @file
+ *****************************************************************************
+ * Benchmark of multi_exp over curves, groups, sizes, methods, base forms and
+ * thread counts. Results are written in the JSON format of Google Benchmark
+ * (as produced by --benchmark_format=json), so that runs can be compared
+ * with the existing tooling for that format.
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "libff/algebra/curves/bls12_377/bls12_377_pp.hpp"
+#include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#include "libff/algebra/curves/bw6_761/bw6_761_pp.hpp"
+#include "libff/algebra/curves/edwards/edwards_pp.hpp"
+#include "libff/algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "libff/algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#ifdef CURVE_BN128
+#include "libff/algebra/curves/bn128/bn128_pp.hpp"
+#endif
+#include "libff/algebra/scalar_multiplication/multiexp.hpp"
+#include "libff/common/parallel.hpp"
+#include "libff/common/profiling.hpp"
+#include "libff/common/rng.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace libff;
+
+namespace
+{
+
+/// Number of distinct base elements. Larger inputs repeat these, since
+/// generating random group elements is expensive.
+const size_t NUM_DIFFERENT_ELEMENTS = 1024;
+
+struct method_info {
+    multi_exp_method method;
+    const char *name;
+    /// Largest log2 of the number of elements for which the method is run,
+    /// so that slow methods are only measured at sizes where they may be
+    /// selected.
+    size_t max_log_size;
+};
+
+const method_info METHODS[] = {
+    {multi_exp_method_naive, "naive", 12},
+    {multi_exp_method_naive_plain, "naive_plain", 12},
+    {multi_exp_method_bos_coster, "bos_coster", 16},
+    {multi_exp_method_BDLO12, "BDLO12", 24},
+    {multi_exp_method_BDLO12_signed, "BDLO12_signed", 24},
+    {multi_exp_method_straus, "straus", 12},
+    {multi_exp_method_auto, "auto", 24},
+};
+
+struct bench_options {
+    /// Selected curves, groups, methods and base forms (all if empty).
+    std::vector<std::string> curves;
+    std::vector<std::string> groups;
+    std::vector<std::string> methods;
+    std::vector<std::string> base_forms;
+    /// Thread counts. Each multi_exp is split into one chunk per thread.
+    std::vector<size_t> threads;
+    size_t min_log_size = 4;
+    size_t max_log_size = 24;
+    /// Minimum total time (in seconds) of the iterations of each benchmark.
+    double min_time = 0.5;
+    /// Output file (stdout if empty).
+    std::string output;
+};
+
+struct bench_result {
+    std::string name;
+    std::string curve;
+    std::string group;
+    std::string method;
+    std::string base_form;
+    size_t num_elements;
+    size_t threads;
+    size_t chunks;
+    size_t iterations;
+    /// Times per iteration, in nanoseconds. cpu_time is the CPU time of the
+    /// calling thread only.
+    double real_time;
+    double cpu_time;
+};
+
+bool is_selected(
+    const std::vector<std::string> &selection, const std::string &name)
+{
+    return selection.empty() ||
+           std::find(selection.begin(), selection.end(), name) !=
+               selection.end();
+}
+
+std::vector<std::string> split_list(const std::string &list)
+{
+    std::vector<std::string> result;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        size_t end = list.find(',', begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        if (end > begin) {
+            result.push_back(list.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+    return result;
+}
+
+template<typename GroupT, multi_exp_method Method, multi_exp_base_form BaseForm>
+GroupT run_method(
+    const std::vector<GroupT> &bases,
+    const std::vector<typename GroupT::scalar_field> &scalars,
+    const size_t num_elements,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, typename GroupT::scalar_field> &workspace)
+{
+    using FieldT = typename GroupT::scalar_field;
+    return multi_exp<GroupT, FieldT, Method, BaseForm>(
+        bases.begin(),
+        bases.begin() + num_elements,
+        scalars.begin(),
+        scalars.begin() + num_elements,
+        chunks,
+        workspace);
+}
+
+template<typename GroupT, multi_exp_base_form BaseForm>
+GroupT run_multi_exp(
+    const multi_exp_method method,
+    const std::vector<GroupT> &bases,
+    const std::vector<typename GroupT::scalar_field> &scalars,
+    const size_t num_elements,
+    const size_t chunks,
+    multi_exp_workspace<GroupT, typename GroupT::scalar_field> &workspace)
+{
+    switch (method) {
+    case multi_exp_method_naive:
+        return run_method<GroupT, multi_exp_method_naive, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_naive_plain:
+        return run_method<GroupT, multi_exp_method_naive_plain, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_bos_coster:
+        return run_method<GroupT, multi_exp_method_bos_coster, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_BDLO12:
+        return run_method<GroupT, multi_exp_method_BDLO12, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_BDLO12_signed:
+        return run_method<GroupT, multi_exp_method_BDLO12_signed, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_straus:
+        return run_method<GroupT, multi_exp_method_straus, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    case multi_exp_method_auto:
+        return run_method<GroupT, multi_exp_method_auto, BaseForm>(
+            bases, scalars, num_elements, chunks, workspace);
+    }
+    throw std::runtime_error("invalid multi_exp_method");
+}
+
+/// CPU time of the calling thread, in nanoseconds. As in Google Benchmark,
+/// time spent by worker threads is not included, so that cpu_time is
+/// comparable across thread counts.
+long long get_nsec_thread_cpu_time()
+{
+    ::timespec ts;
+    if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) {
+        throw std::runtime_error(
+            "clock_gettime(CLOCK_THREAD_CPUTIME_ID) failed");
+    }
+    return ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+/// Run fn repeatedly, for at least min_time seconds (and at least once), and
+/// record the number of iterations and the mean time per iteration.
+template<typename FnT>
+void time_iterations(
+    const double min_time, const FnT &fn, bench_result &result)
+{
+    const long long min_time_ns = (long long)(min_time * 1e9);
+    const long long real_start = get_nsec_time();
+    const long long cpu_start = get_nsec_thread_cpu_time();
+
+    size_t iterations = 0;
+    long long real_elapsed;
+    do {
+        fn();
+        ++iterations;
+        real_elapsed = get_nsec_time() - real_start;
+    } while (real_elapsed < min_time_ns);
+
+    const long long cpu_elapsed = get_nsec_thread_cpu_time() - cpu_start;
+    result.iterations = iterations;
+    result.real_time = (double)real_elapsed / iterations;
+    result.cpu_time = (double)cpu_elapsed / iterations;
+}
+
+template<typename GroupT>
+void bench_group(
+    const bench_options &options,
+    const std::string &curve,
+    const std::string &group,
+    std::vector<bench_result> &results)
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    if (!is_selected(options.groups, group)) {
+        return;
+    }
+
+    // Only generate inputs up to the largest size at which any selected
+    // method is run.
+    size_t max_log_size = 0;
+    for (const method_info &method : METHODS) {
+        if (is_selected(options.methods, method.name)) {
+            max_log_size = std::max(max_log_size, method.max_log_size);
+        }
+    }
+    max_log_size = std::min(max_log_size, options.max_log_size);
+    if (max_log_size < options.min_log_size) {
+        return;
+    }
+
+    // Generate inputs for the largest size. Smaller sizes use a prefix.
+    // Scalars are distinct, and generated with SHA512_rng, which is much
+    // faster than FieldT::random_element().
+    const size_t max_size = 1ul << max_log_size;
+    std::cerr << "Generating " << max_size << " elements of " << curve << "_"
+              << group << " ...\n";
+    std::vector<GroupT> bases;
+    bases.reserve(max_size);
+    for (size_t i = 0; i < std::min(max_size, NUM_DIFFERENT_ELEMENTS); ++i) {
+        bases.push_back(GroupT::random_element());
+    }
+    for (size_t i = bases.size(); i < max_size; ++i) {
+        bases.push_back(bases[i % NUM_DIFFERENT_ELEMENTS]);
+    }
+    std::vector<GroupT> special_bases;
+    if (is_selected(options.base_forms, "special")) {
+        special_bases = bases;
+        batch_to_special(special_bases);
+    }
+    std::vector<FieldT> scalars(max_size);
+    parallel_for(0, max_size, 0, [&scalars](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            scalars[i] = SHA512_rng<FieldT>(i);
+        }
+    });
+
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    for (size_t log_size = options.min_log_size; log_size <= max_log_size;
+         ++log_size) {
+        const size_t num_elements = 1ul << log_size;
+        for (const method_info &method : METHODS) {
+            if (log_size > method.max_log_size ||
+                !is_selected(options.methods, method.name)) {
+                continue;
+            }
+
+            for (const bool special : {false, true}) {
+                if (!is_selected(
+                        options.base_forms, special ? "special" : "normal")) {
+                    continue;
+                }
+
+                for (const size_t threads : options.threads) {
+                    parallel_set_num_threads(threads);
+
+                    bench_result result;
+                    result.curve = curve;
+                    result.group = group;
+                    result.method = method.name;
+                    result.base_form = special ? "special" : "normal";
+                    result.num_elements = num_elements;
+                    result.threads = parallel_num_threads();
+                    result.chunks = result.threads;
+                    result.name = "multi_exp/" + curve + "_" + group + "/" +
+                                  result.method + "/" + result.base_form +
+                                  "/" + std::to_string(num_elements) +
+                                  "/threads:" + std::to_string(result.threads);
+
+                    time_iterations(
+                        options.min_time,
+                        [&]() {
+                            if (special) {
+                                run_multi_exp<
+                                    GroupT,
+                                    multi_exp_base_form_special>(
+                                    method.method,
+                                    special_bases,
+                                    scalars,
+                                    num_elements,
+                                    result.chunks,
+                                    workspace);
+                            } else {
+                                run_multi_exp<
+                                    GroupT,
+                                    multi_exp_base_form_normal>(
+                                    method.method,
+                                    bases,
+                                    scalars,
+                                    num_elements,
+                                    result.chunks,
+                                    workspace);
+                            }
+                        },
+                        result);
+
+                    std::cerr << result.name << "  " << result.iterations
+                              << " iterations  " << (size_t)result.real_time
+                              << " ns\n";
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+
+    parallel_set_num_threads(0);
+}
+
+template<typename ppT>
+void bench_curve(
+    const bench_options &options,
+    const std::string &curve,
+    std::vector<bench_result> &results)
+{
+    if (!is_selected(options.curves, curve)) {
+        return;
+    }
+
+    ppT::init_public_params();
+    bench_group<G1<ppT>>(options, curve, "G1", results);
+    bench_group<G2<ppT>>(options, curve, "G2", results);
+}
+
+void write_json(
+    std::ostream &out,
+    const char *const executable,
+    const std::vector<bench_result> &results)
+{
+    char date[64];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(
+        date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+    out << "{\n"
+        << "  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"executable\": \"" << executable << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+        << ",\n"
+#ifdef NDEBUG
+        << "    \"library_build_type\": \"release\",\n"
+#else
+        << "    \"library_build_type\": \"debug\",\n"
+#endif
+#ifdef MULTICORE
+        << "    \"multicore\": true\n"
+#else
+        << "    \"multicore\": false\n"
+#endif
+        << "  },\n"
+        << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const bench_result &r = results[i];
+        out << ((i == 0) ? "\n" : ",\n") << "    {\n"
+            << "      \"name\": \"" << r.name << "\",\n"
+            << "      \"run_name\": \"" << r.name << "\",\n"
+            << "      \"run_type\": \"iteration\",\n"
+            << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"real_time\": " << r.real_time << ",\n"
+            << "      \"cpu_time\": " << r.cpu_time << ",\n"
+            << "      \"time_unit\": \"ns\",\n"
+            << "      \"curve\": \"" << r.curve << "\",\n"
+            << "      \"group\": \"" << r.group << "\",\n"
+            << "      \"method\": \"" << r.method << "\",\n"
+            << "      \"base_form\": \"" << r.base_form << "\",\n"
+            << "      \"num_elements\": " << r.num_elements << ",\n"
+            << "      \"threads\": " << r.threads << ",\n"
+            << "      \"chunks\": " << r.chunks << ",\n"
+            << "      \"ns_per_element\": " << r.real_time / r.num_elements
+            << "\n"
+            << "    }";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+void usage(const char *const argv0)
+{
+    std::cout
+        << "Usage: " << argv0 << " [flags]\n"
+        << "\n"
+        << "Flags:\n"
+        << "  --curves <c1,c2,...>      Curves (default all)\n"
+        << "  --groups <G1,G2>          Groups (default all)\n"
+        << "  --methods <m1,m2,...>     Methods (default all)\n"
+        << "  --base-forms <f1,f2>      Base forms: normal, special "
+           "(default all)\n"
+        << "  --threads <t1,t2,...>     Thread counts (default 1 and all)\n"
+        << "  --min-log-size <n>        Smallest size 2^n (default 4)\n"
+        << "  --max-log-size <n>        Largest size 2^n (default 24)\n"
+        << "  --min-time <seconds>      Minimum time per benchmark "
+           "(default 0.5)\n"
+        << "  --out <file>              Write JSON to file (default stdout)\n";
+}
+
+} // namespace
+
+int main(const int argc, char const *const *const argv)
+{
+    bench_options options;
+    for (size_t i = 1; i < (size_t)argc; ++i) {
+        const char *const arg = argv[i];
+        if (i + 1 == (size_t)argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (!strcmp(arg, "--curves")) {
+            options.curves = split_list(argv[++i]);
+        } else if (!strcmp(arg, "--groups")) {
+            options.groups = split_list(argv[++i]);
+        } else if (!strcmp(arg, "--methods")) {
+            options.methods = split_list(argv[++i]);
+        } else if (!strcmp(arg, "--base-forms")) {
+            options.base_forms = split_list(argv[++i]);
+        } else if (!strcmp(arg, "--threads")) {
+            for (const std::string &t : split_list(argv[++i])) {
+                options.threads.push_back(std::stoul(t));
+            }
+        } else if (!strcmp(arg, "--min-log-size")) {
+            options.min_log_size = std::stoul(argv[++i]);
+        } else if (!strcmp(arg, "--max-log-size")) {
+            options.max_log_size = std::stoul(argv[++i]);
+        } else if (!strcmp(arg, "--min-time")) {
+            options.min_time = std::stod(argv[++i]);
+        } else if (!strcmp(arg, "--out")) {
+            options.output = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (options.threads.empty()) {
+        options.threads.push_back(1);
+        if (parallel_num_threads() > 1) {
+            options.threads.push_back(parallel_num_threads());
+        }
+    }
+
+    inhibit_profiling_info = true;
+
+    std::vector<bench_result> results;
+    bench_curve<alt_bn128_pp>(options, "alt_bn128", results);
+    bench_curve<bls12_377_pp>(options, "bls12_377", results);
+    bench_curve<bls12_381_pp>(options, "bls12_381", results);
+    bench_curve<bw6_761_pp>(options, "bw6_761", results);
+    bench_curve<mnt4_pp>(options, "mnt4", results);
+    bench_curve<mnt6_pp>(options, "mnt6", results);
+    bench_curve<edwards_pp>(options, "edwards", results);
+#ifdef CURVE_BN128
+    bench_curve<bn128_pp>(options, "bn128", results);
+#endif
+
+    if (options.output.empty()) {
+        write_json(std::cout, argv[0], results);
+    } else {
+        std::ofstream out(options.output.c_str());
+        write_json(out, argv[0], results);
+    }
+
+    return 0;
+}
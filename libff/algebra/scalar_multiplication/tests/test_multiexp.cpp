@@ -1,9 +1,13 @@
 #include "libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp"
 #include "libff/algebra/curves/bls12_377/bls12_377_pp.hpp"
 #include "libff/algebra/curves/bls12_381/bls12_381_pp.hpp"
+#include "libff/algebra/scalar_multiplication/fixed_base.hpp"
 #include "libff/algebra/scalar_multiplication/multiexp.hpp"
+#include "libff/algebra/scalar_multiplication/multiexp_stream.hpp"
+#include "libff/algebra/scalar_multiplication/wnaf.hpp"
 
 #include <gtest/gtest.h>
+#include <sstream>
 
 using namespace libff;
 
@@ -152,10 +156,15 @@ void test_multiexp_inner()
     const GroupT expected = FieldT(expected_unencoded) * GroupT::one();
 
     // Actual value
+    internal::multi_exp_arena<GroupT, FieldT> arena;
     const GroupT actual =
         internal::multi_exp_implementation<GroupT, FieldT, Method, BaseForm>::
             multi_exp_inner(
-                bases.begin(), bases.end(), exponents.begin(), exponents.end());
+                bases.begin(),
+                bases.end(),
+                exponents.begin(),
+                exponents.end(),
+                arena);
 
     ASSERT_EQ(expected, actual);
 }
@@ -274,6 +283,528 @@ void test_multi_exp_group_method()
     test_multi_exp_config<GroupT, Method, multi_exp_base_form_special>(257);
 }
 
+template<typename GroupT> void test_multi_exp_straus_zeros()
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    // Zero bases and zero scalars are skipped by the Straus method.
+    std::vector<GroupT> bases{{
+        GroupT::random_element(),
+        GroupT::zero(),
+        GroupT::random_element(),
+        GroupT::random_element(),
+    }};
+    std::vector<FieldT> scalars{{
+        FieldT::random_element(),
+        FieldT::random_element(),
+        FieldT::zero(),
+        -FieldT::one(),
+    }};
+
+    const GroupT expect = multi_exp<
+        GroupT,
+        FieldT,
+        multi_exp_method_naive_plain,
+        multi_exp_base_form_normal>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+    const GroupT actual = multi_exp<GroupT, FieldT, multi_exp_method_straus>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+    ASSERT_EQ(expect, actual);
+
+    const GroupT zero = multi_exp<GroupT, FieldT, multi_exp_method_straus>(
+        bases.begin() + 1,
+        bases.begin() + 3,
+        scalars.begin() + 1,
+        scalars.begin() + 3,
+        1);
+    ASSERT_EQ(GroupT::zero(), zero);
+}
+
+template<typename GroupT> void test_multi_exp_numa()
+{
+    using FieldT = typename GroupT::scalar_field;
+    const size_t num_elements = 517;
+
+    std::vector<GroupT> bases;
+    std::vector<FieldT> scalars;
+    for (size_t i = 0; i < num_elements; ++i) {
+        bases.push_back(FieldT(i + 3) * GroupT::one());
+        scalars.push_back(FieldT::random_element());
+    }
+    const GroupT expect = multi_exp<GroupT, FieldT, multi_exp_method_auto>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+
+    // Partitions cover the original vector, in order.
+    const numa_partitioned_vector<GroupT> partitioned(
+        bases.begin(), bases.end());
+    ASSERT_EQ(numa_num_nodes(), partitioned.num_partitions());
+    ASSERT_EQ(num_elements, partitioned.size());
+    for (size_t i = 0; i < partitioned.num_partitions(); ++i) {
+        const std::vector<GroupT> &partition = partitioned.partition(i);
+        const size_t offset = partitioned.partition_offset(i);
+        for (size_t j = 0; j < partition.size(); ++j) {
+            ASSERT_EQ(bases[offset + j], partition[j]);
+        }
+    }
+
+    ASSERT_EQ(
+        expect,
+        (multi_exp_numa<GroupT, FieldT, multi_exp_method_BDLO12_signed>(
+            partitioned, scalars.begin(), scalars.end())));
+    ASSERT_EQ(
+        expect,
+        (multi_exp_numa<GroupT, FieldT, multi_exp_method_bos_coster>(
+            partitioned, scalars.begin(), scalars.end(), 3)));
+
+    // Partitioned elements read from a stream.
+    std::stringstream ss;
+    for (const GroupT &base : bases) {
+        group_write<encoding_binary, form_montgomery, compression_off>(
+            base, ss);
+    }
+    const numa_partitioned_vector<GroupT> from_stream =
+        numa_partitioned_elements_from_stream<
+            form_montgomery,
+            compression_off,
+            GroupT>(ss, num_elements);
+    ASSERT_EQ(
+        expect,
+        (multi_exp_numa<
+            GroupT,
+            FieldT,
+            multi_exp_method_BDLO12_signed,
+            multi_exp_base_form_special>(
+            from_stream, scalars.begin(), scalars.end())));
+}
+
+template<typename GroupT> void test_multi_exp_workspace()
+{
+    using FieldT = typename GroupT::scalar_field;
+    const size_t num_elements = 300;
+
+    std::vector<GroupT> bases;
+    std::vector<FieldT> scalars;
+    for (size_t i = 0; i < num_elements; ++i) {
+        bases.push_back(FieldT(i + 3) * GroupT::one());
+        scalars.push_back(FieldT::random_element());
+    }
+    batch_to_special(bases);
+    const GroupT expect = multi_exp<GroupT, FieldT, multi_exp_method_auto>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+
+    // Buffers are allocated on the first call, and reused (without growing)
+    // by later calls of the same size.
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    ASSERT_EQ(0u, workspace.num_bytes());
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, multi_exp_method_BDLO12_signed>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            4,
+            workspace)));
+    const size_t num_bytes = workspace.num_bytes();
+    ASSERT_LT(0u, num_bytes);
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, multi_exp_method_BDLO12_signed>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            4,
+            workspace)));
+    ASSERT_EQ(num_bytes, workspace.num_bytes());
+
+    // The same workspace can be used with other methods and sizes (including
+    // stale buffer contents from previous calls).
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, multi_exp_method_straus>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            2,
+            workspace)));
+    ASSERT_EQ(
+        expect,
+        (multi_exp<
+            GroupT,
+            FieldT,
+            multi_exp_method_BDLO12,
+            multi_exp_base_form_special>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            1,
+            workspace)));
+    ASSERT_EQ(
+        (multi_exp<GroupT, FieldT, multi_exp_method_naive>(
+            bases.begin(),
+            bases.begin() + 5,
+            scalars.begin(),
+            scalars.begin() + 5,
+            1)),
+        (multi_exp<GroupT, FieldT, multi_exp_method_auto>(
+            bases.begin(),
+            bases.begin() + 5,
+            scalars.begin(),
+            scalars.begin() + 5,
+            1,
+            workspace)));
+
+    // Streaming variant, holding the buckets for all rounds.
+    std::stringstream ss;
+    for (const GroupT &base : bases) {
+        group_write<encoding_binary, form_montgomery, compression_off>(
+            base, ss);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        ss.seekg(0);
+        ASSERT_EQ(
+            expect,
+            (multi_exp_stream<form_montgomery, compression_off>(
+                ss, scalars, workspace)));
+    }
+
+    workspace.release();
+    ASSERT_EQ(0u, workspace.num_bytes());
+}
+
+template<typename GroupT, multi_exp_method Method>
+void test_multi_exp_prepared_method(
+    const std::vector<GroupT> &bases,
+    const prepared_scalars<typename GroupT::scalar_field> &scalars,
+    const GroupT &expect)
+{
+    using FieldT = typename GroupT::scalar_field;
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, Method>(
+            bases.begin(), bases.end(), scalars, 1)));
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, Method>(
+            bases.begin(), bases.end(), scalars, 3)));
+}
+
+template<typename GroupT>
+void test_multi_exp_prepared(
+    const std::vector<typename GroupT::scalar_field> &scalars,
+    const prepared_scalars<typename GroupT::scalar_field> &prepared)
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    std::vector<GroupT> bases;
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        bases.push_back(FieldT(i + 3) * GroupT::one());
+    }
+    const GroupT expect = multi_exp<GroupT, FieldT, multi_exp_method_naive>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_naive>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_naive_plain>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_bos_coster>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_BDLO12>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_BDLO12_signed>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_straus>(
+        bases, prepared, expect);
+    test_multi_exp_prepared_method<GroupT, multi_exp_method_auto>(
+        bases, prepared, expect);
+
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    ASSERT_EQ(
+        expect,
+        (multi_exp<GroupT, FieldT, multi_exp_method_BDLO12_signed>(
+            bases.begin(), bases.end(), prepared, 2, workspace)));
+
+    ASSERT_EQ(
+        expect,
+        (multi_exp_filter_one_zero<
+            GroupT,
+            FieldT,
+            multi_exp_method_BDLO12_signed>(
+            bases.begin(), bases.end(), prepared, 2)));
+}
+
+template<typename GroupT1, typename GroupT2> void test_prepared_scalars()
+{
+    using FieldT = typename GroupT1::scalar_field;
+    const size_t num_elements = 301;
+
+    // Include zero and one scalars (for multi_exp_filter_one_zero).
+    std::vector<FieldT> scalars;
+    for (size_t i = 0; i < num_elements; ++i) {
+        if (i % 7 == 0) {
+            scalars.push_back(FieldT::zero());
+        } else if (i % 7 == 1) {
+            scalars.push_back(FieldT::one());
+        } else {
+            scalars.push_back(FieldT::random_element());
+        }
+    }
+    scalars[2] = -FieldT::one();
+
+    // Bigints only.
+    const prepared_scalars<FieldT> bigints_only(scalars.begin(), scalars.end());
+    ASSERT_EQ(num_elements, bigints_only.size());
+    ASSERT_EQ(0u, bigints_only.digit_size());
+    ASSERT_EQ(0u, bigints_only.num_digits());
+    for (size_t i = 0; i < num_elements; ++i) {
+        ASSERT_EQ(scalars[i].as_bigint(), bigints_only.bigints()[i]);
+    }
+
+    // With signed digits, which must recombine to the original scalars.
+    const size_t c = bdlo12_signed_optimal_c(num_elements / 2);
+    const prepared_scalars<FieldT> prepared(scalars.begin(), scalars.end(), c);
+    ASSERT_EQ(c, prepared.digit_size());
+    ASSERT_EQ((prepared.num_bits() + 2 + c - 1) / c, prepared.num_digits());
+    const FieldT radix = FieldT(1ul << c);
+    for (size_t i = 0; i < num_elements; ++i) {
+        FieldT value = FieldT::zero();
+        for (size_t j = prepared.num_digits() - 1; j < prepared.num_digits();
+             --j) {
+            value = value * radix + FieldT(prepared.signed_digits(j)[i]);
+        }
+        ASSERT_EQ(scalars[i], value);
+    }
+
+    // Subsets hold the selected bigints and digits.
+    const std::vector<size_t> indices{{5, 2, 300}};
+    const prepared_scalars<FieldT> subset = prepared.subset(indices);
+    ASSERT_EQ(indices.size(), subset.size());
+    ASSERT_EQ(prepared.num_digits(), subset.num_digits());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        ASSERT_EQ(prepared.bigints()[indices[i]], subset.bigints()[i]);
+        for (size_t j = 0; j < prepared.num_digits(); ++j) {
+            ASSERT_EQ(
+                prepared.signed_digits(j)[indices[i]],
+                subset.signed_digits(j)[i]);
+        }
+    }
+
+    // The same prepared scalars are used with both groups.
+    test_multi_exp_prepared<GroupT1>(scalars, bigints_only);
+    test_multi_exp_prepared<GroupT1>(scalars, prepared);
+    test_multi_exp_prepared<GroupT2>(scalars, prepared);
+}
+
+template<typename GroupT, multi_exp_base_form BaseForm>
+void test_multi_exp_filter_one_zero_form(
+    const std::vector<GroupT> &bases,
+    const std::vector<typename GroupT::scalar_field> &scalars,
+    const multi_exp_filter_stats &expect_stats)
+{
+    using FieldT = typename GroupT::scalar_field;
+    const GroupT expect = multi_exp<GroupT, FieldT, multi_exp_method_naive>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+
+    multi_exp_filter_stats stats;
+    ASSERT_EQ(
+        expect,
+        (multi_exp_filter_one_zero<
+            GroupT,
+            FieldT,
+            multi_exp_method_BDLO12_signed,
+            BaseForm>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            3,
+            &stats)));
+    ASSERT_EQ(expect_stats.num_zero, stats.num_zero);
+    ASSERT_EQ(expect_stats.num_one, stats.num_one);
+    ASSERT_EQ(expect_stats.num_small, stats.num_small);
+    ASSERT_EQ(expect_stats.num_other, stats.num_other);
+
+    ASSERT_EQ(
+        expect,
+        (multi_exp_filter_one_zero<
+            GroupT,
+            FieldT,
+            multi_exp_method_straus,
+            BaseForm>(
+            bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1)));
+
+    const prepared_scalars<FieldT> prepared(
+        scalars.begin(), scalars.end(), bdlo12_signed_optimal_c(100));
+    stats = multi_exp_filter_stats();
+    ASSERT_EQ(
+        expect,
+        (multi_exp_filter_one_zero<
+            GroupT,
+            FieldT,
+            multi_exp_method_auto,
+            BaseForm>(bases.begin(), bases.end(), prepared, 2, &stats)));
+    ASSERT_EQ(expect_stats.num_zero, stats.num_zero);
+    ASSERT_EQ(expect_stats.num_one, stats.num_one);
+    ASSERT_EQ(expect_stats.num_small, stats.num_small);
+    ASSERT_EQ(expect_stats.num_other, stats.num_other);
+}
+
+template<typename GroupT> void test_multi_exp_filter_one_zero()
+{
+    using FieldT = typename GroupT::scalar_field;
+    const size_t num_elements = 3000;
+
+    // Zeros, ones, small positive and negative values (including the bounds
+    // of the small-scalar path) and other values. There are enough elements
+    // to be partitioned into several ranges.
+    std::vector<GroupT> bases;
+    std::vector<FieldT> scalars;
+    multi_exp_filter_stats expect_stats;
+    for (size_t i = 0; i < num_elements; ++i) {
+        bases.push_back(FieldT(i + 1) * GroupT::one());
+        switch (i % 8) {
+        case 0:
+            scalars.push_back(FieldT::zero());
+            ++expect_stats.num_zero;
+            break;
+        case 1:
+            scalars.push_back(FieldT::one());
+            ++expect_stats.num_one;
+            break;
+        case 2:
+            scalars.push_back(FieldT(i % 256 + 1));
+            ++expect_stats.num_small;
+            break;
+        case 3:
+            scalars.push_back(-FieldT(i % 256 + 1));
+            ++expect_stats.num_small;
+            break;
+        case 4:
+            scalars.push_back(FieldT(multi_exp_filter_max_small + 1));
+            ++expect_stats.num_other;
+            break;
+        case 5:
+            scalars.push_back(-FieldT(multi_exp_filter_max_small + 1));
+            ++expect_stats.num_other;
+            break;
+        default:
+            scalars.push_back(FieldT::random_element());
+            ++expect_stats.num_other;
+            break;
+        }
+    }
+    scalars[2] = -FieldT::one();
+    scalars[10] = FieldT(multi_exp_filter_max_small);
+    scalars[11] = -FieldT(multi_exp_filter_max_small);
+
+    test_multi_exp_filter_one_zero_form<GroupT, multi_exp_base_form_normal>(
+        bases, scalars, expect_stats);
+
+    batch_to_special(bases);
+    test_multi_exp_filter_one_zero_form<GroupT, multi_exp_base_form_special>(
+        bases, scalars, expect_stats);
+
+    // Only small scalars.
+    const std::vector<GroupT> small_bases(bases.begin(), bases.begin() + 4);
+    const std::vector<FieldT> small_scalars(
+        scalars.begin(), scalars.begin() + 4);
+    multi_exp_filter_stats small_stats;
+    small_stats.num_zero = 1;
+    small_stats.num_one = 1;
+    small_stats.num_small = 2;
+    test_multi_exp_filter_one_zero_form<GroupT, multi_exp_base_form_special>(
+        small_bases, small_scalars, small_stats);
+}
+
+template<typename GroupT, multi_exp_base_form BaseForm>
+void test_multi_exp_small_config(
+    const std::vector<GroupT> &bases, const size_t num_bits)
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    // Scalars (including 0 and the maximum value) spread over num_bits bits.
+    std::vector<uint64_t> scalars;
+    std::vector<FieldT> field_scalars;
+    const uint64_t max_value =
+        (num_bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << num_bits) - 1);
+    for (size_t i = 0; i < bases.size(); ++i) {
+        const uint64_t value =
+            (i == 1) ? max_value
+                     : ((i * 0x9e3779b97f4a7c15ull) >> (64 - num_bits));
+        scalars.push_back(value);
+        field_scalars.push_back(FieldT((long)value, true));
+    }
+
+    const GroupT expect = multi_exp<GroupT, FieldT, multi_exp_method_naive>(
+        bases.begin(),
+        bases.end(),
+        field_scalars.begin(),
+        field_scalars.end(),
+        1);
+    ASSERT_EQ(
+        expect,
+        (multi_exp_small<GroupT, FieldT, BaseForm>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            num_bits,
+            1)));
+
+    multi_exp_workspace<GroupT, FieldT> workspace;
+    ASSERT_EQ(
+        expect,
+        (multi_exp_small<GroupT, FieldT, BaseForm>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            num_bits,
+            3,
+            workspace)));
+
+    // The scalar field defaults to that of GroupT.
+    ASSERT_EQ(
+        expect,
+        multi_exp_small<GroupT>(
+            bases.begin(),
+            bases.end(),
+            scalars.begin(),
+            scalars.end(),
+            num_bits,
+            2));
+}
+
+template<typename GroupT> void test_multi_exp_small()
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    std::vector<GroupT> bases;
+    for (size_t i = 0; i < 150; ++i) {
+        bases.push_back(FieldT::random_element() * GroupT::one());
+    }
+
+    for (const size_t num_bits : {1, 3, 8, 32, 64}) {
+        test_multi_exp_small_config<GroupT, multi_exp_base_form_normal>(
+            bases, num_bits);
+    }
+
+    batch_to_special(bases);
+    test_multi_exp_small_config<GroupT, multi_exp_base_form_special>(
+        bases, 16);
+
+    // Window sizes grow with the number of entries, and are bounded by the
+    // number of bits.
+    ASSERT_EQ(1u, internal::multi_exp_small_optimal_c(1000000, 1));
+    ASSERT_EQ(8u, internal::multi_exp_small_optimal_c(1000000, 8));
+    ASSERT_LE(
+        internal::multi_exp_small_optimal_c(100, 64),
+        internal::multi_exp_small_optimal_c(1000000, 64));
+}
+
 template<typename GroupT> void test_multi_exp()
 {
     test_multi_exp_group_method<GroupT, multi_exp_method_naive>();
@@ -281,6 +812,94 @@ template<typename GroupT> void test_multi_exp()
     test_multi_exp_group_method<GroupT, multi_exp_method_bos_coster>();
     test_multi_exp_group_method<GroupT, multi_exp_method_BDLO12>();
     test_multi_exp_group_method<GroupT, multi_exp_method_BDLO12_signed>();
+    test_multi_exp_group_method<GroupT, multi_exp_method_straus>();
+    test_multi_exp_group_method<GroupT, multi_exp_method_auto>();
+    test_multi_exp_straus_zeros<GroupT>();
+    test_multi_exp_numa<GroupT>();
+    test_multi_exp_workspace<GroupT>();
+    test_multi_exp_filter_one_zero<GroupT>();
+    test_multi_exp_small<GroupT>();
+}
+
+template<typename GroupT> void test_fixed_base_mul()
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    // Edge cases, including scalars whose highest-order signed digit is
+    // negative.
+    std::vector<FieldT> scalars{{
+        FieldT::zero(),
+        FieldT::one(),
+        -FieldT::one(),
+        FieldT(2),
+        -FieldT(2),
+    }};
+    for (size_t i = 0; i < 8; ++i) {
+        scalars.push_back(FieldT::random_element());
+    }
+
+    const GroupT base = FieldT::random_element() * GroupT::one();
+    const fixed_base_table<GroupT> table(base, 5);
+    for (const FieldT &s : scalars) {
+        ASSERT_EQ(s * base, table.mul(s));
+        ASSERT_EQ(s * GroupT::one(), mul_generator<GroupT>(s));
+    }
+
+    const std::vector<GroupT> results = batch_mul_generator<GroupT>(scalars);
+    ASSERT_EQ(scalars.size(), results.size());
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        ASSERT_EQ(scalars[i] * GroupT::one(), results[i]);
+    }
+}
+
+template<typename GroupT> void test_wnaf_precomputed(const size_t window_size)
+{
+    using FieldT = typename GroupT::scalar_field;
+
+    const GroupT base = GroupT::random_element();
+    const wnaf_precomputed<GroupT> precomputed(base, window_size);
+    ASSERT_EQ(window_size, precomputed.window_size());
+
+    std::vector<FieldT> scalars{{
+        FieldT::zero(),
+        FieldT::one(),
+        -FieldT::one(),
+    }};
+    for (size_t i = 0; i < 8; ++i) {
+        scalars.push_back(FieldT::random_element());
+    }
+
+    for (const FieldT &s : scalars) {
+        ASSERT_EQ(s * base, precomputed.mul(s.as_bigint()));
+        ASSERT_EQ(
+            fixed_window_wnaf_exp(window_size, base, s.as_bigint()),
+            precomputed.mul(s.as_bigint()));
+    }
+
+    // A zero base cannot be converted to special form.
+    const wnaf_precomputed<GroupT> zero_precomputed(
+        GroupT::zero(), window_size);
+    ASSERT_EQ(GroupT::zero(), zero_precomputed.mul(scalars.back().as_bigint()));
+}
+
+TEST(MultiExpTest, TestWnafPrecomputed)
+{
+    for (size_t window_size = 1; window_size < 6; ++window_size) {
+        test_wnaf_precomputed<alt_bn128_G1>(window_size);
+        test_wnaf_precomputed<alt_bn128_G2>(window_size);
+        test_wnaf_precomputed<bls12_377_G1>(window_size);
+        test_wnaf_precomputed<bls12_381_G2>(window_size);
+    }
+}
+
+TEST(MultiExpTest, TestFixedBaseMul)
+{
+    test_fixed_base_mul<alt_bn128_G1>();
+    test_fixed_base_mul<alt_bn128_G2>();
+    test_fixed_base_mul<bls12_377_G1>();
+    test_fixed_base_mul<bls12_377_G2>();
+    test_fixed_base_mul<bls12_381_G1>();
+    test_fixed_base_mul<bls12_381_G2>();
 }
 
 TEST(MultiExpTest, TestMultiExpAccumulateBucketsAltBN128)
@@ -307,6 +926,12 @@ TEST(MultiExpTest, TestMultiExpSignedDigitsRoundBLS12_377)
     test_multiexp_signed_digits_round<bls12_377_G2>();
 }
 
+TEST(MultiExpTest, TestPreparedScalars)
+{
+    test_prepared_scalars<alt_bn128_G1, alt_bn128_G2>();
+    test_prepared_scalars<bls12_377_G1, bls12_377_G2>();
+}
+
 TEST(MultiExpTest, TestMultiExpAltBN128)
 {
     test_multi_exp<alt_bn128_G1>();
@@ -341,6 +966,30 @@ alt_bn128_G1 g1_from_string(const std::string &str)
     return v;
 }
 
+TEST(MultiExpTest, TestSelectMethod)
+{
+    // Straus' method for small inputs, and BDLO12_signed for large inputs.
+    ASSERT_EQ(
+        multi_exp_method_straus, multi_exp_select_method<alt_bn128_G1>(16));
+    ASSERT_EQ(
+        multi_exp_method_straus, multi_exp_select_method<bls12_381_G2>(16));
+    ASSERT_EQ(
+        multi_exp_method_BDLO12_signed,
+        multi_exp_select_method<alt_bn128_G1>(1 << 20));
+    ASSERT_EQ(
+        multi_exp_method_BDLO12_signed,
+        multi_exp_select_method<bls12_381_G2>(1 << 20));
+
+    // Bos-Coster is used up to larger sizes in groups with more expensive
+    // operations.
+    ASSERT_EQ(
+        multi_exp_method_BDLO12_signed,
+        multi_exp_select_method<alt_bn128_G1>(8192));
+    ASSERT_EQ(
+        multi_exp_method_bos_coster,
+        multi_exp_select_method<alt_bn128_G2>(8192));
+}
+
 TEST(MultiExpTest, TestEdgeCase1)
 {
     // Shows up an edge case in which the highest-order digit of the scalar is
@@ -375,6 +1024,7 @@ TEST(MultiExpTest, TestEdgeCase1)
         scalars.begin(),
         scalars.end(),
         2);
+    internal::multi_exp_arena<alt_bn128_G1, alt_bn128_Fr> arena;
     const alt_bn128_G1 actual = internal::multi_exp_implementation<
         alt_bn128_G1,
         alt_bn128_Fr,
@@ -384,7 +1034,8 @@ TEST(MultiExpTest, TestEdgeCase1)
             base_elements.begin(),
             base_elements.end(),
             scalars.begin(),
-            scalars.end());
+            scalars.end(),
+            arena);
 
     ASSERT_EQ(expect, actual);
 }
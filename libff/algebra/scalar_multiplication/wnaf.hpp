@@ -19,6 +19,14 @@
 namespace libff
 {
 
+/// Write the wNAF representation of the given scalar relative to the given
+/// window size into a caller-supplied buffer, which must hold at least
+/// scalar.max_bits() + 1 entries. Returns the number of digits written. The
+/// most significant digit (if any) is always non-zero.
+template<mp_size_t n>
+size_t find_wnaf_digits(
+    long *wnaf, const size_t window_size, const bigint<n> &scalar);
+
 /// Find the wNAF representation of the given scalar relative to the given
 /// window size, reusing the given vector to store it.
 template<mp_size_t n>
@@ -51,6 +59,26 @@ template<typename T, mp_size_t n>
 T opt_window_wnaf_exp(
     const T &base, const bigint<n> &scalar, const size_t scalar_bits);
 
+/// The odd multiples B, 3B, ..., (2^window_size - 1)B of a fixed base B, for
+/// repeated wNAF exponentiation of B by many scalars. Where all multiples are
+/// non-zero, the table is batch-converted to special form so that mixed
+/// addition can be used.
+template<typename T> class wnaf_precomputed
+{
+public:
+    wnaf_precomputed(const T &base, const size_t window_size);
+
+    /// Compute scalar * base. No memory is allocated.
+    template<mp_size_t n> T mul(const bigint<n> &scalar) const;
+
+    size_t window_size() const;
+
+protected:
+    size_t _window_size;
+    bool _is_special;
+    std::vector<T> _table;
+};
+
 } // namespace libff
 
 #include <libff/algebra/scalar_multiplication/wnaf.tcc>
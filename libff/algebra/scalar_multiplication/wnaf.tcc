@@ -15,19 +15,19 @@
 #ifndef WNAF_TCC_
 #define WNAF_TCC_
 
+#include <cassert>
+#include <cstdlib>
 #include <gmp.h>
 
 namespace libff
 {
 
 template<mp_size_t n>
-void update_wnaf(
-    std::vector<long> &wnaf, const size_t window_size, const bigint<n> &scalar)
+size_t find_wnaf_digits(
+    long *wnaf, const size_t window_size, const bigint<n> &scalar)
 {
-    const size_t length = scalar.max_bits(); // upper bound
-    wnaf.resize(length + 1);
     bigint<n> c = scalar;
-    long j = 0;
+    size_t j = 0;
     while (!c.is_zero()) {
         long u;
         if ((c.data[0] & 1) == 1) {
@@ -50,7 +50,16 @@ void update_wnaf(
         mpn_rshift(c.data, c.data, n, 1); // c = c/2
     }
 
-    wnaf.resize(j);
+    return j;
+}
+
+template<mp_size_t n>
+void update_wnaf(
+    std::vector<long> &wnaf, const size_t window_size, const bigint<n> &scalar)
+{
+    const size_t length = scalar.max_bits(); // upper bound
+    wnaf.resize(length + 1);
+    wnaf.resize(find_wnaf_digits(wnaf.data(), window_size, scalar));
 }
 
 template<mp_size_t n>
@@ -124,6 +133,58 @@ T opt_window_wnaf_exp(
     }
 }
 
+template<typename T>
+wnaf_precomputed<T>::wnaf_precomputed(const T &base, const size_t window_size)
+    : _window_size(window_size), _is_special(false)
+{
+    assert(window_size > 0);
+    _table.reserve(1ul << (window_size - 1));
+    T tmp = base;
+    const T dbl = base.dbl();
+    for (size_t i = 0; i < 1ul << (window_size - 1); ++i) {
+        _table.push_back(tmp);
+        tmp = tmp + dbl;
+    }
+
+    // A multiple may be zero if base is zero, or has small order.
+    for (const T &t : _table) {
+        if (t.is_zero()) {
+            return;
+        }
+    }
+
+    T::batch_to_special_all_non_zeros(_table);
+    _is_special = true;
+}
+
+template<typename T>
+template<mp_size_t n>
+T wnaf_precomputed<T>::mul(const bigint<n> &scalar) const
+{
+    long naf[n * GMP_NUMB_BITS + 1];
+    const size_t naf_size = find_wnaf_digits(naf, _window_size, scalar);
+
+    T res = T::zero();
+    for (size_t i = naf_size - 1; i < naf_size; --i) {
+        if (i != naf_size - 1) {
+            res = res.dbl();
+        }
+
+        if (naf[i] != 0) {
+            const T &entry = _table[std::abs(naf[i]) / 2];
+            const T addend = (naf[i] > 0) ? entry : -entry;
+            res = _is_special ? res.mixed_add(addend) : res + addend;
+        }
+    }
+
+    return res;
+}
+
+template<typename T> size_t wnaf_precomputed<T>::window_size() const
+{
+    return _window_size;
+}
+
 } // namespace libff
 
 #endif // WNAF_TCC_
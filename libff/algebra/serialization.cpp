@@ -14,6 +14,27 @@
 namespace libff
 {
 
+void size_write_binary(const size_t size, std::ostream &out_s)
+{
+    const uint32_t n = (uint32_t)size;
+    assert((size_t)n == size);
+    const char bytes[4] = {
+        (char)(n >> 24), (char)(n >> 16), (char)(n >> 8), (char)n};
+    out_s.write(bytes, sizeof(bytes));
+}
+
+size_t size_read_binary(std::istream &in_s)
+{
+    unsigned char bytes[4];
+    in_s.read((char *)bytes, sizeof(bytes));
+    if (!in_s) {
+        throw std::runtime_error("truncated size");
+    }
+
+    return ((size_t)bytes[0] << 24) | ((size_t)bytes[1] << 16) |
+           ((size_t)bytes[2] << 8) | (size_t)bytes[3];
+}
+
 // Converts a single character to a nibble. Throws std::invalid_argument if the
 // character is not hex.
 uint8_t char_to_nibble(const char c)
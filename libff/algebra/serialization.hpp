@@ -9,6 +9,10 @@
 #ifndef __LIBFF_ALGEBRA_SERIALIZATION_HPP__
 #define __LIBFF_ALGEBRA_SERIALIZATION_HPP__
 
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
 #include <stdint.h>
 #include <string>
 
@@ -33,6 +37,104 @@ enum compression_t : uint8_t {
     compression_on = 1,
 };
 
+/// Write a size (for example, the number of elements in a sequence) as a
+/// 4-byte big-endian value.
+void size_write_binary(const size_t size, std::ostream &out_s);
+
+/// Read a size written by size_write_binary. Throws std::runtime_error if the
+/// stream is truncated.
+size_t size_read_binary(std::istream &in_s);
+
+/// Output to a fixed, caller-owned region of memory. Implements the subset of
+/// the std::ostream interface used by the field and group codecs, without
+/// virtual calls, locales or stream state. Throws std::runtime_error if the
+/// buffer is too small.
+class buffer_writer
+{
+public:
+    buffer_writer(void *buffer, const size_t size)
+        : _begin((char *)buffer), _cur(_begin), _end(_begin + size)
+    {
+    }
+
+    buffer_writer &write(const char *data, const size_t size)
+    {
+        if ((size_t)(_end - _cur) < size) {
+            throw std::runtime_error("buffer too small");
+        }
+        memcpy(_cur, data, size);
+        _cur += size;
+        return *this;
+    }
+
+    buffer_writer &operator<<(const char c) { return write(&c, 1); }
+
+    buffer_writer &operator<<(const std::string &s)
+    {
+        return write(s.data(), s.size());
+    }
+
+    size_t num_written() const { return _cur - _begin; }
+
+protected:
+    char *const _begin;
+    char *_cur;
+    char *const _end;
+};
+
+/// Input from a fixed, caller-owned region of memory. Implements the subset of
+/// the std::istream interface used by the field and group codecs, without
+/// virtual calls, locales or stream state. Throws std::runtime_error if the
+/// end of the buffer is reached.
+class buffer_reader
+{
+public:
+    buffer_reader(const void *buffer, const size_t size)
+        : _begin((const char *)buffer), _cur(_begin), _end(_begin + size)
+    {
+    }
+
+    buffer_reader &read(char *data, const size_t size)
+    {
+        if ((size_t)(_end - _cur) < size) {
+            throw std::runtime_error("unexpected end of buffer");
+        }
+        memcpy(data, _cur, size);
+        _cur += size;
+        return *this;
+    }
+
+    /// As for std::istream, leading whitespace is skipped.
+    buffer_reader &operator>>(char &c)
+    {
+        while (_cur < _end && isspace((unsigned char)*_cur)) {
+            ++_cur;
+        }
+        return read(&c, 1);
+    }
+
+    /// As std::getline. The delimiter is consumed, but not appended to s.
+    friend buffer_reader &getline(
+        buffer_reader &in, std::string &s, const char delim)
+    {
+        const char *const end =
+            (const char *)memchr(in._cur, delim, in._end - in._cur);
+        if (end == nullptr) {
+            throw std::runtime_error("delimiter not found");
+        }
+        s.assign(in._cur, end);
+        in._cur = end + 1;
+        return in;
+    }
+
+    size_t num_read() const { return _cur - _begin; }
+
+protected:
+    const char *const _begin;
+    const char *_cur;
+    const char *const _end;
+};
+
 void hex_to_bytes_reversed(const std::string &hex, void *dest, size_t bytes);
 
 /// "prefix" here refers to "0x"
@@ -0,0 +1,68 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/common/concurrent_fifo.hpp"
+
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace libff
+{
+
+concurrent_waiter::concurrent_waiter()
+    // Spinning cannot succeed unless the other side is running concurrently,
+    // so it is disabled on single-core machines.
+    : _spin_iterations(
+          std::thread::hardware_concurrency() > 1 ? min_spin_iterations : 0)
+    , _num_blocked(0)
+{
+}
+
+void concurrent_waiter::notify()
+{
+    // See the comment in wait().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_num_blocked.load(std::memory_order_relaxed) != 0) {
+        // Taking the lock ensures that any thread which has registered as
+        // blocked is either inside _condition.wait(), or has not yet
+        // re-checked the state.
+        std::lock_guard<std::mutex> lock(_mutex);
+        _condition.notify_all();
+    }
+}
+
+void concurrent_waiter::spin_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+void concurrent_waiter::adapt_spin_iterations(
+    const size_t spin_iterations, bool succeeded)
+{
+    // Spin for longer if spinning was recently sufficient, and for less time
+    // if not. The update is racy, but any value in range is acceptable.
+    if (spin_iterations == 0) {
+        return;
+    }
+    if (succeeded) {
+        if (spin_iterations < max_spin_iterations) {
+            _spin_iterations.store(
+                2 * spin_iterations, std::memory_order_relaxed);
+        }
+    } else if (spin_iterations > min_spin_iterations) {
+        _spin_iterations.store(spin_iterations / 2, std::memory_order_relaxed);
+    }
+}
+
+} // namespace libff
@@ -10,11 +10,53 @@
 #define __LIBFF_COMMON_CONCURRENT_FIFO_HPP__
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 
 namespace libff
 {
 
+/// Size in bytes assumed for cache lines. State written by different threads
+/// is aligned to this, to avoid false sharing.
+constexpr size_t cache_line_size = 64;
+
+/// Waiting strategy for threads waiting for a concurrent fifo to change
+/// state. Waiting threads first spin, then yield, and finally block until
+/// notified. The number of spin iterations adapts to whether recent waits
+/// completed while spinning, so that short waits avoid the latency of
+/// blocking, and long waits (e.g. for data from disk) do not occupy a core.
+/// notify() only requires a system call if some thread is blocked.
+class concurrent_waiter
+{
+public:
+    concurrent_waiter(const concurrent_waiter &) = delete;
+    concurrent_waiter &operator=(const concurrent_waiter &) = delete;
+
+    concurrent_waiter();
+
+    /// Call try_fn() until it returns a value that converts to true, and
+    /// return that value.
+    template<typename FnT> auto wait(const FnT &try_fn) -> decltype(try_fn());
+
+    /// Wake any blocked threads. Must be called after any state change that
+    /// may allow a waiting thread to make progress.
+    void notify();
+
+protected:
+    static const size_t min_spin_iterations = 64;
+    static const size_t max_spin_iterations = 1 << 14;
+    static const size_t num_yield_iterations = 16;
+
+    static void spin_pause();
+    void adapt_spin_iterations(const size_t spin_iterations, bool succeeded);
+
+    std::atomic<size_t> _spin_iterations;
+    std::atomic<size_t> _num_blocked;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+};
+
 /// Simple lock-less single-producer, single-consumer fifo buffer. Exposes the
 /// raw read/write location directly, in way that the producer can know if the
 /// destination memory is available BEFORE he begins data production. In
@@ -37,8 +79,9 @@ public:
     /// enqueue_end().
     T *try_enqueue_begin();
 
-    /// Call try_enqueue_begin() until it succeeds. The caller should be sure
-    /// that a consumer is active, to avoid the fifo being permanently blocked.
+    /// Wait (see concurrent_waiter) until try_enqueue_begin() succeeds. The
+    /// caller should be sure that a consumer is active, to avoid the fifo
+    /// being permanently blocked.
     T *enqueue_begin_wait();
 
     void enqueue_end();
@@ -48,8 +91,8 @@ public:
     /// dequeue_end().
     const T *try_dequeue_begin();
 
-    /// Call try_dequeue_begin() until it succeeds. The caller should be sure
-    /// that a producer will produce an element.
+    /// Wait (see concurrent_waiter) until try_dequeue_begin() succeeds. The
+    /// caller should be sure that a producer will produce an element.
     const T *dequeue_begin_wait();
 
     void dequeue_end();
@@ -59,11 +102,21 @@ protected:
 
     T *const _buffer;
 
-    size_t _producer_next_idx;
+    // State written by the producer and by the consumer is held on separate
+    // cache lines. Each side caches the last value it observed of the other
+    // side's counter, and only reads the counter itself (from the other
+    // cache line) when the fifo appears to be full or empty.
+
+    alignas(cache_line_size) size_t _producer_next_idx;
+    size_t _producer_num_consumed_cache;
     std::atomic<size_t> _producer_num_produced;
 
-    size_t _consumer_next_idx;
+    alignas(cache_line_size) size_t _consumer_next_idx;
+    size_t _consumer_num_produced_cache;
     std::atomic<size_t> _consumer_num_consumed;
+
+    alignas(cache_line_size) concurrent_waiter _not_full_waiter;
+    concurrent_waiter _not_empty_waiter;
 };
 
 /// Similar semantics as concurrent_fifo_spsc, but entries are pre-allocated
@@ -106,6 +159,65 @@ protected:
     size_t _next_buffer_idx;
 };
 
+/// Bounded lock-less multi-producer, multi-consumer fifo, using the same
+/// protocol as concurrent_fifo_spsc. Since several entries may be in the
+/// process of being written (or read) at once, the pointer returned by
+/// try_enqueue_begin() (or try_dequeue_begin()) must be passed to the
+/// corresponding enqueue_end() (or dequeue_end()).
+///
+/// Each slot holds a sequence number indicating whether it is ready to be
+/// written or read (as in D. Vyukov's bounded MPMC queue), so that a single
+/// compare-and-swap claims a slot. Entries are dequeued in the order in
+/// which producers claimed slots, so a producer that is slow to call
+/// enqueue_end() delays consumers of later entries.
+template<typename T> class concurrent_fifo_mpmc
+{
+public:
+    concurrent_fifo_mpmc() = delete;
+    concurrent_fifo_mpmc(const concurrent_fifo_mpmc &) = delete;
+    concurrent_fifo_mpmc &operator=(const concurrent_fifo_mpmc &) = delete;
+
+    concurrent_fifo_mpmc(size_t capacity);
+    ~concurrent_fifo_mpmc();
+
+    size_t capacity() const;
+
+    /// Claim a slot to write to, returning nullptr if the fifo is full.
+    T *try_enqueue_begin();
+
+    T *enqueue_begin_wait();
+
+    /// Make the entry written to slot (returned by try_enqueue_begin() or
+    /// enqueue_begin_wait()) available to consumers.
+    void enqueue_end(T *slot);
+
+    /// Claim the next entry to be read, returning nullptr if the fifo is
+    /// empty.
+    const T *try_dequeue_begin();
+
+    const T *dequeue_begin_wait();
+
+    /// Release slot (returned by try_dequeue_begin() or dequeue_begin_wait())
+    /// for reuse by producers.
+    void dequeue_end(const T *slot);
+
+protected:
+    const size_t _capacity;
+
+    T *const _buffer;
+
+    // _sequences[i] is equal to the enqueue position p (where i = p %
+    // _capacity) if slot i is ready to be written, and to p + 1 if it holds
+    // entry p, ready to be read.
+    std::atomic<size_t> *const _sequences;
+
+    alignas(cache_line_size) std::atomic<size_t> _enqueue_pos;
+    alignas(cache_line_size) std::atomic<size_t> _dequeue_pos;
+
+    alignas(cache_line_size) concurrent_waiter _not_full_waiter;
+    concurrent_waiter _not_empty_waiter;
+};
+
 } // namespace libff
 
 #include "libff/common/concurrent_fifo.tcc"
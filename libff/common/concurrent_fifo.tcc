@@ -18,6 +18,47 @@
 namespace libff
 {
 
+// concurrent_waiter
+
+template<typename FnT>
+auto concurrent_waiter::wait(const FnT &try_fn) -> decltype(try_fn())
+{
+    const size_t spin_iterations =
+        _spin_iterations.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < spin_iterations; ++i) {
+        auto v = try_fn();
+        if (v) {
+            adapt_spin_iterations(spin_iterations, true);
+            return v;
+        }
+        spin_pause();
+    }
+
+    adapt_spin_iterations(spin_iterations, false);
+    for (size_t i = 0; i < num_yield_iterations; ++i) {
+        std::this_thread::yield();
+        auto v = try_fn();
+        if (v) {
+            return v;
+        }
+    }
+
+    // Block. The fence (paired with that in notify()) ensures that either
+    // try_fn() observes any state change made before notify() was called, or
+    // notify() observes _num_blocked > 0 (and must then wait for the mutex to
+    // be released by _condition.wait() before notifying).
+    std::unique_lock<std::mutex> lock(_mutex);
+    _num_blocked.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto v = try_fn();
+    while (!v) {
+        _condition.wait(lock);
+        v = try_fn();
+    }
+    _num_blocked.fetch_sub(1, std::memory_order_relaxed);
+    return v;
+}
+
 // concurrent_fifo_spsc
 
 template<typename T>
@@ -25,8 +66,10 @@ concurrent_fifo_spsc<T>::concurrent_fifo_spsc(size_t capacity)
     : _capacity(capacity)
     , _buffer((T *)malloc(capacity * sizeof(T)))
     , _producer_next_idx(0)
+    , _producer_num_consumed_cache(0)
     , _producer_num_produced(0)
     , _consumer_next_idx(0)
+    , _consumer_num_produced_cache(0)
     , _consumer_num_consumed(0)
 {
 }
@@ -43,30 +86,26 @@ template<typename T> size_t concurrent_fifo_spsc<T>::capacity() const
 
 template<typename T> T *concurrent_fifo_spsc<T>::try_enqueue_begin()
 {
-    const size_t consumer_num_consumed =
-        _consumer_num_consumed.load(std::memory_order_relaxed);
+    // Counters are compared using modular arithmetic, so overflow is harmless.
     const size_t producer_num_produced =
         _producer_num_produced.load(std::memory_order_relaxed);
-    const size_t num_empty_slots =
-        consumer_num_consumed + _capacity - producer_num_produced;
-    // TODO: handle overflow
-    assert(num_empty_slots <= _capacity);
-
-    if (num_empty_slots > 0) {
-        return &_buffer[_producer_next_idx];
+    if (producer_num_produced - _producer_num_consumed_cache == _capacity) {
+        // Acquire ensures that the consumer has finished reading the slot.
+        _producer_num_consumed_cache =
+            _consumer_num_consumed.load(std::memory_order_acquire);
+        if (producer_num_produced - _producer_num_consumed_cache ==
+            _capacity) {
+            return nullptr;
+        }
     }
 
-    return nullptr;
+    assert(producer_num_produced - _producer_num_consumed_cache < _capacity);
+    return &_buffer[_producer_next_idx];
 }
 
 template<typename T> T *concurrent_fifo_spsc<T>::enqueue_begin_wait()
 {
-    T *v = try_enqueue_begin();
-    while (!v) {
-        std::this_thread::yield();
-        v = try_enqueue_begin();
-    }
-    return v;
+    return _not_full_waiter.wait([this]() { return try_enqueue_begin(); });
 }
 
 template<typename T> void concurrent_fifo_spsc<T>::enqueue_end()
@@ -79,33 +118,29 @@ template<typename T> void concurrent_fifo_spsc<T>::enqueue_end()
         _producer_num_produced.load(std::memory_order_relaxed);
     _producer_num_produced.store(
         producer_num_produced + 1, std::memory_order_release);
+    _not_empty_waiter.notify();
 }
 
 template<typename T> const T *concurrent_fifo_spsc<T>::try_dequeue_begin()
 {
-    const size_t producer_num_produced =
-        _producer_num_produced.load(std::memory_order_relaxed);
     const size_t consumer_num_consumed =
         _consumer_num_consumed.load(std::memory_order_relaxed);
-    const size_t num_available = producer_num_produced - consumer_num_consumed;
-    assert(num_available <= _capacity);
-    // TODO: handle overflow
-
-    if (num_available > 0) {
-        return &_buffer[_consumer_next_idx];
+    if (_consumer_num_produced_cache == consumer_num_consumed) {
+        // Acquire ensures that the producer has finished writing the slot.
+        _consumer_num_produced_cache =
+            _producer_num_produced.load(std::memory_order_acquire);
+        if (_consumer_num_produced_cache == consumer_num_consumed) {
+            return nullptr;
+        }
     }
 
-    return nullptr;
+    assert(_consumer_num_produced_cache - consumer_num_consumed <= _capacity);
+    return &_buffer[_consumer_next_idx];
 }
 
 template<typename T> const T *concurrent_fifo_spsc<T>::dequeue_begin_wait()
 {
-    const T *v = try_dequeue_begin();
-    while (!v) {
-        std::this_thread::yield();
-        v = try_dequeue_begin();
-    }
-    return v;
+    return _not_empty_waiter.wait([this]() { return try_dequeue_begin(); });
 }
 
 template<typename T> void concurrent_fifo_spsc<T>::dequeue_end()
@@ -118,6 +153,7 @@ template<typename T> void concurrent_fifo_spsc<T>::dequeue_end()
         _consumer_num_consumed.load(std::memory_order_relaxed);
     _consumer_num_consumed.store(
         consumer_num_consumed + 1, std::memory_order_release);
+    _not_full_waiter.notify();
 }
 
 // concurrent_buffer_fifo_spsc
@@ -199,6 +235,111 @@ T *concurrent_buffer_fifo_spsc<T>::enqueue_next_buffer(T **const buffer_ptr)
     return buffer;
 }
 
+// concurrent_fifo_mpmc
+
+template<typename T>
+concurrent_fifo_mpmc<T>::concurrent_fifo_mpmc(size_t capacity)
+    : _capacity(capacity)
+    , _buffer((T *)malloc(capacity * sizeof(T)))
+    , _sequences(new std::atomic<size_t>[capacity])
+    , _enqueue_pos(0)
+    , _dequeue_pos(0)
+{
+    for (size_t i = 0; i < capacity; ++i) {
+        _sequences[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T> concurrent_fifo_mpmc<T>::~concurrent_fifo_mpmc()
+{
+    delete[] _sequences;
+    free(_buffer);
+}
+
+template<typename T> size_t concurrent_fifo_mpmc<T>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename T> T *concurrent_fifo_mpmc<T>::try_enqueue_begin()
+{
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        const size_t idx = pos % _capacity;
+        const size_t sequence =
+            _sequences[idx].load(std::memory_order_acquire);
+        const ptrdiff_t diff = (ptrdiff_t)(sequence - pos);
+        if (diff == 0) {
+            // Slot is ready to be written. Claim it (on failure, pos is
+            // updated to the current position).
+            if (_enqueue_pos.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                return &_buffer[idx];
+            }
+        } else if (diff < 0) {
+            // Slot still holds the entry from the previous round.
+            return nullptr;
+        } else {
+            // Another producer claimed this position.
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T> T *concurrent_fifo_mpmc<T>::enqueue_begin_wait()
+{
+    return _not_full_waiter.wait([this]() { return try_enqueue_begin(); });
+}
+
+template<typename T> void concurrent_fifo_mpmc<T>::enqueue_end(T *slot)
+{
+    // Only the caller can modify the sequence number of a claimed slot.
+    const size_t idx = slot - _buffer;
+    assert(idx < _capacity);
+    const size_t sequence = _sequences[idx].load(std::memory_order_relaxed);
+    _sequences[idx].store(sequence + 1, std::memory_order_release);
+    _not_empty_waiter.notify();
+}
+
+template<typename T> const T *concurrent_fifo_mpmc<T>::try_dequeue_begin()
+{
+    size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        const size_t idx = pos % _capacity;
+        const size_t sequence =
+            _sequences[idx].load(std::memory_order_acquire);
+        const ptrdiff_t diff = (ptrdiff_t)(sequence - (pos + 1));
+        if (diff == 0) {
+            if (_dequeue_pos.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                return &_buffer[idx];
+            }
+        } else if (diff < 0) {
+            // Entry pos has not been written (or not yet claimed).
+            return nullptr;
+        } else {
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T> const T *concurrent_fifo_mpmc<T>::dequeue_begin_wait()
+{
+    return _not_empty_waiter.wait([this]() { return try_dequeue_begin(); });
+}
+
+template<typename T> void concurrent_fifo_mpmc<T>::dequeue_end(const T *slot)
+{
+    // The slot held entry pos = sequence - 1, and is next written by entry
+    // pos + _capacity.
+    const size_t idx = slot - _buffer;
+    assert(idx < _capacity);
+    const size_t sequence = _sequences[idx].load(std::memory_order_relaxed);
+    _sequences[idx].store(
+        sequence - 1 + _capacity, std::memory_order_release);
+    _not_full_waiter.notify();
+}
+
 } // namespace libff
 
 #endif // __LIBFF_COMMON_CONCURRENT_FIFO_TCC__
@@ -0,0 +1,368 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/common/numa.hpp"
+
+#include "libff/common/parallel.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace libff
+{
+
+namespace
+{
+
+/// Parse a list of the form "0-3,8,10-11" (as used in sysfs).
+std::vector<size_t> parse_id_list(const std::string &list)
+{
+    std::vector<size_t> ids;
+    std::istringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const size_t dash = range.find('-');
+        const size_t first = std::stoul(range.substr(0, dash));
+        const size_t last = (dash == std::string::npos)
+                                ? first
+                                : std::stoul(range.substr(dash + 1));
+        for (size_t id = first; id <= last; ++id) {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+std::string read_first_line(const std::string &filename)
+{
+    std::ifstream in_s(filename);
+    std::string line;
+    std::getline(in_s, line);
+    return line;
+}
+
+/// The CPUs of each node with at least one CPU available to the process.
+std::vector<std::vector<size_t>> read_topology()
+{
+    std::vector<std::vector<size_t>> nodes;
+    std::vector<size_t> all_cpus;
+#ifdef __linux__
+    cpu_set_t available;
+    CPU_ZERO(&available);
+    if (0 == sched_getaffinity(0, sizeof(available), &available)) {
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &available)) {
+                all_cpus.push_back(cpu);
+            }
+        }
+    }
+
+    try {
+        const std::string node_dir = "/sys/devices/system/node/";
+        for (const size_t node :
+             parse_id_list(read_first_line(node_dir + "online"))) {
+            const std::string cpulist = read_first_line(
+                node_dir + "node" + std::to_string(node) + "/cpulist");
+            std::vector<size_t> cpus;
+            for (const size_t cpu : parse_id_list(cpulist)) {
+                if (all_cpus.empty() || (cpu < CPU_SETSIZE &&
+                                         CPU_ISSET(cpu, &available))) {
+                    cpus.push_back(cpu);
+                }
+            }
+            if (!cpus.empty()) {
+                nodes.push_back(cpus);
+            }
+        }
+    } catch (const std::exception &) {
+        // Malformed or missing topology information.
+        nodes.clear();
+    }
+#endif
+
+    if (nodes.empty()) {
+        // Treat all available CPUs as a single node.
+        if (all_cpus.empty()) {
+            const size_t num_cpus =
+                std::max(1u, std::thread::hardware_concurrency());
+            for (size_t cpu = 0; cpu < num_cpus; ++cpu) {
+                all_cpus.push_back(cpu);
+            }
+        }
+        nodes.push_back(all_cpus);
+    }
+    return nodes;
+}
+
+const std::vector<std::vector<size_t>> &topology()
+{
+    static const std::vector<std::vector<size_t>> nodes = read_topology();
+    return nodes;
+}
+
+/// Persistent worker threads, pinned to the CPUs of each node, with one queue
+/// of tasks per node. num_threads workers are divided between the nodes in
+/// proportion to their number of CPUs (with at least one per node).
+class numa_worker_pool
+{
+public:
+    numa_worker_pool(const numa_worker_pool &) = delete;
+    numa_worker_pool &operator=(const numa_worker_pool &) = delete;
+
+    explicit numa_worker_pool(size_t num_threads);
+    ~numa_worker_pool();
+
+    size_t num_threads() const { return _num_threads; }
+    size_t node_num_threads(size_t node) const
+    {
+        return _node_num_threads[node];
+    }
+
+    /// Call fn(node, task_idx) for task_idx < num_tasks[node], on the workers
+    /// of each node, and wait for all calls to complete. The first exception
+    /// thrown by fn (if any) is rethrown.
+    void run(
+        const std::vector<size_t> &num_tasks,
+        const std::function<void(size_t, size_t)> &fn);
+
+protected:
+    struct node_queue {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::deque<std::function<void()>> tasks;
+        bool stopping = false;
+    };
+
+    void worker_main(size_t node);
+    void stop();
+
+    const size_t _num_threads;
+    std::vector<size_t> _node_num_threads;
+    std::vector<std::unique_ptr<node_queue>> _queues;
+    std::vector<std::thread> _workers;
+};
+
+numa_worker_pool::numa_worker_pool(size_t num_threads)
+    : _num_threads(num_threads)
+    , _node_num_threads(internal::numa_partition_sizes(num_threads))
+{
+    for (size_t &node_num_threads : _node_num_threads) {
+        node_num_threads = std::max<size_t>(1, node_num_threads);
+        _queues.emplace_back(new node_queue());
+    }
+
+    // If a thread cannot be created, stop and join those already started
+    // (destroying a joinable std::thread terminates the process).
+    try {
+        for (size_t node = 0; node < _node_num_threads.size(); ++node) {
+            for (size_t i = 0; i < _node_num_threads[node]; ++i) {
+                _workers.emplace_back(
+                    &numa_worker_pool::worker_main, this, node);
+            }
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+numa_worker_pool::~numa_worker_pool() { stop(); }
+
+void numa_worker_pool::run(
+    const std::vector<size_t> &num_tasks,
+    const std::function<void(size_t, size_t)> &fn)
+{
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t num_pending;
+    std::exception_ptr exception;
+
+    auto task_done = [&](std::exception_ptr task_exception) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (task_exception && !exception) {
+            exception = task_exception;
+        }
+        if (--num_pending == 0) {
+            done.notify_one();
+        }
+    };
+
+    size_t num_total = 0;
+    for (const size_t n : num_tasks) {
+        num_total += n;
+    }
+    num_pending = num_total;
+
+    // Tasks reference local state, so if scheduling fails, wait for the
+    // tasks already scheduled before rethrowing.
+    size_t num_scheduled = 0;
+    try {
+        for (size_t node = 0; node < num_tasks.size(); ++node) {
+            node_queue &queue = *_queues[node];
+            for (size_t task_idx = 0; task_idx < num_tasks[node];
+                 ++task_idx) {
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.tasks.emplace_back([&, node, task_idx]() {
+                        std::exception_ptr task_exception;
+                        try {
+                            fn(node, task_idx);
+                        } catch (...) {
+                            task_exception = std::current_exception();
+                        }
+                        task_done(task_exception);
+                    });
+                }
+                ++num_scheduled;
+                queue.cond.notify_one();
+            }
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        num_pending -= num_total - num_scheduled;
+        if (!exception) {
+            exception = std::current_exception();
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&num_pending]() { return num_pending == 0; });
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void numa_worker_pool::worker_main(size_t node)
+{
+    numa_pin_current_thread(node);
+
+    node_queue &queue = *_queues[node];
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.cond.wait(lock, [&queue]() {
+                return queue.stopping || !queue.tasks.empty();
+            });
+            if (queue.tasks.empty()) {
+                return;
+            }
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void numa_worker_pool::stop()
+{
+    for (const std::unique_ptr<node_queue> &queue : _queues) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->stopping = true;
+        queue->cond.notify_all();
+    }
+    for (std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+/// The process-wide worker pool, (re)created on demand with
+/// parallel_num_threads() workers. Callers hold a reference to the pool
+/// while using it, so it is only destroyed once idle.
+std::shared_ptr<numa_worker_pool> get_worker_pool()
+{
+    static std::mutex pool_mutex;
+    static std::shared_ptr<numa_worker_pool> pool;
+
+    const size_t num_threads = parallel_num_threads();
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if (!pool || pool->num_threads() != num_threads) {
+        pool.reset();
+        pool = std::make_shared<numa_worker_pool>(num_threads);
+    }
+    return pool;
+}
+
+} // namespace
+
+namespace internal
+{
+
+std::vector<size_t> numa_partition_sizes(const size_t num_elements)
+{
+    const std::vector<std::vector<size_t>> &nodes = topology();
+    size_t total_cpus = 0;
+    for (const std::vector<size_t> &cpus : nodes) {
+        total_cpus += cpus.size();
+    }
+
+    std::vector<size_t> sizes;
+    size_t cpus_so_far = 0;
+    size_t elements_so_far = 0;
+    for (const std::vector<size_t> &cpus : nodes) {
+        cpus_so_far += cpus.size();
+        const size_t end = num_elements * cpus_so_far / total_cpus;
+        sizes.push_back(end - elements_so_far);
+        elements_so_far = end;
+    }
+    return sizes;
+}
+
+void numa_run(
+    const std::vector<size_t> &num_tasks,
+    const std::function<void(size_t, size_t)> &fn)
+{
+    get_worker_pool()->run(num_tasks, fn);
+}
+
+} // namespace internal
+
+size_t numa_num_nodes() { return topology().size(); }
+
+size_t numa_node_num_threads(const size_t node)
+{
+    return get_worker_pool()->node_num_threads(node);
+}
+
+const std::vector<size_t> &numa_node_cpus(const size_t node)
+{
+    return topology()[node];
+}
+
+bool numa_pin_current_thread(const size_t node)
+{
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const size_t cpu : numa_node_cpus(node)) {
+        if (cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+    return 0 == sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+} // namespace libff
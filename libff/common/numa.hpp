@@ -0,0 +1,91 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_COMMON_NUMA_HPP__
+#define __LIBFF_COMMON_NUMA_HPP__
+
+#include <stddef.h>
+#include <vector>
+
+namespace libff
+{
+
+/// Number of NUMA nodes with CPUs available to this process. Topology is read
+/// from /sys/devices/system/node on Linux. On other platforms, or if the
+/// topology cannot be determined, all CPUs are treated as a single node.
+size_t numa_num_nodes();
+
+/// The (OS-assigned) ids of CPUs of the given node (0 <= node <
+/// numa_num_nodes()) which are available to this process.
+const std::vector<size_t> &numa_node_cpus(const size_t node);
+
+/// Restrict the calling thread to the CPUs of the given node. Memory pages
+/// first written by the thread are then (under the default first-touch
+/// policy) allocated on that node. Returns false if pinning is not supported
+/// or fails.
+bool numa_pin_current_thread(const size_t node);
+
+/// Number of worker threads pinned to the given node, used by
+/// numa_run_on_all_nodes and numa_run_on_node. The parallel_num_threads()
+/// threads are divided between nodes in proportion to their number of CPUs
+/// (with at least one per node).
+size_t numa_node_num_threads(const size_t node);
+
+/// For each node, call fn(node, task_idx) for task_idx < tasks_per_node (or <
+/// numa_node_num_threads(node) if tasks_per_node is 0), and wait for all
+/// calls to complete. Calls are executed by persistent worker threads pinned
+/// to the node (created on first use, and re-created if the number of threads
+/// set by parallel_set_num_threads changes). The first exception thrown by fn
+/// (if any) is rethrown. fn must not itself wait for work on the NUMA
+/// workers.
+template<typename FnT>
+void numa_run_on_all_nodes(const size_t tasks_per_node, const FnT &fn);
+
+/// Call fn(task_idx) for task_idx < num_tasks on the workers of a single
+/// node, as for numa_run_on_all_nodes.
+template<typename FnT>
+void numa_run_on_node(const size_t node, const size_t num_tasks, const FnT &fn);
+
+/// A vector divided into contiguous partitions, one per NUMA node, where
+/// each partition is allocated by a thread pinned to the node, so that its
+/// memory is local to that node. Partition sizes are proportional to the
+/// number of CPUs of each node.
+template<typename T> class numa_partitioned_vector
+{
+public:
+    numa_partitioned_vector() = default;
+
+    /// Create a vector of num_elements default-constructed elements.
+    /// Partitions are allocated on all nodes concurrently.
+    explicit numa_partitioned_vector(const size_t num_elements);
+
+    /// Copy the elements of [begin, end) into partitions. The elements of each
+    /// partition are copied in parallel by the workers of its node.
+    template<typename IteratorT>
+    numa_partitioned_vector(IteratorT begin, IteratorT end);
+
+    size_t size() const;
+    size_t num_partitions() const;
+
+    /// The elements of partition i, allocated on node i.
+    const std::vector<T> &partition(const size_t i) const;
+    std::vector<T> &partition(const size_t i);
+
+    /// The index of the first element of partition i.
+    size_t partition_offset(const size_t i) const;
+
+protected:
+    std::vector<std::vector<T>> _partitions;
+    std::vector<size_t> _offsets;
+};
+
+} // namespace libff
+
+#include "libff/common/numa.tcc"
+
+#endif // __LIBFF_COMMON_NUMA_HPP__
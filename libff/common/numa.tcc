@@ -0,0 +1,130 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_COMMON_NUMA_TCC__
+#define __LIBFF_COMMON_NUMA_TCC__
+
+#include "libff/common/numa.hpp"
+
+#include <functional>
+#include <iterator>
+
+namespace libff
+{
+
+namespace internal
+{
+
+/// Number of elements of each partition, when distributing num_elements over
+/// all nodes in proportion to their number of CPUs.
+std::vector<size_t> numa_partition_sizes(const size_t num_elements);
+
+/// Call fn(node, task_idx) for task_idx < num_tasks[node] on the workers of
+/// each node, and wait for all calls to complete.
+void numa_run(
+    const std::vector<size_t> &num_tasks,
+    const std::function<void(size_t, size_t)> &fn);
+
+} // namespace internal
+
+template<typename FnT>
+void numa_run_on_all_nodes(const size_t tasks_per_node, const FnT &fn)
+{
+    std::vector<size_t> num_tasks(numa_num_nodes());
+    for (size_t node = 0; node < num_tasks.size(); ++node) {
+        num_tasks[node] =
+            tasks_per_node ? tasks_per_node : numa_node_num_threads(node);
+    }
+    internal::numa_run(num_tasks, fn);
+}
+
+template<typename FnT>
+void numa_run_on_node(const size_t node, const size_t num_tasks, const FnT &fn)
+{
+    std::vector<size_t> node_num_tasks(numa_num_nodes(), 0);
+    node_num_tasks[node] = num_tasks;
+    internal::numa_run(
+        node_num_tasks, [&fn](size_t, size_t task_idx) { fn(task_idx); });
+}
+
+template<typename T>
+numa_partitioned_vector<T>::numa_partitioned_vector(const size_t num_elements)
+{
+    const std::vector<size_t> sizes =
+        internal::numa_partition_sizes(num_elements);
+    _partitions.resize(sizes.size());
+    size_t offset = 0;
+    for (const size_t size : sizes) {
+        _offsets.push_back(offset);
+        offset += size;
+    }
+
+    // Each partition is allocated (and first written) on its node.
+    numa_run_on_all_nodes(1, [this, &sizes](size_t node, size_t) {
+        _partitions[node].resize(sizes[node]);
+    });
+}
+
+template<typename T>
+template<typename IteratorT>
+numa_partitioned_vector<T>::numa_partitioned_vector(
+    IteratorT begin, IteratorT end)
+    : numa_partitioned_vector(std::distance(begin, end))
+{
+    std::vector<size_t> num_tasks(_partitions.size());
+    for (size_t node = 0; node < num_tasks.size(); ++node) {
+        num_tasks[node] = numa_node_num_threads(node);
+    }
+
+    internal::numa_run(num_tasks, [&](size_t node, size_t task_idx) {
+        std::vector<T> &partition = _partitions[node];
+        const size_t task_begin =
+            partition.size() * task_idx / num_tasks[node];
+        const size_t task_end =
+            partition.size() * (task_idx + 1) / num_tasks[node];
+        IteratorT it = begin;
+        std::advance(it, _offsets[node] + task_begin);
+        for (size_t i = task_begin; i < task_end; ++i) {
+            partition[i] = *it;
+            ++it;
+        }
+    });
+}
+
+template<typename T> size_t numa_partitioned_vector<T>::size() const
+{
+    return _offsets.empty() ? 0 : _offsets.back() + _partitions.back().size();
+}
+
+template<typename T> size_t numa_partitioned_vector<T>::num_partitions() const
+{
+    return _partitions.size();
+}
+
+template<typename T>
+const std::vector<T> &numa_partitioned_vector<T>::partition(
+    const size_t i) const
+{
+    return _partitions[i];
+}
+
+template<typename T>
+std::vector<T> &numa_partitioned_vector<T>::partition(const size_t i)
+{
+    return _partitions[i];
+}
+
+template<typename T>
+size_t numa_partitioned_vector<T>::partition_offset(const size_t i) const
+{
+    return _offsets[i];
+}
+
+} // namespace libff
+
+#endif // __LIBFF_COMMON_NUMA_TCC__
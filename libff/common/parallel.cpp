@@ -0,0 +1,326 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "libff/common/parallel.hpp"
+
+#include "libff/common/concurrent_fifo.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+namespace libff
+{
+
+namespace
+{
+
+struct task {
+    std::function<void()> fn;
+    task_group *group;
+};
+
+/// Pool of worker threads, each with a queue of tasks. Workers push and pop
+/// tasks at the back of their own queue (so that recently created, smaller
+/// tasks are executed first, with their data still in cache), and steal from
+/// the front of other queues. Tasks scheduled by threads outside of the pool
+/// are pushed to an additional shared queue.
+class task_scheduler
+{
+public:
+    task_scheduler(const task_scheduler &) = delete;
+    task_scheduler &operator=(const task_scheduler &) = delete;
+
+    explicit task_scheduler(size_t num_workers);
+    ~task_scheduler();
+
+    void push(task &&t);
+
+    /// Execute pending tasks until done() returns true. If there are no
+    /// pending tasks, the calling thread waits on the idle waiter (spinning,
+    /// then blocking), and is woken when a task is pushed or a group
+    /// completes.
+    template<typename DoneFnT> void run_until(const DoneFnT &done);
+
+    /// Execute t and notify its group. Returns true if t was the last pending
+    /// task of the group.
+    static bool execute(task &t);
+
+protected:
+    struct task_queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    bool find_task(task &t);
+    void worker_main(size_t worker_idx);
+
+    const size_t _num_workers;
+    // _num_workers worker queues, followed by the shared queue.
+    std::vector<std::unique_ptr<task_queue>> _queues;
+    std::vector<std::thread> _workers;
+    std::atomic<size_t> _num_queued;
+    std::atomic<bool> _stopping;
+    concurrent_waiter _idle_waiter;
+};
+
+// Identify the pool and queue of the current thread (if it is a worker).
+thread_local task_scheduler *current_scheduler = nullptr;
+thread_local size_t current_worker_idx = 0;
+
+task_scheduler::task_scheduler(size_t num_workers)
+    : _num_workers(num_workers), _num_queued(0), _stopping(false)
+{
+    for (size_t i = 0; i <= num_workers; ++i) {
+        _queues.emplace_back(new task_queue());
+    }
+    for (size_t i = 0; i < num_workers; ++i) {
+        _workers.emplace_back(&task_scheduler::worker_main, this, i);
+    }
+}
+
+task_scheduler::~task_scheduler()
+{
+    _stopping.store(true, std::memory_order_release);
+    _idle_waiter.notify();
+    for (std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+void task_scheduler::push(task &&t)
+{
+    const size_t queue_idx =
+        (current_scheduler == this) ? current_worker_idx : _num_workers;
+    task_queue &queue = *_queues[queue_idx];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        _num_queued.fetch_add(1, std::memory_order_relaxed);
+        queue.tasks.push_back(std::move(t));
+    }
+    _idle_waiter.notify();
+}
+
+template<typename DoneFnT> void task_scheduler::run_until(const DoneFnT &done)
+{
+    for (;;) {
+        task t;
+        _idle_waiter.wait(
+            [this, &t, &done]() { return done() || find_task(t); });
+        if (!t.fn) {
+            return;
+        }
+        if (execute(t)) {
+            _idle_waiter.notify();
+        }
+    }
+}
+
+bool task_scheduler::find_task(task &t)
+{
+    if (_num_queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    // Workers first check their own queue, taking the most recent task.
+    const bool is_worker = (current_scheduler == this);
+    const size_t own_idx = is_worker ? current_worker_idx : _num_workers;
+    if (is_worker) {
+        task_queue &queue = *_queues[own_idx];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            t = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            _num_queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest task from other queues (including the shared queue).
+    const size_t num_queues = _queues.size();
+    for (size_t i = 1; i <= num_queues; ++i) {
+        task_queue &queue = *_queues[(own_idx + i) % num_queues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            t = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            _num_queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void task_scheduler::worker_main(size_t worker_idx)
+{
+    current_scheduler = this;
+    current_worker_idx = worker_idx;
+
+    for (;;) {
+        task t;
+        _idle_waiter.wait([this, &t]() {
+            return _stopping.load(std::memory_order_acquire) || find_task(t);
+        });
+        if (!t.fn) {
+            return;
+        }
+        // Wake any thread waiting for the group to complete.
+        if (execute(t)) {
+            _idle_waiter.notify();
+        }
+    }
+}
+
+bool task_scheduler::execute(task &t)
+{
+    std::exception_ptr exception;
+    try {
+        t.fn();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    // Release captured state before the group is notified (after which the
+    // group, and anything referenced by the function, may be destroyed).
+    t.fn = nullptr;
+    return t.group->task_done(exception);
+}
+
+std::mutex scheduler_mutex;
+std::atomic<size_t> num_threads(0);
+std::atomic<task_scheduler *> scheduler(nullptr);
+
+size_t default_num_threads()
+{
+#ifdef MULTICORE
+    return std::max(1, omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+/// Returns the process-wide scheduler, creating it if necessary, or nullptr
+/// if there are no worker threads.
+task_scheduler *get_scheduler()
+{
+    task_scheduler *s = scheduler.load(std::memory_order_acquire);
+    const size_t n = parallel_num_threads();
+    if (s != nullptr || n == 1) {
+        return s;
+    }
+
+    std::lock_guard<std::mutex> lock(scheduler_mutex);
+    s = scheduler.load(std::memory_order_relaxed);
+    if (s == nullptr) {
+        s = new task_scheduler(n - 1);
+        scheduler.store(s, std::memory_order_release);
+    }
+    return s;
+}
+
+} // namespace
+
+size_t parallel_num_threads()
+{
+    size_t n = num_threads.load(std::memory_order_relaxed);
+    if (n == 0) {
+        std::lock_guard<std::mutex> lock(scheduler_mutex);
+        n = num_threads.load(std::memory_order_relaxed);
+        if (n == 0) {
+            n = default_num_threads();
+            num_threads.store(n, std::memory_order_relaxed);
+        }
+    }
+    return n;
+}
+
+void parallel_set_num_threads(size_t new_num_threads)
+{
+#ifdef MULTICORE
+    if (new_num_threads == 0) {
+        new_num_threads = default_num_threads();
+    }
+#else
+    new_num_threads = 1;
+#endif
+
+    std::lock_guard<std::mutex> lock(scheduler_mutex);
+    // The existing pool (if any) is idle. Destroy it, and create a new one on
+    // demand.
+    delete scheduler.exchange(nullptr, std::memory_order_acq_rel);
+    num_threads.store(new_num_threads, std::memory_order_relaxed);
+}
+
+task_group::task_group() : _num_pending(0) {}
+
+task_group::~task_group()
+{
+    // Tasks may reference the group, and must complete before it is
+    // destroyed. Exceptions which have not been rethrown by wait() are
+    // ignored.
+    wait_all();
+}
+
+void task_group::wait()
+{
+    wait_all();
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(_exception_mutex);
+        std::swap(exception, _exception);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+bool task_group::task_done(std::exception_ptr exception)
+{
+    if (exception) {
+        std::lock_guard<std::mutex> lock(_exception_mutex);
+        if (!_exception) {
+            _exception = exception;
+        }
+    }
+    return _num_pending.fetch_sub(1, std::memory_order_release) == 1;
+}
+
+void task_group::run_function(std::function<void()> &&fn)
+{
+    task t;
+    t.fn = std::move(fn);
+    t.group = this;
+    _num_pending.fetch_add(1, std::memory_order_relaxed);
+
+    task_scheduler *s = get_scheduler();
+    if (s == nullptr) {
+        task_scheduler::execute(t);
+        return;
+    }
+    s->push(std::move(t));
+}
+
+void task_group::wait_all()
+{
+    // Without a scheduler, all tasks have been executed by run().
+    task_scheduler *s = scheduler.load(std::memory_order_acquire);
+    if (s == nullptr) {
+        return;
+    }
+    s->run_until([this]() {
+        return _num_pending.load(std::memory_order_acquire) == 0;
+    });
+}
+
+} // namespace libff
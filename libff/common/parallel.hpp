@@ -0,0 +1,108 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_COMMON_PARALLEL_HPP__
+#define __LIBFF_COMMON_PARALLEL_HPP__
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stddef.h>
+
+namespace libff
+{
+
+/// Number of threads (including any thread calling into libff) used to
+/// execute parallel work. Always 1 if MULTICORE is not enabled.
+size_t parallel_num_threads();
+
+/// Set the number of threads used to execute parallel work. 0 selects the
+/// default (omp_get_max_threads(), which respects OMP_NUM_THREADS). Callers
+/// which already run libff operations from their own thread pool can set this
+/// to 1, so that all work is executed on the calling threads, or to a small
+/// number to bound the total number of threads. Must not be called while
+/// parallel work is in progress.
+///
+/// Work is executed by a single process-wide pool of parallel_num_threads() -
+/// 1 worker threads, each with its own queue of tasks. Idle workers steal
+/// tasks from the queues of other workers, and threads waiting for tasks to
+/// complete execute pending tasks (blocking only when there are none), so
+/// that nested parallel work (and work submitted concurrently by several
+/// external threads) shares the same workers.
+///
+/// All parallel loops in libff and in its FFI library run on this pool (none
+/// use OpenMP parallel regions). NUMA-aware operations run on separate
+/// workers pinned to each node (see numa_run_on_all_nodes), which are also
+/// bounded by this thread count.
+void parallel_set_num_threads(size_t num_threads);
+
+/// A set of tasks which may be executed in parallel, and waited on together.
+/// Tasks may themselves add tasks to the group. If any task throws, wait()
+/// rethrows the first exception once all tasks have completed.
+class task_group
+{
+public:
+    task_group(const task_group &) = delete;
+    task_group &operator=(const task_group &) = delete;
+
+    task_group();
+    ~task_group();
+
+    /// Schedule fn() for execution. If there are no worker threads, fn is
+    /// executed immediately.
+    template<typename FnT> void run(FnT &&fn);
+
+    /// Wait for all tasks (including those scheduled while waiting) to
+    /// complete, executing pending tasks on the calling thread.
+    void wait();
+
+    /// Called by the scheduler when a task of this group has been executed.
+    /// Returns true if no tasks of the group remain pending.
+    bool task_done(std::exception_ptr exception);
+
+protected:
+    void run_function(std::function<void()> &&fn);
+    void wait_all();
+
+    std::atomic<size_t> _num_pending;
+    std::mutex _exception_mutex;
+    std::exception_ptr _exception;
+};
+
+/// Call fn(range_begin, range_end) for disjoint ranges covering [begin, end),
+/// in parallel. The range is recursively split in half (scheduling one half as
+/// a task) until ranges contain at most grain_size indices, so that work is
+/// balanced dynamically even if the cost per index varies. A grain_size of 0
+/// selects a size giving around 8 ranges per thread.
+template<typename FnT>
+void parallel_for(
+    const size_t begin,
+    const size_t end,
+    const size_t grain_size,
+    const FnT &fn);
+
+/// Split [begin, end) into consecutive ranges of grain_size indices (where
+/// grain_size == 0 is interpreted as for parallel_for()), compute map_fn(
+/// range_begin, range_end) for each range in parallel, and return the results
+/// combined (in order) using reduce_fn, starting from identity. The result is
+/// independent of the number of threads.
+template<typename T, typename MapFnT, typename ReduceFnT>
+T parallel_reduce(
+    const size_t begin,
+    const size_t end,
+    const size_t grain_size,
+    const T &identity,
+    const MapFnT &map_fn,
+    const ReduceFnT &reduce_fn);
+
+} // namespace libff
+
+#include "libff/common/parallel.tcc"
+
+#endif // __LIBFF_COMMON_PARALLEL_HPP__
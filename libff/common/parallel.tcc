@@ -0,0 +1,116 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libff, developed by Clearmatics Ltd
+ *             (originally developed by SCIPR Lab) and contributors
+ *             (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef __LIBFF_COMMON_PARALLEL_TCC__
+#define __LIBFF_COMMON_PARALLEL_TCC__
+
+#include "libff/common/parallel.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace libff
+{
+
+namespace internal
+{
+
+inline size_t parallel_grain_size(
+    const size_t num_indices, const size_t grain_size)
+{
+    if (grain_size != 0) {
+        return grain_size;
+    }
+    return std::max<size_t>(1, num_indices / (8 * parallel_num_threads()));
+}
+
+template<typename FnT>
+void parallel_for_split(
+    task_group &group,
+    const size_t begin,
+    size_t end,
+    const size_t grain_size,
+    const FnT &fn)
+{
+    // Schedule the upper half of the range, and continue with the lower half,
+    // so that larger ranges are available to be stolen.
+    while (end - begin > grain_size) {
+        const size_t middle = begin + (end - begin) / 2;
+        group.run([&group, middle, end, grain_size, &fn]() {
+            parallel_for_split(group, middle, end, grain_size, fn);
+        });
+        end = middle;
+    }
+    fn(begin, end);
+}
+
+} // namespace internal
+
+template<typename FnT> void task_group::run(FnT &&fn)
+{
+    run_function(std::function<void()>(std::forward<FnT>(fn)));
+}
+
+template<typename FnT>
+void parallel_for(
+    const size_t begin,
+    const size_t end,
+    const size_t grain_size,
+    const FnT &fn)
+{
+    if (begin >= end) {
+        return;
+    }
+
+    const size_t grain = internal::parallel_grain_size(end - begin, grain_size);
+    if (parallel_num_threads() == 1) {
+        for (size_t b = begin; b < end; b += grain) {
+            fn(b, std::min(b + grain, end));
+        }
+        return;
+    }
+
+    task_group group;
+    internal::parallel_for_split(group, begin, end, grain, fn);
+    group.wait();
+}
+
+template<typename T, typename MapFnT, typename ReduceFnT>
+T parallel_reduce(
+    const size_t begin,
+    const size_t end,
+    const size_t grain_size,
+    const T &identity,
+    const MapFnT &map_fn,
+    const ReduceFnT &reduce_fn)
+{
+    if (begin >= end) {
+        return identity;
+    }
+
+    const size_t grain = internal::parallel_grain_size(end - begin, grain_size);
+    const size_t num_ranges = (end - begin + grain - 1) / grain;
+    std::vector<T> partial(num_ranges, identity);
+    parallel_for(0, num_ranges, 1, [&](size_t range_begin, size_t range_end) {
+        for (size_t i = range_begin; i < range_end; ++i) {
+            const size_t b = begin + i * grain;
+            partial[i] = map_fn(b, std::min(b + grain, end));
+        }
+    });
+
+    T result = identity;
+    for (const T &p : partial) {
+        result = reduce_fn(result, p);
+    }
+    return result;
+}
+
+} // namespace libff
+
+#endif // __LIBFF_COMMON_PARALLEL_TCC__
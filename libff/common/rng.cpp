@@ -0,0 +1,38 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of functions for generating randomness.
+
+ See rng.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libff, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <libff/common/rng.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <openssl/rand.h>
+#include <stdexcept>
+
+namespace libff
+{
+
+void random_bytes(void *buffer, const size_t size)
+{
+    unsigned char *dest = (unsigned char *)buffer;
+    size_t remaining = size;
+    while (remaining > 0) {
+        const size_t n = std::min(remaining, (size_t)INT_MAX);
+        if (1 != RAND_bytes(dest, (int)n)) {
+            throw std::runtime_error("RAND_bytes failed");
+        }
+        dest += n;
+        remaining -= n;
+    }
+}
+
+} // namespace libff
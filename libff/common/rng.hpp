@@ -12,6 +12,7 @@
 #ifndef RNG_HPP_
 #define RNG_HPP_
 
+#include <cstddef>
 #include <cstdint>
 
 namespace libff
@@ -19,6 +20,10 @@ namespace libff
 
 template<typename FieldT> FieldT SHA512_rng(const uint64_t idx);
 
+/// Fill the buffer with cryptographically secure random bytes (from the
+/// OpenSSL random number generator). Throws std::runtime_error on failure.
+void random_bytes(void *buffer, const size_t size);
+
 } // namespace libff
 
 #include <libff/common/rng.tcc>
@@ -12,6 +12,8 @@
 #ifndef TEMPLATE_UTILS_HPP_
 #define TEMPLATE_UTILS_HPP_
 
+#include <cstddef>
+
 namespace libff
 {
 
@@ -20,6 +22,20 @@ template<typename T> struct void_type {
     typedef void type;
 };
 
+/// Compile-time sequence of indices (equivalent to std::index_sequence, which
+/// is not available in C++11).
+template<std::size_t... I> struct index_sequence {
+};
+
+/// make_index_sequence<N> derives from index_sequence<0, ..., N-1>.
+template<std::size_t N, std::size_t... I>
+struct make_index_sequence : make_index_sequence<N - 1, N - 1, I...> {
+};
+
+template<std::size_t... I>
+struct make_index_sequence<0, I...> : index_sequence<I...> {
+};
+
 } // namespace libff
 
 #endif // TEMPLATE_UTILS_HPP_
@@ -7,9 +7,16 @@
  *****************************************************************************/
 
 #include "libff/common/concurrent_fifo.hpp"
+#include "libff/common/numa.hpp"
+#include "libff/common/parallel.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace libff;
 
@@ -149,4 +156,334 @@ TEST(CommonTests, ConcurrentBufferFifoTest)
     test_concurrent_buffer_fifo(32, 256, 1024 * 1024);
 }
 
+TEST(CommonTests, ConcurrentFifoWaitTest)
+{
+    // Producer and consumer each periodically sleep for long enough that the
+    // other side stops spinning and blocks, and must be woken by notify().
+    const size_t total_num_values = 64;
+    concurrent_fifo_spsc<size_t> fifo(4);
+
+    auto fill_fn = [&fifo, total_num_values]() {
+        for (size_t i = 0; i < total_num_values; ++i) {
+            if (i % 8 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            size_t *dest = fifo.enqueue_begin_wait();
+            *dest = i;
+            fifo.enqueue_end();
+        }
+    };
+
+    std::thread filler(fill_fn);
+
+    for (size_t i = 0; i < total_num_values; ++i) {
+        if (i % 16 == 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        const size_t *src = fifo.dequeue_begin_wait();
+        ASSERT_EQ(i, *src);
+        fifo.dequeue_end();
+    }
+
+    filler.join();
+}
+
+static void test_concurrent_fifo_mpmc(
+    const size_t queue_size,
+    const size_t num_producers,
+    const size_t num_consumers,
+    const size_t num_values_per_producer)
+{
+    concurrent_fifo_mpmc<size_t> fifo(queue_size);
+    ASSERT_EQ(queue_size, fifo.capacity());
+
+    // Producer p enqueues values p, p + num_producers, p + 2*num_producers,
+    // ... Consumers stop on reading the value total_num_values (enqueued by
+    // the main thread once all producers have finished).
+    const size_t total_num_values = num_producers * num_values_per_producer;
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; ++p) {
+        producers.emplace_back(
+            [&fifo, p, num_producers, num_values_per_producer]() {
+                for (size_t i = 0; i < num_values_per_producer; ++i) {
+                    size_t *dest = fifo.enqueue_begin_wait();
+                    *dest = p + i * num_producers;
+                    fifo.enqueue_end(dest);
+                }
+            });
+    }
+
+    std::vector<std::vector<size_t>> consumed(num_consumers);
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < num_consumers; ++c) {
+        consumers.emplace_back([&fifo, &consumed, c, total_num_values]() {
+            for (;;) {
+                const size_t *src = fifo.dequeue_begin_wait();
+                const size_t value = *src;
+                fifo.dequeue_end(src);
+                if (value == total_num_values) {
+                    return;
+                }
+                consumed[c].push_back(value);
+            }
+        });
+    }
+
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    for (size_t c = 0; c < num_consumers; ++c) {
+        size_t *dest = fifo.enqueue_begin_wait();
+        *dest = total_num_values;
+        fifo.enqueue_end(dest);
+    }
+    for (std::thread &consumer : consumers) {
+        consumer.join();
+    }
+
+    // Every value is consumed exactly once, and each consumer sees the values
+    // from any given producer in order.
+    std::vector<bool> seen(total_num_values, false);
+    for (const std::vector<size_t> &values : consumed) {
+        std::vector<size_t> next_from_producer(num_producers, 0);
+        for (const size_t value : values) {
+            ASSERT_GT(total_num_values, value);
+            ASSERT_FALSE(seen[value]);
+            seen[value] = true;
+
+            const size_t p = value % num_producers;
+            ASSERT_LE(next_from_producer[p], value);
+            next_from_producer[p] = value + num_producers;
+        }
+    }
+    for (const bool s : seen) {
+        ASSERT_TRUE(s);
+    }
+}
+
+TEST(CommonTests, ConcurrentFifoMPMCTest)
+{
+    // Single producer and consumer
+    test_concurrent_fifo_mpmc(2, 1, 1, 256 * 1024);
+
+    // High contention
+    test_concurrent_fifo_mpmc(2, 4, 4, 64 * 1024);
+
+    // Larger queue
+    test_concurrent_fifo_mpmc(64, 4, 2, 256 * 1024);
+    test_concurrent_fifo_mpmc(64, 2, 4, 256 * 1024);
+}
+
+static void test_parallel_for(const size_t num_indices, const size_t grain_size)
+{
+    std::vector<std::atomic<size_t>> counts(num_indices);
+    for (std::atomic<size_t> &c : counts) {
+        c = 0;
+    }
+
+    std::atomic<size_t> num_ranges(0);
+    parallel_for(0, num_indices, grain_size, [&](size_t begin, size_t end) {
+        ASSERT_LT(begin, end);
+        if (grain_size != 0) {
+            ASSERT_LE(end - begin, grain_size);
+        }
+        ++num_ranges;
+        for (size_t i = begin; i < end; ++i) {
+            ++counts[i];
+        }
+    });
+
+    for (const std::atomic<size_t> &c : counts) {
+        ASSERT_EQ(1, c.load());
+    }
+    if (grain_size == 1) {
+        ASSERT_EQ(num_indices, num_ranges.load());
+    }
+}
+
+static void test_parallel()
+{
+    test_parallel_for(0, 1);
+    test_parallel_for(1, 1);
+    test_parallel_for(1000, 1);
+    test_parallel_for(1000, 7);
+    test_parallel_for(1000, 0);
+    test_parallel_for(1000, 2000);
+
+    // Reduction, with a non-commutative operation to check the order.
+    const std::string expect = "abcdefghijklmnopqrstuvwxyz";
+    const std::string result = parallel_reduce(
+        0,
+        expect.size(),
+        3,
+        std::string(),
+        [&expect](size_t begin, size_t end) {
+            return expect.substr(begin, end - begin);
+        },
+        [](const std::string &a, const std::string &b) { return a + b; });
+    ASSERT_EQ(expect, result);
+    ASSERT_EQ(
+        7,
+        parallel_reduce(
+            5,
+            5,
+            1,
+            7,
+            [](size_t, size_t) { return 0; },
+            [](int a, int b) { return a + b; }));
+
+    // Nested parallelism, with uneven work.
+    const size_t n = 64;
+    std::vector<size_t> sums(n, 0);
+    parallel_for(0, n, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            sums[i] = parallel_reduce(
+                0,
+                i * 100,
+                16,
+                (size_t)0,
+                [](size_t b, size_t e) {
+                    size_t sum = 0;
+                    for (size_t j = b; j < e; ++j) {
+                        sum += j;
+                    }
+                    return sum;
+                },
+                [](size_t a, size_t b) { return a + b; });
+        }
+    });
+    for (size_t i = 0; i < n; ++i) {
+        const size_t m = i * 100;
+        ASSERT_EQ(m * (m - 1) / 2, sums[i]);
+    }
+
+    // Exceptions are propagated to the caller.
+    ASSERT_THROW(
+        parallel_for(
+            0,
+            100,
+            1,
+            [](size_t begin, size_t) {
+                if (begin == 57) {
+                    throw std::runtime_error("task failure");
+                }
+            }),
+        std::runtime_error);
+
+    // Tasks may add further tasks to a group.
+    std::atomic<size_t> num_run(0);
+    task_group group;
+    for (size_t i = 0; i < 8; ++i) {
+        group.run([&group, &num_run]() {
+            ++num_run;
+            group.run([&num_run]() { ++num_run; });
+        });
+    }
+    group.wait();
+    ASSERT_EQ(16, num_run.load());
+}
+
+TEST(CommonTests, ParallelTest)
+{
+    // Default number of threads.
+    test_parallel();
+
+    // Work executed on the calling thread only.
+    parallel_set_num_threads(1);
+    ASSERT_EQ(1, parallel_num_threads());
+    test_parallel();
+
+#ifdef MULTICORE
+    // Multiple workers (more than there may be cores).
+    parallel_set_num_threads(4);
+    ASSERT_EQ(4, parallel_num_threads());
+    test_parallel();
+
+    // Concurrent calls from several external threads share the workers.
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 3; ++i) {
+        threads.emplace_back([]() { test_parallel(); });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+#endif
+
+    parallel_set_num_threads(0);
+}
+
+static void test_numa_run()
+{
+    // The workers of all nodes are bounded by the number of threads (with at
+    // least one per node).
+    const size_t num_nodes = numa_num_nodes();
+    size_t num_threads = 0;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        ASSERT_LE(1, numa_node_num_threads(node));
+        num_threads += numa_node_num_threads(node);
+    }
+    ASSERT_EQ(std::max(num_nodes, parallel_num_threads()), num_threads);
+
+    // Each task is executed once.
+    std::vector<std::vector<std::atomic<size_t>>> counts(num_nodes);
+    for (std::vector<std::atomic<size_t>> &node_counts : counts) {
+        node_counts = std::vector<std::atomic<size_t>>(5);
+    }
+    numa_run_on_all_nodes(5, [&counts](size_t node, size_t task_idx) {
+        ++counts[node][task_idx];
+    });
+    for (const std::vector<std::atomic<size_t>> &node_counts : counts) {
+        for (const std::atomic<size_t> &c : node_counts) {
+            ASSERT_EQ(1, c.load());
+        }
+    }
+
+    std::atomic<size_t> num_run(0);
+    numa_run_on_node(num_nodes - 1, 0, [&num_run](size_t) { ++num_run; });
+    numa_run_on_node(num_nodes - 1, 3, [&num_run](size_t) { ++num_run; });
+    ASSERT_EQ(3, num_run.load());
+
+    // Exceptions are propagated to the caller.
+    ASSERT_THROW(
+        numa_run_on_all_nodes(
+            0,
+            [](size_t, size_t task_idx) {
+                if (task_idx == 0) {
+                    throw std::runtime_error("task failure");
+                }
+            }),
+        std::runtime_error);
+
+    // Partitioned vectors cover the original elements, in order.
+    std::vector<size_t> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 3 * i + 1;
+    }
+    numa_partitioned_vector<size_t> partitioned(values.begin(), values.end());
+    ASSERT_EQ(num_nodes, partitioned.num_partitions());
+    ASSERT_EQ(values.size(), partitioned.size());
+    for (size_t node = 0; node < num_nodes; ++node) {
+        const std::vector<size_t> &partition = partitioned.partition(node);
+        const size_t offset = partitioned.partition_offset(node);
+        for (size_t i = 0; i < partition.size(); ++i) {
+            ASSERT_EQ(values[offset + i], partition[i]);
+        }
+    }
+}
+
+TEST(CommonTests, NumaTest)
+{
+    test_numa_run();
+
+    // Workers are re-created when the number of threads changes.
+    parallel_set_num_threads(1);
+    test_numa_run();
+#ifdef MULTICORE
+    parallel_set_num_threads(6);
+    test_numa_run();
+#endif
+
+    parallel_set_num_threads(0);
+}
+
 } // namespace
@@ -12,6 +12,9 @@
 #include <cstdarg>
 #include <cstdint>
 #include <libff/common/utils.hpp>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 namespace libff
 {
@@ -119,4 +122,23 @@ void deserialize_bit_vector(std::istream &in, bit_vector &v)
         v[i] = b;
     }
 }
+
+void advise_huge_pages(void *ptr, const size_t num_bytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise requires page-aligned ranges. Restrict to the huge-page-aligned
+    // interior of the buffer (the advice is ignored for smaller ranges).
+    const uintptr_t huge_page_size = 2 * 1024 * 1024;
+    const uintptr_t begin = ((uintptr_t)ptr + huge_page_size - 1) &
+                            ~(huge_page_size - 1);
+    const uintptr_t end = ((uintptr_t)ptr + num_bytes) & ~(huge_page_size - 1);
+    if (begin < end) {
+        // Failure (e.g. if transparent huge pages are disabled) is harmless.
+        madvise((void *)begin, end - begin, MADV_HUGEPAGE);
+    }
+#else
+    UNUSED(ptr, num_bytes);
+#endif
+}
+
 } // namespace libff
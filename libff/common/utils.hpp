@@ -55,6 +55,13 @@ void deserialize_bit_vector(std::istream &in, bit_vector &v);
 
 template<typename T> size_t size_in_bits(const std::vector<T> &v);
 
+/// Advise the OS that the memory [ptr, ptr + num_bytes) may be backed by
+/// (transparent) huge pages, reducing TLB misses when large buffers are
+/// accessed at random. Only whole huge pages within the range are affected,
+/// and the advice is most effective before the memory is first written. Has
+/// no effect on platforms which do not support it.
+void advise_huge_pages(void *ptr, const size_t num_bytes);
+
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof(arr[0]))
 
 } // namespace libff